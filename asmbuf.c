@@ -0,0 +1,263 @@
+/****************************************************************/
+/*								*/
+/*	CSCE531 - "Pascal" Compiler				*/
+/*								*/
+/*	--asmbuf.c--						*/
+/*								*/
+/*	Buffered assembly output (see asmbuf.h).		*/
+/*								*/
+/****************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "asmbuf.h"
+#include "peephole.h"
+#include "frame.h"
+#include "elfobj.h"
+#include "options.h"
+#include "message.h"
+
+/* The buffered records, in order */
+static ASM_LIST *recs = NULL;
+static int nrecs = 0, recs_size = 0;
+
+/* Text of the line being built by asm_vprintf() */
+static char *line = NULL;
+static int line_len = 0, line_size = 0;
+
+/* TRUE while asm_vprintf() is dropping the rest of a comment line */
+static BOOLEAN dropping = FALSE;
+
+
+static char *copy_string (char *s, int n)
+{
+    char *ret = (char *) malloc(n + 1);
+
+    if (ret == NULL)
+	bug("asmbuf: out of memory");
+    memcpy(ret, s, n);
+    ret[n] = '\0';
+    return ret;
+}
+
+/* Splits an instruction's operand list at the commas that are not inside
+   parentheses */
+static void parse_args (ASM_LIST rec, char *s)
+{
+    int depth = 0;
+    char *start;
+
+    while (isspace((unsigned char)*s))
+	s++;
+    for (start = s; *s != '\0'; s++) {
+	if (*s == '(')
+	    depth++;
+	else if (*s == ')')
+	    depth--;
+	else if (*s == ',' && depth == 0) {
+	    if (rec->nargs == ASM_MAX_ARGS)
+		bug("asmbuf: too many operands in \"%s\"", rec->text);
+	    rec->args[rec->nargs++] = copy_string(start, s - start);
+	    for (start = s + 1; isspace((unsigned char)*start); start++)
+		;
+	    s = start - 1;
+	}
+    }
+    while (s > start && isspace((unsigned char)s[-1]))
+	s--;
+    if (s > start) {
+	if (rec->nargs == ASM_MAX_ARGS)
+	    bug("asmbuf: too many operands in \"%s\"", rec->text);
+	rec->args[rec->nargs++] = copy_string(start, s - start);
+    }
+}
+
+/* Makes a record of one complete line of text */
+static void add_line (char *text, int len)
+{
+    ASM_LIST rec = (ASM_LIST) calloc(1, sizeof(ASM_REC));
+    char *s, *end;
+
+    if (rec == NULL)
+	bug("asmbuf: out of memory");
+    rec->text = copy_string(text, len);
+
+    for (s = rec->text; isspace((unsigned char)*s); s++)
+	;
+    for (end = s; *end != '\0' && !isspace((unsigned char)*end); end++)
+	;
+
+    if (*s == '\0' || *s == '#')
+	rec->kind = AK_COMMENT;
+    else if ((end - s == 4 && !strncmp(s, ".loc", 4)) || !strncmp(s, ".cfi_", 5))
+	rec->kind = AK_DEBUG;
+    else if (*s == '.' && end[-1] != ':')
+	rec->kind = AK_DIRECTIVE;
+    else if (end[-1] == ':' && *end == '\0') {
+	rec->kind = AK_LABEL;
+	rec->op = copy_string(s, end - s - 1);
+    }
+    else {
+	rec->kind = AK_INSN;
+	rec->op = copy_string(s, end - s);
+	parse_args(rec, end);
+    }
+
+    if (nrecs == recs_size) {
+	recs_size = recs_size ? 2*recs_size : 1024;
+	recs = (ASM_LIST *) realloc(recs, recs_size * sizeof(ASM_LIST));
+	if (recs == NULL)
+	    bug("asmbuf: out of memory");
+    }
+    recs[nrecs++] = rec;
+}
+
+
+/* Tells whether format starts a comment line */
+static BOOLEAN is_comment (char *format)
+{
+    while (*format == '\t' || *format == ' ')
+	format++;
+    return *format == '#';
+}
+
+
+void asm_vprintf (char *format, va_list ap, BOOLEAN newline)
+{
+    va_list ap2;
+    int n;
+    char *s, *nl;
+
+	/* Below full verbosity, comments are dropped before they are
+	 * formatted.  One comment may take several calls to build. */
+    if (line_len == 0 && !dropping && opt_verbose_asm != VERBOSE_FULL)
+	dropping = is_comment(format);
+    if (dropping) {
+	if (newline)
+	    dropping = FALSE;
+	return;
+    }
+
+	/* Format straight into the line, and again only if it did not fit */
+    if (line == NULL) {
+	line_size = 256;
+	line = (char *) malloc(line_size);
+	if (line == NULL)
+	    bug("asmbuf: out of memory");
+    }
+    va_copy(ap2, ap);
+    n = vsnprintf(line + line_len, line_size - line_len, format, ap2);
+    va_end(ap2);
+    if (line_len + n + 1 > line_size) {
+	line_size = 2*(line_len + n + 1);
+	line = (char *) realloc(line, line_size);
+	if (line == NULL)
+	    bug("asmbuf: out of memory");
+	vsnprintf(line + line_len, n + 1, format, ap);
+    }
+    line_len += n;
+
+    if (!newline)
+	return;
+
+	/* The text may hold more than one line */
+    for (s = line; (nl = strchr(s, '\n')) != NULL; s = nl + 1)
+	add_line(s, nl - s);
+    add_line(s, line + line_len - s);
+    line_len = 0;
+}
+
+
+void asm_line (char *text)
+{
+    add_line(text, strlen(text));
+}
+
+
+void asm_set_insn (ASM_LIST rec, char *op, char *arg0, char *arg1)
+{
+    rec->kind = AK_INSN;
+    rec->op = op;
+    rec->nargs = 0;
+    if (arg0 != NULL)
+	rec->args[rec->nargs++] = arg0;
+    if (arg1 != NULL)
+	rec->args[rec->nargs++] = arg1;
+    rec->text = NULL;
+}
+
+
+void asm_set_label (ASM_LIST rec, char *name)
+{
+    rec->kind = AK_LABEL;
+    rec->op = name;
+    rec->nargs = 0;
+    rec->text = NULL;
+}
+
+
+int asm_mark (void)
+{
+    return nrecs;
+}
+
+
+ASM_LIST *asm_records (void)
+{
+    return recs;
+}
+
+
+static void print_rec (FILE *fp, ASM_LIST rec)
+{
+    int i;
+
+    if (rec->text != NULL) {
+	fputs(rec->text, fp);
+	putc('\n', fp);
+	return;
+    }
+    if (rec->kind == AK_LABEL) {
+	fputs(rec->op, fp);
+	fputs(":\n", fp);
+	return;
+    }
+    putc('\t', fp);
+    fputs(rec->op, fp);
+    for (i = 0; i < rec->nargs; i++) {
+	fputs(i == 0 ? "\t" : ", ", fp);
+	fputs(rec->args[i], fp);
+    }
+    putc('\n', fp);
+}
+
+
+
+void asm_flush (FILE *fp, BOOLEAN long_mode)
+{
+    int i;
+
+    if (opt_peephole)
+	peephole(recs, nrecs, long_mode);
+    if (opt_debug)
+	frame_cfi(recs, nrecs, long_mode);
+
+    if (opt_elf) {
+	if (long_mode)
+	    bug("asmbuf: -felf with the x86-64 back end");
+	elf_assemble(recs, nrecs);
+    }
+
+    for (i = 0; i < nrecs; i++) {
+	if (!recs[i]->deleted && !opt_elf) {
+	    print_rec(fp, recs[i]);
+	    if (recs[i]->cfa_offset != 0)
+		fprintf(fp, "\t.cfi_def_cfa_offset %d\n", recs[i]->cfa_offset);
+	}
+	    /* The strings may be shared between records after a pass, so
+	     * only the records themselves are freed */
+	free(recs[i]);
+    }
+    nrecs = 0;
+}
@@ -0,0 +1,79 @@
+/****************************************************************/
+/*								*/
+/*	CSCE531 - "Pascal" Compiler				*/
+/*								*/
+/*	--asmbuf.h--						*/
+/*								*/
+/*	Buffered assembly output.  The back end's emit() and	*/
+/*	emitn() hand their text to this module, which keeps	*/
+/*	each line as a structured record until asm_flush()	*/
+/*	prints them, so that passes such as the peephole	*/
+/*	optimizer can rewrite the code first.			*/
+/*								*/
+/****************************************************************/
+
+#ifndef ASMBUF_H
+#define ASMBUF_H
+
+#include <stdio.h>
+#include <stdarg.h>
+#include "defs.h"
+
+/* Maximum number of operands of an instruction */
+#define ASM_MAX_ARGS 3
+
+/* Kinds of assembly lines.  AK_DEBUG is a .loc or .cfi_* directive (see
+   -g), which the optimization passes look through like a comment. */
+typedef enum {
+    AK_INSN, AK_LABEL, AK_DIRECTIVE, AK_COMMENT, AK_DEBUG
+} ASM_KIND;
+
+/* One line of assembly code.  For an instruction, op is the mnemonic and
+   args are its operands in AT&T order; for a label, op is the label name.
+   text is the line as emitted, and is printed as is unless the record
+   has been changed, in which case it is NULL and the line is rebuilt
+   from op and args.  Directives and comments keep only their text.  If
+   cfa_offset is not 0, the record is followed by a .cfi_def_cfa_offset
+   directive with that offset (see frame_cfi). */
+typedef struct asm_rec {
+    ASM_KIND kind;
+    char *op;
+    int nargs;
+    char *args[ASM_MAX_ARGS];
+    char *text;
+    BOOLEAN deleted;
+    int cfa_offset;
+} ASM_REC, *ASM_LIST;
+
+/* Appends formatted text to the current line; if newline is TRUE, the line
+   is complete and becomes a record in the buffer.  Unless -fverbose-asm is
+   full, a line that starts with '#' is a comment and is dropped. */
+void asm_vprintf (char *format, va_list ap, BOOLEAN newline);
+
+/* Adds text as one complete line, without formatting it and whatever the
+   verbosity.  No line may be under way in asm_vprintf(). */
+void asm_line (char *text);
+
+/* Replaces the operation and operands of an instruction record (args may
+   be NULL for no operand) */
+void asm_set_insn (ASM_LIST rec, char *op, char *arg0, char *arg1);
+
+/* Makes rec a label record defining name */
+void asm_set_label (ASM_LIST rec, char *name);
+
+/* Returns the number of records in the buffer, which is the index that
+   the next complete line will get */
+int asm_mark (void);
+
+/* Returns the buffered records, indexed from 0 to asm_mark()-1.  The array
+   may move when more lines are added. */
+ASM_LIST *asm_records (void);
+
+/* Runs the enabled optimization passes over the buffered records (and,
+   with -g, frame_cfi), prints
+   them to fp (or, with -felf, hands them to elf_assemble), and empties
+   the buffer.  long_mode tells whether the code
+   is for x86-64 (rather than i386). */
+void asm_flush (FILE *fp, BOOLEAN long_mode);
+
+#endif
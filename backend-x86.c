@@ -10,11 +10,15 @@
 
 #include <stdarg.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
 #include "defs.h"
 #include "types.h"
 #include "message.h"
+#include "options.h"
+#include "asmbuf.h"
+#include "frame.h"
 /* defined in defs.h */
 #include BACKEND_HEADER_FILE
 
@@ -24,9 +28,9 @@
 
 
 #define errfp stderr
-#define outfp stdout       /* outfp is the file to which emit and emitn
-			      send their code.  Set it to stdout for
-			      now.  */
+extern FILE *outfp;	   /* outfp is the file to which the code that
+			      emit and emitn buffer is sent.  main()
+			      sets it to stdout or the -o file.  */
 
 /* Nonzero to set the rounding properties in the FPU control word on entry */
 #define SET_ROUND 0
@@ -56,7 +60,12 @@ static int actual_arg_word_count[MAX_CALL_NEST];
    aaa_top as the common top index. */
 static int actual_arg_space[MAX_CALL_NEST];
 
-/* Common top index for both stacks above */
+/* Stack to tell whether the old %esp was saved below the argument list
+   (TRUE) or the list was aligned with a constant adjustment that is
+   simply undone after the call (FALSE; see b_alloc_arglist). */
+static BOOLEAN actual_arg_saved_sp[MAX_CALL_NEST];
+
+/* Common top index for the stacks above */
 static int aaa_top = -1;
 
 #if 0
@@ -89,6 +98,42 @@ static int double_base_offset;
 static int caller_offset;
 static int loc_var_offset = 1;  /* Positive value is guaranteed illegal */
 
+/* Indices in the output buffer (see asmbuf.h) of the current function's
+   first record and of the instruction that allocated its return value
+   slot (-1 if none).  frame.c uses them to rewrite leaf functions. */
+static int func_start_rec;
+static int return_slot_rec = -1;
+
+/* The display (see b_enter_display) is a table at DISPLAY_LABEL holding,
+   for each nesting level from 1 to display_size, the frame pointer of
+   the latest activation of a routine at that level whose frame is used
+   by the routines nested in it.  display_level is the level of the
+   current function if it keeps its frame there, and -1 otherwise;
+   display_save_offset is where it saves the entry it replaced. */
+#define DISPLAY_LABEL ".Ldisplay"
+static int display_size = 0;
+static int display_level = -1;
+static int display_save_offset;
+
+/* Tail calls (see b_tail_call_self and b_tail_call_by_name).  body_rec is
+   the index in the output buffer of the place held for the label at the
+   start of the current function's body (-1 if none), and body_label the
+   label once a jump to it has been made.  tail_called is TRUE if the
+   function ends with a tail call, which leaves nothing for the epilogue
+   to do.  The labels in the records from moved_from to moved_to are to be
+   moved past the next tail call (see b_retract_code). */
+static int body_rec = -1;
+static char *body_label;
+static BOOLEAN tail_called;
+static int moved_from, moved_to;
+
+/* The out-of-line traps of the current function's index checks (see
+   b_check_index): the label of each, and the index in the output buffer
+   of the jump to it, which b_retract_code may have deleted */
+static char **trap_labels;
+static int *trap_recs;
+static int ntraps = 0, traps_size = 0;
+
 /* Not needed, because x86 C calling convention puts all arguments on
  * the stack.  -SF 4/4/2011 */
 #if 0
@@ -147,6 +192,11 @@ static void post_call_clean_up (TYPETAG return_type, BOOLEAN is_name);
 static void divide_by_size(unsigned int size);
 
 
+/* Pops the value of the given type on top of the stack into offset(%ebp),
+   where it takes size bytes (see the tail calls) */
+static void pop_to_frame (TYPETAG type, int offset, int size);
+
+
 
 /* Makes room on the stack for a temporary value */
 static void b_push()
@@ -158,6 +208,109 @@ static void b_push()
 }
 
 
+/* Constant pool.  Floating point and string literals are interned by
+ * value, so that each distinct constant gets a single label, and the pool
+ * is emitted all at once in .rodata by b_emit_const_pool() at the end of
+ * the compilation unit.  Doubles are compared bitwise, which keeps 0.0 and
+ * -0.0 apart. */
+
+typedef struct const_rec {
+    char *label;
+    BOOLEAN is_string;
+    double dval;
+    char *sval;
+    struct const_rec *next, *hash_next;
+} CONST_REC, *CONST_LIST;
+
+static CONST_LIST const_pool = NULL;
+static CONST_LIST *const_pool_end = &const_pool;
+
+/* The pool entries hashed by value (the bit pattern of a double, the
+   characters of a string) */
+#define CONST_HASH 1024
+static CONST_LIST const_hash[CONST_HASH];
+
+static unsigned int hash_const (BOOLEAN is_string, double dval, char *sval)
+{
+  unsigned char *c = is_string ? (unsigned char *) sval
+			       : (unsigned char *) &dval;
+  int n = is_string ? strlen (sval) : sizeof(double);
+  unsigned int h = is_string;
+
+  while (n-- > 0)
+      h = h * 31 + *c++;
+  return h % CONST_HASH;
+}
+
+/* Returns the pool entry equal to the given constant, adding it first
+   if necessary */
+static CONST_LIST intern_const (BOOLEAN is_string, double dval, char *sval)
+{
+  unsigned int h = hash_const (is_string, dval, sval);
+  CONST_LIST p;
+
+  for (p = const_hash[h]; p != NULL; p = p->hash_next)
+      if (p->is_string == is_string &&
+	  (is_string ? !strcmp (p->sval, sval)
+		     : !memcmp (&p->dval, &dval, sizeof(double))))
+	  return p;
+
+  p = (CONST_LIST) malloc (sizeof(CONST_REC));
+  if (p == NULL)
+      bug ("intern_const: out of memory");
+  p->label = new_symbol ();
+  p->is_string = is_string;
+  p->dval = dval;
+  p->sval = is_string ? strdup (sval) : NULL;
+  p->next = NULL;
+  p->hash_next = const_hash[h];
+  const_hash[h] = p;
+  *const_pool_end = p;
+  const_pool_end = &p->next;
+  return p;
+}
+
+/* Emits the constant pool and flushes the buffered code.  Call once,
+   after all code has been generated. */
+void b_emit_const_pool (void)
+{
+  CONST_LIST p;
+
+  if (display_size > 0) {
+      emit ("\t\t\t\t# display (%d levels)", display_size);
+      emit ("\t.data");
+      asm_section = SEC_DATA;
+      emit ("\t.align\t%d", TARGET_PTR_SIZE);
+      emit ("%s:", DISPLAY_LABEL);
+      emit ("\t.zero\t%d", display_size * TARGET_PTR_SIZE);
+  }
+
+  if (const_pool == NULL) {
+      asm_flush (outfp, FALSE);
+      return;
+  }
+
+  emit ("\t\t\t\t# b_emit_const_pool ()");
+  emit ("\t.section\t.rodata");
+  asm_section = SEC_RODATA;
+
+      /* Doubles first, so that one .align covers them all */
+  emit ("\t.align\t%d", sizeof(double));
+  for (p = const_pool; p != NULL; p = p->next)
+      if (!p->is_string) {
+	  emit ("%s:", p->label);
+	  b_alloc_double (p->dval);
+      }
+  for (p = const_pool; p != NULL; p = p->next)
+      if (p->is_string) {
+	  emit ("%s:", p->label);
+	  emit (".string\t\"%s\"", p->sval);
+      }
+  asm_flush (outfp, FALSE);
+}
+
+
+
 /* Sets the FPU control word in anticipation of a conversion from
  * floating point to integer.
  * The original control word is saved in the %dx register.
@@ -177,6 +330,189 @@ static void restore_fpu_control()
     emit ("\tfldcw\t%%dx");
 }
 
+/* SSE2 floating point (opt_sse2).
+ *
+ * By default, all arithmetic on values of type double and float goes
+ * through the x87 register stack, and every conversion to an integer type
+ * must switch the FPU rounding mode to truncation and back.  With -fsse2,
+ * these operations use the scalar SSE2 instructions instead, with %xmm0
+ * and %xmm1 as scratch registers; cvttsd2si/cvttss2si truncate by
+ * themselves, so the FPU control word is never touched.  Values on the
+ * control stack have the same layout in both modes.  The calling
+ * convention still returns floating point values in %st(0), so
+ * b_prepare_return, b_encode_return and post_call_clean_up are unaffected.
+ * Conversions between floating point and UNSIGNED integers keep using the
+ * x87, because 32-bit SSE2 has no unsigned (or 64-bit) conversions. */
+
+/* Instruction suffix ("sd" or "ss") for SSE2 operations on the type */
+#define SSE_SFX(type) ((type)==TYDOUBLE?"sd":"ss")
+
+
+
+/* Top-of-stack register caching (opt_tos_cache).
+ *
+ * When enabled, the top one or two integer/pointer items of the control
+ * stack may live in %eax, %ecx, or %edx instead of in an 8-byte slot at
+ * (%esp).  tos_reg[0..tos_count-1] lists the registers holding the cached
+ * items, deepest first; every item below them is on the real stack as
+ * usual.  Routines that know about the cache consume operands with
+ * tos_pop_reg() and produce results with tos_push_reg(); every other
+ * routine calls tos_flush() first, which spills the cached items so that
+ * the stack looks exactly as it does without caching.  The cache is also
+ * flushed before labels and jumps, so that the stack is in memory at every
+ * control-flow join, and at b_alloc_arglist, where the argument list must
+ * lie directly under the stack top.  With caching disabled tos_count is
+ * always zero, and none of this emits any code. */
+
+#define TOS_MAX 2
+
+enum { REG_EAX, REG_ECX, REG_EDX, NUM_TOS_REGS };
+
+static char *reg32[NUM_TOS_REGS] = { "%eax", "%ecx", "%edx" };
+static char *reg16[NUM_TOS_REGS] = { "%ax", "%cx", "%dx" };
+static char *reg8[NUM_TOS_REGS]  = { "%al", "%cl", "%dl" };
+
+static int tos_count = 0;
+static int tos_reg[TOS_MAX];
+
+/* Registers holding a cached item or an operand being worked on */
+static BOOLEAN reg_busy[NUM_TOS_REGS];
+
+
+/* Tells whether an item of the given type may be cached in a register */
+static BOOLEAN tos_cacheable (TYPETAG type)
+{
+  switch (type) {
+  case TYSIGNEDCHAR:
+  case TYUNSIGNEDCHAR:
+  case TYSIGNEDSHORTINT:
+  case TYUNSIGNEDSHORTINT:
+  case TYSIGNEDINT:
+  case TYUNSIGNEDINT:
+  case TYSIGNEDLONGINT:
+  case TYUNSIGNEDLONGINT:
+  case TYPTR:
+  case TYFLOAT:
+      return opt_tos_cache;
+  default:
+      return FALSE;
+  }
+}
+
+/* Tells whether b_convert() can convert between the two types without
+   touching the floating point unit, i.e., by at most widening a character
+   in a register */
+static BOOLEAN is_int_conversion (TYPETAG from_type, TYPETAG to_type)
+{
+  switch (from_type) {
+  case TYSIGNEDCHAR:
+  case TYUNSIGNEDCHAR:
+  case TYSIGNEDINT:
+  case TYSIGNEDLONGINT:
+      switch (to_type) {
+      case TYSIGNEDCHAR:
+      case TYUNSIGNEDCHAR:
+      case TYSIGNEDINT:
+      case TYUNSIGNEDINT:
+      case TYSIGNEDLONGINT:
+      case TYUNSIGNEDLONGINT:
+	  return TRUE;
+      case TYPTR:
+	  return from_type!=TYSIGNEDCHAR && from_type!=TYUNSIGNEDCHAR;
+      default:
+	  return FALSE;
+      }
+  case TYUNSIGNEDINT:
+  case TYUNSIGNEDLONGINT:
+      return to_type==TYSIGNEDCHAR || to_type==TYUNSIGNEDCHAR
+	  || to_type==TYPTR;
+  default:
+      return FALSE;
+  }
+}
+
+/* Moves the deepest cached item onto the real stack */
+static void tos_spill_bottom ()
+{
+  int i;
+
+  b_push ();
+  emit ("\tmovl\t%s, (%%esp)", reg32[tos_reg[0]]);
+  reg_busy[tos_reg[0]] = FALSE;
+  for (i = 1; i < tos_count; i++)
+      tos_reg[i-1] = tos_reg[i];
+  tos_count--;
+}
+
+/* Moves all cached items onto the real stack */
+static void tos_flush ()
+{
+  while (tos_count > 0)
+      tos_spill_bottom ();
+}
+
+/* Returns a free register, spilling a cached item if necessary.  The
+   register is marked busy until released or pushed. */
+static int tos_scratch ()
+{
+  int r;
+
+  for (;;) {
+      for (r = 0; r < NUM_TOS_REGS; r++)
+	  if (!reg_busy[r]) {
+	      reg_busy[r] = TRUE;
+	      return r;
+	  }
+      if (tos_count == 0)
+	  bug ("tos_scratch: no free register");
+      tos_spill_bottom ();
+  }
+}
+
+/* Releases a register obtained from tos_scratch() or tos_pop_reg() */
+static void tos_release (int r)
+{
+  reg_busy[r] = FALSE;
+}
+
+/* Pushes the value in register r (which must be busy) as the new top of
+   the stack */
+static void tos_push_reg (int r)
+{
+  if (tos_count == TOS_MAX)
+      tos_spill_bottom ();
+  tos_reg[tos_count++] = r;
+}
+
+/* Pops the top item of the given type into a register and returns the
+   register.  A cached item stays where it is; an item on the real stack
+   is loaded (zero- or sign-extended if narrower than a word) and popped. */
+static int tos_pop_reg (TYPETAG type)
+{
+  int r;
+
+  if (tos_count > 0)
+      return tos_reg[--tos_count];
+
+  r = tos_scratch ();
+  switch (type) {
+  case TYSIGNEDCHAR:
+  case TYUNSIGNEDCHAR:
+      emit ("\tmov%sbl\t(%%esp), %s", type==TYSIGNEDCHAR?"s":"z", reg32[r]);
+      break;
+  case TYSIGNEDSHORTINT:
+  case TYUNSIGNEDSHORTINT:
+      emit ("\tmov%swl\t(%%esp), %s", type==TYSIGNEDSHORTINT?"s":"z",
+	    reg32[r]);
+      break;
+  default:
+      emit ("\tmovl\t(%%esp), %s", reg32[r]);
+      break;
+  }
+  b_pop ();
+  return r;
+}
+
 
 
 /* Removes and discards a value from the top of the stack.  If passed TRUE,
@@ -189,6 +525,11 @@ void b_internal_pop (BOOLEAN display_flag)
   if (display_flag)
     emit ("\t\t\t\t# b_pop ()");
 
+  if (tos_count > 0) {
+      tos_release (tos_reg[--tos_count]);
+      return;
+  }
+
   emit ("\taddl\t$%d, %%esp", STACK_ITEM);
   #if 0
   align_16_flip;
@@ -219,6 +560,7 @@ void b_jump (char *label)
 {
   emit ("\t\t\t\t# b_jump ( destination = %s )", label);
 
+  tos_flush ();
   emit ("\tjmp\t%s", label);
 }
 
@@ -250,6 +592,22 @@ void b_cond_jump (TYPETAG type, B_COND cond, char *label)
   emit (", %s,", cond == B_ZERO ? "ZERO" : "NON-ZERO");
   emit  ("\t\t\t\t#              %s)", label);
 
+  if (tos_cacheable (type)) {
+      int r = tos_pop_reg (type);
+
+          /* Whatever remains cached must be in memory at the label */
+      tos_flush ();
+      if (type==TYSIGNEDCHAR || type==TYUNSIGNEDCHAR)
+          emit ("\ttestb\t%s, %s", reg8[r], reg8[r]);
+      else
+          emit ("\ttestl\t%s, %s", reg32[r], reg32[r]);
+      emit ("\tj%s\t%s", cond==B_ZERO?"e":"ne", label);
+      tos_release (r);
+      return;
+  }
+
+  tos_flush ();
+
   switch (type) {
 
   case TYSIGNEDCHAR:
@@ -267,6 +625,24 @@ void b_cond_jump (TYPETAG type, B_COND cond, char *label)
       break;
 
   case TYDOUBLE:
+      if (opt_sse2) {
+          emit ("\tmovsd\t(%%esp), %%xmm0");
+          b_pop ();
+          emit ("\txorpd\t%%xmm1, %%xmm1");
+          emit ("\tucomisd\t%%xmm1, %%xmm0");
+              /* NaN compares unordered (PF set), and is nonzero */
+          if (cond==B_ZERO) {
+              char *temp_label = new_symbol();
+              emit ("\tjp\t%s", temp_label);
+              emit ("\tje\t%s", label);
+              b_label (temp_label);
+          }
+          else {
+              emit ("\tjp\t%s", label);
+              emit ("\tjne\t%s", label);
+          }
+          break;
+      }
       emit ("\tfld\t(%%esp)");    /* Push value onto floating point stack */
       b_pop ();
       emit ("\tfldz");            /* Push zero onto floating point stack */
@@ -337,6 +713,8 @@ void b_dispatch (B_ARITH_REL_OP op, TYPETAG type, int cmp_value, char *label,
   emit  (", %d, %s, %s )", cmp_value, label,
 	 pop_on_jump ? "pop on jump" : "no pop on jump");
 
+  tos_flush ();
+
   switch (type) {
   case TYSIGNEDINT:
   case TYSIGNEDLONGINT:
@@ -390,6 +768,115 @@ void b_dispatch (B_ARITH_REL_OP op, TYPETAG type, int cmp_value, char *label,
 
 
 
+/* b_dispatch_bits is like b_dispatch, but jumps if the value v on the
+   stack is one of up to 32 values, those v for which 0 <= v-lo < 32 and
+   bit v-lo of mask is set.  The test is a bounds check and a bt
+   instruction. */
+
+
+void b_dispatch_bits (TYPETAG type, int lo, unsigned int mask, char *label,
+		      BOOLEAN pop_on_jump)
+{
+  char *temp_label = new_symbol();
+
+  emitn ("\t\t\t\t# b_dispatch_bits (");
+  my_print_typetag (type);
+  emit  (", %d, 0x%x, %s, %s )", lo, mask, label,
+	 pop_on_jump ? "pop on jump" : "no pop on jump");
+
+  if (type!=TYSIGNEDINT && type!=TYSIGNEDLONGINT &&
+      type!=TYUNSIGNEDINT && type!=TYUNSIGNEDLONGINT)
+      bug ("unsupported type in b_dispatch_bits");
+
+  tos_flush ();
+
+  emit ("\tmovl\t(%%esp), %%eax");
+  if (lo != 0)
+      emit ("\tsubl\t$%d, %%eax", lo);
+  emit ("\tcmpl\t$31, %%eax");
+  emit ("\tja\t%s", temp_label);
+  emit ("\tmovl\t$%u, %%edx", mask);
+  emit ("\tbtl\t%%eax, %%edx");
+  emit ("\tjnc\t%s", temp_label);
+  if (pop_on_jump)
+      b_pop ();
+  b_jump (label);
+  b_label (temp_label);
+}
+
+
+
+
+/* b_jump_table pops the value v on the stack, of the given type, and
+   jumps to labels[v-lo] if 0 <= v-lo < n, or to default_label if not.
+   The table of labels goes in .rodata. */
+
+
+void b_jump_table (TYPETAG type, int lo, int n, char *labels[],
+		   char *default_label)
+{
+  char *table = new_symbol();
+  int r, i;
+
+  emitn ("\t\t\t\t# b_jump_table (");
+  my_print_typetag (type);
+  emit  (", %d, %d, %s )", lo, n, default_label);
+
+  if (type!=TYSIGNEDINT && type!=TYSIGNEDLONGINT &&
+      type!=TYUNSIGNEDINT && type!=TYUNSIGNEDLONGINT)
+      bug ("unsupported type in b_jump_table");
+  if (n <= 0)
+      bug ("empty jump table in b_jump_table");
+
+  if (opt_tos_cache) {
+      r = tos_pop_reg (type);
+      tos_flush ();
+  }
+  else {
+      r = REG_EAX;
+      emit ("\tmovl\t(%%esp), %%eax");
+      b_pop ();
+  }
+
+      /* One unsigned compare checks both bounds */
+  if (lo != 0)
+      emit ("\tsubl\t$%d, %s", lo, reg32[r]);
+  emit ("\tcmpl\t$%d, %s", n-1, reg32[r]);
+  emit ("\tja\t%s", default_label);
+  emit ("\tjmp\t*%s(,%s,4)", table, reg32[r]);
+  if (opt_tos_cache)
+      tos_release (r);
+
+  emit ("\t.section\t.rodata");
+  emit ("\t.align\t4");
+  emit ("%s:", table);
+  for (i = 0; i < n; i++)
+      emit ("\t.long\t%s", labels[i]);
+  emit ("\t.text");
+}
+
+
+
+
+/* b_dispatch_label is b_label for a label that code emitted later at
+   dispatch_label jumps to after popping the value dispatched on, as the
+   arms of a case statement are emitted before their dispatch code.  It
+   lets the stack alignment tracking of -fdirect-args (see frame.c) know
+   the stack depth at the label ahead of time. */
+
+
+void b_dispatch_label (char *label, char *dispatch_label)
+{
+  if (opt_direct_args)
+      stack_align_label (asm_records () + func_start_rec,
+			 asm_mark () - func_start_rec, FALSE,
+			 label, dispatch_label, STACK_ITEM);
+  b_label (label);
+}
+
+
+
+
 
 /* b_duplicate pushes a duplicate of the datum currently on the stack.
    The datum is assumed to be of the given type.  */
@@ -401,6 +888,19 @@ void b_duplicate (TYPETAG type)
   my_print_typetag(type);
   emit (")");
 
+  if (tos_cacheable (type)) {
+      int r = tos_pop_reg (type);
+      int dup;
+
+      tos_push_reg (r);
+      dup = tos_scratch ();
+      emit ("\tmovl\t%s, %s", reg32[r], reg32[dup]);
+      tos_push_reg (dup);
+      return;
+  }
+
+  tos_flush ();
+
   switch (type) {
 
   case TYSIGNEDCHAR:
@@ -429,9 +929,9 @@ void b_duplicate (TYPETAG type)
     break;
 
   case TYDOUBLE:
-    emit ("\tfldl\t(%%esp)");
+    emit (opt_sse2 ? "\tmovsd\t(%%esp), %%xmm0" : "\tfldl\t(%%esp)");
     b_push ();
-    emit ("\tfstpl\t(%%esp)");
+    emit (opt_sse2 ? "\tmovsd\t%%xmm0, (%%esp)" : "\tfstpl\t(%%esp)");
     break;
 
   default:
@@ -452,6 +952,14 @@ void b_push_ext_addr (char *id)
 {
   emit ("\t\t\t\t# b_push_ext_addr (%s)", id);
 
+  if (opt_tos_cache) {
+      int r = tos_scratch ();
+
+      emit ("\tmovl\t$%s, %s", id, reg32[r]);
+      tos_push_reg (r);
+      return;
+  }
+
   b_push ();
   emit ("\tmovl\t$%s, (%%esp)", id);
 }
@@ -473,6 +981,14 @@ void b_push_loc_addr (int offset)
 {
   emit ("\t\t\t\t# b_push_loc_addr (offset = %d)", offset);
 
+  if (opt_tos_cache) {
+      int r = tos_scratch ();
+
+      emit ("\tleal\t%d(%%ebp), %s", offset, reg32[r]);
+      tos_push_reg (r);
+      return;
+  }
+
   emit ("\tleal\t%d(%%ebp), %%eax", offset);
   b_push ();
   emit ("\tmovl\t%%eax, (%%esp)");
@@ -481,6 +997,43 @@ void b_push_loc_addr (int offset)
 
 
 
+
+/* b_push_display_addr accepts the nesting level of an enclosing function
+   and an offset value from its frame pointer, and emits code to push
+   the address of that parameter or local variable onto the stack.  The
+   frame pointer is taken from the display, so the enclosing function
+   must call b_enter_display (see below). */
+
+
+void b_push_display_addr (int level, int offset)
+{
+  emit ("\t\t\t\t# b_push_display_addr (level = %d, offset = %d)",
+	level, offset);
+
+  if (level < 1)
+      bug("b_push_display_addr: illegal level %d", level);
+  if (level > display_size)
+      display_size = level;
+
+  if (opt_tos_cache) {
+      int r = tos_scratch ();
+
+      emit ("\tmovl\t%s+%d, %s", DISPLAY_LABEL,
+	    (level - 1) * TARGET_PTR_SIZE, reg32[r]);
+      emit ("\tleal\t%d(%s), %s", offset, reg32[r], reg32[r]);
+      tos_push_reg (r);
+      return;
+  }
+
+  emit ("\tmovl\t%s+%d, %%eax", DISPLAY_LABEL, (level - 1) * TARGET_PTR_SIZE);
+  emit ("\tleal\t%d(%%eax), %%eax", offset);
+  b_push ();
+  emit ("\tmovl\t%%eax, (%%esp)");
+}
+
+
+
+
 /* b_offset accepts an offset value as a parameter, and assumes some
    address is currently on the stack.  It pops the address and pushes
    the result obtained by adding the offset to the address.  This is
@@ -492,6 +1045,14 @@ void b_offset (int offset)
 {
   emit ("\t\t\t\t# b_offset (offset = %d)", offset);
 
+  if (opt_tos_cache) {
+      int r = tos_pop_reg (TYPTR);
+
+      emit ("\taddl\t$%d, %s", offset, reg32[r]);
+      tos_push_reg (r);
+      return;
+  }
+
   emit ("\tmovl\t(%%esp), %%eax");
   emit ("\taddl\t$%d, %%eax", offset);
   emit ("\tmovl\t%%eax, (%%esp)");
@@ -513,6 +1074,30 @@ void b_deref (TYPETAG type)
   my_print_typetag (type);
   emit (")");
 
+  if (tos_cacheable (type)) {
+      int r = tos_pop_reg (TYPTR);
+
+      switch (type) {
+      case TYSIGNEDCHAR:
+      case TYUNSIGNEDCHAR:
+	  emit ("\tmov%sbl\t(%s), %s", type==TYSIGNEDCHAR?"s":"z",
+		reg32[r], reg32[r]);
+	  break;
+      case TYSIGNEDSHORTINT:
+      case TYUNSIGNEDSHORTINT:
+	  emit ("\tmov%swl\t(%s), %s", type==TYSIGNEDSHORTINT?"s":"z",
+		reg32[r], reg32[r]);
+	  break;
+      default:
+	  emit ("\tmovl\t(%s), %s", reg32[r], reg32[r]);
+	  break;
+      }
+      tos_push_reg (r);
+      return;
+  }
+
+  tos_flush ();
+
   emit ("\tmovl\t(%%esp), %%eax");
 
   switch (type) {
@@ -540,8 +1125,8 @@ void b_deref (TYPETAG type)
     break;
 
   case TYDOUBLE:
-    emit ("\tfldl\t(%%eax)");
-    emit ("\tfstpl\t(%%esp)");
+    emit (opt_sse2 ? "\tmovsd\t(%%eax), %%xmm0" : "\tfldl\t(%%eax)");
+    emit (opt_sse2 ? "\tmovsd\t%%xmm0, (%%esp)" : "\tfstpl\t(%%esp)");
     break;
 
   default:
@@ -553,6 +1138,151 @@ void b_deref (TYPETAG type)
 
 
 
+/* b_store_temp pops the value on top of the stack into a temporary, and
+   b_load_temp pushes it back.  A Real takes the whole 8 bytes, and
+   anything else the first 4. */
+
+
+void b_store_temp (TYPETAG type, int offset)
+{
+  emitn ("\t\t\t\t# b_store_temp (");
+  my_print_typetag (type);
+  emit (", offset = %d)", offset);
+
+  pop_to_frame (type, offset, type == TYDOUBLE ? 8 : 4);
+}
+
+
+void b_load_temp (TYPETAG type, int offset)
+{
+  b_push_loc_addr (offset);
+  b_deref (type);
+}
+
+
+
+
+
+/* Register variables: %ebx, %esi and %edi, which the code otherwise never
+   uses, hold variables and temporaries chosen by the register allocator
+   (see regalloc.c).  A value of a character type is kept zero- or
+   sign-extended to the whole register.  b_save_var_regs saves them in
+   the frame for b_void_return to put back. */
+
+static char *var_reg32[B_NUM_VAR_REGS] = { "%ebx", "%esi", "%edi" };
+
+static int var_regs_saved = 0;
+static int var_regs_offset;
+
+
+void b_save_var_regs (int n)
+{
+  int i;
+
+  emit ("\t\t\t\t# b_save_var_regs (%d)", n);
+
+  if (n < 0 || n > B_NUM_VAR_REGS)
+      bug("b_save_var_regs: illegal number of registers %d", n);
+  if (n == 0)
+      return;
+
+  var_regs_offset = b_alloc_local_vars (n * 4);
+  var_regs_saved = n;
+  for (i = 0; i < n; i++) {
+      emit ("\tmovl\t%s, %d(%%ebp)", var_reg32[i], var_regs_offset + 4 * i);
+      if (opt_debug)
+	  emit ("\t.cfi_offset\t%s, %d", var_reg32[i],
+		var_regs_offset + 4 * i - 8);
+  }
+}
+
+
+void b_push_var_reg (TYPETAG type, int reg)
+{
+  emitn ("\t\t\t\t# b_push_var_reg (");
+  my_print_typetag (type);
+  emit (", %s)", var_reg32[reg]);
+
+  if (tos_cacheable (type)) {
+      int r = tos_scratch ();
+
+      emit ("\tmovl\t%s, %s", var_reg32[reg], reg32[r]);
+      tos_push_reg (r);
+      return;
+  }
+
+  tos_flush ();
+  b_push ();
+  emit ("\tmovl\t%s, (%%esp)", var_reg32[reg]);
+}
+
+
+void b_assign_var_reg (TYPETAG type, int reg)
+{
+  char *ext = type==TYSIGNEDCHAR ? "movsbl" : "movzbl";
+  BOOLEAN is_char = type==TYSIGNEDCHAR || type==TYUNSIGNEDCHAR;
+
+  emitn ("\t\t\t\t# b_assign_var_reg (");
+  my_print_typetag (type);
+  emit (", %s)", var_reg32[reg]);
+
+  if (tos_cacheable (type)) {
+      int r = tos_pop_reg (type);
+
+      if (is_char)
+	  emit ("\t%s\t%s, %s", ext, reg8[r], var_reg32[reg]);
+      else
+	  emit ("\tmovl\t%s, %s", reg32[r], var_reg32[reg]);
+      tos_push_reg (r);
+      return;
+  }
+
+  tos_flush ();
+  emit ("\t%s\t(%%esp), %s", is_char ? ext : "movl", var_reg32[reg]);
+}
+
+
+void b_inc_dec_var_reg (TYPETAG type, B_INC_DEC_OP idop, unsigned int size,
+			int reg)
+{
+  char *op = (idop == B_PRE_INC || idop == B_POST_INC) ? "add" : "sub";
+  BOOLEAN is_pre = (idop == B_PRE_INC || idop == B_PRE_DEC);
+
+  emitn ("\t\t\t\t# b_inc_dec_var_reg (");
+  my_print_typetag (type);
+  emit (", %s, %s)", idop == B_PRE_INC ? "PRE-INC" :
+	               idop == B_POST_INC ? "POS-INC" :
+	               idop == B_PRE_DEC ? "PRE-DEC" :
+	                                    "POST-DEC", var_reg32[reg]);
+
+  if (type != TYPTR)
+      size = 1;
+
+  if (tos_cacheable (type)) {
+      int r = tos_scratch ();
+
+      if (!is_pre)
+	  emit ("\tmovl\t%s, %s", var_reg32[reg], reg32[r]);
+      emit ("\t%sl\t$%u, %s", op, size, var_reg32[reg]);
+      if (is_pre)
+	  emit ("\tmovl\t%s, %s", var_reg32[reg], reg32[r]);
+      tos_push_reg (r);
+      return;
+  }
+
+  tos_flush ();
+  b_push ();
+  if (!is_pre)
+      emit ("\tmovl\t%s, (%%esp)", var_reg32[reg]);
+  emit ("\t%sl\t$%u, %s", op, size, var_reg32[reg]);
+  if (is_pre)
+      emit ("\tmovl\t%s, (%%esp)", var_reg32[reg]);
+}
+
+
+
+
+
 /* b_push_const_int accepts an integer value and emits code to
    push that value onto the stack.  */
 
@@ -561,6 +1291,14 @@ void b_push_const_int (int value)
 {
   emit ("\t\t\t\t# b_push_const_int (%d)", value);
 
+  if (opt_tos_cache) {
+      int r = tos_scratch ();
+
+      emit ("\tmovl\t$%d, %s", value, reg32[r]);
+      tos_push_reg (r);
+      return;
+  }
+
   emit ("\tmovl\t$%d, %%eax", value);
   b_push ();
   emit ("\tmovl\t%%eax, (%%esp)");
@@ -572,9 +1310,8 @@ void b_push_const_int (int value)
 
 
 /* b_push_const_double accepts a double value and emits code to
-   push that value onto the stack.  It does this by generating a new 
-   label for the value, inserting a labeled double value (two .long's)
-   into the .rodata section, and pushing the 8-byte value at the label 
+   push that value onto the stack.  It does this by interning the value
+   in the constant pool, and pushing the 8-byte value at its label
    onto the stack.  */
 
 
@@ -586,12 +1323,16 @@ void b_push_const_double (double value)
     bug("non-text assembler section in b_push_const_double");
 
   emit ("\t\t\t\t# b_push_const_double (%.16e)", value);
-  
-  emit ("\t.section\t.rodata");
-  emit ("\t.align\t%d", sizeof(double));
-  b_label (label = new_symbol());
-  b_alloc_double (value);
-  emit ("\t.text");
+
+  tos_flush ();
+
+  label = intern_const (FALSE, value, NULL)->label;
+  if (opt_sse2) {
+      emit ("\tmovsd\t%s, %%xmm0", label);
+      b_push ();
+      emit ("\tmovsd\t%%xmm0, (%%esp)");
+      return;
+  }
   emit ("\tfldl\t%s", label);
   b_push ();
   emit ("\tfstpl\t(%%esp)");
@@ -603,26 +1344,19 @@ void b_push_const_double (double value)
 
 
 /* b_push_const_string accepts a string and emits code to "push
-   the string onto the stack."  It does this by generating a new 
-   label for the string, inserting a labeled line of ascii text 
-   into the .rodata section, and pushing the address of the label 
+   the string onto the stack."  It does this by interning the string
+   in the constant pool, and pushing the address of its label
    onto the stack.  */
 
 
 void b_push_const_string (char *string)
 {
-  char *label;
-
   emit ("\t\t\t\t# b_push_const_string (\"%s\")", string);
 
   if (asm_section != SEC_TEXT)
     bug("non-text assembler section in b_push_const_string");
 
-  emit ("\t.section\t.rodata");
-  b_label (label = new_symbol());
-  emit (".string\t\"%s\"", string);
-  emit ("\t.text");
-  b_push_ext_addr (label);
+  b_push_ext_addr (intern_const (TRUE, 0.0, string)->label);
 }
 
 
@@ -653,6 +1387,30 @@ void b_assign (TYPETAG type)
   my_print_typetag (type);
   emit (")");
 
+  if (tos_cacheable (type)) {
+      int val = tos_pop_reg (type);
+      int addr = tos_pop_reg (TYPTR);
+
+      switch (type) {
+      case TYSIGNEDCHAR:
+      case TYUNSIGNEDCHAR:
+	  emit ("\tmovb\t%s, (%s)", reg8[val], reg32[addr]);
+	  break;
+      case TYSIGNEDSHORTINT:
+      case TYUNSIGNEDSHORTINT:
+	  emit ("\tmovw\t%s, (%s)", reg16[val], reg32[addr]);
+	  break;
+      default:
+	  emit ("\tmovl\t%s, (%s)", reg32[val], reg32[addr]);
+	  break;
+      }
+      tos_release (addr);
+      tos_push_reg (val);
+      return;
+  }
+
+  tos_flush ();
+
   switch (type) {
   case TYSIGNEDCHAR:
   case TYUNSIGNEDCHAR:
@@ -674,6 +1432,11 @@ void b_assign (TYPETAG type)
       put_instr   = "\tmovl\t%%edx, %s";
       break;
   case TYDOUBLE:
+      if (opt_sse2) {
+          fetch_instr = "\tmovsd\t(%%esp), %%xmm0";
+          put_instr   = "\tmovsd\t%%xmm0, %s";
+          break;
+      }
       fetch_instr = "\tfldl\t(%%esp)";
       put_instr   = "\tfstpl\t%s";
       break;
@@ -710,6 +1473,20 @@ void b_convert (TYPETAG from_type, TYPETAG to_type)
   if (from_type==to_type)
       return;
 
+  if (opt_tos_cache && is_int_conversion (from_type, to_type)) {
+      int r = tos_pop_reg (from_type);
+
+          /* Widen a character; narrowing needs nothing, because only the
+           * low-order byte of a cached character is significant. */
+      if (from_type == TYSIGNEDCHAR || from_type == TYUNSIGNEDCHAR)
+          emit ("\tmov%sbl\t%s, %s", from_type==TYSIGNEDCHAR?"s":"z",
+                reg8[r], reg32[r]);
+      tos_push_reg (r);
+      return;
+  }
+
+  tos_flush ();
+
   switch (from_type) {
 
   case TYSIGNEDCHAR:
@@ -738,6 +1515,11 @@ void b_convert (TYPETAG from_type, TYPETAG to_type)
           break;
       case TYFLOAT:
       case TYDOUBLE:
+          if (opt_sse2) {
+              emit ("\tcvtsi2%s\t(%%esp), %%xmm0", SSE_SFX(to_type));
+              emit ("\tmov%s\t%%xmm0, (%%esp)", SSE_SFX(to_type));
+              break;
+          }
 	  emit ("\tfildl\t(%%esp)");
 	  emit ("\tfstp%s\t(%%esp)", to_type==TYDOUBLE?"l":"s");
 	  break;
@@ -767,6 +1549,28 @@ void b_convert (TYPETAG from_type, TYPETAG to_type)
 
   case TYFLOAT:
   case TYDOUBLE:
+
+      if (opt_sse2 && to_type!=TYUNSIGNEDINT && to_type!=TYUNSIGNEDLONGINT) {
+          emit ("\tmov%s\t(%%esp), %%xmm0", SSE_SFX(from_type));
+          switch (to_type) {
+          case TYSIGNEDCHAR:
+          case TYUNSIGNEDCHAR:
+          case TYSIGNEDINT:
+          case TYSIGNEDLONGINT:
+              emit ("\tcvtt%s2si\t%%xmm0, %%eax", SSE_SFX(from_type));
+              emit ("\tmovl\t%%eax, (%%esp)");
+              break;
+          case TYFLOAT:
+          case TYDOUBLE:
+              emit ("\tcvt%s2%s\t%%xmm0, %%xmm0", SSE_SFX(from_type),
+                    SSE_SFX(to_type));
+              emit ("\tmov%s\t%%xmm0, (%%esp)", SSE_SFX(to_type));
+              break;
+          default:
+              bug ("unsupported destination type in b_convert");
+          }
+          break;
+      }
           
       emit ("\tfld%s\t(%%esp)", from_type==TYDOUBLE?"l":"s");
     
@@ -816,6 +1620,16 @@ void b_negate (TYPETAG type)
   my_print_typetag (type);
   emit (")");
 
+  if (tos_cacheable (type) && type != TYFLOAT) {
+      int r = tos_pop_reg (type);
+
+      emit ("\tnegl\t%s", reg32[r]);
+      tos_push_reg (r);
+      return;
+  }
+
+  tos_flush ();
+
   switch (type) {
 
   case TYSIGNEDINT:
@@ -828,6 +1642,11 @@ void b_negate (TYPETAG type)
     break;
     
   case TYDOUBLE:
+    if (opt_sse2) {
+            /* Just flip the sign bit, like fchs does */
+        emit ("\txorl\t$0x80000000, 4(%%esp)");
+        break;
+    }
     emit ("\tfldl\t(%%esp)");
     emit ("\tfchs");
     emit ("\tfstpl\t(%%esp)");
@@ -897,6 +1716,34 @@ void b_inc_dec (TYPETAG type, B_INC_DEC_OP idop, unsigned int size)
   if (type!=TYPTR)
       size = 1;
 
+  if (tos_cacheable (type) && type != TYFLOAT) {
+      int ptr = tos_pop_reg (TYPTR);
+      int val = tos_scratch ();
+      int old = -1;
+      char *mem = (type==TYSIGNEDCHAR || type==TYUNSIGNEDCHAR) ? "b" : "l";
+
+      emit ("\tmov%s\t(%s), %s", ldsz=(type==TYSIGNEDCHAR?"sbl":
+					type==TYUNSIGNEDCHAR?"zbl":"l"),
+	    reg32[ptr], reg32[val]);
+      if (idop==B_POST_INC || idop==B_POST_DEC) {
+	  old = tos_scratch ();
+	  emit ("\tmovl\t%s, %s", reg32[val], reg32[old]);
+      }
+      emit ("\t%sl\t$%u, %s", op, size, reg32[val]);
+      emit ("\tmov%s\t%s, (%s)", mem,
+	    *mem=='b' ? reg8[val] : reg32[val], reg32[ptr]);
+      tos_release (ptr);
+      if (old >= 0) {
+	  tos_release (val);
+	  tos_push_reg (old);
+      }
+      else
+	  tos_push_reg (val);
+      return;
+  }
+
+  tos_flush ();
+
   emit ("\tmovl\t(%%esp), %%edx");  /* load the pointer (l-value) */
 
   switch (type) {
@@ -925,6 +1772,19 @@ void b_inc_dec (TYPETAG type, B_INC_DEC_OP idop, unsigned int size)
     
   case TYFLOAT:
   case TYDOUBLE:
+      if (opt_sse2) {
+          emit ("\tmov%s\t(%%edx), %%xmm0", SSE_SFX(type));
+          emit ("\tmovl\t$1, %%eax");
+          emit ("\tcvtsi2%s\t%%eax, %%xmm1", SSE_SFX(type));
+          if (idop==B_POST_INC || idop==B_POST_DEC)
+              emit ("\tmov%s\t%%xmm0, (%%esp)", SSE_SFX(type));
+          emit ("\t%s%s\t%%xmm1, %%xmm0", *op=='a'?"add":"sub",
+                SSE_SFX(type));
+          if (idop==B_PRE_INC || idop==B_PRE_DEC)
+              emit ("\tmov%s\t%%xmm0, (%%esp)", SSE_SFX(type));
+          emit ("\tmov%s\t%%xmm0, (%%edx)", SSE_SFX(type));
+          break;
+      }
       emit ("\tfld%s\t(%%edx)", fpsz);
       if (idop==B_PRE_INC || idop==B_PRE_DEC) {
           emit ("\tfld1");
@@ -949,6 +1809,99 @@ void b_inc_dec (TYPETAG type, B_INC_DEC_OP idop, unsigned int size)
 
 
 
+/* Condition code suffix for the given relational operator */
+static char *cc_suffix (B_ARITH_REL_OP arop, BOOLEAN is_signed)
+{
+  if (is_signed)
+      return arop==B_LT?"l":
+	     arop==B_LE?"le":
+	     arop==B_GT?"g":
+	     arop==B_GE?"ge":
+	     arop==B_EQ?"e":"ne";
+  else
+      return arop==B_LT?"b":
+	     arop==B_LE?"be":
+	     arop==B_GT?"a":
+	     arop==B_GE?"ae":
+	     arop==B_EQ?"e":"ne";
+}
+
+/* Register-cached version of b_arith_rel_op() for word-sized operands */
+static void tos_arith_rel_op (B_ARITH_REL_OP arop, TYPETAG type)
+{
+  BOOLEAN is_signed = (type==TYSIGNEDINT||type==TYSIGNEDLONGINT);
+  int right, left;
+
+  if (type!=TYPTR && type!=TYSIGNEDINT && type!=TYSIGNEDLONGINT &&
+      type!=TYUNSIGNEDINT && type!=TYUNSIGNEDLONGINT)
+      bug("unsupported type in b_arith_rel_op");
+  if (type==TYPTR &&
+      (arop==B_ADD||arop==B_SUB||arop==B_MULT||arop==B_DIV||arop==B_MOD))
+      bug("unsupported op or op incompatible with type in b_arith_rel_op");
+
+  right = tos_pop_reg (type);
+  left = tos_pop_reg (type);
+
+  switch (arop) {
+  case B_ADD:
+  case B_SUB:
+  case B_MULT:
+      emit ("\t%sl\t%s, %s", arop==B_ADD?"add":arop==B_SUB?"sub":"imul",
+	    reg32[right], reg32[left]);
+      tos_release (right);
+      tos_push_reg (left);
+      break;
+  case B_DIV:
+  case B_MOD:
+	  /* Both operands have been popped, so nothing else is cached and
+	   * all three registers are ours.  Get the divisor into %ecx and the
+	   * dividend into %eax, leaving %edx free. */
+      if (left == REG_ECX && right == REG_EAX)
+	  emit ("\txchgl\t%%eax, %%ecx");
+      else {
+	  if (left == REG_ECX) {
+	      emit ("\tmovl\t%%ecx, %%eax");	/* right is in %edx */
+	      left = REG_EAX;
+	  }
+	  if (right != REG_ECX) {
+	      emit ("\tmovl\t%s, %%ecx", reg32[right]);
+	      right = REG_ECX;
+	  }
+	  if (left != REG_EAX)
+	      emit ("\tmovl\t%s, %%eax", reg32[left]);
+      }
+      if (is_signed) {
+	  emit ("\tmovl\t%%eax, %%edx");
+	  emit ("\tsarl\t$31, %%edx");
+      }
+      else
+	  emit ("\tmovl\t$0, %%edx");
+      emit ("\t%sdivl\t%%ecx", is_signed?"i":"");
+      reg_busy[REG_EAX] = reg_busy[REG_ECX] = reg_busy[REG_EDX] = FALSE;
+      left = arop==B_DIV ? REG_EAX : REG_EDX;
+      reg_busy[left] = TRUE;
+      tos_push_reg (left);
+      break;
+  case B_LT:
+  case B_LE:
+  case B_GT:
+  case B_GE:
+  case B_EQ:
+  case B_NE:
+      emit ("\tcmpl\t%s, %s", reg32[right], reg32[left]);
+      emit ("\tset%s\t%s", cc_suffix (arop, is_signed), reg8[left]);
+      emit ("\tmovzbl\t%s, %s", reg8[left], reg32[left]);
+      tos_release (right);
+      tos_push_reg (left);
+      break;
+  default:
+      bug("unsupported op or op incompatible with type in b_arith_rel_op");
+  }
+}
+
+
+
+
 /* b_arith_rel_op accepts a binary arithmetic or relational operator
    and a type.  The operators are:
 
@@ -992,6 +1945,13 @@ void b_arith_rel_op (B_ARITH_REL_OP arop, TYPETAG type)
   my_print_typetag (type);
   emit (")");
 
+  if (opt_tos_cache && type != TYDOUBLE) {
+      tos_arith_rel_op (arop, type);
+      return;
+  }
+
+  tos_flush ();
+
   switch (type) {
   case TYPTR:
       if (arop==B_ADD||arop==B_SUB||arop==B_MULT||arop==B_DIV||arop==B_MOD)
@@ -1059,6 +2019,50 @@ void b_arith_rel_op (B_ARITH_REL_OP arop, TYPETAG type)
 
   case TYDOUBLE:
 
+      if (opt_sse2) {
+          emit ("\tmovsd\t%d(%%esp), %%xmm0", STACK_ITEM);
+          emit ("\tmovsd\t(%%esp), %%xmm1");
+          b_pop();
+          switch (arop) {
+          case B_ADD:
+          case B_SUB:
+          case B_MULT:
+          case B_DIV:
+              emit ("\t%ssd\t%%xmm1, %%xmm0",
+                    arop==B_ADD ? "add" :
+                    arop==B_SUB ? "sub" :
+                    arop==B_MULT ? "mul" : "div");
+              emit ("\tmovsd\t%%xmm0, (%%esp)");
+              break;
+          case B_LT:
+          case B_LE:
+          case B_GT:
+          case B_GE:
+          case B_EQ:
+          case B_NE:
+                  /* Compare so that "above" means the relation holds;
+                   * an unordered result (NaN) then sets CF and fails. */
+              if (arop==B_LT || arop==B_LE)
+                  emit ("\tucomisd\t%%xmm0, %%xmm1");
+              else
+                  emit ("\tucomisd\t%%xmm1, %%xmm0");
+              emit ("\tset%s\t%%al",
+                    arop==B_LT||arop==B_GT ? "a" :
+                    arop==B_LE||arop==B_GE ? "ae" :
+                    arop==B_EQ ? "e" : "ne");
+              if (arop==B_EQ || arop==B_NE) {
+                  emit ("\tset%sp\t%%dl", arop==B_EQ?"n":"");
+                  emit ("\t%sb\t%%dl, %%al", arop==B_EQ?"and":"or");
+              }
+              emit ("\tmovzbl\t%%al, %%eax");
+              emit ("\tmovl\t%%eax, (%%esp)");
+              break;
+          default:
+              bug("unsupported op or op incompatible with type in b_arith_rel_op");
+          }
+          break;
+      }
+
           /* Match stack loading order of gcc */
       emit ("\tfldl\t%d(%%esp)", STACK_ITEM);
       emit ("\tfldl\t(%%esp)");
@@ -1068,12 +2072,251 @@ void b_arith_rel_op (B_ARITH_REL_OP arop, TYPETAG type)
       case B_ADD:
       case B_SUB:
       case B_MULT:
-      case B_DIV:
-	  emit ("\tf%sp\t%%st, %%st(1)",
-		arop==B_ADD ? "add" :
-		arop==B_SUB ? "subr" :
-		arop==B_MULT ? "mul" : "divr");
-	  emit ("\tfstpl\t(%%esp)");
+      case B_DIV:
+	  emit ("\tf%sp\t%%st, %%st(1)",
+		arop==B_ADD ? "add" :
+		arop==B_SUB ? "subr" :
+		arop==B_MULT ? "mul" : "divr");
+	  emit ("\tfstpl\t(%%esp)");
+	  break;
+      case B_LT:
+      case B_LE:
+      case B_GT:
+      case B_GE:
+      case B_EQ:
+      case B_NE:
+          if (arop==B_GT || arop==B_GE)
+              emit ("\tfxch\t%%st(1)");
+	  emit ("\tfucompp");
+	  emit ("\tfnstsw\t%%ax");
+          if (arop==B_LT || arop==B_LE) {
+              emit ("\ttestb\t$%d, %%ah", arop==B_LT?0x45:0x05);
+              emit ("\tsete\t%%al");
+          }
+          else {
+              emit ("\tsahf");
+              emit ("\tset%s\t%%al",
+                    arop==B_GT?"a":arop==B_GE?"ae":arop==B_EQ?"e":"ne");
+          }
+          if (arop==B_EQ || arop==B_NE) {
+              emit ("\tset%sp\t%%dl", arop==B_EQ?"n":"");
+              emit ("\t%sl\t%%edx, %%eax", arop==B_EQ?"and":"or");
+          }
+          emit ("\tmovzbl\t%%al, %%eax");
+          emit ("\tmovl\t%%eax, (%%esp)");
+	  break;
+      default:
+	  bug("unsupported op or op incompatible with type in b_arith_rel_op");
+      }
+      break;
+
+  default:
+      bug("unsupported type in b_arith_rel_op");
+  }
+}
+
+
+
+
+/* Division by a constant.  idivl takes tens of cycles, so division and
+ * remainder by a constant d are done without it, with the same results
+ * (the quotient is truncated toward zero, and the remainder has the sign
+ * of the dividend n):
+ *
+ *   d = 1, -1		the quotient is n or -n, the remainder 0
+ *   |d| = 2^k		n is biased by 2^k-1 if negative, then shifted
+ *			right arithmetically; the remainder is n minus the
+ *			biased n with its low k bits cleared
+ *   otherwise		the high word of n times a "magic number" M, then
+ *			shifted right, plus 1 if negative (Hacker's
+ *			Delight, ch. 10); the remainder is n - q*d
+ *
+ * An unsigned dividend is handled only for d = 2^k, by a logical shift or
+ * a mask; other unsigned divisors, and d = 0, still use divl/idivl. */
+
+/* Returns k if v is 2^k for k >= 0, or -1 if it is not a power of 2 */
+static int exact_log2 (unsigned int v)
+{
+  int k;
+
+  if (v == 0 || (v & (v-1)) != 0)
+      return -1;
+  for (k = 0; v != 1; k++)
+      v >>= 1;
+  return k;
+}
+
+/* Tells whether div_by_const can divide a value of the given type by d */
+static BOOLEAN div_by_const_ok (TYPETAG type, int d)
+{
+  if (type==TYSIGNEDINT || type==TYSIGNEDLONGINT)
+      return d != 0;
+  return d > 0 && exact_log2 (d) >= 0;
+}
+
+/* Computes the magic number and shift count for signed division by d,
+   where 2 <= |d| < 2^31 (Hacker's Delight, figure 10-1) */
+static void div_magic (int d, int *magic, int *shift)
+{
+  const unsigned int two31 = 0x80000000;
+  unsigned int ad, anc, delta, q1, r1, q2, r2, t;
+  int p = 31;
+
+  ad = d < 0 ? -(unsigned int) d : (unsigned int) d;
+  t = two31 + ((unsigned int) d >> 31);
+  anc = t - 1 - t%ad;
+  q1 = two31/anc;
+  r1 = two31 - q1*anc;
+  q2 = two31/ad;
+  r2 = two31 - q2*ad;
+  do {
+      p++;
+      q1 = 2*q1;
+      r1 = 2*r1;
+      if (r1 >= anc) {
+	  q1++;
+	  r1 -= anc;
+      }
+      q2 = 2*q2;
+      r2 = 2*r2;
+      if (r2 >= ad) {
+	  q2++;
+	  r2 -= ad;
+      }
+      delta = ad - r2;
+  } while (q1 < delta || (q1 == delta && r1 == 0));
+
+  *magic = (int) (q2 + 1);
+  if (d < 0)
+      *magic = -*magic;
+  *shift = p - 32;
+}
+
+/* Emits code to divide %eax by d (B_DIV) or take its remainder (B_MOD),
+   leaving the result in %eax.  Uses %ecx and %edx.  The caller must have
+   checked div_by_const_ok. */
+static void div_by_const (B_ARITH_REL_OP arop, TYPETAG type, int d)
+{
+  int k = exact_log2 (d < 0 ? -(unsigned int) d : (unsigned int) d);
+  int magic, shift;
+
+  if (type!=TYSIGNEDINT && type!=TYSIGNEDLONGINT) {
+      if (arop==B_DIV && k > 0)
+	  emit ("\tshrl\t$%d, %%eax", k);
+      else if (arop==B_MOD)
+	  emit ("\tandl\t$%d, %%eax", d-1);
+      return;
+  }
+
+  if (k == 0) {
+      if (arop==B_MOD)
+	  emit ("\tmovl\t$0, %%eax");
+      else if (d < 0)
+	  emit ("\tnegl\t%%eax");
+      return;
+  }
+
+  if (k > 0) {
+          /* %edx = 2^k-1 if n is negative, else 0 */
+      emit ("\tmovl\t%%eax, %%edx");
+      if (k > 1)
+	  emit ("\tsarl\t$31, %%edx");
+      emit ("\tshrl\t$%d, %%edx", 32-k);
+      if (arop==B_DIV) {
+	  emit ("\taddl\t%%edx, %%eax");
+	  emit ("\tsarl\t$%d, %%eax", k);
+	  if (d < 0)
+	      emit ("\tnegl\t%%eax");
+      }
+      else {
+	  emit ("\taddl\t%%eax, %%edx");
+	  emit ("\tandl\t$%d, %%edx", (int) -(1u << k));
+	  emit ("\tsubl\t%%edx, %%eax");
+      }
+      return;
+  }
+
+  div_magic (d, &magic, &shift);
+  emit ("\tmovl\t%%eax, %%ecx");
+  emit ("\tmovl\t$%d, %%edx", magic);
+  emit ("\timull\t%%edx");
+  if (d > 0 && magic < 0)
+      emit ("\taddl\t%%ecx, %%edx");
+  else if (d < 0 && magic > 0)
+      emit ("\tsubl\t%%ecx, %%edx");
+  if (shift > 0)
+      emit ("\tsarl\t$%d, %%edx", shift);
+  emit ("\tmovl\t%%edx, %%eax");
+  emit ("\tshrl\t$31, %%eax");
+  emit ("\taddl\t%%edx, %%eax");
+  if (arop==B_MOD) {
+      emit ("\timull\t$%d, %%eax, %%eax", -d);
+      emit ("\taddl\t%%ecx, %%eax");
+  }
+}
+
+
+/* b_arith_rel_op_const is b_arith_rel_op with a constant right operand
+   (see backend-x86.h).  Addition, subtraction, multiplication and the
+   relational operators use the constant as an immediate operand, working
+   on the cached register or directly on the stack slot.  Division and
+   remainder are done by div_by_const in %eax, or, where it cannot be
+   used, by pushing the constant and using b_arith_rel_op. */
+
+
+void b_arith_rel_op_const (B_ARITH_REL_OP arop, TYPETAG type, int value)
+{
+  BOOLEAN is_signed = (type==TYSIGNEDINT||type==TYSIGNEDLONGINT);
+  int r;
+
+  if ((arop==B_DIV || arop==B_MOD) && !div_by_const_ok (type, value)) {
+      b_push_const_int (value);
+      b_arith_rel_op (arop, type);
+      return;
+  }
+
+  emitn ("\t\t\t\t# b_arith_rel_op_const (%s, ",
+	 b_arith_rel_op_string (arop));
+  my_print_typetag (type);
+  emit (", %d)", value);
+
+  if (type!=TYPTR && type!=TYSIGNEDINT && type!=TYSIGNEDLONGINT &&
+      type!=TYUNSIGNEDINT && type!=TYUNSIGNEDLONGINT)
+      bug("unsupported type in b_arith_rel_op_const");
+  if (type==TYPTR &&
+      (arop==B_ADD||arop==B_SUB||arop==B_MULT||arop==B_DIV||arop==B_MOD))
+      bug("unsupported op or op incompatible with type in b_arith_rel_op_const");
+
+  if (arop==B_DIV || arop==B_MOD) {
+      if (opt_tos_cache) {
+	      /* Spill whatever else is cached, so that all three registers
+	       * are free */
+	  r = tos_pop_reg (type);
+	  tos_flush ();
+	  if (r != REG_EAX)
+	      emit ("\tmovl\t%s, %%eax", reg32[r]);
+	  div_by_const (arop, type, value);
+	  reg_busy[REG_ECX] = reg_busy[REG_EDX] = FALSE;
+	  reg_busy[REG_EAX] = TRUE;
+	  tos_push_reg (REG_EAX);
+      }
+      else {
+	  emit ("\tmovl\t(%%esp), %%eax");
+	  div_by_const (arop, type, value);
+	  emit ("\tmovl\t%%eax, (%%esp)");
+      }
+      return;
+  }
+
+  if (opt_tos_cache) {
+      r = tos_pop_reg (type);
+      switch (arop) {
+      case B_ADD:
+      case B_SUB:
+	  emit ("\t%sl\t$%d, %s", arop==B_ADD?"add":"sub", value, reg32[r]);
+	  break;
+      case B_MULT:
+	  emit ("\timull\t$%d, %s, %s", value, reg32[r], reg32[r]);
 	  break;
       case B_LT:
       case B_LE:
@@ -1081,34 +2324,128 @@ void b_arith_rel_op (B_ARITH_REL_OP arop, TYPETAG type)
       case B_GE:
       case B_EQ:
       case B_NE:
-          if (arop==B_GT || arop==B_GE)
-              emit ("\tfxch\t%%st(1)");
-	  emit ("\tfucompp");
-	  emit ("\tfnstsw\t%%ax");
-          if (arop==B_LT || arop==B_LE) {
-              emit ("\ttestb\t$%d, %%ah", arop==B_LT?0x45:0x05);
-              emit ("\tsete\t%%al");
-          }
-          else {
-              emit ("\tsahf");
-              emit ("\tset%s\t%%al",
-                    arop==B_GT?"a":arop==B_GE?"ae":arop==B_EQ?"e":"ne");
-          }
-          if (arop==B_EQ || arop==B_NE) {
-              emit ("\tset%sp\t%%dl", arop==B_EQ?"n":"");
-              emit ("\t%sl\t%%edx, %%eax", arop==B_EQ?"and":"or");
-          }
-          emit ("\tmovzbl\t%%al, %%eax");
-          emit ("\tmovl\t%%eax, (%%esp)");
+	  emit ("\tcmpl\t$%d, %s", value, reg32[r]);
+	  emit ("\tset%s\t%s", cc_suffix (arop, is_signed), reg8[r]);
+	  emit ("\tmovzbl\t%s, %s", reg8[r], reg32[r]);
 	  break;
       default:
-	  bug("unsupported op or op incompatible with type in b_arith_rel_op");
+	  bug("unsupported op in b_arith_rel_op_const");
       }
-      break;
+      tos_push_reg (r);
+      return;
+  }
 
+  switch (arop) {
+  case B_ADD:
+  case B_SUB:
+      emit ("\t%sl\t$%d, (%%esp)", arop==B_ADD?"add":"sub", value);
+      break;
+  case B_MULT:
+      emit ("\timull\t$%d, (%%esp), %%eax", value);
+      emit ("\tmovl\t%%eax, (%%esp)");
+      break;
+  case B_LT:
+  case B_LE:
+  case B_GT:
+  case B_GE:
+  case B_EQ:
+  case B_NE:
+      emit ("\tcmpl\t$%d, (%%esp)", value);
+      emit ("\tset%s\t%%al", cc_suffix (arop, is_signed));
+      emit ("\tmovzbl\t%%al, %%eax");
+      emit ("\tmovl\t%%eax, (%%esp)");
+      break;
   default:
-      bug("unsupported type in b_arith_rel_op");
+      bug("unsupported op in b_arith_rel_op_const");
+  }
+}
+
+
+
+
+/* b_cond_jump_rel fuses b_arith_rel_op with a relational operator and
+   b_cond_jump: the two operands are compared and the flags branched on
+   directly, instead of being turned into a 0 or 1 that is then tested. */
+
+
+void b_cond_jump_rel (B_ARITH_REL_OP arop, TYPETAG type, char *label)
+{
+  BOOLEAN is_signed = (type==TYSIGNEDINT||type==TYSIGNEDLONGINT);
+  int right, left;
+
+  emitn ("\t\t\t\t# b_cond_jump_rel (%s, ", b_arith_rel_op_string (arop));
+  my_print_typetag (type);
+  emit (", %s)", label);
+
+  if (type!=TYPTR && type!=TYSIGNEDINT && type!=TYSIGNEDLONGINT &&
+      type!=TYUNSIGNEDINT && type!=TYUNSIGNEDLONGINT)
+      bug("unsupported type in b_cond_jump_rel");
+  if (arop!=B_LT && arop!=B_LE && arop!=B_GT && arop!=B_GE &&
+      arop!=B_EQ && arop!=B_NE)
+      bug("b_cond_jump_rel: illegal comparison operator: %s",
+	  b_arith_rel_op_string (arop));
+
+  if (opt_tos_cache) {
+      right = tos_pop_reg (type);
+      left = tos_pop_reg (type);
+	  /* Whatever remains cached must be in memory at the label */
+      tos_flush ();
+      emit ("\tcmpl\t%s, %s", reg32[right], reg32[left]);
+      emit ("\tj%s\t%s", cc_suffix (arop, is_signed), label);
+      tos_release (right);
+      tos_release (left);
+      return;
+  }
+
+  tos_flush ();
+  emit ("\tmovl\t(%%esp), %%ecx");
+  b_pop ();
+  emit ("\tmovl\t(%%esp), %%eax");
+  b_pop ();
+  emit ("\tcmpl\t%%ecx, %%eax");
+  emit ("\tj%s\t%s", cc_suffix (arop, is_signed), label);
+}
+
+
+
+
+/* b_cond_jump_rel_const is b_cond_jump_rel with a constant right
+   operand, which is compared as an immediate. */
+
+
+void b_cond_jump_rel_const (B_ARITH_REL_OP arop, TYPETAG type, int value,
+			    char *label)
+{
+  BOOLEAN is_signed = (type==TYSIGNEDINT||type==TYSIGNEDLONGINT);
+  int r;
+
+  emitn ("\t\t\t\t# b_cond_jump_rel_const (%s, ",
+	 b_arith_rel_op_string (arop));
+  my_print_typetag (type);
+  emit (", %d, %s)", value, label);
+
+  if (type!=TYPTR && type!=TYSIGNEDINT && type!=TYSIGNEDLONGINT &&
+      type!=TYUNSIGNEDINT && type!=TYUNSIGNEDLONGINT)
+      bug("unsupported type in b_cond_jump_rel_const");
+  if (arop!=B_LT && arop!=B_LE && arop!=B_GT && arop!=B_GE &&
+      arop!=B_EQ && arop!=B_NE)
+      bug("b_cond_jump_rel_const: illegal comparison operator: %s",
+	  b_arith_rel_op_string (arop));
+
+  if (opt_tos_cache) {
+      r = tos_pop_reg (type);
+      tos_flush ();
+      emit ("\tcmpl\t$%d, %s", value, reg32[r]);
+      emit ("\tj%s\t%s", cc_suffix (arop, is_signed), label);
+      tos_release (r);
+      return;
   }
+
+  tos_flush ();
+  emit ("\tmovl\t(%%esp), %%eax");
+  b_pop ();
+  emit ("\tcmpl\t$%d, %%eax", value);
+  emit ("\tj%s\t%s", cc_suffix (arop, is_signed), label);
 }
 
 
@@ -1140,6 +2477,45 @@ void b_ptr_arith_op (B_ARITH_REL_OP arop, TYPETAG type, unsigned int size)
   if (size == 0)
       bug("size == 0 in b_ptr_arith_op");
 
+  if (opt_tos_cache) {
+      int right = tos_pop_reg (type);
+      int left = tos_pop_reg (TYPTR);
+
+      switch (type) {
+      case TYSIGNEDINT:
+      case TYUNSIGNEDINT:
+      case TYSIGNEDLONGINT:
+      case TYUNSIGNEDLONGINT:
+	  if (arop!=B_ADD && arop!=B_SUB)
+	      bug("unsupported pointer/integer operation in b_ptr_arith_op");
+	  emit ("\timull\t$%u, %s, %s", size, reg32[right], reg32[right]);
+	  emit ("\t%sl\t%s, %s", arop==B_ADD?"add":"sub",
+		reg32[right], reg32[left]);
+	  tos_release (right);
+	  break;
+      case TYPTR:
+	  if (arop != B_SUB)
+	      bug("unsupported pointer/pointer operation in b_ptr_arith_op");
+	  emit ("\tsubl\t%s, %s", reg32[right], reg32[left]);
+	  tos_release (right);
+	      /* divide_by_size() works on %eax, which is free unless it
+	       * holds the difference already */
+	  if (left != REG_EAX) {
+	      emit ("\tmovl\t%s, %%eax", reg32[left]);
+	      tos_release (left);
+	      reg_busy[left = REG_EAX] = TRUE;
+	  }
+	  divide_by_size(size);
+	  break;
+      default:
+	  bug("illegal type of second operand in b_ptr_arith_op");
+      }
+      tos_push_reg (left);
+      return;
+  }
+
+  tos_flush ();
+
   emit ("\tmovl\t(%%esp), %%edx");
   b_pop();
   emit ("\tmovl\t(%%esp), %%eax");
@@ -1172,6 +2548,67 @@ void b_ptr_arith_op (B_ARITH_REL_OP arop, TYPETAG type, unsigned int size)
 
 
 
+/* b_check_index compares the index on top of the stack with n - 1 as
+   unsigned numbers, so that one compare catches indices below the low
+   bound as well as above the high one, and jumps to a trap emitted at the
+   end of the function (see emit_traps) if it is greater.  See
+   backend-x86.h. */
+
+
+void b_check_index (TYPETAG type, int n)
+{
+  char *trap = new_symbol ();
+  int r;
+
+  emitn ("\t\t\t\t# b_check_index (");
+  my_print_typetag (type);
+  emit (", %d)", n);
+
+  if (type!=TYSIGNEDINT && type!=TYSIGNEDLONGINT &&
+      type!=TYUNSIGNEDINT && type!=TYUNSIGNEDLONGINT)
+      bug("unsupported type in b_check_index");
+
+  if (opt_tos_cache) {
+      r = tos_pop_reg (type);
+      emit ("\tcmpl\t$%d, %s", n - 1, reg32[r]);
+      tos_push_reg (r);
+  }
+  else
+      emit ("\tcmpl\t$%d, (%%esp)", n - 1);
+  emit ("\tja\t%s", trap);
+
+  if (ntraps == traps_size) {
+      traps_size = traps_size ? 2 * traps_size : 16;
+      trap_labels = (char **) realloc (trap_labels,
+				       traps_size * sizeof (char *));
+      trap_recs = (int *) realloc (trap_recs, traps_size * sizeof (int));
+      if (trap_labels == NULL || trap_recs == NULL)
+	  bug ("b_check_index: out of memory");
+  }
+  trap_labels[ntraps] = trap;
+  trap_recs[ntraps++] = asm_mark () - 1;
+}
+
+
+/* Emits the traps of the index checks of the current function that are
+   still there, after its last instruction.  A ud2 stops the program
+   with SIGILL, and needs no run-time library. */
+static void emit_traps (void)
+{
+  ASM_LIST *recs = asm_records ();
+  int i;
+
+  for (i = 0; i < ntraps; i++)
+      if (!recs[trap_recs[i]]->deleted) {
+	  emit ("%s:", trap_labels[i]);
+	  emit ("\tud2");
+      }
+  ntraps = 0;
+}
+
+
+
+
 
 /* b_func_prologue accepts a function name and generates the prologue
    for a function with that name.  It also initializes four static
@@ -1180,11 +2617,19 @@ void b_ptr_arith_op (B_ARITH_REL_OP arop, TYPETAG type, unsigned int size)
 
 void b_func_prologue (char *f_name)
 {
+  func_start_rec = asm_mark ();
+  return_slot_rec = -1;
+  tail_called = FALSE;
+  stack_align_reset ();
   emit ("\t\t\t\t# b_func_prologue (%s)", f_name);
 
   /* Args of type double will be stored starting at %ebp-8. */
   loc_var_offset = double_base_offset = 0;
 
+  /* Nothing is cached on entry */
+  tos_count = 0;
+  reg_busy[REG_EAX] = reg_busy[REG_ECX] = reg_busy[REG_EDX] = FALSE;
+
       /* The following won't work, because we can't compute stack alignment
        * at compile time, due to nontrivial control flow.  Instead, we will
        * 16-byte align %esp explicitly before an argument build. */
@@ -1215,11 +2660,24 @@ void b_func_prologue (char *f_name)
   emit (".global %s", f_name);
   emit ("\t.type\t%s, @function", f_name);
   b_label (f_name);
+      /* With -g, describe the frame for unwinders as it is built (see
+       * frame_cfi for functions that end up without one) */
+  if (opt_debug) {
+      emit ("\t.cfi_startproc");
+      emit ("\t.loc\t1 %d", sc_line ());
+  }
       /* Save the old frame pointer */
   emit ("\tpushl\t%%ebp");
+  if (opt_debug) {
+      emit ("\t.cfi_def_cfa_offset\t8");
+      emit ("\t.cfi_offset\t%%ebp, -8");
+  }
       /* Update the frame pointer to current call frame */
   emit ("\tmovl\t%%esp, %%ebp");
-      /* We don't use %ebx for anything */
+  if (opt_debug)
+      emit ("\t.cfi_def_cfa_register\t%%ebp");
+      /* %ebx is saved in the frame, if it is used at all, by
+       * b_save_var_regs */
   #if 0
       /* %ebx should persist across function calls.  Save it now and
        * restore it at the end in b_encode_void_return() */
@@ -1336,6 +2794,7 @@ int b_store_formal_param (TYPETAG type)
 	return caller_offset - sizeof(int);
     case TYFLOAT:
     case TYDOUBLE:
+	tos_flush ();
 	emit ("\tmovl\t%d(%%ebp), %%eax", caller_offset);
 	caller_offset += sizeof(int);
 	emit ("\tmovl\t%d(%%ebp), %%edx", caller_offset);
@@ -1418,6 +2877,7 @@ void b_alloc_return_value()
     emit ("\t\t\t\t# b_alloc_return_value ( )");
 
     return_value_offset = b_alloc_local_vars(STACK_ITEM);
+    return_slot_rec = asm_mark () - 1;
 }
 
 
@@ -1451,6 +2911,7 @@ int b_alloc_local_vars (int size)
   if (new_space == 0)
       return loc_var_offset;
   
+  tos_flush ();
   loc_var_offset -= new_space;
   emit ("\tsubl\t$%d, %%esp", new_space);
   #if 0
@@ -1485,6 +2946,59 @@ int b_get_local_var_offset()
 
 
 
+
+/* b_enter_display accepts the nesting level of the current function
+   (1 for a function declared in the main program) and emits code to make
+   its frame the one the display gives for that level, saving the old
+   entry in a new local slot.  It should be called after the local
+   variables are allocated, in functions whose parameters or local
+   variables are used by the functions nested in them; the old entry is
+   put back on return.  Up-level access (b_push_display_addr) then takes
+   one load whatever the distance between the levels, and functions that
+   do not call b_enter_display never touch the display.  (This replaces
+   a static link, which is why nothing is passed at FUNC_LINK_OFFSET.) */
+
+
+void b_enter_display (int level)
+{
+  emit ("\t\t\t\t# b_enter_display (level = %d)", level);
+
+  if (level < 1)
+      bug("b_enter_display: illegal level %d", level);
+  if (level > display_size)
+      display_size = level;
+
+  display_save_offset = b_alloc_local_vars (STACK_ITEM);
+  display_level = level;
+  tos_flush ();
+  emit ("\tmovl\t%s+%d, %%eax", DISPLAY_LABEL, (level - 1) * TARGET_PTR_SIZE);
+  emit ("\tmovl\t%%eax, %d(%%ebp)", display_save_offset);
+  emit ("\tmovl\t%%ebp, %s+%d", DISPLAY_LABEL, (level - 1) * TARGET_PTR_SIZE);
+}
+
+
+
+
+/* b_func_body marks the start of the body of the current function, which
+   must come after its parameters are stored, its local variables
+   allocated and the display entered.  A self-recursive tail call
+   (b_tail_call_self) jumps back here.  Nothing is emitted unless one
+   does. */
+
+
+void b_func_body (void)
+{
+  tos_flush ();
+      /* Hold a place for the label, which is invisible until used */
+  asm_line ("");
+  body_rec = asm_mark () - 1;
+  asm_records ()[body_rec]->deleted = TRUE;
+  body_label = NULL;
+}
+
+
+
+
 /* b_dealloc_local_vars accepts an integer and emits code to decrease the
    stack by that number of bytes.  The stack pointer is restored
    (if necessary) to quadword (8-byte) alignment.  The size value passed
@@ -1504,6 +3018,7 @@ void b_dealloc_local_vars (int size)
     if (size < 0)
 	bug("negative size given to b_dealloc_local_vars");
 
+    tos_flush ();
     loc_var_offset += old_space;
     emit ("\taddl\t$%d, %%esp", old_space);
     #if 0
@@ -1519,11 +3034,16 @@ void b_dealloc_local_vars (int size)
 /* This is the only backend routine that performs the actual return
    from a C or Pascal function.  It is called from b_encode_return to
    execute a return statement, and also from b_func_epilogue when control
-   falls out of the bottom of a function.
+   falls out of the bottom of a function.  For a tail call, it is called
+   with the name of the function to jump to instead of returning (see
+   b_tail_call_by_name); otherwise jump_to is NULL.
 */
-static void b_void_return (void)
+static void b_void_return (char *jump_to)
 {
-        /* We don't use %ebx for anything, so just leave the function no
+    int i;
+
+        /* %ebx, %esi and %edi are put back from the frame if they were
+         * used (see b_save_var_regs), so just leave the function no
          * matter where %esp is at this point. */
     #if 0
         /* Move stack pointer from wherever it is to where %ebx was stored.
@@ -1532,9 +3052,34 @@ static void b_void_return (void)
     emit ("\tpopl\t%%ebx");
     emit ("\tpopl\t%%ebp");
     #else
+        /* Put back the display entry replaced by b_enter_display.  %ecx
+         * holds no return value. */
+    if (display_level >= 0) {
+        emit ("\tmovl\t%d(%%ebp), %%ecx", display_save_offset);
+        emit ("\tmovl\t%%ecx, %s+%d", DISPLAY_LABEL,
+              (display_level - 1) * TARGET_PTR_SIZE);
+    }
+    if (opt_debug)
+        emit ("\t.cfi_remember_state");
+        /* Put back the registers saved by b_save_var_regs */
+    for (i = 0; i < var_regs_saved; i++) {
+        emit ("\tmovl\t%d(%%ebp), %s", var_regs_offset + 4 * i,
+              var_reg32[i]);
+        if (opt_debug)
+            emit ("\t.cfi_restore\t%s", var_reg32[i]);
+    }
     emit ("\tleave");
+    if (opt_debug) {
+        emit ("\t.cfi_restore\t%%ebp");
+        emit ("\t.cfi_def_cfa\t%%esp, 4");
+    }
     #endif
-    emit ("\tret");	/* control goes back to caller */
+    if (jump_to != NULL)
+        emit ("\tjmp\t%s", jump_to);	/* the callee returns to our caller */
+    else
+        emit ("\tret");	/* control goes back to caller */
+    if (opt_debug)
+        emit ("\t.cfi_restore_state");
 }
 
 
@@ -1549,15 +3094,34 @@ static void b_void_return (void)
 
 void b_func_epilogue (char *f_name)
 {
+  int slot_offset = return_value_offset;
+
   emit ("\t\t\t\t# b_func_epilogue (%s)", f_name);
 
   /* Reset this to an illegal value */
   return_value_offset = 0;
-  b_void_return ();
+  tos_count = 0;
+  reg_busy[REG_EAX] = reg_busy[REG_ECX] = reg_busy[REG_EDX] = FALSE;
+  if (!tail_called)
+      b_void_return (NULL);
+  emit_traps ();
+  display_level = -1;
+  var_regs_saved = 0;
+  body_rec = -1;
+  if (opt_debug)
+      emit ("\t.cfi_endproc");
   emit ("\t.size\t%s, .-%s", f_name, f_name);
 
       /* Reset loc_var_offset to a positive (illegal) value */
   loc_var_offset = 1;
+
+  if (opt_omit_frame_pointer)
+      omit_frame_pointer (asm_records () + func_start_rec,
+			  asm_mark () - func_start_rec, FALSE,
+			  return_slot_rec < 0 ? -1
+			  : return_slot_rec - func_start_rec,
+			  slot_offset, STACK_ITEM);
+  asm_flush (outfp, FALSE);
 }
 
 
@@ -1565,6 +3129,46 @@ void b_func_epilogue (char *f_name)
 
 
 
+/* If the last instruction stores a double onto the stack top (fstpl or
+   movsd to (%esp)), makes it store to offset(reg) instead, so that the
+   value goes straight to where it is wanted, and returns TRUE.  The stack
+   top still has to be popped. */
+static BOOLEAN store_double_to (int offset, char *reg)
+{
+  ASM_LIST *recs = asm_records ();
+  ASM_LIST rec;
+  char *s;
+  int i;
+
+  for (i = asm_mark () - 1; i > func_start_rec; i--)
+      if (recs[i]->kind != AK_COMMENT && recs[i]->kind != AK_DEBUG)
+	  break;
+  rec = recs[i];
+  if (i <= func_start_rec || rec->kind != AK_INSN || rec->deleted)
+      return FALSE;
+
+  if (!strcmp (rec->op, "fstpl") && rec->nargs == 1
+      && !strcmp (rec->args[0], "(%esp)")) {
+      s = (char *) malloc (16);
+      if (s == NULL)
+	  bug ("store_double_to: out of memory");
+      sprintf (s, "%d(%s)", offset, reg);
+      asm_set_insn (rec, rec->op, s, NULL);
+      return TRUE;
+  }
+  if (!strcmp (rec->op, "movsd") && rec->nargs == 2
+      && !strcmp (rec->args[1], "(%esp)")) {
+      s = (char *) malloc (16);
+      if (s == NULL)
+	  bug ("store_double_to: out of memory");
+      sprintf (s, "%d(%s)", offset, reg);
+      asm_set_insn (rec, rec->op, rec->args[0], s);
+      return TRUE;
+  }
+  return FALSE;
+}
+
+
 /* b_set_return copies the value currently on the stack into the space
    designated for the return value, which should not be TYVOID.  The space
    designated for the return value is given by %ebp + return_value_offset.
@@ -1604,6 +3208,21 @@ void b_set_return (TYPETAG return_type)
       bug("b_set_return: illegal return type");
   }
 
+  if (tos_cacheable (return_type)) {
+      int r = tos_pop_reg (return_type);
+      emit ("\tmovl\t%s, %d(%%ebp)", reg32[r], return_value_offset);
+      tos_release (r);
+      return;
+  }
+
+  tos_flush ();
+      /* With -fomit-frame-pointer, a real value may go straight into the
+       * slot, where frame.c can see it to keep it in %st(0) instead */
+  if (return_type == TYDOUBLE && opt_omit_frame_pointer
+      && store_double_to (return_value_offset, "%ebp")) {
+      b_pop ();
+      return;
+  }
   emit ("\tmovl\t(%%esp), %%eax");
   emit ("\tmovl\t%%eax, %d(%%ebp)", return_value_offset);
   if (return_type==TYDOUBLE) {
@@ -1692,6 +3311,8 @@ void b_encode_return (TYPETAG return_type)
   my_print_typetag (return_type);
   emit  (")");
 
+  tos_flush ();
+
   switch (return_type) {
   case TYSIGNEDCHAR:
   case TYUNSIGNEDCHAR:
@@ -1714,7 +3335,7 @@ void b_encode_return (TYPETAG return_type)
       bug("b_encode_return: illegal return type");
   }
 
-  b_void_return ();
+  b_void_return (NULL);
 }
 
 
@@ -1768,9 +3389,33 @@ void b_alloc_arglist (int total_size)
         /* Only display total_size as this is more useful to the user */
     emit ("\t\t\t\t# b_alloc_arglist (%d bytes)", total_size);
 
+        /* The argument list must lie directly under whatever is pushed
+         * next, so nothing may stay cached above it. */
+    tos_flush ();
+
         /* push and initialize a new actual argument word count */
     actual_arg_word_count[++aaa_top] = 0;
     actual_arg_space[aaa_top] = arg_space;
+    actual_arg_saved_sp[aaa_top] = TRUE;
+
+        /* With -fdirect-args, see whether the alignment of %esp is known
+         * here from the code of the function so far (see frame.c).  If it
+         * is, padding the argument list by a constant aligns it, and the
+         * whole list is removed with a constant after the call.
+         * Otherwise (e.g., after a call made the long way below) the old
+         * %esp is saved and restored as usual. */
+    if (opt_direct_args) {
+	int pad = stack_align_pad (asm_records () + func_start_rec,
+				   asm_mark () - func_start_rec, FALSE);
+
+	if (pad >= 0) {
+	    actual_arg_space[aaa_top] = arg_space + pad;
+	    actual_arg_saved_sp[aaa_top] = FALSE;
+	    if (arg_space + pad > 0)
+		emit ("\tsubl\t$%d, %%esp", arg_space + pad);
+	    return;
+	}
+    }
 
         /* Function calls require 16-byte alignment of %esp, but we need
          * to recover the old %esp (before argument build) after the call.
@@ -1864,6 +3509,15 @@ void b_load_arg (TYPETAG type)
     case TYDOUBLE:
             /* Move 4 bytes at a time, because destination may not be
              * 8-byte aligned */
+	tos_flush ();
+	    /* With -fdirect-args, the value may go straight into its slot,
+	     * which lies under the stack top */
+	if (opt_direct_args
+	    && store_double_to (4*word_count + STACK_ITEM, "%esp")) {
+	    b_pop ();
+	    word_count += 2;
+	    break;
+	}
 	emit ("\tmovl\t(%%esp), %%eax");
         emit ("\tmovl\t4(%%esp), %%edx");
         b_pop ();
@@ -1877,9 +3531,16 @@ void b_load_arg (TYPETAG type)
     case TYSIGNEDLONGINT:
     case TYUNSIGNEDLONGINT:
     case TYPTR:
-	emit ("\tmovl\t(%%esp), %%eax");
-	b_pop ();
-	emit ("\tmovl\t%%eax, %d(%%esp)", 4*word_count);
+	if (opt_tos_cache) {
+	    int r = tos_pop_reg (type);
+	    emit ("\tmovl\t%s, %d(%%esp)", reg32[r], 4*word_count);
+	    tos_release (r);
+	}
+	else {
+	    emit ("\tmovl\t(%%esp), %%eax");
+	    b_pop ();
+	    emit ("\tmovl\t%%eax, %d(%%esp)", 4*word_count);
+	}
 	word_count++;
 	break;
     default:
@@ -1893,6 +3554,24 @@ void b_load_arg (TYPETAG type)
 
 
 
+/* b_load_arg_const_int is like b_push_const_int followed by b_load_arg
+   (TYSIGNEDLONGINT), but stores the constant straight into its place in
+   the argument list. */
+
+
+void b_load_arg_const_int (int value)
+{
+    int word_count = actual_arg_word_count[aaa_top];
+
+    emit ("\t\t\t\t# b_load_arg_const_int (%d)", value);
+
+    emit ("\tmovl\t$%d, %d(%%esp)", value, 4*word_count);
+    actual_arg_word_count[aaa_top] = word_count + 1;
+}
+
+
+
+
 /* b_funcall_by_name accepts a function name and a
    return type for the function.  It emits code to jump to 
    that function, pop any space off the stack used for actual
@@ -1920,6 +3599,8 @@ void b_funcall_by_name (char *f_name, TYPETAG return_type)
   my_print_typetag (return_type);
   emit  (")");
 
+  tos_flush ();
+
   /* Call the function.  It is assumed that %esp is the base of the
    * argument list and is 16-byte aligned. */
   emit ("\tcall\t%s", f_name);
@@ -1961,6 +3642,15 @@ void b_funcall_by_ptr (TYPETAG return_type)
   my_print_typetag (return_type);
   emit  (")");
 
+  if (opt_tos_cache) {
+      int r = tos_pop_reg (TYPTR);
+      tos_flush ();
+      emit ("\tcall\t*%s", reg32[r]);
+      tos_release (r);
+      post_call_clean_up (return_type, FALSE);
+      return;
+  }
+
   emit ("\tmovl\t(%%esp), %%eax");   /* load procedure value */
   b_pop ();                               /* pop from stack */
 
@@ -1973,6 +3663,187 @@ void b_funcall_by_ptr (TYPETAG return_type)
 
 
 
+/* Tail calls.
+ *
+ * A call that is the last thing a function does need not come back to
+ * it.  A call of the function itself (b_tail_call_self) stores the new
+ * argument values in its parameters and jumps back to the start of its
+ * body, so the recursion becomes a loop.  A call of another function
+ * (b_tail_call_by_name) stores the arguments over the function's own,
+ * leaves the function and jumps to the callee, which then returns
+ * straight to our caller.  Either way, the stack does not grow with the
+ * depth of the calls, and no argument list is built or removed.
+ *
+ * The front end only knows that a call is the last statement of a body
+ * once the code for it has been generated, so it marks the code of
+ * each call statement (b_code_mark) and takes it back (b_retract_code)
+ * to generate the tail call instead. */
+
+
+/* Returns the position in the buffered code that the next line will
+   take */
+int b_code_mark (void)
+{
+  return asm_mark ();
+}
+
+
+/* Returns TRUE if no code but comments has been generated from the mark
+   start to the mark end */
+BOOLEAN b_code_is_empty (int start, int end)
+{
+  ASM_LIST *recs = asm_records ();
+  int i;
+
+  for (i = start; i < end; i++)
+      if (recs[i]->kind != AK_COMMENT && recs[i]->kind != AK_DEBUG)
+	  return FALSE;
+  return TRUE;
+}
+
+
+/* If no code but comments and labels has been generated since the mark
+   end, deletes the code from the mark start to end and returns TRUE;
+   otherwise returns FALSE.  The labels are taken out too, and put back
+   after the tail call that follows (end_tail_call), so that the other
+   paths through the function still reach its end.  The state of the back
+   end must be the same at both marks. */
+BOOLEAN b_retract_code (int start, int end)
+{
+  ASM_LIST *recs = asm_records ();
+  int i;
+
+  for (i = end; i < asm_mark (); i++)
+      if (recs[i]->kind != AK_COMMENT && recs[i]->kind != AK_DEBUG
+	  && recs[i]->kind != AK_LABEL)
+	  return FALSE;
+  for (i = start; i < end; i++)
+      recs[i]->deleted = TRUE;
+
+      /* Labels reached from elsewhere go after the tail call */
+  moved_from = end;
+  moved_to = asm_mark ();
+  for (i = moved_from; i < moved_to; i++)
+      if (recs[i]->kind == AK_LABEL)
+	  recs[i]->deleted = TRUE;
+  return TRUE;
+}
+
+
+/* Ends a tail call: puts back the labels retracted with its code, and
+   returns TRUE if there are none, so nothing else reaches the end of the
+   function. */
+static BOOLEAN end_tail_call (void)
+{
+  ASM_LIST *recs = asm_records ();
+  BOOLEAN moved = FALSE;
+  int i;
+
+  for (i = moved_from; i < moved_to; i++)
+      if (recs[i]->kind == AK_LABEL) {
+	  emit ("%s:", recs[i]->op);
+	  moved = TRUE;
+      }
+  moved_from = moved_to = 0;
+  tail_called = !moved;
+  return tail_called;
+}
+
+
+/* Pops the value of the given type on top of the stack into offset(%ebp),
+   where it takes size bytes */
+static void pop_to_frame (TYPETAG type, int offset, int size)
+{
+  if (tos_cacheable (type)) {
+      int r = tos_pop_reg (type);
+      emit ("\tmovl\t%s, %d(%%ebp)", reg32[r], offset);
+      tos_release (r);
+      return;
+  }
+
+  tos_flush ();
+  emit ("\tmovl\t(%%esp), %%eax");
+  emit ("\tmovl\t%%eax, %d(%%ebp)", offset);
+  if (size > 4) {
+      emit ("\tmovl\t4(%%esp), %%eax");
+      emit ("\tmovl\t%%eax, %d(%%ebp)", offset + 4);
+  }
+  b_pop ();
+}
+
+
+BOOLEAN b_tail_call_self (int nparams, TYPETAG types[], int offsets[])
+{
+  int i;
+
+  emit ("\t\t\t\t# b_tail_call_self (%d params)", nparams);
+
+  if (body_rec < 0)
+      bug("b_tail_call_self: no function body");
+
+      /* The last value is on top */
+  for (i = nparams - 1; i >= 0; i--)
+      pop_to_frame (types[i], offsets[i],
+		    types[i] == TYFLOAT || types[i] == TYDOUBLE ? 8 : 4);
+  tos_flush ();
+
+  if (body_label == NULL) {
+      ASM_LIST rec = asm_records ()[body_rec];
+
+      body_label = new_symbol ();
+      asm_set_label (rec, body_label);
+      rec->deleted = FALSE;
+  }
+  emit ("\tjmp\t%s", body_label);
+  return end_tail_call ();
+}
+
+
+/* Returns the offset from the start of an argument list of each of the
+   arguments of the given types, and the size of the list */
+static int arg_offsets (int nargs, TYPETAG types[], int offsets[])
+{
+  int i, size = 0;
+
+  for (i = 0; i < nargs; i++) {
+      offsets[i] = size;
+      size += types[i] == TYDOUBLE ? 8 : 4;
+  }
+  return size;
+}
+
+
+BOOLEAN b_tail_call_fits (int nargs, TYPETAG types[])
+{
+  int offsets[nargs];
+
+  return arg_offsets (nargs, types, offsets) <= caller_offset - FUNC_LINK_OFFSET;
+}
+
+
+BOOLEAN b_tail_call_by_name (char *f_name, int nargs, TYPETAG types[])
+{
+  int offsets[nargs];
+  int i;
+
+  emit ("\t\t\t\t# b_tail_call_by_name (%s, %d args)", f_name, nargs);
+
+  if (!b_tail_call_fits (nargs, types))
+      bug("b_tail_call_by_name: arguments do not fit");
+
+  arg_offsets (nargs, types, offsets);
+  for (i = nargs - 1; i >= 0; i--)
+      pop_to_frame (types[i], FUNC_LINK_OFFSET + offsets[i],
+		    types[i] == TYDOUBLE ? 8 : 4);
+  tos_flush ();
+
+  b_void_return (f_name);
+  return end_tail_call ();
+}
+
+
+
+
 
 
 /* b_global_decl emits the pseudo-op .data if beginning a data
@@ -2140,9 +4011,8 @@ void emit( char *format, ... )
 {
         va_list ap;  
 	va_start (ap, format);
-	vfprintf(outfp, format, ap);
+	asm_vprintf (format, ap, TRUE);
 	va_end (ap);
-	putc ('\n', outfp);
 }
      
 
@@ -2157,7 +4027,7 @@ void emitn( char *format, ... )
 {
         va_list ap;  
 	va_start (ap, format);
-	vfprintf(outfp, format, ap);
+	asm_vprintf (format, ap, FALSE);
 	va_end (ap);
 		
 }
@@ -2172,7 +4042,10 @@ void emitn( char *format, ... )
 
 void b_label (char *label)
 {
+  tos_flush ();
   emit ("%s:", label);
+      /* A label after a tail call leads to the end of the function */
+  tail_called = FALSE;
 }
 
 
@@ -2212,21 +4085,26 @@ char *new_symbol ()
 static void post_call_clean_up (TYPETAG return_type, BOOLEAN is_name)
 {
   int arg_space;
+  BOOLEAN saved_sp;
 
   /* Get actual space that was allocated on the stack for actual args.
      Pop this and the current word count at the same time; we no longer
      need the latter, since we're done loading actual arguments. */
-  arg_space = actual_arg_space[aaa_top--];
+  arg_space = actual_arg_space[aaa_top];
+  saved_sp = actual_arg_saved_sp[aaa_top--];
 
   /* Upon return, remove argument list built for the call */
-  emit ("\taddl\t$%d, %%esp", arg_space);
+  if (saved_sp || arg_space > 0)
+      emit ("\taddl\t$%d, %%esp", arg_space);
 
       /* The original value of %esp (before the argument build) is stored
        * right here.  Pop it and restore the original %esp.  Use %ecx as
        * the temporary register so as not to trash the return value stored
        * in %eax or in (%edx,%eax) */
-  emit ("\tmovl\t(%%esp), %%ecx");
-  emit ("\tmovl\t%%ecx, %%esp");
+  if (saved_sp) {
+      emit ("\tmovl\t(%%esp), %%ecx");
+      emit ("\tmovl\t%%ecx, %%esp");
+  }
   
   #if 0
   align_16_adjust = (arg_space%16 != 0);
@@ -2234,6 +4112,15 @@ static void post_call_clean_up (TYPETAG return_type, BOOLEAN is_name)
 
   if (return_type == TYVOID)
       return;
+
+      /* With caching, a word-sized return value just stays in %eax */
+  if (tos_cacheable (return_type) && return_type != TYFLOAT) {
+      if (return_type==TYSIGNEDCHAR || return_type==TYUNSIGNEDCHAR)
+	  emit ("\tmov%sbl\t%%al, %%eax", return_type==TYSIGNEDCHAR?"s":"z");
+      reg_busy[REG_EAX] = TRUE;
+      tos_push_reg (REG_EAX);
+      return;
+  }
   
       /* Non-void return.  Make room to push the return value. */
   b_push ();
@@ -2271,8 +4158,8 @@ static void post_call_clean_up (TYPETAG return_type, BOOLEAN is_name)
 
 static void divide_by_size(unsigned int size)
 {
-    int shift, i;
-    unsigned int cur, prev;
+    int shift;
+    unsigned int i, cur, prev;
 
     if (size == 0)
 	bug("b_ptr_arith_op: size must be positive");
@@ -2312,14 +4199,42 @@ static void divide_by_size(unsigned int size)
 
 
 
+/* b_source_file names the source file for the line numbers that -g
+   emits (see b_lineno_comment).  It should be called once, before any
+   other back-end routine.  Nothing is generated without -g. */
+
+
+void b_source_file (char *name)
+{
+  if (!opt_debug)
+    return;
+  emit ("\t.file\t\"%s\"", name);
+  emit ("\t.file\t1 \"%s\"", name);
+}
+
+
+
+
+
 /* b_lineno_comment generates a comment in the assembly code, displaying
    the given number.  It should be called from scan.l to generate the number
-   of the new line as soon as a '\n' is detected in the source file. */
+   of the new line as soon as a '\n' is detected in the source file.
+   With -g, it also generates a .loc directive for the line in code.
+   The comment is left out if -fverbose-asm is none. */
 
 
 void b_lineno_comment (int lineno)
 {
-  emit (" #%5d", lineno);
+  char text[24];
+
+  if (opt_debug && asm_section == SEC_TEXT) {
+    sprintf (text, "\t.loc\t1 %d", lineno);
+    asm_line (text);
+  }
+  if (opt_verbose_asm == VERBOSE_NONE)
+    return;
+  sprintf (text, " #%5d", lineno);
+  asm_line (text);
 }
 
 
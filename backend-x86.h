@@ -19,9 +19,16 @@
    Pascal function is stored (also the offset of the first parameter) */
 #define FUNC_LINK_OFFSET 8
 
+/* Sizes (in bytes) of a pointer and of a long (Pascal Integer) */
+#define TARGET_PTR_SIZE 4
+#define TARGET_LONG_SIZE 4
+
 /* Maximum allowable depth of function call nesting */
 #define MAX_CALL_NEST  128
 
+/* Number of registers that can hold variables (see b_push_var_reg) */
+#define B_NUM_VAR_REGS 3
+
 /* Sections of the executable program */
 typedef enum { SEC_NONE, SEC_TEXT, SEC_RODATA, SEC_DATA } ASM_SECTION;
 
@@ -139,27 +146,66 @@ void b_push_ext_addr (char *id);
 */
 void b_push_loc_addr (int offset);
 
+/* b_push_display_addr accepts the nesting level of an enclosing function
+   (1 for a function declared in the main program) and the offset value
+   of one of its parameters or local variables, and emits code to push
+   the address of that variable onto the stack.  The enclosing function's
+   frame pointer is found in the display, so that function must call
+   b_enter_display.
+*/
+void b_push_display_addr (int level, int offset);
+
 /* b_push_const_int accepts an integer value and emits code to
    push that value onto the stack.
 */
 void b_push_const_int (int value);
 
 /* b_push_const_double accepts a double value and emits code to
-   push that value onto the stack.  It does this by generating a new 
-   label for the value, inserting a labeled double value (two .long's)
-   into the .rodata section, and pushing the 8-byte value at the label 
-   onto the stack.
+   push that value onto the stack.  It does this by interning the value
+   in the constant pool (see b_emit_const_pool), and pushing the 8-byte
+   value at its label onto the stack.
 */
 void b_push_const_double (double value);
 
 /* b_push_const_string accepts a string and emits code to "push
-   the string onto the stack."  It does this by generating a new 
-   label for the string, inserting a labeled line of ascii text 
-   into the .rodata section, and pushing the address of the label 
-   onto the stack.
+   the string onto the stack."  It does this by interning the string
+   in the constant pool (see b_emit_const_pool), and pushing the address
+   of its label onto the stack.
 */
 void b_push_const_string (char *string);
 
+/* b_emit_const_pool emits, in the .rodata section, all the constants
+   used by b_push_const_double and b_push_const_string.  Each distinct
+   value is emitted only once.  It must be called once, after all other
+   code for the compilation unit has been generated.
+*/
+void b_emit_const_pool (void);
+
+/* b_load_temp accepts a type and the offset (from the frame pointer) of
+   an 8-byte temporary in the local variable area, and emits code to push
+   the value of that type kept there by b_store_temp.
+*/
+void b_load_temp (TYPETAG type, int offset);
+
+/* Register variables.  Registers 0 to B_NUM_VAR_REGS-1 (%ebx, %esi and
+   %edi) can each hold a variable or temporary of an integer, character
+   or pointer type in place of a slot in the frame.  b_save_var_regs
+   accepts the number n of them used by the current function, counting
+   from 0, and emits code to save them in a new local slot, from which
+   they are put back on return; it should be called once, after the
+   local variables are allocated and before the body.  b_push_var_reg
+   pushes the value of the given type held in register reg,
+   b_assign_var_reg copies the value on top of the stack into it,
+   leaving the value there (as b_assign does), and b_inc_dec_var_reg
+   increments or decrements it as b_inc_dec does a variable in memory,
+   for an integer (not character) or pointer type.
+*/
+void b_save_var_regs (int n);
+void b_push_var_reg (TYPETAG type, int reg);
+void b_assign_var_reg (TYPETAG type, int reg);
+void b_inc_dec_var_reg (TYPETAG type, B_INC_DEC_OP idop, unsigned int size,
+			int reg);
+
 
 /***** Unary operators (one item popped) *****/
 
@@ -178,6 +224,12 @@ void b_offset (int offset);
 */
 void b_deref (TYPETAG type);
 
+/* b_store_temp accepts a type and the offset (from the frame pointer) of
+   an 8-byte temporary in the local variable area, and emits code to pop
+   the value of that type on top of the stack into it.
+*/
+void b_store_temp (TYPETAG type, int offset);
+
 /* b_convert accepts a from_type and a to_type and emits code to
    convert a value of type from_type to a value of type to_type.
    It assumes that there is a value of type from_type on the 
@@ -265,6 +317,16 @@ void b_assign (TYPETAG type);
 */
 void b_arith_rel_op (B_ARITH_REL_OP arop, TYPETAG type);
 
+/* b_arith_rel_op_const is b_arith_rel_op with a constant right operand:
+   it assumes that one value of the indicated type (the left operand) is
+   on the stack, pops it, applies the operator to it and value, and pushes
+   the result.  This is the same as b_push_const_int(value) followed by
+   b_arith_rel_op(arop, type), but the constant becomes an immediate
+   operand instead of being pushed.  The type must be an integer type, or
+   TYPTR for a relational operator.
+*/
+void b_arith_rel_op_const (B_ARITH_REL_OP arop, TYPETAG type, int value);
+
 
 /*****                                                                *****
  ***** Function defn, fcn call, local vars, param handling routines   *****
@@ -388,6 +450,23 @@ int b_alloc_local_vars (int size);
 */
 int b_get_local_var_offset();
 
+/* b_enter_display accepts the nesting level of the current function and
+   emits code to save its frame pointer in the display, the table from
+   which b_push_display_addr finds the frames of enclosing functions.  It
+   should be called right after b_alloc_local_vars(), and only in
+   functions whose parameters or local variables are used by functions
+   nested in them.  It allocates a local slot of its own, in which the
+   old display entry is kept until the function returns.
+*/
+void b_enter_display (int level);
+
+/* b_func_body marks the start of the body of the current function, after
+   its parameters are stored, its local variables allocated and the display
+   entered (if it is).  It must be called once in each function that may
+   make a tail call of itself, before any code for the body.
+*/
+void b_func_body (void);
+
 /* b_dealloc_local_vars accepts an integer and emits code to decrease the
    stack by that number of bytes.  The stack pointer is restored
    (if necessary) to quadword (8-byte) alignment.  The size value passed
@@ -462,6 +541,13 @@ void b_alloc_arglist (int total_size);
 */
 void b_load_arg (TYPETAG type);
 
+/* b_load_arg_const_int stores the integer constant value straight into
+   the argument list as the next argument, of type TYSIGNEDLONGINT.  It
+   does the job of b_push_const_int (value) followed by b_load_arg
+   (TYSIGNEDLONGINT), without going through the stack.
+*/
+void b_load_arg_const_int (int value);
+
 /* b_funcall_by_name accepts a function name and a
    return type for the function.  It emits code to jump to 
    that function, pop any space off the stack used for actual
@@ -525,6 +611,22 @@ void b_jump (char *label);
 */
 void b_cond_jump (TYPETAG type, B_COND cond, char *label);
 
+/* b_cond_jump_rel accepts a relational operator (B_EQ, B_NE, B_LT,
+   B_LE, B_GT, or B_GE), a type, and a label.  The type must be
+   TYSIGNEDINT, TYUNSIGNEDINT, TYSIGNEDLONGINT, TYUNSIGNEDLONGINT, or
+   TYPTR.  It assumes that two values of the type are on the stack, as
+   for b_arith_rel_op, pops them, and jumps to the label if they satisfy
+   the relation.  It does the same as b_arith_rel_op followed by
+   b_cond_jump with B_NONZERO, but without computing the 0 or 1.
+*/
+void b_cond_jump_rel (B_ARITH_REL_OP arop, TYPETAG type, char *label);
+
+/* b_cond_jump_rel_const is like b_cond_jump_rel, but the right operand
+   is the constant value instead of a second value on the stack.
+*/
+void b_cond_jump_rel_const (B_ARITH_REL_OP arop, TYPETAG type, int value,
+			    char *label);
+
 /* b_dispatch accepts a relational operator, a type, an integer
    comparison value, and a label.  The operator must be either B_EQ,
    B_NE, B_LT, B_LE, B_GT, or B_GE.  The type must be either
@@ -551,6 +653,28 @@ void b_cond_jump (TYPETAG type, B_COND cond, char *label);
 void b_dispatch (B_ARITH_REL_OP op, TYPETAG type, int cmp_value, char *label,
 		 BOOLEAN pop_on_jump);
 
+/* b_dispatch_bits is like b_dispatch, but tests the value v on the stack
+   (of the same types) for membership in a set of up to 32 values: it
+   jumps to the label if 0 <= v-lo < 32 and bit v-lo of mask is set.  For
+   example, with lo 3 and mask 0x5 it jumps if v is 3 or 5.
+*/
+void b_dispatch_bits (TYPETAG type, int lo, unsigned int mask, char *label,
+		      BOOLEAN pop_on_jump);
+
+/* b_jump_table pops the value v on the stack, of one of the types
+   accepted by b_dispatch, and jumps through a table of n labels: to
+   labels[v-lo] if lo <= v < lo+n, and to default_label otherwise.
+*/
+void b_jump_table (TYPETAG type, int lo, int n, char *labels[],
+		   char *default_label);
+
+/* b_dispatch_label is b_label for the target of a dispatch whose code is
+   emitted after the target, such as an arm of a case statement.  The
+   dispatch code starts at dispatch_label, which must already have been
+   jumped to, and pops the value dispatched on before jumping to label.
+*/
+void b_dispatch_label (char *label, char *dispatch_label);
+
 /* b_encode_return encodes a return statement in a function.  The type
    argument is the type of the return expression (after assignment
    conversion to the return type of the function) if there is one.  If
@@ -589,6 +713,16 @@ void b_encode_return (TYPETAG return_type);
 */
 void b_ptr_arith_op (B_ARITH_REL_OP arop, TYPETAG type, unsigned int size);
 
+/* b_check_index checks an array index on top of the stack, of type
+   TYSIGNEDINT, TYUNSIGNEDINT, TYSIGNEDLONGINT or TYUNSIGNEDLONGINT, from
+   which the low bound of its dimension has been subtracted: if it is not
+   below n as an unsigned number, the program stops with a trap.  The
+   index is left on the stack.  The traps are emitted out of the way, at
+   the end of the function, so an index in range costs a compare and a
+   branch not taken.
+*/
+void b_check_index (TYPETAG type, int n);
+
 /* b_funcall_by_ptr accepts the return type for a function, and when
    called, assumes that the entry address of the function is on top
    of the stack.  It emits code to pop the entry address and jump to 
@@ -613,6 +747,53 @@ void b_ptr_arith_op (B_ARITH_REL_OP arop, TYPETAG type, unsigned int size);
 */
 void b_funcall_by_ptr (TYPETAG return_type);
 
+/* b_code_mark returns a mark for the place in the code that the next
+   instruction will take.  b_retract_code accepts two marks start and end,
+   taken in that order when the back end was in the same state; if no
+   code but comments and labels has been emitted since end, it deletes
+   the code between start and end and returns TRUE, and otherwise it
+   returns FALSE.  The labels are moved past the tail call that must be
+   made next.  These let the caller replace the code of a call statement
+   by a tail call once it knows that nothing follows the statement.
+*/
+int b_code_mark (void);
+BOOLEAN b_retract_code (int start, int end);
+
+/* b_code_is_empty accepts two marks from b_code_mark, and returns TRUE if
+   no code but comments has been emitted between them.
+*/
+BOOLEAN b_code_is_empty (int start, int end);
+
+/* b_tail_call_self makes a call of the current function that is the last
+   thing the function does: it pops nparams values off the stack, the last
+   on top, each of the type of the corresponding parameter (types[i], not
+   promoted), into the parameters at offsets[i] (as returned by
+   b_store_formal_param), and jumps back to the start of the body (see
+   b_func_body).  No argument list is allocated for it.  Parameters passed
+   by reference take the TYPTR address of the variable.  Returns TRUE if
+   the end of the function can no longer be reached, and FALSE if labels
+   retracted by b_retract_code still lead there.
+*/
+BOOLEAN b_tail_call_self (int nparams, TYPETAG types[], int offsets[]);
+
+/* b_tail_call_fits accepts the (promoted) types of the nargs arguments of
+   a call, and returns TRUE if they take no more argument words than the
+   current function's own, so that b_tail_call_by_name can be used.
+*/
+BOOLEAN b_tail_call_fits (int nargs, TYPETAG types[]);
+
+/* b_tail_call_by_name makes a call of the function f_name that is the last
+   thing the current function does.  It pops nargs argument values off the
+   stack, the last on top, of the (promoted) types types[i], puts them
+   where f_name expects them, in place of the current function's own
+   arguments, and leaves the current function by jumping to f_name, which
+   returns to the current function's caller.  The return value, if any,
+   is left as f_name returns it.  No argument list is allocated for it,
+   and b_tail_call_fits must return TRUE for the arguments.  Returns as
+   b_tail_call_self does.
+*/
+BOOLEAN b_tail_call_by_name (char *f_name, int nargs, TYPETAG types[]);
+
 
 
 /**************************
@@ -637,9 +818,17 @@ void emit( char *format, ... );
 */ 
 void emitn( char *format, ... );
 
+/* b_source_file names the source file for the line numbers that -g
+   emits (see b_lineno_comment).  It should be called once, before any
+   other back-end routine.  Nothing is generated without -g.
+*/
+void b_source_file (char *name);
+
 /* b_lineno_comment generates a comment in the assembly code, displaying
    the given number.  It should be called from scan.l to generate the number
    of the new line as soon as a '\n' is detected in the source file.
+   With -g, it also generates a .loc directive for the line in code.
+   The comment is left out if -fverbose-asm is none.
 */
 void b_lineno_comment (int lineno);
 
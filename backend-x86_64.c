@@ -0,0 +1,3119 @@
+/*
+ *
+ *   backend-x86_64.c
+ *
+ *   backend functions for compiler construction, x86-64 (System V ABI)
+ *
+ *   This implements the same interface as backend-x86.c.  The control
+ *   stack still holds one 8-byte item per value, so the code below mostly
+ *   mirrors its i386 counterpart, with these differences:
+ *
+ *     - longs (Pascal Integer) and pointers are 64 bits wide;
+ *     - global variables and constants are addressed relative to %rip;
+ *     - the first six integer/pointer arguments and the first eight
+ *       floating point arguments are passed in registers;
+ *     - floating point arithmetic always uses SSE2, and floating point
+ *       values are returned in %xmm0.
+ *
+ */
+
+
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "defs.h"
+#include "types.h"
+#include "message.h"
+#include "options.h"
+#include "asmbuf.h"
+#include "frame.h"
+/* defined in defs.h */
+#include BACKEND_HEADER_FILE
+
+/* Override external b_pop() definition with internal one. */
+#undef   b_pop
+#define  b_pop()  b_internal_pop(FALSE)
+
+
+#define errfp stderr
+extern FILE *outfp;	   /* outfp is the file to which the code that
+			      emit and emitn buffer is sent.  main()
+			      sets it to stdout or the -o file.  */
+
+/* Size (in bytes) of a single stack item */
+#define STACK_ITEM 8
+
+/* Number of integer and floating point argument registers */
+#define NUM_INT_ARG_REGS 6
+#define NUM_FLOAT_ARG_REGS 8
+
+/* Space at the bottom of an argument list build where the values of
+   register arguments are kept until the call (see b_alloc_arglist) */
+#define REG_SAVE_SIZE (STACK_ITEM*(NUM_INT_ARG_REGS+NUM_FLOAT_ARG_REGS))
+
+static char *int_arg_reg[NUM_INT_ARG_REGS] =
+    { "%rdi", "%rsi", "%rdx", "%rcx", "%r8", "%r9" };
+
+/* Stacks for the argument list builds in progress, with common top index
+   aaa_top.  A stack is necessary because function calls may be nested.
+       actual_arg_int_regs - integer argument registers used so far
+       actual_arg_float_regs - floating point argument registers used so far
+       actual_arg_word_count - 8-byte words of stack arguments so far
+       actual_arg_space - space for stack arguments (below the register
+                          save area)
+       actual_arg_pad - padding above the register save area, or -1 if
+                        the old %rsp is saved there instead
+*/
+static int actual_arg_int_regs[MAX_CALL_NEST];
+static int actual_arg_float_regs[MAX_CALL_NEST];
+static int actual_arg_word_count[MAX_CALL_NEST];
+static int actual_arg_space[MAX_CALL_NEST];
+static int actual_arg_pad[MAX_CALL_NEST];
+static int aaa_top = -1;
+
+/* These vars give various offsets from the frame pointer %rbp:
+       return_value_offset - where the return value of the function
+                           can be stored and updated
+       reg_param_offset - where register formal params are stored in
+                          callee's frame
+       caller_offset - where stack formal params are (in caller's frame)
+       loc_var_offset - offsets of local vars
+
+   They play the same roles as in backend-x86.c.  formal_int_reg and
+   formal_float_reg count the argument registers taken by the formal
+   parameters seen so far.
+*/
+static int return_value_offset = 0;	/* Guaranteed illegal value */
+static int reg_param_offset;
+static int caller_offset;
+static int loc_var_offset = 1;  /* Positive value is guaranteed illegal */
+static int formal_int_reg;
+static int formal_float_reg;
+
+/* Indices in the output buffer (see asmbuf.h) of the current function's
+   first record and of the instruction that allocated its return value
+   slot (-1 if none).  frame.c uses them to rewrite leaf functions. */
+static int func_start_rec;
+static int return_slot_rec = -1;
+
+/* The display (see b_enter_display in backend-x86.c) is a table at
+   DISPLAY_LABEL holding the frame pointer of the latest activation at
+   each nesting level from 1 to display_size that keeps its frame there.
+   display_level is the level of the current function if it does so, and
+   -1 otherwise; display_save_offset is where it saves the old entry. */
+#define DISPLAY_LABEL ".Ldisplay"
+static int display_size = 0;
+static int display_level = -1;
+static int display_save_offset;
+
+/* Tail calls (see b_tail_call_self in backend-x86.c).  body_rec is the
+   output buffer index of the place held for the label at the start of
+   the current function's body (-1 if none), body_label that label once
+   it is jumped to, and tail_called TRUE if the function ends with a tail
+   call.  The labels in the records from moved_from to moved_to are to be
+   moved past the next tail call. */
+static int body_rec = -1;
+static char *body_label;
+static BOOLEAN tail_called;
+static int moved_from, moved_to;
+
+/* The out-of-line traps of the current function's index checks: the
+   label of each, and the output buffer index of the jump to it (see
+   b_check_index in backend-x86.c) */
+static char **trap_labels;
+static int *trap_recs;
+static int ntraps = 0, traps_size = 0;
+
+
+/* asm_section keeps track of the current section in the assembler. */
+static ASM_SECTION asm_section = SEC_NONE;
+
+
+/* Temporary location for storing floats */
+static float global_float_val;
+
+
+/* Function to calculate the least multiple of m that is >= x.
+   Assumes m>0 and x>=0. */
+static int next_multiple(int x, int m)
+{
+  x += m-1;
+  return x - x%m;
+}
+
+/* Handle clean-up after a function call (called from both
+   b_funcall_by_name() and b_funcall_by_ptr()). */
+static void post_call_clean_up (TYPETAG return_type, BOOLEAN is_name);
+
+/* Loads the argument registers from the register save area of the
+   current argument list build, just before the call. */
+static void load_arg_regs (void);
+
+/* Same as in backend-x86.c, but for 64-bit differences in %rax. */
+static void divide_by_size(unsigned int size);
+
+
+
+/* Constant pool of interned floating point and string literals, emitted
+ * at the end of the compilation unit; see backend-x86.c. */
+
+typedef struct const_rec {
+    char *label;
+    BOOLEAN is_string;
+    double dval;
+    char *sval;
+    struct const_rec *next, *hash_next;
+} CONST_REC, *CONST_LIST;
+
+static CONST_LIST const_pool = NULL;
+static CONST_LIST *const_pool_end = &const_pool;
+
+/* The pool entries hashed by value (the bit pattern of a double, the
+   characters of a string) */
+#define CONST_HASH 1024
+static CONST_LIST const_hash[CONST_HASH];
+
+static unsigned int hash_const (BOOLEAN is_string, double dval, char *sval)
+{
+  unsigned char *c = is_string ? (unsigned char *) sval
+			       : (unsigned char *) &dval;
+  int n = is_string ? strlen (sval) : sizeof(double);
+  unsigned int h = is_string;
+
+  while (n-- > 0)
+      h = h * 31 + *c++;
+  return h % CONST_HASH;
+}
+
+/* Returns the pool entry equal to the given constant, adding it first
+   if necessary */
+static CONST_LIST intern_const (BOOLEAN is_string, double dval, char *sval)
+{
+  unsigned int h = hash_const (is_string, dval, sval);
+  CONST_LIST p;
+
+  for (p = const_hash[h]; p != NULL; p = p->hash_next)
+      if (p->is_string == is_string &&
+	  (is_string ? !strcmp (p->sval, sval)
+		     : !memcmp (&p->dval, &dval, sizeof(double))))
+	  return p;
+
+  p = (CONST_LIST) malloc (sizeof(CONST_REC));
+  if (p == NULL)
+      bug ("intern_const: out of memory");
+  p->label = new_symbol ();
+  p->is_string = is_string;
+  p->dval = dval;
+  p->sval = is_string ? strdup (sval) : NULL;
+  p->next = NULL;
+  p->hash_next = const_hash[h];
+  const_hash[h] = p;
+  *const_pool_end = p;
+  const_pool_end = &p->next;
+  return p;
+}
+
+/* Emits the constant pool and flushes the buffered code.  Call once,
+   after all code has been generated. */
+void b_emit_const_pool (void)
+{
+  CONST_LIST p;
+
+  if (display_size > 0) {
+      emit ("\t\t\t\t# display (%d levels)", display_size);
+      emit ("\t.data");
+      asm_section = SEC_DATA;
+      emit ("\t.align\t%d", TARGET_PTR_SIZE);
+      emit ("%s:", DISPLAY_LABEL);
+      emit ("\t.zero\t%d", display_size * TARGET_PTR_SIZE);
+  }
+
+  if (const_pool == NULL) {
+      asm_flush (outfp, TRUE);
+      return;
+  }
+
+  emit ("\t\t\t\t# b_emit_const_pool ()");
+  emit ("\t.section\t.rodata");
+  asm_section = SEC_RODATA;
+
+      /* Doubles first, so that one .align covers them all */
+  emit ("\t.align\t%d", sizeof(double));
+  for (p = const_pool; p != NULL; p = p->next)
+      if (!p->is_string) {
+	  emit ("%s:", p->label);
+	  b_alloc_double (p->dval);
+      }
+  for (p = const_pool; p != NULL; p = p->next)
+      if (p->is_string) {
+	  emit ("%s:", p->label);
+	  emit (".string\t\"%s\"", p->sval);
+      }
+  asm_flush (outfp, TRUE);
+}
+
+
+
+/* Makes room on the stack for a temporary value */
+static void b_push()
+{
+    emit ("\tsubq\t$%d, %%rsp", STACK_ITEM);
+}
+
+
+/* Operand size suffix of integer instructions on a value of the type
+   (which must be an integer or pointer type) */
+static char *int_sfx (TYPETAG type)
+{
+  switch (type) {
+  case TYSIGNEDLONGINT:
+  case TYUNSIGNEDLONGINT:
+  case TYPTR:
+      return "q";
+  default:
+      return "l";
+  }
+}
+
+/* The %rax register of the same width as int_sfx(type) */
+static char *int_rax (TYPETAG type)
+{
+  return *int_sfx(type)=='q' ? "%rax" : "%eax";
+}
+
+/* Instruction suffix ("sd" or "ss") for SSE2 operations on the type */
+#define SSE_SFX(type) ((type)==TYDOUBLE?"sd":"ss")
+
+
+
+/* Removes and discards a value from the top of the stack.  If passed TRUE,
+   a comment is placed in the assembly code. */
+
+void b_internal_pop (BOOLEAN display_flag)
+{
+  if (display_flag)
+    emit ("\t\t\t\t# b_pop ()");
+
+  emit ("\taddq\t$%d, %%rsp", STACK_ITEM);
+}
+
+
+
+/* b_jump accepts a label and emits an unconditional jump to
+   that label.  */
+
+
+void b_jump (char *label)
+{
+  emit ("\t\t\t\t# b_jump ( destination = %s )", label);
+
+  emit ("\tjmp\t%s", label);
+}
+
+
+
+
+
+/* b_cond_jump accepts a TYPETAG, a B_COND (B_ZERO or B_NONZERO),
+   and a label.  It pops a value of the type off the stack and jumps
+   to the label if the value is zero (B_ZERO) or nonzero (B_NONZERO). */
+
+
+void b_cond_jump (TYPETAG type, B_COND cond, char *label)
+{
+  emitn ("\t\t\t\t# b_cond_jump (");
+  my_print_typetag (type);
+  emit (", %s,", cond == B_ZERO ? "ZERO" : "NON-ZERO");
+  emit  ("\t\t\t\t#              %s)", label);
+
+  switch (type) {
+
+  case TYSIGNEDCHAR:
+  case TYUNSIGNEDCHAR:
+  case TYSIGNEDINT:
+  case TYUNSIGNEDINT:
+  case TYSIGNEDLONGINT:
+  case TYUNSIGNEDLONGINT:
+  case TYPTR:
+      emit ("\tmov%s\t(%%rsp), %s",
+            type==TYSIGNEDCHAR?"sbl":type==TYUNSIGNEDCHAR?"zbl":int_sfx(type),
+            int_rax(type));
+      b_pop ();
+      emit ("\ttest%s\t%s, %s", int_sfx(type), int_rax(type), int_rax(type));
+      emit ("\tj%s\t%s", cond==B_ZERO?"e":"ne", label);
+      break;
+
+  case TYFLOAT:
+  case TYDOUBLE:
+      emit ("\tmov%s\t(%%rsp), %%xmm0", SSE_SFX(type));
+      b_pop ();
+      emit ("\txorps\t%%xmm1, %%xmm1");
+      emit ("\tucomi%s\t%%xmm1, %%xmm0", SSE_SFX(type));
+          /* NaN compares unordered (PF set), and is nonzero */
+      if (cond==B_ZERO) {
+          char *temp_label = new_symbol();
+          emit ("\tjp\t%s", temp_label);
+          emit ("\tje\t%s", label);
+          b_label (temp_label);
+      }
+      else {
+          emit ("\tjp\t%s", label);
+          emit ("\tjne\t%s", label);
+      }
+      break;
+
+  default:
+      bug ("b_cond_jump: illegal typetag");
+  }
+}
+
+
+
+
+
+
+/* Tells whether value can be the immediate operand of a 64-bit
+   instruction, which is sign-extended from 32 bits.  A constant that
+   cannot is loaded into a register with movabsq instead. */
+static BOOLEAN fits_imm32 (long value)
+{
+  return value == (long) (int) value;
+}
+
+
+/* b_dispatch compares the integer value on top of the stack with
+   cmp_value, and jumps to the label if the relation holds, popping the
+   value first if pop_on_jump.  See backend-x86_64.h for details. */
+
+
+void b_dispatch (B_ARITH_REL_OP op, TYPETAG type, long cmp_value, char *label,
+		 BOOLEAN pop_on_jump)
+{
+  char *temp_label = new_symbol();
+  char *jmp_suffix;
+  BOOLEAN is_signed;
+
+  emitn ("\t\t\t\t# b_dispatch ( %s,", b_arith_rel_op_string(op));
+  my_print_typetag (type);
+  emit  (", %ld, %s, %s )", cmp_value, label,
+	 pop_on_jump ? "pop on jump" : "no pop on jump");
+
+  switch (type) {
+  case TYSIGNEDINT:
+  case TYSIGNEDLONGINT:
+      is_signed = TRUE;
+      break;
+  case TYUNSIGNEDINT:
+  case TYUNSIGNEDLONGINT:
+      is_signed = FALSE;
+      break;
+  default:
+      bug ("unsupported type in b_dispatch");
+  }
+
+      /* The jmp_suffix must have the opposite (negated) sense of the
+       * comparison, because we use it to branch around an unconditional
+       * jump to the label. */
+  switch (op) {
+  case B_EQ:
+      jmp_suffix = "ne";
+      break;
+  case B_NE:
+      jmp_suffix = "e";
+      break;
+  case B_LT:
+      jmp_suffix = is_signed?"ge":"ae";
+      break;
+  case B_LE:
+      jmp_suffix = is_signed?"g":"a";
+      break;
+  case B_GT:
+      jmp_suffix = is_signed?"le":"be";
+      break;
+  case B_GE:
+      jmp_suffix = is_signed?"l":"b";
+      break;
+  default:
+      bug("b_dispatch: illegal comparison operator: %s",
+	  b_arith_rel_op_string(op));
+  }
+
+  if (fits_imm32 (cmp_value))
+      emit ("\tcmp%s\t$%ld, (%%rsp)", int_sfx(type), cmp_value);
+  else {
+      emit ("\tmovabsq\t$%ld, %%rax", cmp_value);
+      emit ("\tcmpq\t%%rax, (%%rsp)");
+  }
+  emit ("\tj%s\t%s", jmp_suffix, temp_label);
+  if (pop_on_jump)
+      b_pop ();
+  b_jump (label);
+  b_label (temp_label);
+}
+
+
+
+
+/* Subtracts the constant lo from the value of the given type in %rax,
+   using %rdx for a constant that is not an immediate. */
+static void sub_const_rax (TYPETAG type, long lo)
+{
+  if (lo == 0)
+      return;
+  if (fits_imm32 (lo))
+      emit ("\tsub%s\t$%ld, %s", int_sfx(type), lo, int_rax(type));
+  else {
+      emit ("\tmovabsq\t$%ld, %%rdx", lo);
+      emit ("\tsubq\t%%rdx, %%rax");
+  }
+}
+
+
+
+
+/* b_dispatch_bits is like b_dispatch, but jumps if the value v on the
+   stack is one of up to 32 values, those v for which 0 <= v-lo < 32 and
+   bit v-lo of mask is set.  The test is a bounds check and a bt
+   instruction. */
+
+
+void b_dispatch_bits (TYPETAG type, long lo, unsigned int mask, char *label,
+		      BOOLEAN pop_on_jump)
+{
+  char *temp_label = new_symbol();
+
+  emitn ("\t\t\t\t# b_dispatch_bits (");
+  my_print_typetag (type);
+  emit  (", %ld, 0x%x, %s, %s )", lo, mask, label,
+	 pop_on_jump ? "pop on jump" : "no pop on jump");
+
+  if (type!=TYSIGNEDINT && type!=TYSIGNEDLONGINT &&
+      type!=TYUNSIGNEDINT && type!=TYUNSIGNEDLONGINT)
+      bug ("unsupported type in b_dispatch_bits");
+
+  emit ("\tmov%s\t(%%rsp), %s", int_sfx(type), int_rax(type));
+  sub_const_rax (type, lo);
+  emit ("\tcmp%s\t$31, %s", int_sfx(type), int_rax(type));
+  emit ("\tja\t%s", temp_label);
+  emit ("\tmovl\t$%u, %%edx", mask);
+  emit ("\tbtl\t%%eax, %%edx");
+  emit ("\tjnc\t%s", temp_label);
+  if (pop_on_jump)
+      b_pop ();
+  b_jump (label);
+  b_label (temp_label);
+}
+
+
+
+
+/* b_jump_table pops the value v on the stack, of the given type, and
+   jumps to labels[v-lo] if 0 <= v-lo < n, or to default_label if not.
+   The table in .rodata holds 32-bit offsets of the labels from the table,
+   so it needs no relocations. */
+
+
+void b_jump_table (TYPETAG type, long lo, int n, char *labels[],
+		   char *default_label)
+{
+  char *table = new_symbol();
+  int i;
+
+  emitn ("\t\t\t\t# b_jump_table (");
+  my_print_typetag (type);
+  emit  (", %ld, %d, %s )", lo, n, default_label);
+
+  if (type!=TYSIGNEDINT && type!=TYSIGNEDLONGINT &&
+      type!=TYUNSIGNEDINT && type!=TYUNSIGNEDLONGINT)
+      bug ("unsupported type in b_jump_table");
+  if (n <= 0)
+      bug ("empty jump table in b_jump_table");
+
+  emit ("\tmov%s\t(%%rsp), %s", int_sfx(type), int_rax(type));
+  b_pop ();
+
+      /* One unsigned compare checks both bounds; it also leaves the
+       * index zero-extended in %rax */
+  sub_const_rax (type, lo);
+  emit ("\tcmp%s\t$%d, %s", int_sfx(type), n-1, int_rax(type));
+  emit ("\tja\t%s", default_label);
+  emit ("\tleaq\t%s(%%rip), %%rdx", table);
+  emit ("\tmovslq\t(%%rdx,%%rax,4), %%rax");
+  emit ("\taddq\t%%rdx, %%rax");
+  emit ("\tjmp\t*%%rax");
+
+  emit ("\t.section\t.rodata");
+  emit ("\t.align\t4");
+  emit ("%s:", table);
+  for (i = 0; i < n; i++)
+      emit ("\t.long\t%s-%s", labels[i], table);
+  emit ("\t.text");
+}
+
+
+
+
+/* b_dispatch_label is b_label for a label that code emitted later at
+   dispatch_label jumps to after popping the value dispatched on, as the
+   arms of a case statement are emitted before their dispatch code.  It
+   lets the stack alignment tracking of -fdirect-args (see frame.c) know
+   the stack depth at the label ahead of time. */
+
+
+void b_dispatch_label (char *label, char *dispatch_label)
+{
+  if (opt_direct_args)
+      stack_align_label (asm_records () + func_start_rec,
+			 asm_mark () - func_start_rec, TRUE,
+			 label, dispatch_label, STACK_ITEM);
+  b_label (label);
+}
+
+
+
+
+
+/* b_duplicate pushes a duplicate of the datum currently on the stack.
+   Every stack item is 8 bytes, so the type does not matter here. */
+
+
+void b_duplicate (TYPETAG type)
+{
+  emitn ("\t\t\t\t# b_duplicate (");
+  my_print_typetag(type);
+  emit (")");
+
+  switch (type) {
+  case TYSIGNEDCHAR:
+  case TYUNSIGNEDCHAR:
+  case TYSIGNEDSHORTINT:
+  case TYUNSIGNEDSHORTINT:
+  case TYSIGNEDINT:
+  case TYUNSIGNEDINT:
+  case TYSIGNEDLONGINT:
+  case TYUNSIGNEDLONGINT:
+  case TYPTR:
+  case TYFLOAT:
+  case TYDOUBLE:
+      emit ("\tmovq\t(%%rsp), %%rax");
+      b_push ();
+      emit ("\tmovq\t%%rax, (%%rsp)");
+      break;
+
+  default:
+      bug ("unsupported type in b_duplicate");
+  }
+}
+
+
+
+
+
+
+/* b_push_ext_addr accepts a global variable name and emits
+   code to push the address of that variable onto the stack.  */
+
+
+void b_push_ext_addr (char *id)
+{
+  emit ("\t\t\t\t# b_push_ext_addr (%s)", id);
+
+  emit ("\tleaq\t%s(%%rip), %%rax", id);
+  b_push ();
+  emit ("\tmovq\t%%rax, (%%rsp)");
+}
+
+
+
+
+
+/* b_push_loc_addr accepts an offset value (from the frame pointer)
+   as parameter, and emits code to push the effective address offset(%rbp)
+   onto the stack. */
+
+
+void b_push_loc_addr (int offset)
+{
+  emit ("\t\t\t\t# b_push_loc_addr (offset = %d)", offset);
+
+  emit ("\tleaq\t%d(%%rbp), %%rax", offset);
+  b_push ();
+  emit ("\tmovq\t%%rax, (%%rsp)");
+}
+
+
+
+
+
+/* b_push_display_addr accepts the nesting level of an enclosing function
+   and an offset value from its frame pointer (as kept in the display),
+   and emits code to push the address of that parameter or local
+   variable onto the stack. */
+
+
+void b_push_display_addr (int level, int offset)
+{
+  emit ("\t\t\t\t# b_push_display_addr (level = %d, offset = %d)",
+	level, offset);
+
+  if (level < 1)
+      bug("b_push_display_addr: illegal level %d", level);
+  if (level > display_size)
+      display_size = level;
+
+  emit ("\tmovq\t%s+%d(%%rip), %%rax", DISPLAY_LABEL,
+	(level - 1) * TARGET_PTR_SIZE);
+  emit ("\tleaq\t%d(%%rax), %%rax", offset);
+  b_push ();
+  emit ("\tmovq\t%%rax, (%%rsp)");
+}
+
+
+
+
+/* b_offset accepts an offset value as a parameter, and assumes some
+   address is currently on the stack.  It pops the address and pushes
+   the result obtained by adding the offset to the address.  */
+
+
+void b_offset (int offset)
+{
+  emit ("\t\t\t\t# b_offset (offset = %d)", offset);
+
+  emit ("\taddq\t$%d, (%%rsp)", offset);
+}
+
+
+
+
+
+/* b_deref accepts a type.  It assumes that the address of
+   a variable of that type is on the stack.  It pops the
+   address and pushes the value stored at that address
+   onto the stack.   */
+
+
+void b_deref (TYPETAG type)
+{
+  emitn ("\t\t\t\t# b_deref (");
+  my_print_typetag (type);
+  emit (")");
+
+  emit ("\tmovq\t(%%rsp), %%rax");
+
+  switch (type) {
+
+  case TYSIGNEDCHAR:
+  case TYUNSIGNEDCHAR:
+    emit ("\tmov%sbl\t(%%rax), %%edx", type==TYSIGNEDCHAR?"s":"z");
+    emit ("\tmovb\t%%dl, (%%rsp)");
+    break;
+
+  case TYSIGNEDSHORTINT:
+  case TYUNSIGNEDSHORTINT:
+    emit ("\tmov%swl\t(%%rax), %%edx", type==TYSIGNEDSHORTINT?"s":"z");
+    emit ("\tmovw\t%%dx, (%%rsp)");
+    break;
+
+  case TYSIGNEDINT:
+  case TYUNSIGNEDINT:
+  case TYFLOAT:
+    emit ("\tmovl\t(%%rax), %%edx");
+    emit ("\tmovl\t%%edx, (%%rsp)");
+    break;
+
+  case TYSIGNEDLONGINT:
+  case TYUNSIGNEDLONGINT:
+  case TYPTR:
+  case TYDOUBLE:
+    emit ("\tmovq\t(%%rax), %%rdx");
+    emit ("\tmovq\t%%rdx, (%%rsp)");
+    break;
+
+  default:
+    bug ("unsupported type in b_deref");
+  }
+}
+
+
+
+
+
+/* b_store_temp pops the value on top of the stack into a temporary, and
+   b_load_temp pushes it back.  Either way the whole stack item moves. */
+
+
+void b_store_temp (TYPETAG type, int offset)
+{
+  emitn ("\t\t\t\t# b_store_temp (");
+  my_print_typetag (type);
+  emit (", offset = %d)", offset);
+
+  emit ("\tmovq\t(%%rsp), %%rax");
+  b_pop ();
+  emit ("\tmovq\t%%rax, %d(%%rbp)", offset);
+}
+
+
+void b_load_temp (TYPETAG type, int offset)
+{
+  b_push_loc_addr (offset);
+  b_deref (type);
+}
+
+
+
+
+
+/* Register variables: %rbx and %r12 to %r15, which the code otherwise
+   never uses, hold variables and temporaries chosen by the register
+   allocator.  A value narrower than 64 bits is kept zero- or
+   sign-extended to the whole register.  See backend-x86_64.h. */
+
+static char *var_reg64[B_NUM_VAR_REGS] =
+    { "%rbx", "%r12", "%r13", "%r14", "%r15" };
+static char *var_reg32[B_NUM_VAR_REGS] =
+    { "%ebx", "%r12d", "%r13d", "%r14d", "%r15d" };
+
+static int var_regs_saved = 0;
+static int var_regs_offset;
+
+
+void b_save_var_regs (int n)
+{
+  int i;
+
+  emit ("\t\t\t\t# b_save_var_regs (%d)", n);
+
+  if (n < 0 || n > B_NUM_VAR_REGS)
+      bug("b_save_var_regs: illegal number of registers %d", n);
+  if (n == 0)
+      return;
+
+  var_regs_offset = b_alloc_local_vars (n * 8);
+  var_regs_saved = n;
+  for (i = 0; i < n; i++) {
+      emit ("\tmovq\t%s, %d(%%rbp)", var_reg64[i], var_regs_offset + 8 * i);
+      if (opt_debug)
+	  emit ("\t.cfi_offset\t%s, %d", var_reg64[i],
+		var_regs_offset + 8 * i - 16);
+  }
+}
+
+
+void b_push_var_reg (TYPETAG type, int reg)
+{
+  emitn ("\t\t\t\t# b_push_var_reg (");
+  my_print_typetag (type);
+  emit (", %s)", var_reg64[reg]);
+
+  b_push ();
+  emit ("\tmovq\t%s, (%%rsp)", var_reg64[reg]);
+}
+
+
+void b_assign_var_reg (TYPETAG type, int reg)
+{
+  emitn ("\t\t\t\t# b_assign_var_reg (");
+  my_print_typetag (type);
+  emit (", %s)", var_reg64[reg]);
+
+  switch (type) {
+  case TYSIGNEDCHAR:
+      emit ("\tmovsbq\t(%%rsp), %s", var_reg64[reg]);
+      break;
+  case TYUNSIGNEDCHAR:
+      emit ("\tmovzbl\t(%%rsp), %s", var_reg32[reg]);
+      break;
+  case TYSIGNEDINT:
+      emit ("\tmovslq\t(%%rsp), %s", var_reg64[reg]);
+      break;
+  case TYUNSIGNEDINT:
+      emit ("\tmovl\t(%%rsp), %s", var_reg32[reg]);
+      break;
+  case TYSIGNEDLONGINT:
+  case TYUNSIGNEDLONGINT:
+  case TYPTR:
+      emit ("\tmovq\t(%%rsp), %s", var_reg64[reg]);
+      break;
+  default:
+      bug ("unsupported type in b_assign_var_reg");
+  }
+}
+
+
+void b_inc_dec_var_reg (TYPETAG type, B_INC_DEC_OP idop, unsigned int size,
+			int reg)
+{
+  char *op = (idop == B_PRE_INC || idop == B_POST_INC) ? "add" : "sub";
+  BOOLEAN is_pre = (idop == B_PRE_INC || idop == B_PRE_DEC);
+
+  emitn ("\t\t\t\t# b_inc_dec_var_reg (");
+  my_print_typetag (type);
+  emit (", %s, %s)", idop == B_PRE_INC ? "PRE-INC" :
+	               idop == B_POST_INC ? "POS-INC" :
+	               idop == B_PRE_DEC ? "PRE-DEC" :
+	                                    "POST-DEC", var_reg64[reg]);
+
+  if (type != TYPTR)
+      size = 1;
+
+  b_push ();
+  if (!is_pre)
+      emit ("\tmovq\t%s, (%%rsp)", var_reg64[reg]);
+  emit ("\t%sq\t$%u, %s", op, size, var_reg64[reg]);
+  if (is_pre)
+      emit ("\tmovq\t%s, (%%rsp)", var_reg64[reg]);
+}
+
+
+
+
+
+/* b_push_const_int accepts an integer value and emits code to
+   push that value onto the stack.  */
+
+
+void b_push_const_int (long value)
+{
+  emit ("\t\t\t\t# b_push_const_int (%ld)", value);
+
+  b_push ();
+  if (fits_imm32 (value))
+      emit ("\tmovq\t$%ld, (%%rsp)", value);
+  else {
+      emit ("\tmovabsq\t$%ld, %%rax", value);
+      emit ("\tmovq\t%%rax, (%%rsp)");
+  }
+}
+
+
+
+
+
+
+/* b_push_const_double accepts a double value and emits code to
+   push that value onto the stack, by way of its label in the
+   constant pool.  */
+
+
+void b_push_const_double (double value)
+{
+  char *label;
+
+  if (asm_section != SEC_TEXT)
+    bug("non-text assembler section in b_push_const_double");
+
+  emit ("\t\t\t\t# b_push_const_double (%.16e)", value);
+
+  label = intern_const (FALSE, value, NULL)->label;
+  emit ("\tmovq\t%s(%%rip), %%rax", label);
+  b_push ();
+  emit ("\tmovq\t%%rax, (%%rsp)");
+}
+
+
+
+
+
+
+/* b_push_const_string accepts a string and emits code to push the
+   address of its label in the constant pool.  */
+
+
+void b_push_const_string (char *string)
+{
+  emit ("\t\t\t\t# b_push_const_string (\"%s\")", string);
+
+  if (asm_section != SEC_TEXT)
+    bug("non-text assembler section in b_push_const_string");
+
+  b_push_ext_addr (intern_const (TRUE, 0.0, string)->label);
+}
+
+
+
+
+
+
+/* b_assign accepts a type and emits code to store a value of that
+   type in a variable OF THE SAME TYPE.  It pops the value and the
+   address beneath it, stores the value at the address, AND PUSHES THE
+   VALUE BACK ONTO THE STACK.  See backend-x86_64.h. */
+
+void b_assign (TYPETAG type)
+{
+  char *reg;
+
+  emitn ("\t\t\t\t# b_assign (");
+  my_print_typetag (type);
+  emit (")");
+
+  switch (type) {
+  case TYSIGNEDCHAR:
+  case TYUNSIGNEDCHAR:
+      emit ("\tmovzbl\t(%%rsp), %%edx");
+      reg = "b\t%dl";
+      break;
+  case TYSIGNEDSHORTINT:
+  case TYUNSIGNEDSHORTINT:
+      emit ("\tmovzwl\t(%%rsp), %%edx");
+      reg = "w\t%dx";
+      break;
+  case TYSIGNEDINT:
+  case TYUNSIGNEDINT:
+  case TYFLOAT:
+      emit ("\tmovl\t(%%rsp), %%edx");
+      reg = "l\t%edx";
+      break;
+  case TYSIGNEDLONGINT:
+  case TYUNSIGNEDLONGINT:
+  case TYPTR:
+  case TYDOUBLE:
+      emit ("\tmovq\t(%%rsp), %%rdx");
+      reg = "q\t%rdx";
+      break;
+  default:
+    bug ("unsupported type in b_assign");
+  }
+
+  b_pop ();
+  emit ("\tmovq\t(%%rsp), %%rax");
+  emit ("\tmov%s, (%%rax)", reg);
+  emit ("\tmov%s, (%%rsp)", reg);
+}
+
+
+
+
+
+/* Converts the unsigned long in %rax to floating point in %xmm0.  SSE2
+   only converts signed integers, so a value with the high bit set is
+   halved (keeping the low bit for correct rounding), converted, and
+   doubled. */
+static void convert_ulong_to_fp (TYPETAG to_type)
+{
+  char *big_label = new_symbol(), *done_label = new_symbol();
+
+  emit ("\ttestq\t%%rax, %%rax");
+  emit ("\tjs\t%s", big_label);
+  emit ("\tcvtsi2%sq\t%%rax, %%xmm0", SSE_SFX(to_type));
+  emit ("\tjmp\t%s", done_label);
+  b_label (big_label);
+  emit ("\tmovq\t%%rax, %%rdx");
+  emit ("\tshrq\t%%rdx");
+  emit ("\tandl\t$1, %%eax");
+  emit ("\torq\t%%rax, %%rdx");
+  emit ("\tcvtsi2%sq\t%%rdx, %%xmm0", SSE_SFX(to_type));
+  emit ("\tadd%s\t%%xmm0, %%xmm0", SSE_SFX(to_type));
+  b_label (done_label);
+}
+
+/* Converts the double in %xmm0 to an unsigned long in %rax.  Values
+   of 2^63 and above are brought into signed range first. */
+static void convert_double_to_ulong (void)
+{
+  char *big_label = new_symbol(), *done_label = new_symbol();
+
+      /* 0x43e0000000000000 is 2^63 as a double */
+  emit ("\tmovabsq\t$0x43e0000000000000, %%rdx");
+  emit ("\tmovq\t%%rdx, %%xmm1");
+  emit ("\tucomisd\t%%xmm1, %%xmm0");
+  emit ("\tjae\t%s", big_label);
+  emit ("\tcvttsd2siq\t%%xmm0, %%rax");
+  emit ("\tjmp\t%s", done_label);
+  b_label (big_label);
+  emit ("\tsubsd\t%%xmm1, %%xmm0");
+  emit ("\tcvttsd2siq\t%%xmm0, %%rax");
+  emit ("\tbtcq\t$63, %%rax");
+  b_label (done_label);
+}
+
+
+/* b_convert accepts a from_type and a to_type and emits code to
+   convert a value of type from_type to a value of type to_type.
+   It assumes that there is a value of type from_type on the
+   stack.  That value is popped off the stack, converted to a value
+   of the to_type, and pushed back onto the stack.  */
+
+
+void b_convert (TYPETAG from_type, TYPETAG to_type)
+{
+  emitn ("\t\t\t\t# b_convert (");
+  my_print_typetag (from_type);
+  emitn (" -> ");
+  my_print_typetag (to_type);
+  emit (")");
+
+  if (from_type==to_type)
+      return;
+
+  switch (from_type) {
+
+  case TYSIGNEDCHAR:
+  case TYUNSIGNEDCHAR:
+  case TYSIGNEDINT:
+  case TYUNSIGNEDINT:
+
+          /* To simplify things, first extend to 64 bits */
+      if (from_type==TYSIGNEDCHAR || from_type==TYUNSIGNEDCHAR)
+          emit ("\tmov%sbq\t(%%rsp), %%rax", from_type==TYSIGNEDCHAR?"s":"z");
+      else if (from_type==TYSIGNEDINT)
+          emit ("\tmovslq\t(%%rsp), %%rax");
+      else
+          emit ("\tmovl\t(%%rsp), %%eax");    /* zero-extends */
+
+      switch (to_type) {
+      case TYSIGNEDCHAR:
+      case TYUNSIGNEDCHAR:
+      case TYSIGNEDINT:
+      case TYUNSIGNEDINT:
+          break; /* Nothing more to do, because x86 is little-endian */
+      case TYSIGNEDLONGINT:
+      case TYUNSIGNEDLONGINT:
+      case TYPTR:
+          if ((from_type==TYSIGNEDCHAR||from_type==TYUNSIGNEDCHAR)
+              && to_type==TYPTR)
+              bug ("unsupported conversion type in b_convert");
+          emit ("\tmovq\t%%rax, (%%rsp)");
+          break;
+      case TYFLOAT:
+      case TYDOUBLE:
+	  emit ("\tcvtsi2%sq\t%%rax, %%xmm0", SSE_SFX(to_type));
+	  emit ("\tmov%s\t%%xmm0, (%%rsp)", SSE_SFX(to_type));
+	  break;
+      default:
+	  bug ("unsupported destination type in b_convert");
+      }
+      break;
+
+  case TYSIGNEDLONGINT:
+  case TYUNSIGNEDLONGINT:
+
+      switch (to_type) {
+      case TYSIGNEDCHAR:
+      case TYUNSIGNEDCHAR:
+      case TYSIGNEDINT:
+      case TYUNSIGNEDINT:
+      case TYSIGNEDLONGINT:
+      case TYUNSIGNEDLONGINT:
+      case TYPTR:
+	  break;   /* No alteration of data necessary (x86 is little-endian) */
+      case TYFLOAT:
+      case TYDOUBLE:
+          if (from_type==TYSIGNEDLONGINT)
+              emit ("\tcvtsi2%sq\t(%%rsp), %%xmm0", SSE_SFX(to_type));
+          else {
+              emit ("\tmovq\t(%%rsp), %%rax");
+              convert_ulong_to_fp (to_type);
+          }
+	  emit ("\tmov%s\t%%xmm0, (%%rsp)", SSE_SFX(to_type));
+	  break;
+      default:
+	  bug ("unsupported destination type in b_convert");
+      }
+      break;
+
+  case TYFLOAT:
+  case TYDOUBLE:
+
+      emit ("\tmov%s\t(%%rsp), %%xmm0", SSE_SFX(from_type));
+
+      switch (to_type) {
+      case TYSIGNEDCHAR:
+      case TYUNSIGNEDCHAR:
+      case TYSIGNEDINT:
+      case TYUNSIGNEDINT:
+      case TYSIGNEDLONGINT:
+          emit ("\tcvtt%s2siq\t%%xmm0, %%rax", SSE_SFX(from_type));
+	  emit ("\tmovq\t%%rax, (%%rsp)");
+	  break;
+      case TYUNSIGNEDLONGINT:
+          if (from_type==TYFLOAT)
+              emit ("\tcvtss2sd\t%%xmm0, %%xmm0");
+          convert_double_to_ulong ();
+	  emit ("\tmovq\t%%rax, (%%rsp)");
+	  break;
+      case TYFLOAT:
+      case TYDOUBLE:
+	  emit ("\tcvt%s2%s\t%%xmm0, %%xmm0", SSE_SFX(from_type),
+                SSE_SFX(to_type));
+	  emit ("\tmov%s\t%%xmm0, (%%rsp)", SSE_SFX(to_type));
+	  break;
+      default:
+	  bug ("unsupported destination type in b_convert");
+      }
+      break;
+
+  default:
+      bug ("unsupported source type in b_convert");
+  }
+}
+
+
+
+
+
+
+/* b_negate accepts a type and emits code to negate a value of
+   that type on top of the stack.  */
+
+
+void b_negate (TYPETAG type)
+{
+  emitn ("\t\t\t\t# b_negate (");
+  my_print_typetag (type);
+  emit (")");
+
+  switch (type) {
+
+  case TYSIGNEDINT:
+  case TYUNSIGNEDINT:
+  case TYSIGNEDLONGINT:
+  case TYUNSIGNEDLONGINT:
+    emit ("\tneg%s\t(%%rsp)", int_sfx(type));
+    break;
+
+  case TYFLOAT:
+  case TYDOUBLE:
+        /* Just flip the sign bit */
+    emit ("\txorl\t$0x80000000, %d(%%rsp)", type==TYDOUBLE?4:0);
+    break;
+
+  default:
+    bug ("unsupported type in b_negate");
+  }
+}
+
+
+
+
+/* b_inc_dec accepts a type, an increment-decrement operator
+   (B_PRE_INC, B_POST_INC, B_PRE_DEC, B_POST_DEC), and a size
+   parameter, and increments or decrements the variable whose address
+   is on top of the stack.  The address is replaced by the value of the
+   variable before or after the operation.  See backend-x86_64.h. */
+
+
+void b_inc_dec (TYPETAG type, B_INC_DEC_OP idop, unsigned int size)
+{
+  char *op, *ldsz, *stsz;
+  BOOLEAN is_pre = (idop == B_PRE_INC || idop == B_PRE_DEC);
+
+  switch (idop) {
+  case B_PRE_INC:
+  case B_POST_INC:
+  case B_PRE_DEC:
+  case B_POST_DEC:
+      break;
+  default:
+      bug("unrecognized idop in b_inc_dec");
+  }
+
+  emitn ("\t\t\t\t# b_inc_dec (");
+  my_print_typetag (type);
+  emit (", %s)", idop == B_PRE_INC ? "PRE-INC" :
+	               idop == B_POST_INC ? "POS-INC" :
+	               idop == B_PRE_DEC ? "PRE-DEC" :
+	                                    "POST-DEC");
+
+  if (asm_section != SEC_TEXT)
+    bug("non-text assembler section in b_inc_dec");
+
+  op = (idop == B_PRE_INC || idop == B_POST_INC) ? "add" : "sub";
+
+  if (type!=TYPTR)
+      size = 1;
+
+  emit ("\tmovq\t(%%rsp), %%rdx");  /* load the pointer (l-value) */
+
+  switch (type) {
+
+  case TYSIGNEDCHAR:
+  case TYUNSIGNEDCHAR:
+  case TYSIGNEDINT:
+  case TYUNSIGNEDINT:
+  case TYSIGNEDLONGINT:
+  case TYUNSIGNEDLONGINT:
+  case TYPTR:
+      if (type==TYSIGNEDCHAR || type==TYUNSIGNEDCHAR) {
+          ldsz = type==TYSIGNEDCHAR ? "sbq" : "zbq";
+          stsz = "b\t%al";
+      }
+      else if (*int_sfx(type) == 'l') {
+          ldsz = type==TYSIGNEDINT ? "slq" : "l";
+          stsz = "l\t%eax";
+      }
+      else {
+          ldsz = "q";
+          stsz = "q\t%rax";
+      }
+      emit ("\tmov%s\t(%%rdx), %s", ldsz, *ldsz=='l' ? "%eax" : "%rax");
+      if (!is_pre)
+          emit ("\tmovq\t%%rax, (%%rsp)");
+      emit ("\t%sq\t$%u, %%rax", op, size);
+      if (is_pre)
+          emit ("\tmovq\t%%rax, (%%rsp)");
+      emit ("\tmov%s, (%%rdx)", stsz);
+      break;
+
+  case TYFLOAT:
+  case TYDOUBLE:
+      emit ("\tmov%s\t(%%rdx), %%xmm0", SSE_SFX(type));
+      emit ("\tmovl\t$1, %%eax");
+      emit ("\tcvtsi2%sl\t%%eax, %%xmm1", SSE_SFX(type));
+      if (!is_pre)
+          emit ("\tmov%s\t%%xmm0, (%%rsp)", SSE_SFX(type));
+      emit ("\t%s%s\t%%xmm1, %%xmm0", op, SSE_SFX(type));
+      if (is_pre)
+          emit ("\tmov%s\t%%xmm0, (%%rsp)", SSE_SFX(type));
+      emit ("\tmov%s\t%%xmm0, (%%rdx)", SSE_SFX(type));
+      break;
+
+  default:
+    bug ("unsupported type in b_inc_dec");
+  }
+}
+
+
+
+
+
+
+/* b_arith_rel_op accepts a binary arithmetic or relational operator
+   and a type.  It pops two values of that type (the right operand on
+   top), performs the operation, and pushes the result.  Relational
+   operators push 1 (true) or 0 (false).  See backend-x86_64.h. */
+
+
+void b_arith_rel_op (B_ARITH_REL_OP arop, TYPETAG type)
+{
+  BOOLEAN is_signed;
+  char *cmp_string, *sfx, *rax, *rcx;
+
+  emitn ("\t\t\t\t# b_arith_rel_op (%s, ", b_arith_rel_op_string (arop));
+  my_print_typetag (type);
+  emit (")");
+
+  switch (type) {
+  case TYPTR:
+      if (arop==B_ADD||arop==B_SUB||arop==B_MULT||arop==B_DIV||arop==B_MOD)
+  	  bug("unsupported op or op incompatible with type in b_arith_rel_op");
+          /* FALL THROUGH!!! */
+  case TYSIGNEDINT:
+  case TYSIGNEDLONGINT:
+  case TYUNSIGNEDINT:
+  case TYUNSIGNEDLONGINT:
+      is_signed = (type==TYSIGNEDINT||type==TYSIGNEDLONGINT);
+      sfx = int_sfx (type);
+      rax = int_rax (type);
+      rcx = *sfx=='q' ? "%rcx" : "%ecx";
+
+      emit ("\tmov%s\t(%%rsp), %s", sfx, rcx);
+      b_pop();
+      emit ("\tmov%s\t(%%rsp), %s", sfx, rax);
+
+      switch (arop) {
+      case B_ADD:
+      case B_SUB:
+      case B_MULT:
+	  emit ("\t%s%s\t%s, %s",
+                arop==B_ADD?"add":arop==B_SUB?"sub":"imul", sfx, rcx, rax);
+          emit ("\tmovq\t%%rax, (%%rsp)");
+	  break;
+      case B_DIV:
+      case B_MOD:
+          if (is_signed)
+              emit (*sfx=='q' ? "\tcqto" : "\tcltd");
+          else
+              emit ("\txorl\t%%edx, %%edx");
+	  emit ("\t%sdiv%s\t%s", is_signed?"i":"", sfx, rcx);
+          emit ("\tmovq\t%%r%sx, (%%rsp)", arop==B_DIV?"a":"d");
+	  break;
+      case B_LT:
+      case B_LE:
+      case B_GT:
+      case B_GE:
+      case B_EQ:
+      case B_NE:
+          if (is_signed)
+              cmp_string =
+                  arop==B_LT?"l":
+                  arop==B_LE?"le":
+                  arop==B_GT?"g":
+                  arop==B_GE?"ge":
+                  arop==B_EQ?"e":"ne";
+          else
+              cmp_string =
+                  arop==B_LT?"b":
+                  arop==B_LE?"be":
+                  arop==B_GT?"a":
+                  arop==B_GE?"ae":
+                  arop==B_EQ?"e":"ne";
+
+          emit ("\tcmp%s\t%s, %s", sfx, rcx, rax);
+	  emit ("\tset%s\t%%al", cmp_string);
+	  emit ("\tmovzbl\t%%al, %%eax");
+          emit ("\tmovq\t%%rax, (%%rsp)");
+	  break;
+      default:
+	  bug("unsupported op or op incompatible with type in b_arith_rel_op");
+      }
+      break;
+
+  case TYFLOAT:
+  case TYDOUBLE:
+
+      sfx = SSE_SFX (type);
+      emit ("\tmov%s\t%d(%%rsp), %%xmm0", sfx, STACK_ITEM);
+      emit ("\tmov%s\t(%%rsp), %%xmm1", sfx);
+      b_pop();
+
+      switch (arop) {
+      case B_ADD:
+      case B_SUB:
+      case B_MULT:
+      case B_DIV:
+	  emit ("\t%s%s\t%%xmm1, %%xmm0",
+		arop==B_ADD ? "add" :
+		arop==B_SUB ? "sub" :
+		arop==B_MULT ? "mul" : "div", sfx);
+	  emit ("\tmov%s\t%%xmm0, (%%rsp)", sfx);
+	  break;
+      case B_LT:
+      case B_LE:
+      case B_GT:
+      case B_GE:
+      case B_EQ:
+      case B_NE:
+              /* Compare so that "above" means the relation holds;
+               * an unordered result (NaN) then sets CF and fails. */
+          if (arop==B_LT || arop==B_LE)
+              emit ("\tucomi%s\t%%xmm0, %%xmm1", sfx);
+          else
+              emit ("\tucomi%s\t%%xmm1, %%xmm0", sfx);
+          emit ("\tset%s\t%%al",
+                arop==B_LT||arop==B_GT ? "a" :
+                arop==B_LE||arop==B_GE ? "ae" :
+                arop==B_EQ ? "e" : "ne");
+          if (arop==B_EQ || arop==B_NE) {
+              emit ("\tset%sp\t%%dl", arop==B_EQ?"n":"");
+              emit ("\t%sb\t%%dl, %%al", arop==B_EQ?"and":"or");
+          }
+          emit ("\tmovzbl\t%%al, %%eax");
+          emit ("\tmovq\t%%rax, (%%rsp)");
+	  break;
+      default:
+	  bug("unsupported op or op incompatible with type in b_arith_rel_op");
+      }
+      break;
+
+  default:
+      bug("unsupported type in b_arith_rel_op");
+  }
+}
+
+
+
+
+/* Division by a constant, as in backend-x86.c, but with the magic
+ * numbers of 64-bit division for the 64-bit types. */
+
+/* Returns k if v is 2^k for k >= 0, or -1 if it is not a power of 2 */
+static int exact_log2 (unsigned long long v)
+{
+  int k;
+
+  if (v == 0 || (v & (v-1)) != 0)
+      return -1;
+  for (k = 0; v != 1; k++)
+      v >>= 1;
+  return k;
+}
+
+/* Tells whether div_by_const can divide a value of the given type by d */
+static BOOLEAN div_by_const_ok (TYPETAG type, long d)
+{
+  if (type==TYSIGNEDINT || type==TYSIGNEDLONGINT)
+      return d != 0;
+  return d > 0 && exact_log2 (d) >= 0;
+}
+
+/* Computes the magic number and shift count for signed division of a
+   bits-bit value by d, where 2 <= |d| < 2^(bits-1) (Hacker's Delight,
+   figure 10-1) */
+static void div_magic (long long d, int bits, long long *magic, int *shift)
+{
+  const unsigned long long two = 1ULL << (bits-1), mask = two + (two-1);
+  unsigned long long ad, anc, delta, q1, r1, q2, r2, t, m;
+  int p = bits - 1;
+
+  ad = d < 0 ? -(unsigned long long) d : (unsigned long long) d;
+  t = two + (d < 0);
+  anc = t - 1 - t%ad;
+  q1 = two/anc;
+  r1 = two - q1*anc;
+  q2 = two/ad;
+  r2 = two - q2*ad;
+  do {
+      p++;
+      q1 = 2*q1;
+      r1 = 2*r1;
+      if (r1 >= anc) {
+	  q1++;
+	  r1 -= anc;
+      }
+      q2 = 2*q2;
+      r2 = 2*r2;
+      if (r2 >= ad) {
+	  q2++;
+	  r2 -= ad;
+      }
+      delta = ad - r2;
+  } while (q1 < delta || (q1 == delta && r1 == 0));
+
+  m = (q2 + 1) & mask;
+  if (d < 0)
+      m = -m & mask;
+      /* Sign-extend from bits bits */
+  *magic = (m & two) ? (long long) (m | ~mask) : (long long) m;
+  *shift = p - bits;
+}
+
+/* Emits code to divide %rax (or %eax, per int_sfx(type)) by d (B_DIV) or
+   take its remainder (B_MOD), leaving the result there.  Uses %rcx and
+   %rdx.  The caller must have checked div_by_const_ok.  Masks and
+   multipliers that do not fit in an immediate go through %rdx. */
+static void div_by_const (B_ARITH_REL_OP arop, TYPETAG type, long d)
+{
+  char *sfx = int_sfx (type);
+  int bits = *sfx=='q' ? 64 : 32;
+  char *rax = *sfx=='q' ? "%rax" : "%eax";
+  char *rcx = *sfx=='q' ? "%rcx" : "%ecx";
+  char *rdx = *sfx=='q' ? "%rdx" : "%edx";
+  int k = exact_log2 (d < 0 ? -(unsigned long long) d : (unsigned long long) d);
+  long long magic;
+  int shift;
+
+  if (type!=TYSIGNEDINT && type!=TYSIGNEDLONGINT) {
+      if (arop==B_DIV && k > 0)
+	  emit ("\tshr%s\t$%d, %s", sfx, k, rax);
+      else if (arop==B_MOD && fits_imm32 (d-1))
+	  emit ("\tand%s\t$%ld, %s", sfx, d-1, rax);
+      else if (arop==B_MOD) {
+	  emit ("\tmovabsq\t$%ld, %%rdx", d-1);
+	  emit ("\tandq\t%%rdx, %%rax");
+      }
+      return;
+  }
+
+  if (k == 0) {
+      if (arop==B_MOD)
+	  emit ("\tmov%s\t$0, %s", sfx, rax);
+      else if (d < 0)
+	  emit ("\tneg%s\t%s", sfx, rax);
+      return;
+  }
+
+  if (k > 0) {
+          /* %rdx = 2^k-1 if n is negative, else 0 */
+      emit ("\tmov%s\t%s, %s", sfx, rax, rdx);
+      if (k > 1)
+	  emit ("\tsar%s\t$%d, %s", sfx, bits-1, rdx);
+      emit ("\tshr%s\t$%d, %s", sfx, bits-k, rdx);
+      if (arop==B_DIV) {
+	  emit ("\tadd%s\t%s, %s", sfx, rdx, rax);
+	  emit ("\tsar%s\t$%d, %s", sfx, k, rax);
+	  if (d < 0)
+	      emit ("\tneg%s\t%s", sfx, rax);
+      }
+      else {
+	  emit ("\tadd%s\t%s, %s", sfx, rax, rdx);
+	  if (k < 32)
+	      emit ("\tand%s\t$%lld, %s", sfx, -(1LL << k), rdx);
+	  else {
+		  /* Clear the low k bits by shifting them out and back */
+	      emit ("\tshrq\t$%d, %%rdx", k);
+	      emit ("\tshlq\t$%d, %%rdx", k);
+	  }
+	  emit ("\tsub%s\t%s, %s", sfx, rdx, rax);
+      }
+      return;
+  }
+
+  div_magic (d, bits, &magic, &shift);
+  emit ("\tmov%s\t%s, %s", sfx, rax, rcx);
+  if (bits == 64)
+      emit ("\tmovabsq\t$%lld, %%rdx", magic);
+  else
+      emit ("\tmovl\t$%lld, %%edx", magic);
+  emit ("\timul%s\t%s", sfx, rdx);
+  if (d > 0 && magic < 0)
+      emit ("\tadd%s\t%s, %s", sfx, rcx, rdx);
+  else if (d < 0 && magic > 0)
+      emit ("\tsub%s\t%s, %s", sfx, rcx, rdx);
+  if (shift > 0)
+      emit ("\tsar%s\t$%d, %s", sfx, shift, rdx);
+  emit ("\tmov%s\t%s, %s", sfx, rdx, rax);
+  emit ("\tshr%s\t$%d, %s", sfx, bits-1, rax);
+  emit ("\tadd%s\t%s, %s", sfx, rdx, rax);
+  if (arop==B_MOD && fits_imm32 (-d))
+      emit ("\timul%s\t$%ld, %s, %s", sfx, -d, rax, rax);
+  else if (arop==B_MOD) {
+      emit ("\tmovabsq\t$%ld, %%rdx", -d);
+      emit ("\timulq\t%%rdx, %%rax");
+  }
+  if (arop==B_MOD)
+      emit ("\tadd%s\t%s, %s", sfx, rcx, rax);
+}
+
+
+/* b_arith_rel_op_const is b_arith_rel_op with a constant right operand
+   (see backend-x86_64.h).  Addition, subtraction, multiplication and the
+   relational operators use the constant as an immediate operand on the
+   stack slot, or %rax if it does not fit in one.  Division and
+   remainder are done by div_by_const in %rax, or, where it cannot be
+   used, by pushing the constant and using b_arith_rel_op. */
+
+
+void b_arith_rel_op_const (B_ARITH_REL_OP arop, TYPETAG type, long value)
+{
+  BOOLEAN is_signed = (type==TYSIGNEDINT||type==TYSIGNEDLONGINT);
+  char *sfx;
+
+      /* A 32-bit operation only sees the low 32 bits of the constant */
+  if (*int_sfx (type) == 'l')
+      value = (int) value;
+  if ((arop==B_DIV || arop==B_MOD) && !div_by_const_ok (type, value)) {
+      b_push_const_int (value);
+      b_arith_rel_op (arop, type);
+      return;
+  }
+
+  emitn ("\t\t\t\t# b_arith_rel_op_const (%s, ",
+	 b_arith_rel_op_string (arop));
+  my_print_typetag (type);
+  emit (", %ld)", value);
+
+  if (type!=TYPTR && type!=TYSIGNEDINT && type!=TYSIGNEDLONGINT &&
+      type!=TYUNSIGNEDINT && type!=TYUNSIGNEDLONGINT)
+      bug("unsupported type in b_arith_rel_op_const");
+  if (type==TYPTR &&
+      (arop==B_ADD||arop==B_SUB||arop==B_MULT||arop==B_DIV||arop==B_MOD))
+      bug("unsupported op or op incompatible with type in b_arith_rel_op_const");
+
+  sfx = int_sfx (type);
+  if (!fits_imm32 (value) && arop!=B_DIV && arop!=B_MOD)
+      emit ("\tmovabsq\t$%ld, %%rax", value);
+  switch (arop) {
+  case B_DIV:
+  case B_MOD:
+      emit ("\tmov%s\t(%%rsp), %s", sfx, int_rax (type));
+      div_by_const (arop, type, value);
+      emit ("\tmovq\t%%rax, (%%rsp)");
+      break;
+  case B_ADD:
+  case B_SUB:
+      if (fits_imm32 (value))
+	  emit ("\t%s%s\t$%ld, (%%rsp)", arop==B_ADD?"add":"sub", sfx, value);
+      else
+	  emit ("\t%sq\t%%rax, (%%rsp)", arop==B_ADD?"add":"sub");
+      break;
+  case B_MULT:
+      if (fits_imm32 (value))
+	  emit ("\timul%s\t$%ld, (%%rsp), %s", sfx, value, int_rax (type));
+      else
+	  emit ("\timulq\t(%%rsp), %%rax");
+      emit ("\tmovq\t%%rax, (%%rsp)");
+      break;
+  case B_LT:
+  case B_LE:
+  case B_GT:
+  case B_GE:
+  case B_EQ:
+  case B_NE:
+      if (fits_imm32 (value))
+	  emit ("\tcmp%s\t$%ld, (%%rsp)", sfx, value);
+      else
+	  emit ("\tcmpq\t%%rax, (%%rsp)");
+      emit ("\tset%s\t%%al",
+	    is_signed ? (arop==B_LT?"l":
+			 arop==B_LE?"le":
+			 arop==B_GT?"g":
+			 arop==B_GE?"ge":
+			 arop==B_EQ?"e":"ne")
+		      : (arop==B_LT?"b":
+			 arop==B_LE?"be":
+			 arop==B_GT?"a":
+			 arop==B_GE?"ae":
+			 arop==B_EQ?"e":"ne"));
+      emit ("\tmovzbl\t%%al, %%eax");
+      emit ("\tmovq\t%%rax, (%%rsp)");
+      break;
+  default:
+      bug("unsupported op in b_arith_rel_op_const");
+  }
+}
+
+
+
+
+/* Condition code suffix for the given relational operator */
+static char *cc_suffix (B_ARITH_REL_OP arop, BOOLEAN is_signed)
+{
+  if (is_signed)
+      return arop==B_LT?"l":
+	     arop==B_LE?"le":
+	     arop==B_GT?"g":
+	     arop==B_GE?"ge":
+	     arop==B_EQ?"e":"ne";
+  else
+      return arop==B_LT?"b":
+	     arop==B_LE?"be":
+	     arop==B_GT?"a":
+	     arop==B_GE?"ae":
+	     arop==B_EQ?"e":"ne";
+}
+
+
+
+
+/* b_cond_jump_rel fuses b_arith_rel_op with a relational operator and
+   b_cond_jump: the two operands are compared and the flags branched on
+   directly, instead of being turned into a 0 or 1 that is then tested. */
+
+
+void b_cond_jump_rel (B_ARITH_REL_OP arop, TYPETAG type, char *label)
+{
+  BOOLEAN is_signed = (type==TYSIGNEDINT||type==TYSIGNEDLONGINT);
+  char *sfx, *rax, *rcx;
+
+  emitn ("\t\t\t\t# b_cond_jump_rel (%s, ", b_arith_rel_op_string (arop));
+  my_print_typetag (type);
+  emit (", %s)", label);
+
+  if (type!=TYPTR && type!=TYSIGNEDINT && type!=TYSIGNEDLONGINT &&
+      type!=TYUNSIGNEDINT && type!=TYUNSIGNEDLONGINT)
+      bug("unsupported type in b_cond_jump_rel");
+  if (arop!=B_LT && arop!=B_LE && arop!=B_GT && arop!=B_GE &&
+      arop!=B_EQ && arop!=B_NE)
+      bug("b_cond_jump_rel: illegal comparison operator: %s",
+	  b_arith_rel_op_string (arop));
+
+  sfx = int_sfx (type);
+  rax = int_rax (type);
+  rcx = *sfx=='q' ? "%rcx" : "%ecx";
+
+  emit ("\tmov%s\t(%%rsp), %s", sfx, rcx);
+  b_pop ();
+  emit ("\tmov%s\t(%%rsp), %s", sfx, rax);
+  b_pop ();
+  emit ("\tcmp%s\t%s, %s", sfx, rcx, rax);
+  emit ("\tj%s\t%s", cc_suffix (arop, is_signed), label);
+}
+
+
+
+
+/* b_cond_jump_rel_const is b_cond_jump_rel with a constant right
+   operand, which is compared as an immediate, or from %rcx if it does
+   not fit in one. */
+
+
+void b_cond_jump_rel_const (B_ARITH_REL_OP arop, TYPETAG type, long value,
+			    char *label)
+{
+  BOOLEAN is_signed = (type==TYSIGNEDINT||type==TYSIGNEDLONGINT);
+
+  if (*int_sfx (type) == 'l')
+      value = (int) value;
+  emitn ("\t\t\t\t# b_cond_jump_rel_const (%s, ",
+	 b_arith_rel_op_string (arop));
+  my_print_typetag (type);
+  emit (", %ld, %s)", value, label);
+
+  if (type!=TYPTR && type!=TYSIGNEDINT && type!=TYSIGNEDLONGINT &&
+      type!=TYUNSIGNEDINT && type!=TYUNSIGNEDLONGINT)
+      bug("unsupported type in b_cond_jump_rel_const");
+  if (arop!=B_LT && arop!=B_LE && arop!=B_GT && arop!=B_GE &&
+      arop!=B_EQ && arop!=B_NE)
+      bug("b_cond_jump_rel_const: illegal comparison operator: %s",
+	  b_arith_rel_op_string (arop));
+
+  emit ("\tmov%s\t(%%rsp), %s", int_sfx(type), int_rax(type));
+  b_pop ();
+  if (fits_imm32 (value))
+      emit ("\tcmp%s\t$%ld, %s", int_sfx(type), value, int_rax(type));
+  else {
+      emit ("\tmovabsq\t$%ld, %%rcx", value);
+      emit ("\tcmpq\t%%rcx, %%rax");
+  }
+  emit ("\tj%s\t%s", cc_suffix (arop, is_signed), label);
+}
+
+
+
+
+/* b_ptr_arith_op takes an operator (which must be either B_ADD or B_SUB),
+   the type of the second argument, and the size of object pointed to
+   by the pointer argument(s).  See backend-x86_64.h. */
+
+
+void b_ptr_arith_op (B_ARITH_REL_OP arop, TYPETAG type, unsigned int size)
+{
+  emitn ("\t\t\t\t# b_ptr_arith_op (%s, ", b_arith_rel_op_string (arop));
+  my_print_typetag (type);
+  emit (", size = %u)", size);
+
+  if (size == 0)
+      bug("size == 0 in b_ptr_arith_op");
+
+  switch (type) {
+  case TYSIGNEDINT:
+      emit ("\tmovslq\t(%%rsp), %%rdx");
+      break;
+  case TYUNSIGNEDINT:
+      emit ("\tmovl\t(%%rsp), %%edx");
+      break;
+  default:
+      emit ("\tmovq\t(%%rsp), %%rdx");
+      break;
+  }
+  b_pop();
+  emit ("\tmovq\t(%%rsp), %%rax");
+
+  switch (type) {
+  case TYSIGNEDINT:
+  case TYUNSIGNEDINT:
+  case TYSIGNEDLONGINT:
+  case TYUNSIGNEDLONGINT:
+      if (arop!=B_ADD && arop!=B_SUB)
+          bug("unsupported pointer/integer operation in b_ptr_arith_op");
+      emit ("\timulq\t$%u, %%rdx, %%rdx", size);
+      emit ("\t%sq\t%%rdx, %%rax", arop==B_ADD?"add":"sub");
+      break;
+  case TYPTR:
+      if (arop != B_SUB)
+	  bug("unsupported pointer/pointer operation in b_ptr_arith_op");
+      emit ("\tsubq\t%%rdx, %%rax");
+      divide_by_size(size);
+      break;
+  default:
+      bug("illegal type of second operand in b_ptr_arith_op");
+  }
+
+  emit ("\tmovq\t%%rax, (%%rsp)");
+}
+
+
+
+
+/* b_check_index compares the index on top of the stack with n - 1 as
+   unsigned numbers, and jumps to a trap emitted at the end of the
+   function if it is greater.  See backend-x86_64.h. */
+
+
+void b_check_index (TYPETAG type, int n)
+{
+  char *trap = new_symbol ();
+
+  emitn ("\t\t\t\t# b_check_index (");
+  my_print_typetag (type);
+  emit (", %d)", n);
+
+  if (type!=TYSIGNEDINT && type!=TYSIGNEDLONGINT &&
+      type!=TYUNSIGNEDINT && type!=TYUNSIGNEDLONGINT)
+      bug("unsupported type in b_check_index");
+
+  emit ("\tcmp%s\t$%d, (%%rsp)", int_sfx(type), n - 1);
+  emit ("\tja\t%s", trap);
+
+  if (ntraps == traps_size) {
+      traps_size = traps_size ? 2 * traps_size : 16;
+      trap_labels = (char **) realloc (trap_labels,
+				       traps_size * sizeof (char *));
+      trap_recs = (int *) realloc (trap_recs, traps_size * sizeof (int));
+      if (trap_labels == NULL || trap_recs == NULL)
+	  bug ("b_check_index: out of memory");
+  }
+  trap_labels[ntraps] = trap;
+  trap_recs[ntraps++] = asm_mark () - 1;
+}
+
+
+/* Emits the traps of the index checks of the current function that are
+   still there, after its last instruction */
+static void emit_traps (void)
+{
+  ASM_LIST *recs = asm_records ();
+  int i;
+
+  for (i = 0; i < ntraps; i++)
+      if (!recs[trap_recs[i]]->deleted) {
+	  emit ("%s:", trap_labels[i]);
+	  emit ("\tud2");
+      }
+  ntraps = 0;
+}
+
+
+
+
+
+/* b_func_prologue accepts a function name and generates the prologue
+   for a function with that name.  It also initializes the static
+   variables that are used in b_store_formal_param. */
+
+
+void b_func_prologue (char *f_name)
+{
+  func_start_rec = asm_mark ();
+  return_slot_rec = -1;
+  tail_called = FALSE;
+  stack_align_reset ();
+  emit ("\t\t\t\t# b_func_prologue (%s)", f_name);
+
+  b_init_formal_param_offset ();
+
+  if (asm_section != SEC_TEXT) {
+      emit ("\t.text");
+      asm_section = SEC_TEXT;
+  }
+  emit (".global %s", f_name);
+  emit ("\t.type\t%s, @function", f_name);
+  b_label (f_name);
+      /* With -g, describe the frame for unwinders as it is built (see
+       * frame_cfi for functions that end up without one) */
+  if (opt_debug) {
+      emit ("\t.cfi_startproc");
+      emit ("\t.loc\t1 %d", sc_line ());
+  }
+      /* Save the old frame pointer */
+  emit ("\tpushq\t%%rbp");
+  if (opt_debug) {
+      emit ("\t.cfi_def_cfa_offset\t16");
+      emit ("\t.cfi_offset\t%%rbp, -16");
+  }
+      /* Update the frame pointer to current call frame */
+  emit ("\tmovq\t%%rsp, %%rbp");
+  if (opt_debug)
+      emit ("\t.cfi_def_cfa_register\t%%rbp");
+      /* The ABI guarantees 16-byte alignment at every call, but align
+       * explicitly in main as backend-x86.c does. */
+  if (!strcmp(f_name, "main"))
+      emit ("\tandq\t$-16, %%rsp");
+}
+
+
+
+
+
+
+/* b_init_formal_param_offset does the same thing as b_func_prologue,
+   but only initializes the offset variables and emits no assembly code. */
+
+
+void b_init_formal_param_offset ()
+{
+  loc_var_offset = reg_param_offset = 0;
+  formal_int_reg = formal_float_reg = 0;
+
+  /* Stack locations for formal parameters start at %rbp+16. */
+  caller_offset = FUNC_LINK_OFFSET;
+}
+
+
+
+
+
+
+/* b_store_formal_param accepts the type of a parameter, and returns the
+   offset (from %rbp) of the parameter's home.  Parameters that arrive in
+   registers are pushed into the callee's frame, below any earlier ones;
+   parameters that arrive on the stack are left where they are.  Both
+   integer and floating point parameters fill registers in order, so a
+   parameter's home depends on how many of each kind precede it.  It must
+   be called for each formal parameter, in order, immediately after
+   b_func_prologue.  See backend-x86_64.h. */
+
+
+int b_store_formal_param (TYPETAG type)
+{
+    emitn ("\t\t\t\t# b_store_formal_param (");
+    my_print_typetag (type);
+    emit (")");
+
+    switch (type) {
+    case TYSIGNEDCHAR:
+    case TYUNSIGNEDCHAR:
+    case TYSIGNEDINT:
+    case TYUNSIGNEDINT:
+    case TYSIGNEDLONGINT:
+    case TYUNSIGNEDLONGINT:
+    case TYPTR:
+	if (formal_int_reg < NUM_INT_ARG_REGS) {
+	    b_push();
+	    emit ("\tmovq\t%s, (%%rsp)", int_arg_reg[formal_int_reg++]);
+	    loc_var_offset = reg_param_offset -= STACK_ITEM;
+	    return reg_param_offset;
+	}
+	caller_offset += STACK_ITEM;
+	/* if char, the low-order byte has the base address (little endian) */
+	return caller_offset - STACK_ITEM;
+    case TYFLOAT:
+    case TYDOUBLE:
+	    /* Values of type float are passed as doubles, so they must be
+	     * converted in the callee's frame */
+	if (formal_float_reg < NUM_FLOAT_ARG_REGS) {
+	    b_push();
+	    emit ("\tmovsd\t%%xmm%d, (%%rsp)", formal_float_reg++);
+	}
+	else if (type == TYFLOAT) {
+	    emit ("\tmovq\t%d(%%rbp), %%rax", caller_offset);
+	    caller_offset += STACK_ITEM;
+	    b_push();
+	    emit ("\tmovq\t%%rax, (%%rsp)");
+	}
+	else {
+	    caller_offset += STACK_ITEM;
+	    return caller_offset - STACK_ITEM;
+	}
+	if (type == TYFLOAT)
+	    b_convert(TYDOUBLE, TYFLOAT);
+	loc_var_offset = reg_param_offset -= STACK_ITEM;
+	return reg_param_offset;
+    default:
+	bug ("unknown type in b_store_formal_param");
+    }
+
+    return 0;	/* unreachable */
+}
+
+
+
+
+
+
+
+/* b_get_formal_param_offset does the same thing as b_store_formal_param
+   except that it only updates the offset variables and returns the offset
+   of the parameter, without generating any assembly code. */
+
+
+int b_get_formal_param_offset (TYPETAG type)
+{
+    emitn ("\t\t\t\t# b_get_formal_param_offset (");
+    my_print_typetag (type);
+    emit (")");
+
+    switch (type) {
+    case TYSIGNEDCHAR:
+    case TYUNSIGNEDCHAR:
+    case TYSIGNEDINT:
+    case TYUNSIGNEDINT:
+    case TYSIGNEDLONGINT:
+    case TYUNSIGNEDLONGINT:
+    case TYPTR:
+	if (formal_int_reg < NUM_INT_ARG_REGS) {
+	    formal_int_reg++;
+	    loc_var_offset = reg_param_offset -= STACK_ITEM;
+	    return reg_param_offset;
+	}
+	caller_offset += STACK_ITEM;
+	return caller_offset - STACK_ITEM;
+    case TYFLOAT:
+    case TYDOUBLE:
+	if (formal_float_reg < NUM_FLOAT_ARG_REGS)
+	    formal_float_reg++;
+	else {
+	    caller_offset += STACK_ITEM;
+	    if (type == TYDOUBLE)
+		return caller_offset - STACK_ITEM;
+	}
+	loc_var_offset = reg_param_offset -= STACK_ITEM;
+	return reg_param_offset;
+    default:
+	bug ("unknown type in b_get_formal_param_offset");
+    }
+
+    return 0;	/* unreachable */
+}
+
+
+
+
+
+
+
+/* b_alloc_return_value allocates on the stack space to hold the return
+   value for the current function, and sets return_value_offset to it. */
+
+void b_alloc_return_value()
+{
+    emit ("\t\t\t\t# b_alloc_return_value ( )");
+
+    return_value_offset = b_alloc_local_vars(STACK_ITEM);
+    return_slot_rec = asm_mark () - 1;
+}
+
+
+
+
+
+
+
+/* b_alloc_local_vars accepts an integer and emits code to increase the
+   stack by that number of bytes, rounded up to a multiple of 8.  The
+   offset (from %rbp) of the variable with lowest address is returned.  */
+
+
+int b_alloc_local_vars (int size)
+{
+  /* Actual stack space allocated for the new local variables */
+  int new_space;
+
+  emit ("\t\t\t\t# b_alloc_local_vars ( size = %d )", size);
+
+  if (size < 0)
+      bug("negative size given to b_alloc_local_vars");
+
+  new_space = next_multiple(size, STACK_ITEM);
+
+  if (new_space == 0)
+      return loc_var_offset;
+
+  loc_var_offset -= new_space;
+  emit ("\tsubq\t$%d, %%rsp", new_space);
+  return loc_var_offset;
+}
+
+
+
+
+/* b_get_local_var_offset returns the current value of loc_var_offset.
+   See backend-x86_64.h. */
+
+
+int b_get_local_var_offset()
+{
+    return loc_var_offset;
+}
+
+
+
+
+/* b_enter_display accepts the nesting level of the current function and
+   emits code to make its frame the display entry for that level, saving
+   the old entry in a new local slot to be put back on return.  See
+   backend-x86_64.h. */
+
+
+void b_enter_display (int level)
+{
+  emit ("\t\t\t\t# b_enter_display (level = %d)", level);
+
+  if (level < 1)
+      bug("b_enter_display: illegal level %d", level);
+  if (level > display_size)
+      display_size = level;
+
+  display_save_offset = b_alloc_local_vars (STACK_ITEM);
+  display_level = level;
+  emit ("\tmovq\t%s+%d(%%rip), %%rax", DISPLAY_LABEL,
+	(level - 1) * TARGET_PTR_SIZE);
+  emit ("\tmovq\t%%rax, %d(%%rbp)", display_save_offset);
+  emit ("\tmovq\t%%rbp, %s+%d(%%rip)", DISPLAY_LABEL,
+	(level - 1) * TARGET_PTR_SIZE);
+}
+
+
+
+
+/* b_func_body marks the start of the body of the current function, for
+   b_tail_call_self to jump back to.  See backend-x86_64.h. */
+
+
+void b_func_body (void)
+{
+      /* Hold a place for the label, which is invisible until used */
+  asm_line ("");
+  body_rec = asm_mark () - 1;
+  asm_records ()[body_rec]->deleted = TRUE;
+  body_label = NULL;
+}
+
+
+
+
+/* b_dealloc_local_vars accepts an integer and emits code to decrease the
+   stack by that number of bytes, rounded up as in b_alloc_local_vars. */
+
+
+void b_dealloc_local_vars (int size)
+{
+    int old_space = next_multiple(size, STACK_ITEM);
+    emit ("\t\t\t\t# b_dealloc_local_vars ( size = %d )", size);
+
+    if (size < 0)
+	bug("negative size given to b_dealloc_local_vars");
+
+    loc_var_offset += old_space;
+    emit ("\taddq\t$%d, %%rsp", old_space);
+}
+
+
+
+
+
+/* Performs the actual return from a C or Pascal function, no matter where
+   %rsp is at this point, or jumps to the function jump_to instead for a
+   tail call if it is not NULL. */
+static void b_void_return (char *jump_to)
+{
+    int i;
+
+        /* Put back the display entry replaced by b_enter_display.  %r11
+         * holds no return value or argument. */
+    if (display_level >= 0) {
+        emit ("\tmovq\t%d(%%rbp), %%r11", display_save_offset);
+        emit ("\tmovq\t%%r11, %s+%d(%%rip)", DISPLAY_LABEL,
+              (display_level - 1) * TARGET_PTR_SIZE);
+    }
+    if (opt_debug)
+        emit ("\t.cfi_remember_state");
+        /* Put back the registers saved by b_save_var_regs */
+    for (i = 0; i < var_regs_saved; i++) {
+        emit ("\tmovq\t%d(%%rbp), %s", var_regs_offset + 8 * i,
+              var_reg64[i]);
+        if (opt_debug)
+            emit ("\t.cfi_restore\t%s", var_reg64[i]);
+    }
+    emit ("\tleave");
+    if (opt_debug) {
+        emit ("\t.cfi_restore\t%%rbp");
+        emit ("\t.cfi_def_cfa\t%%rsp, 8");
+    }
+    if (jump_to != NULL)
+        emit ("\tjmp\t%s", jump_to);	/* the callee returns to our caller */
+    else
+        emit ("\tret");	/* control goes back to caller */
+    if (opt_debug)
+        emit ("\t.cfi_restore_state");
+}
+
+
+
+
+
+
+
+/* b_func_epilogue accepts the name of a function and emits code
+   for the epilogue of a function by that name.  */
+
+
+void b_func_epilogue (char *f_name)
+{
+  int slot_offset = return_value_offset;
+
+  emit ("\t\t\t\t# b_func_epilogue (%s)", f_name);
+
+  /* Reset this to an illegal value */
+  return_value_offset = 0;
+  if (!tail_called)
+      b_void_return (NULL);
+  emit_traps ();
+  display_level = -1;
+  var_regs_saved = 0;
+  body_rec = -1;
+  if (opt_debug)
+      emit ("\t.cfi_endproc");
+  emit ("\t.size\t%s, .-%s", f_name, f_name);
+
+      /* Reset loc_var_offset to a positive (illegal) value */
+  loc_var_offset = 1;
+
+  if (opt_omit_frame_pointer)
+      omit_frame_pointer (asm_records () + func_start_rec,
+			  asm_mark () - func_start_rec, TRUE,
+			  return_slot_rec < 0 ? -1
+			  : return_slot_rec - func_start_rec,
+			  slot_offset, STACK_ITEM);
+  asm_flush (outfp, TRUE);
+}
+
+
+
+
+
+
+/* b_set_return pops the value on top of the stack into the space
+   designated for the return value (%rbp + return_value_offset). */
+
+
+void b_set_return (TYPETAG return_type)
+{
+  emitn ("\t\t\t\t# b_set_return (");
+  my_print_typetag (return_type);
+  emit  (")");
+
+  if (return_type == TYVOID)
+      bug("b_set_return: void return type");
+
+  if (return_value_offset >= 0)
+      bug("b_set_return: no space allocated for return value");
+
+  switch (return_type) {
+  case TYSIGNEDCHAR:
+  case TYUNSIGNEDCHAR:
+  case TYSIGNEDINT:
+  case TYUNSIGNEDINT:
+  case TYSIGNEDLONGINT:
+  case TYUNSIGNEDLONGINT:
+  case TYPTR:
+  case TYFLOAT:
+  case TYDOUBLE:
+      break;
+  default:
+      bug("b_set_return: illegal return type");
+  }
+
+  emit ("\tmovq\t(%%rsp), %%rax");
+  emit ("\tmovq\t%%rax, %d(%%rbp)", return_value_offset);
+  b_pop();
+}
+
+
+
+
+
+/* Loads the return value of the given type at the given operand into
+   %rax or %xmm0 */
+static void load_return_value (TYPETAG return_type, char *operand)
+{
+  switch (return_type) {
+  case TYSIGNEDCHAR:
+  case TYUNSIGNEDCHAR:
+      emit ("\tmov%sbl\t%s, %%eax", return_type==TYSIGNEDCHAR?"s":"z",
+            operand);
+      break;
+  case TYSIGNEDINT:
+  case TYUNSIGNEDINT:
+  case TYSIGNEDLONGINT:
+  case TYUNSIGNEDLONGINT:
+  case TYPTR:
+      emit ("\tmov%s\t%s, %s", int_sfx(return_type), operand,
+            int_rax(return_type));
+      break;
+  case TYFLOAT:
+  case TYDOUBLE:
+      emit ("\tmov%s\t%s, %%xmm0", SSE_SFX(return_type), operand);
+      break;
+  case TYVOID:
+      break;
+  default:
+      bug("illegal return type");
+  }
+}
+
+
+/* b_prepare_return loads the return value of a Pascal function from
+   %rbp + return_value_offset into the proper return register.  Does
+   nothing if return_type is TYVOID. */
+
+
+void b_prepare_return (TYPETAG return_type)
+{
+  char operand[20];
+
+  emitn ("\t\t\t\t# b_prepare_return (");
+  my_print_typetag (return_type);
+  emit  (")");
+
+      /* Nothing to do if void return type */
+  if (return_type == TYVOID)
+      return;
+
+  if (return_value_offset >= 0)
+      bug("b_prepare_return: no return value allocated");
+
+  sprintf (operand, "%d(%%rbp)", return_value_offset);
+  load_return_value (return_type, operand);
+}
+
+
+
+
+
+/* b_encode_return encodes a return statement in a C function, with the
+   value to be returned (if not TYVOID) on top of the stack. */
+
+
+void b_encode_return (TYPETAG return_type)
+{
+  emitn ("\t\t\t\t# b_encode_return (");
+  my_print_typetag (return_type);
+  emit  (")");
+
+  load_return_value (return_type, "(%rsp)");
+  b_void_return (NULL);
+}
+
+
+
+
+
+
+/* b_alloc_arglist takes the total size (in bytes) of actual arguments in a
+   function call, and allocates space on the stack for them.
+
+   The argument list build looks like this, from %rsp upward:
+
+       stack arguments        actual_arg_space[aaa_top] bytes
+       register save area     REG_SAVE_SIZE bytes
+       (padding)
+       saved %rsp
+
+   or, with -fdirect-args where the alignment of %rsp is known from the
+   code so far (see frame.c), the stack arguments and the register save
+   area over actual_arg_pad[aaa_top] bytes of padding, all of which is
+   removed with a constant after the call.
+
+   b_load_arg puts each register argument in the save area, because
+   evaluating later arguments may clobber the registers; they are loaded
+   into the argument registers just before the call.  Each stack argument
+   takes 8 bytes, and every promoted argument type is at least 4 bytes, so
+   twice total_size is enough space for the stack arguments.
+
+   NOTE: you must call b_alloc_arglist for each function call, even if
+   no actual arguments are passed.  Also, every call to b_alloc_arglist
+   must be followed (as in matching parentheses) by a call to either
+   b_funcall_by_name or b_funcall_by_ptr, with zero or more calls to
+   b_load_arg in between.  */
+
+
+void b_alloc_arglist (int total_size)
+{
+    int arg_space;
+
+    if (total_size < 0)
+	bug("negative size for actual argument list in b_alloc_arglist");
+
+        /* Keeps %rsp 16-byte aligned, since REG_SAVE_SIZE is a multiple
+         * of 16 */
+    arg_space = next_multiple(2*total_size, 16);
+
+    emit ("\t\t\t\t# b_alloc_arglist (%d bytes)", total_size);
+
+    if (++aaa_top >= MAX_CALL_NEST)
+	bug("function calls nested too deeply in b_alloc_arglist");
+    actual_arg_int_regs[aaa_top] = 0;
+    actual_arg_float_regs[aaa_top] = 0;
+    actual_arg_word_count[aaa_top] = 0;
+    actual_arg_space[aaa_top] = arg_space;
+    actual_arg_pad[aaa_top] = -1;
+
+    if (opt_direct_args) {
+	int pad = stack_align_pad (asm_records () + func_start_rec,
+				   asm_mark () - func_start_rec, TRUE);
+
+	if (pad >= 0) {
+	    actual_arg_pad[aaa_top] = pad;
+	    emit ("\tsubq\t$%d, %%rsp", pad + arg_space + REG_SAVE_SIZE);
+	    return;
+	}
+    }
+
+        /* Save the old %rsp where we can find it after the call, and
+         * 16-byte align the stack pointer, as in backend-x86.c */
+    emit ("\tmovq\t%%rsp, %%rax");
+    emit ("\tsubq\t$8, %%rsp");
+    emit ("\tandq\t$-16, %%rsp");
+    emit ("\tmovq\t%%rax, (%%rsp)");
+    emit ("\tsubq\t$%d, %%rsp", arg_space + REG_SAVE_SIZE);
+}
+
+
+
+
+
+
+/* Returns the offset from %rsp of the place in the argument list for the
+   next argument, of the given type */
+static int next_arg_offset (TYPETAG type)
+{
+    int arg_space = actual_arg_space[aaa_top];
+    int offset;
+
+    switch (type) {
+    case TYDOUBLE:
+	if (actual_arg_float_regs[aaa_top] < NUM_FLOAT_ARG_REGS)
+	    offset = arg_space + STACK_ITEM*(NUM_INT_ARG_REGS
+					     + actual_arg_float_regs[aaa_top]++);
+	else
+	    offset = STACK_ITEM*actual_arg_word_count[aaa_top]++;
+	break;
+    case TYSIGNEDINT:
+    case TYUNSIGNEDINT:
+    case TYSIGNEDLONGINT:
+    case TYUNSIGNEDLONGINT:
+    case TYPTR:
+	if (actual_arg_int_regs[aaa_top] < NUM_INT_ARG_REGS)
+	    offset = arg_space + STACK_ITEM*actual_arg_int_regs[aaa_top]++;
+	else
+	    offset = STACK_ITEM*actual_arg_word_count[aaa_top]++;
+	break;
+    default:
+	bug ("unpromoted function argument in b_load_arg");
+    }
+
+    if (STACK_ITEM*actual_arg_word_count[aaa_top] > arg_space)
+	bug ("stack arguments overflow the argument list in b_load_arg");
+    return offset;
+}
+
+
+/* b_load_arg accepts the type of an argument in a function call, pops
+   a value of this type off the stack, and puts it where the callee
+   expects it: in the register save area (see b_alloc_arglist) if an
+   argument register of the right kind is left, otherwise in the next
+   stack argument slot.
+
+   WARNING: it is assumed that the argument list lies direcly underneath the
+   current top value on the stack.  Therefore, b_load_arg must be called
+   after each push of an argument value, before the next argument is
+   pushed. */
+
+
+void b_load_arg (TYPETAG type)
+{
+    int offset;
+
+    emitn ("\t\t\t\t# b_load_arg (");
+    my_print_typetag (type);
+    emit (")");
+
+    offset = next_arg_offset (type);
+    emit ("\tmovq\t(%%rsp), %%rax");
+    b_pop ();
+    emit ("\tmovq\t%%rax, %d(%%rsp)", offset);
+}
+
+
+
+
+/* b_load_arg_const_int stores an integer constant argument straight into
+   its place in the argument list.  See backend-x86_64.h. */
+void b_load_arg_const_int (long value)
+{
+    emit ("\t\t\t\t# b_load_arg_const_int (%ld)", value);
+
+    if (fits_imm32 (value))
+	emit ("\tmovq\t$%ld, %d(%%rsp)", value,
+	      next_arg_offset (TYSIGNEDLONGINT));
+    else {
+	emit ("\tmovabsq\t$%ld, %%rax", value);
+	emit ("\tmovq\t%%rax, %d(%%rsp)", next_arg_offset (TYSIGNEDLONGINT));
+    }
+}
+
+
+
+
+static void load_arg_regs (void)
+{
+    int arg_space = actual_arg_space[aaa_top];
+    int i;
+
+    for (i = 0; i < actual_arg_int_regs[aaa_top]; i++)
+	emit ("\tmovq\t%d(%%rsp), %s", arg_space + STACK_ITEM*i,
+	      int_arg_reg[i]);
+    for (i = 0; i < actual_arg_float_regs[aaa_top]; i++)
+	emit ("\tmovsd\t%d(%%rsp), %%xmm%d",
+	      arg_space + STACK_ITEM*(NUM_INT_ARG_REGS+i), i);
+        /* For variadic callees, %al holds the number of vector
+         * registers used */
+    emit ("\tmovl\t$%d, %%eax", actual_arg_float_regs[aaa_top]);
+}
+
+
+/* b_funcall_by_name accepts a function name and a return type for the
+   function.  It emits code to call that function, remove the argument
+   list built for it, and push the return value (if any) of the function
+   onto the stack.  See backend-x86_64.h. */
+void b_funcall_by_name (char *f_name, TYPETAG return_type)
+{
+  emitn ("\t\t\t\t# b_funcall_by_name (%s, ", f_name);
+  my_print_typetag (return_type);
+  emit  (")");
+
+  load_arg_regs ();
+  emit ("\tcall\t%s", f_name);
+
+  post_call_clean_up (return_type, TRUE);
+}
+
+
+
+
+
+
+/* b_funcall_by_ptr is like b_funcall_by_name, but pops the entry
+   address of the function off the stack first.  */
+
+
+void b_funcall_by_ptr (TYPETAG return_type)
+{
+  emitn ("\t\t\t\t# b_funcall_by_ptr (");
+  my_print_typetag (return_type);
+  emit  (")");
+
+      /* %r11 is not used for arguments */
+  emit ("\tmovq\t(%%rsp), %%r11");   /* load procedure value */
+  b_pop ();                           /* pop from stack */
+
+  load_arg_regs ();
+  emit ("\tcall\t*%%r11");
+
+  post_call_clean_up (return_type, FALSE);
+}
+
+
+
+
+/* Tail calls, as in backend-x86.c.  Arguments that go in registers are
+   popped straight into them, and the others over the function's own
+   stack arguments.  See backend-x86_64.h. */
+
+
+int b_code_mark (void)
+{
+  return asm_mark ();
+}
+
+
+BOOLEAN b_code_is_empty (int start, int end)
+{
+  ASM_LIST *recs = asm_records ();
+  int i;
+
+  for (i = start; i < end; i++)
+      if (recs[i]->kind != AK_COMMENT && recs[i]->kind != AK_DEBUG)
+	  return FALSE;
+  return TRUE;
+}
+
+
+BOOLEAN b_retract_code (int start, int end)
+{
+  ASM_LIST *recs = asm_records ();
+  int i;
+
+  for (i = end; i < asm_mark (); i++)
+      if (recs[i]->kind != AK_COMMENT && recs[i]->kind != AK_DEBUG
+	  && recs[i]->kind != AK_LABEL)
+	  return FALSE;
+  for (i = start; i < end; i++)
+      recs[i]->deleted = TRUE;
+
+      /* Labels reached from elsewhere go after the tail call */
+  moved_from = end;
+  moved_to = asm_mark ();
+  for (i = moved_from; i < moved_to; i++)
+      if (recs[i]->kind == AK_LABEL)
+	  recs[i]->deleted = TRUE;
+  return TRUE;
+}
+
+
+/* Ends a tail call: puts back the labels retracted with its code, and
+   returns TRUE if there are none, so nothing else reaches the end of the
+   function. */
+static BOOLEAN end_tail_call (void)
+{
+  ASM_LIST *recs = asm_records ();
+  BOOLEAN moved = FALSE;
+  int i;
+
+  for (i = moved_from; i < moved_to; i++)
+      if (recs[i]->kind == AK_LABEL) {
+	  emit ("%s:", recs[i]->op);
+	  moved = TRUE;
+      }
+  moved_from = moved_to = 0;
+  tail_called = !moved;
+  return tail_called;
+}
+
+
+BOOLEAN b_tail_call_self (int nparams, TYPETAG types[], int offsets[])
+{
+  int i;
+
+  emit ("\t\t\t\t# b_tail_call_self (%d params)", nparams);
+
+  if (body_rec < 0)
+      bug("b_tail_call_self: no function body");
+
+      /* The last value is on top.  Each value and each parameter slot
+         takes a whole stack item, so the types do not matter here. */
+  (void) types;
+  for (i = nparams - 1; i >= 0; i--) {
+      emit ("\tmovq\t(%%rsp), %%rax");
+      b_pop ();
+      emit ("\tmovq\t%%rax, %d(%%rbp)", offsets[i]);
+  }
+
+  if (body_label == NULL) {
+      ASM_LIST rec = asm_records ()[body_rec];
+
+      body_label = new_symbol ();
+      asm_set_label (rec, body_label);
+      rec->deleted = FALSE;
+  }
+  emit ("\tjmp\t%s", body_label);
+  return end_tail_call ();
+}
+
+
+/* Returns where each of the arguments of the given (promoted) types goes
+   for a call: the number of an argument register of its kind, or
+   -1 - k for the kth stack argument.  Sets *nfloat to the number of
+   vector registers used, and returns the number of stack arguments. */
+static int arg_places (int nargs, TYPETAG types[], int places[], int *nfloat)
+{
+  int i, nint = 0, nstack = 0;
+
+  *nfloat = 0;
+  for (i = 0; i < nargs; i++) {
+      if (types[i] == TYDOUBLE)
+	  places[i] = *nfloat < NUM_FLOAT_ARG_REGS ? (*nfloat)++ : -1 - nstack++;
+      else
+	  places[i] = nint < NUM_INT_ARG_REGS ? nint++ : -1 - nstack++;
+  }
+  return nstack;
+}
+
+
+BOOLEAN b_tail_call_fits (int nargs, TYPETAG types[])
+{
+  int places[nargs];
+  int nfloat;
+
+  return STACK_ITEM * arg_places (nargs, types, places, &nfloat)
+      <= caller_offset - FUNC_LINK_OFFSET;
+}
+
+
+BOOLEAN b_tail_call_by_name (char *f_name, int nargs, TYPETAG types[])
+{
+  int places[nargs];
+  int i, nfloat;
+
+  emit ("\t\t\t\t# b_tail_call_by_name (%s, %d args)", f_name, nargs);
+
+  if (!b_tail_call_fits (nargs, types))
+      bug("b_tail_call_by_name: arguments do not fit");
+
+  arg_places (nargs, types, places, &nfloat);
+  for (i = nargs - 1; i >= 0; i--) {
+      if (places[i] < 0) {
+	  emit ("\tmovq\t(%%rsp), %%rax");
+	  emit ("\tmovq\t%%rax, %d(%%rbp)",
+		FUNC_LINK_OFFSET + STACK_ITEM * (-1 - places[i]));
+      }
+      else if (types[i] == TYDOUBLE)
+	  emit ("\tmovsd\t(%%rsp), %%xmm%d", places[i]);
+      else
+	  emit ("\tmovq\t(%%rsp), %s", int_arg_reg[places[i]]);
+      b_pop ();
+  }
+        /* For variadic callees, %al holds the number of vector
+         * registers used */
+  emit ("\tmovl\t$%d, %%eax", nfloat);
+
+  b_void_return (f_name);
+  return end_tail_call ();
+}
+
+
+
+
+
+
+/* b_global_decl emits the pseudo-op .data if beginning a data
+   section.  In any case, it emits the pseudo-op .global for a global
+   variable and a label for that variable, as well as an .align to the
+   appropriate alignment.  See backend-x86_64.h. */
+
+
+void b_global_decl (char *id, int alignment, unsigned int size)
+{
+  emit ("\t\t\t\t# b_global_decl (%s, alignment = %d, size = %u)", id, alignment, size);
+
+  emit (".globl %s", id);
+  if (asm_section != SEC_DATA) {
+    emit ("\t.data");
+    asm_section = SEC_DATA;
+  }
+  emit ("\t.align\t%d", alignment);
+  emit ("\t.type\t%s, @object", id);
+  emit ("\t.size\t%s, %u", id, size);
+  b_label (id);
+}
+
+
+
+
+
+/* The following seven functions emit code to allocate space for
+   characters, short integers, integers, long integers, pointers, floats,
+   and doubles, respectively.  See backend-x86_64.h. */
+
+
+void b_alloc_char (int init)
+{
+  emit ("\t.byte\t%d", init);
+}
+
+
+
+void b_alloc_short (int init)
+{
+    emit ("\t.value\t%d", init);
+}
+
+
+
+void b_alloc_int (int init)
+{
+  emit ("\t.long\t%d", init);
+}
+
+
+
+void b_alloc_long (long init)
+{
+  emit ("\t.quad\t%ld", init);
+}
+
+
+
+void b_alloc_ptr (char *init)
+{
+  emit ("\t.quad\t%s", init);
+}
+
+
+void b_alloc_float (double init)
+{
+  global_float_val = (float)init;
+  emit ("\t.long\t%d", *(int *)&global_float_val);
+}
+
+
+void b_alloc_double (double init)
+{
+    emit ("\t.long\t%d", ((int *)&init)[0]);
+    emit ("\t.long\t%d", ((int *)&init)[1]);
+}
+
+
+
+
+
+/* b_skip() allocates a given number of bytes of space in static storage.
+   These bytes are zeroed.  Use b_skip() after a truncated
+   initialization list.  */
+
+void b_skip(unsigned int amount)
+{
+  emit ("\t.zero\t%u", amount);
+}
+
+
+
+/*  emit prints printf strings to outfp, with an end-of-line character  */
+
+void emit( char *format, ... )
+{
+        va_list ap;
+	va_start (ap, format);
+	asm_vprintf (format, ap, TRUE);
+	va_end (ap);
+}
+
+
+
+/*  emitn prints printf strings to outfp with no end-of-line character  */
+
+void emitn( char *format, ... )
+{
+        va_list ap;
+	va_start (ap, format);
+	asm_vprintf (format, ap, FALSE);
+	va_end (ap);
+
+}
+
+
+
+
+/* b_label emits a label */
+
+
+void b_label (char *label)
+{
+  emit ("%s:", label);
+      /* A label after a tail call leads to the end of the function */
+  tail_called = FALSE;
+}
+
+
+
+
+/* new_symbol generates unique symbols that can be used as
+   local labels in the assembly code being emitted.  */
+
+
+char *new_symbol ()
+{
+  static int n = 0;
+  static char buf[20];
+  char *ret;
+
+  sprintf (buf, ".LC%d", n++);
+  ret = strdup (buf);
+  if ( !ret )
+      bug( "new_symbol: out of memory" );
+  return ret;
+}
+
+
+
+
+
+/* Handle clean-up after a function call: pop the argument list build,
+ * restore the original %rsp from before the build, and push the return
+ * value of the function, if any. */
+static void post_call_clean_up (TYPETAG return_type, BOOLEAN is_name)
+{
+  int arg_space = actual_arg_space[aaa_top];
+  int pad = actual_arg_pad[aaa_top--];
+
+  /* Upon return, remove argument list built for the call */
+  if (pad >= 0) {
+      emit ("\taddq\t$%d, %%rsp", pad + arg_space + REG_SAVE_SIZE);
+  }
+  else {
+      emit ("\taddq\t$%d, %%rsp", arg_space + REG_SAVE_SIZE);
+
+	  /* The original value of %rsp (before the argument build) is
+	   * stored right here.  Use %rcx so as not to trash the return
+	   * value. */
+      emit ("\tmovq\t(%%rsp), %%rcx");
+      emit ("\tmovq\t%%rcx, %%rsp");
+  }
+
+  if (return_type == TYVOID)
+      return;
+
+      /* Non-void return.  Make room to push the return value. */
+  b_push ();
+
+  switch (return_type) {
+
+  case TYSIGNEDCHAR:
+  case TYUNSIGNEDCHAR:
+      emit ("\tmov%sbl\t%%al, %%eax", return_type==TYSIGNEDCHAR?"s":"z");
+          /* FALL THROUGH!!! */
+
+  case TYSIGNEDINT:
+  case TYUNSIGNEDINT:
+  case TYSIGNEDLONGINT:
+  case TYUNSIGNEDLONGINT:
+  case TYPTR:
+      emit ("\tmovq\t%%rax, (%%rsp)");
+      break;
+
+  case TYFLOAT:
+  case TYDOUBLE:
+      emit ("\tmov%s\t%%xmm0, (%%rsp)", SSE_SFX(return_type));
+      break;
+
+  default:
+      bug ("unsupported type in b_funcall_by_%s", is_name?"name":"ptr");
+  }
+}
+
+
+
+
+static void divide_by_size(unsigned int size)
+{
+    int shift;
+    unsigned int i;
+    unsigned long cur, prev;
+
+    if (size == 0)
+	bug("b_ptr_arith_op: size must be positive");
+
+        /* This is zero-extended right shift, because size is unsigned. */
+    for (shift = 0; !(size & 0x00000001); shift++, size >>= 1)
+	;
+
+    if (shift > 0)
+            /* Sign-extended right shift (arithmetic right shift) */
+	emit("\tsarq\t$%d, %%rax", shift);
+
+    if (size == 1)
+	return;
+
+    /* size is odd and > 2; compute its inverse (mod 2^{64}) as in
+       backend-x86.c */
+    cur = size;
+    prev = 1;
+    i = 0;
+    while (i < 8*sizeof(unsigned long) && cur != 1) {
+	cur *= cur;
+	prev *= prev*size;
+	i++;
+    }
+
+    if (i >= 8*sizeof(unsigned long) || prev*size != 1)
+	bug("divide_by_size: modular arithmetic error!");
+
+    emit("\tmovabsq\t$%ld, %%rdx", (long)prev);
+    emit("\timulq\t%%rdx, %%rax");
+}
+
+
+
+
+/* b_source_file names the source file for the line numbers that -g
+   emits (see b_lineno_comment).  It should be called once, before any
+   other back-end routine.  Nothing is generated without -g. */
+
+
+void b_source_file (char *name)
+{
+  if (!opt_debug)
+    return;
+  emit ("\t.file\t\"%s\"", name);
+  emit ("\t.file\t1 \"%s\"", name);
+}
+
+
+
+
+
+/* b_lineno_comment generates a comment in the assembly code, displaying
+   the given number, and with -g a .loc directive for the line in code.
+   The comment is left out if -fverbose-asm is none.  */
+
+
+void b_lineno_comment (int lineno)
+{
+  char text[24];
+
+  if (opt_debug && asm_section == SEC_TEXT) {
+    sprintf (text, "\t.loc\t1 %d", lineno);
+    asm_line (text);
+  }
+  if (opt_verbose_asm == VERBOSE_NONE)
+    return;
+  sprintf (text, " #%5d", lineno);
+  asm_line (text);
+}
+
+
+
+
+
+/* b_arith_rel_op_string accepts an arithmetic/relational
+   operator of type B_ARITH_REL_OP and returns a string
+   indicating the nature of the arithmetic or relational
+   operator.  */
+
+
+char *b_arith_rel_op_string (B_ARITH_REL_OP arop)
+{
+  switch (arop) {
+
+  case B_ADD:
+    return " + ";
+
+  case B_SUB:
+    return " - ";
+
+  case B_MULT:
+    return " * ";
+
+  case B_DIV:
+    return " / ";
+
+  case B_MOD:
+    return " % ";
+
+  case B_LT:
+    return " < ";
+
+  case B_LE:
+    return " <= ";
+
+  case B_GT:
+    return " > ";
+
+  case B_GE:
+    return " >= ";
+
+  case B_EQ:
+    return " == ";
+
+  case B_NE:
+    return " != ";
+
+  default:
+    return "NO SUCH OP";
+  }
+}
+
+
+
+
+
+
+/* my_print_typetag is a version of ty_print_typetag (found
+   in types.c) that sends its output to stdout instead of
+   stderr.  */
+
+
+void my_print_typetag (TYPETAG tag)
+{
+  switch (tag) {
+  case TYARRAY:            emitn ("array"); break;
+  case TYBITFIELD:         emitn ("bitfield"); break;
+  case TYPTR:              emitn ("pointer"); break;
+  case TYSTRUCT:           emitn ("structure"); break;
+  case TYUNION:            emitn ("union"); break;
+  case TYENUM:             emitn ("enumeration"); break;
+  case TYFUNC:             emitn ("function"); break;
+  case TYFLOAT:            emitn ("float"); break;
+  case TYDOUBLE:           emitn ("double"); break;
+  case TYLONGDOUBLE:       emitn ("long double"); break;
+  case TYUNSIGNEDINT:      emitn ("unsigned int"); break;
+  case TYUNSIGNEDCHAR:     emitn ("unsigned char"); break;
+  case TYUNSIGNEDSHORTINT: emitn ("unsigned short int"); break;
+  case TYUNSIGNEDLONGINT:  emitn ("unsigned long int"); break;
+  case TYSIGNEDCHAR:       emitn ("signed char"); break;
+  case TYSIGNEDINT:        emitn ("signed int"); break;
+  case TYSIGNEDLONGINT:    emitn ("signed long int"); break;
+  case TYSIGNEDSHORTINT:   emitn ("signed short int"); break;
+  case TYVOID:             emitn ("void"); break;
+  case TYERROR:            emitn ("error"); break;
+  default:
+      bug("illegal tag in \"my_print_typetag\"");
+  }
+}
@@ -0,0 +1,848 @@
+/****************************************************************/
+/*								*/
+/*	CSCE531 - "Pascal" Compiler				*/
+/*								*/
+/*	--bounds.c--						*/
+/*								*/
+/*	Elimination of redundant array bounds checks on the	*/
+/*	SSA intermediate representation (see ir.h), enabled	*/
+/*	by -fbounds-elim.					*/
+/*								*/
+/****************************************************************/
+
+/*
+ * With -fbounds-checks, encode_array checks each index, less the low bound
+ * of its dimension, with an IR_CHECK_INDEX.  A check goes if the index is
+ * known to be in range already, which is worked out as an interval of
+ * values for each integer value:
+ *
+ * - a constant is its own interval, a comparison is 0 or 1, a conversion
+ *   from Char or Boolean fits in its type, and adding, subtracting,
+ *   multiplying or dividing by a constant, or taking it as a modulus,
+ *   moves the interval of the operand accordingly;
+ * - a value that has been checked is in range for the code after the
+ *   check that it dominates, and so is the variable it was loaded from,
+ *   until something may store to that;
+ * - in the body of a for loop with constant bounds, the control variable
+ *   is between them, as long as the body itself never changes it.
+ *
+ * What is known of variables is carried down the dominator tree the way
+ * gvn.c carries the loaded values: a block starts with what its immediate
+ * dominator ended with, less what the blocks on the paths between them
+ * may store to, and the same variables may be changed through pointers
+ * and by calls.  An interval stays within +-2^30, so that nothing done
+ * to it can overflow.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "ir.h"
+#include "message.h"
+
+/* The number of variables remembered, of blocks looked through for
+   stores between a block and its immediate dominator, and of values
+   looked through for an interval */
+#define MAX_FACTS 32
+#define MAX_WALK 64
+#define MAX_DEPTH 8
+
+/* The largest magnitude of a bound */
+#define LIMIT (1L << 30)
+
+typedef struct {
+    long lo, hi;
+} RANGE;
+
+/* What an address points into: a variable of the frame, a global, a
+   variable of an enclosing function, or anything */
+typedef enum { ROOT_LOCAL, ROOT_GLOBAL, ROOT_DISPLAY, ROOT_UNKNOWN } ROOT_KIND;
+
+typedef struct {
+    ROOT_KIND kind;
+    long offset;
+    char *name;
+    int level;
+} ROOT;
+
+/* The variable with the root, loaded as type, holds a value in range */
+typedef struct {
+    ROOT root;
+    TYPETAG type;
+    RANGE range;
+} FACT;
+
+typedef struct {
+    int n;
+    FACT fact[MAX_FACTS];
+} FACTS;
+
+/* A block of the dominator tree being walked, with what it ends with
+   and the next of its children to walk */
+typedef struct {
+    IR_BLOCK *block;
+    IR_BLOCK *child;
+    int mark;
+    FACTS *out;
+} FRAME;
+
+/* The interval of each value known from the checks and the loads seen,
+   indexed by id, and the changes made to it, so that those of a subtree
+   can be undone */
+static RANGE *ranges = NULL;
+static char *known = NULL;
+
+typedef struct {
+    int id;
+    char known;
+    RANGE range;
+} CHANGE;
+static CHANGE *changes = NULL;
+static int nchanges, changes_size;
+
+/* What replaces each check that goes, indexed by id (NULL if nothing) */
+static IR_VALUE *repl = NULL;
+
+/* The frame offsets of the local variables whose addresses are taken
+   for more than loading, storing and indexing */
+static long *escaped = NULL;
+static int nescaped, escaped_size;
+static BOOLEAN shared_frame;
+
+/* The children of each block in the dominator tree, indexed by index */
+static IR_BLOCK **first_child = NULL, **next_sibling = NULL;
+
+/* The blocks seen by kill_between, marked with the walk they were seen in */
+static int *seen = NULL;
+static int walk;
+
+
+static void *bounds_alloc (void *p, int *size, int n, size_t elsize)
+{
+    if (n < *size)
+	return p;
+    *size = *size ? 2 * *size : 16;
+    p = realloc(p, *size * elsize);
+    if (p == NULL)
+	bug("bounds: out of memory");
+    return p;
+}
+
+
+/* Intervals */
+
+static BOOLEAN make_range (RANGE *r, long lo, long hi)
+{
+    if (lo < -LIMIT || hi > LIMIT || lo > hi)
+	return FALSE;
+    r->lo = lo;
+    r->hi = hi;
+    return TRUE;
+}
+
+
+/* Sets *r to the values of the type, if it is narrower than an Integer */
+static BOOLEAN type_range (TYPETAG type, RANGE *r)
+{
+    switch (type) {
+    case TYSIGNEDCHAR:
+	return make_range(r, -128, 127);
+    case TYUNSIGNEDCHAR:
+	return make_range(r, 0, 255);
+    case TYSIGNEDSHORTINT:
+	return make_range(r, -32768, 32767);
+    case TYUNSIGNEDSHORTINT:
+	return make_range(r, 0, 65535);
+    default:
+	return FALSE;
+    }
+}
+
+
+static BOOLEAN is_integer (TYPETAG type)
+{
+    switch (type) {
+    case TYSIGNEDCHAR:
+    case TYUNSIGNEDCHAR:
+    case TYSIGNEDSHORTINT:
+    case TYUNSIGNEDSHORTINT:
+    case TYSIGNEDINT:
+    case TYUNSIGNEDINT:
+    case TYSIGNEDLONGINT:
+    case TYUNSIGNEDLONGINT:
+	return TRUE;
+    default:
+	return FALSE;
+    }
+}
+
+
+static BOOLEAN is_unsigned (TYPETAG type)
+{
+    return type == TYUNSIGNEDCHAR || type == TYUNSIGNEDSHORTINT
+	|| type == TYUNSIGNEDINT || type == TYUNSIGNEDLONGINT;
+}
+
+
+/* Records that v is in r from here on in the subtree being walked */
+static void set_range (IR_VALUE v, RANGE *r)
+{
+    CHANGE *c;
+
+    changes = bounds_alloc(changes, &changes_size, nchanges, sizeof(CHANGE));
+    c = &changes[nchanges++];
+    c->id = v->id;
+    c->known = known[v->id];
+    c->range = ranges[v->id];
+    known[v->id] = TRUE;
+    ranges[v->id] = *r;
+}
+
+
+/* Undoes the changes made since there were mark of them */
+static void undo_ranges (int mark)
+{
+    while (nchanges > mark) {
+	CHANGE *c = &changes[--nchanges];
+
+	known[c->id] = c->known;
+	ranges[c->id] = c->range;
+    }
+}
+
+
+/* Sets *r to the interval of the integer value v, and returns TRUE if
+   there is one */
+static BOOLEAN range_of (IR_VALUE v, RANGE *r, int depth)
+{
+    RANGE a, b;
+    long c;
+    int i;
+
+    if (depth > MAX_DEPTH)
+	return FALSE;
+    if (known[v->id]) {
+	*r = ranges[v->id];
+	return TRUE;
+    }
+    switch (v->op) {
+    case IR_CONST_INT:
+	return make_range(r, v->imm, v->imm);
+    case IR_DUP:
+	return range_of(v->args[0], r, depth + 1);
+    case IR_PHI:
+	for (i = 0, c = 0; i < v->nargs; i++) {
+	    if (v->args[i] == v)
+		continue;
+	    if (!range_of(v->args[i], &a, depth + 1))
+		return FALSE;
+	    if (c++ == 0 || a.lo < r->lo)
+		r->lo = a.lo;
+	    if (c == 1 || a.hi > r->hi)
+		r->hi = a.hi;
+	}
+	return c > 0;
+    case IR_CHECK_INDEX:
+	return make_range(r, 0, v->imm - 1);
+    case IR_CONVERT:
+	if (!is_integer(v->optype) || !is_integer(v->type))
+	    return FALSE;
+	if (!range_of(v->args[0], &a, depth + 1) && !type_range(v->optype, &a))
+	    return FALSE;
+	if (type_range(v->type, &b) && (a.lo < b.lo || a.hi > b.hi))
+	    *r = b;
+	else if (is_unsigned(v->type) && a.lo < 0)
+	    return FALSE;
+	else
+	    *r = a;
+	return TRUE;
+    case IR_NEGATE:
+	if (!is_integer(v->type) || is_unsigned(v->type)
+	    || !range_of(v->args[0], &a, depth + 1))
+	    return FALSE;
+	return make_range(r, -a.hi, -a.lo);
+    case IR_ARITH:
+	if (v->arop >= B_LT)
+	    return make_range(r, 0, 1);
+	if ((v->arop != B_ADD && v->arop != B_SUB) || !is_integer(v->optype)
+	    || !range_of(v->args[0], &a, depth + 1)
+	    || !range_of(v->args[1], &b, depth + 1))
+	    return FALSE;
+	if (v->arop == B_ADD) {
+	    if (!make_range(r, a.lo + b.lo, a.hi + b.hi))
+		return FALSE;
+	}
+	else if (!make_range(r, a.lo - b.hi, a.hi - b.lo))
+	    return FALSE;
+	return !is_unsigned(v->optype) || r->lo >= 0;
+    case IR_ARITH_IMM:
+	if (v->arop >= B_LT)
+	    return make_range(r, 0, 1);
+	c = v->imm;
+	if (!is_integer(v->optype) || c < -LIMIT || c > LIMIT
+	    || !range_of(v->args[0], &a, depth + 1))
+	    return FALSE;
+	switch (v->arop) {
+	case B_ADD:
+	    if (!make_range(r, a.lo + c, a.hi + c))
+		return FALSE;
+	    break;
+	case B_SUB:
+	    if (!make_range(r, a.lo - c, a.hi - c))
+		return FALSE;
+	    break;
+	case B_MULT:
+	    if (c > 0x7fff || c < -0x7fff || a.lo < -0x7fff || a.hi > 0x7fff)
+		return FALSE;
+	    if (c >= 0)
+		make_range(r, a.lo * c, a.hi * c);
+	    else
+		make_range(r, a.hi * c, a.lo * c);
+	    break;
+	case B_DIV:
+	    if (c <= 0)
+		return FALSE;
+	    make_range(r, a.lo / c, a.hi / c);
+	    break;
+	case B_MOD:
+	    if (c <= 0)
+		return FALSE;
+	    if (a.lo >= 0)
+		make_range(r, 0, a.hi < c ? a.hi : c - 1);
+	    else
+		make_range(r, 1 - c, c - 1);
+	    break;
+	default:
+	    return FALSE;
+	}
+	return !is_unsigned(v->optype) || r->lo >= 0;
+    default:
+	return FALSE;
+    }
+}
+
+
+/* Returns the value that v is a copy of, through dups and phis whose
+   operands all are copies of the same value */
+static IR_VALUE base_value (IR_VALUE v, int depth)
+{
+    IR_VALUE same = NULL, a;
+    int i;
+
+    if (depth > MAX_DEPTH)
+	return v;
+    if (v->op == IR_DUP)
+	return base_value(v->args[0], depth + 1);
+    if (v->op != IR_PHI)
+	return v;
+    for (i = 0; i < v->nargs; i++) {
+	if (v->args[i] == v)
+	    continue;
+	a = base_value(v->args[i], depth + 1);
+	if (same != NULL && a != same)
+	    return v;
+	same = a;
+    }
+    return same != NULL ? same : v;
+}
+
+
+/* Memory */
+
+static BOOLEAN is_remat_addr (IR_VALUE v)
+{
+    return v->op == IR_GLOBAL_ADDR || v->op == IR_LOCAL_ADDR
+	|| v->op == IR_DISPLAY_ADDR;
+}
+
+
+static ROOT root_of (IR_VALUE addr)
+{
+    ROOT r;
+
+    while (addr->op == IR_PTR_ARITH || addr->op == IR_DUP)
+	addr = addr->args[0];
+    memset(&r, 0, sizeof(r));
+    switch (addr->op) {
+    case IR_LOCAL_ADDR:
+	r.kind = ROOT_LOCAL;
+	r.offset = addr->imm;
+	break;
+    case IR_GLOBAL_ADDR:
+	r.kind = ROOT_GLOBAL;
+	r.name = addr->name;
+	break;
+    case IR_DISPLAY_ADDR:
+	r.kind = ROOT_DISPLAY;
+	r.offset = addr->imm;
+	r.level = addr->level;
+	break;
+    default:
+	r.kind = ROOT_UNKNOWN;
+	break;
+    }
+    return r;
+}
+
+
+static BOOLEAN is_escaped (long offset)
+{
+    int i;
+
+    for (i = 0; i < nescaped; i++)
+	if (escaped[i] == offset)
+	    return TRUE;
+    return FALSE;
+}
+
+
+/* Notes that the address v, if of a local variable, is used for more than
+   loading and storing */
+static void escape (IR_VALUE v)
+{
+    ROOT r = root_of(v);
+
+    if (v->op != IR_LOCAL_ADDR && v->op != IR_PTR_ARITH && v->op != IR_DUP)
+	return;
+    if (r.kind != ROOT_LOCAL || is_escaped(r.offset))
+	return;
+    escaped = bounds_alloc(escaped, &escaped_size, nescaped, sizeof(long));
+    escaped[nescaped++] = r.offset;
+}
+
+
+static void find_escaped (IR_FUNC *f)
+{
+    IR_BLOCK *b;
+    IR_INSN *insn;
+    int i;
+
+    nescaped = 0;
+    for (b = f->first; b != NULL; b = b->next) {
+	for (i = 0; i < b->nstack; i++)
+	    escape(b->stack[i]);
+	for (insn = b->first; insn != NULL; insn = insn->next)
+	    for (i = 0; i < insn->nargs; i++) {
+		if (i == 0 && (insn->op == IR_LOAD || insn->op == IR_STORE
+			       || insn->op == IR_INC_DEC || insn->op == IR_DUP
+			       || insn->op == IR_PTR_ARITH))
+		    continue;
+		escape(insn->args[i]);
+	    }
+    }
+}
+
+
+/* Tells whether the variable can be changed through a pointer or by a
+   call */
+static BOOLEAN is_visible (ROOT *r)
+{
+    return r->kind != ROOT_LOCAL || shared_frame || is_escaped(r->offset);
+}
+
+
+static BOOLEAN same_root (ROOT *a, ROOT *b)
+{
+    if (a->kind != b->kind)
+	return FALSE;
+    switch (a->kind) {
+    case ROOT_LOCAL:
+	return a->offset == b->offset;
+    case ROOT_GLOBAL:
+	return !strcmp(a->name, b->name);
+    case ROOT_DISPLAY:
+	return a->level == b->level && a->offset == b->offset;
+    default:
+	return FALSE;
+    }
+}
+
+
+/* Tells whether insn may change the variable with root r */
+static BOOLEAN may_write (IR_INSN *insn, ROOT *r)
+{
+    ROOT w;
+
+    switch (insn->op) {
+    case IR_STORE:
+    case IR_INC_DEC:
+	w = root_of(insn->args[0]);
+	return same_root(&w, r) || (w.kind == ROOT_UNKNOWN && is_visible(r));
+    case IR_CALL:
+    case IR_TAIL_SELF:
+    case IR_TAIL_CALL:
+	return is_visible(r);
+    default:
+	return FALSE;
+    }
+}
+
+
+/* Forgets what insn may change */
+static void kill_effects (FACTS *m, IR_INSN *insn)
+{
+    int i, n = 0;
+
+    for (i = 0; i < m->n; i++)
+	if (!may_write(insn, &m->fact[i].root))
+	    m->fact[n++] = m->fact[i];
+    m->n = n;
+}
+
+
+static FACT *find_fact (FACTS *m, IR_VALUE addr, TYPETAG type)
+{
+    ROOT r = root_of(addr);
+    int i;
+
+    for (i = 0; i < m->n; i++)
+	if (same_root(&m->fact[i].root, &r) && m->fact[i].type == type)
+	    return &m->fact[i];
+    return NULL;
+}
+
+
+/* Remembers that the variable at addr holds a value in r */
+static void add_fact (FACTS *m, IR_VALUE addr, TYPETAG type, RANGE *r)
+{
+    FACT *e;
+
+    if (!is_remat_addr(addr))
+	return;
+    e = find_fact(m, addr, type);
+    if (e == NULL) {
+	if (m->n == MAX_FACTS) {
+	    memmove(&m->fact[0], &m->fact[1], (MAX_FACTS - 1) * sizeof(FACT));
+	    m->n--;
+	}
+	e = &m->fact[m->n++];
+    }
+    e->root = root_of(addr);
+    e->type = type;
+    e->range = *r;
+}
+
+
+/* Forgets what the blocks on the paths from d to its child c in the
+   dominator tree may change */
+static void kill_between (FACTS *m, IR_BLOCK *c, IR_BLOCK *d)
+{
+    IR_BLOCK **work, *b;
+    IR_INSN *insn;
+    int nwork = 0, nseen = 0, i;
+
+    if (c->npreds == 1 && c->preds[0] == d)
+	return;
+    walk++;
+    work = (IR_BLOCK **) malloc((MAX_WALK + c->npreds) * sizeof(IR_BLOCK *));
+    if (work == NULL)
+	bug("bounds: out of memory");
+    for (i = 0; i < c->npreds; i++)
+	if (c->preds[i] != d && seen[c->preds[i]->index] != walk) {
+	    seen[c->preds[i]->index] = walk;
+	    work[nwork++] = c->preds[i];
+	}
+    while (nwork > 0 && m->n > 0) {
+	b = work[--nwork];
+	if (++nseen > MAX_WALK) {
+	    m->n = 0;
+	    break;
+	}
+	for (insn = b->first; insn != NULL; insn = insn->next)
+	    kill_effects(m, insn);
+	for (i = 0; i < b->npreds; i++) {
+	    IR_BLOCK *p = b->preds[i];
+
+	    if (p == d || seen[p->index] == walk)
+		continue;
+	    seen[p->index] = walk;
+	    if (nwork == MAX_WALK + c->npreds) {
+		m->n = 0;
+		nwork = 0;
+		break;
+	    }
+	    work[nwork++] = p;
+	}
+    }
+    free(work);
+}
+
+
+/* Tells whether any of the instructions after insn in its block may
+   change the variable with root r */
+static BOOLEAN written_after (IR_INSN *insn, ROOT *r)
+{
+    for (insn = insn->next; insn != NULL; insn = insn->next)
+	if (may_write(insn, r))
+	    return TRUE;
+    return FALSE;
+}
+
+
+/* For loops */
+
+static BOOLEAN is_operand (IR_INSN *insn, IR_VALUE v)
+{
+    int i;
+
+    for (i = 0; i < insn->nargs; i++)
+	if (insn->args[i] == v)
+	    return TRUE;
+    return FALSE;
+}
+
+
+/* Tells whether anything in b but the operands of iv may change the
+   variable with root r */
+static BOOLEAN changed_in (IR_BLOCK *b, IR_INSN *iv, ROOT *r)
+{
+    IR_INSN *insn;
+
+    for (insn = b->first; insn != NULL; insn = insn->next)
+	if (may_write(insn, r) && !is_operand(iv, insn))
+	    return TRUE;
+    return FALSE;
+}
+
+
+/* If b is the body of a for loop with a constant bound, remembers that
+   its control variable is within the bounds on entry.  The front end
+   stores the first value to the variable and goes to the header, which
+   compares the bound, left on the operand stack, with the variable, as
+   the phi iv of the values stored to it, and leaves the loop if it is
+   past.  The end of the body steps the variable and jumps back.  As long
+   as nothing else in the body changes the variable, it starts each
+   iteration between the lowest first value and the bound (or, for
+   downto, the bound and the highest first value). */
+static void for_loop_fact (IR_FUNC *f, IR_BLOCK *b, FACTS *m)
+{
+    IR_BLOCK *header, *r;
+    IR_INSN *test, *iv, *arg, *store = NULL;
+    IR_VALUE bound, value;
+    B_INC_DEC_OP step;
+    ROOT root, w;
+    RANGE first, range;
+    int i;
+
+    if (b->npreds != 1)
+	return;
+    header = b->preds[0];
+    test = header->last;
+    if (test == NULL || test->op != IR_BRANCH_REL || header->fall != b
+	|| (test->arop != B_LT && test->arop != B_GT)
+	|| (test->optype != TYSIGNEDINT && test->optype != TYSIGNEDLONGINT))
+	return;
+    step = test->arop == B_LT ? B_PRE_INC : B_PRE_DEC;
+    bound = base_value(test->args[0], 0);
+    iv = test->args[1];
+    if (bound->op != IR_CONST_INT || iv->op != IR_PHI || iv->block != header)
+	return;
+
+	/* Each operand of iv is the last change to the variable on its
+	   way in: a store of a first value, or the step */
+    for (i = 0; i < iv->nargs; i++) {
+	arg = iv->args[i];
+	if (arg->block != header->preds[i] || !is_remat_addr(arg->args[0]))
+	    return;
+	w = root_of(arg->args[0]);
+	if (i == 0)
+	    root = w;
+	else if (!same_root(&w, &root) || arg->type != iv->args[0]->type)
+	    return;
+	if (written_after(arg, &root))
+	    return;
+	if (arg->op == IR_STORE) {
+	    value = base_value(arg->args[1], 0);
+	    if (value->op != IR_CONST_INT)
+		return;
+	    if (store == NULL || value->imm < first.lo)
+		first.lo = value->imm;
+	    if (store == NULL || value->imm > first.hi)
+		first.hi = value->imm;
+	    store = arg;
+	}
+	else if (arg->op != IR_INC_DEC || arg->idop != step
+		 || arg->block->nsuccs != 1 || !ir_dominates(b, arg->block))
+	    return;
+    }
+    if (store == NULL)
+	return;
+    if (step == B_PRE_INC ? !make_range(&range, first.lo, bound->imm)
+	: !make_range(&range, bound->imm, first.hi))
+	return;
+
+    if (changed_in(header, iv, &root))
+	return;
+    for (r = f->first; r != NULL; r = r->next)
+	if (r->rpo >= 0 && ir_dominates(b, r) && changed_in(r, iv, &root))
+	    return;
+    add_fact(m, store->args[0], store->type, &range);
+}
+
+
+/* Checks */
+
+/* Takes out the check if its index is known to be in range, and
+   otherwise remembers that it is from here on, as is the variable it
+   was loaded from if nothing has changed that since */
+static void check_index (IR_INSN *check, FACTS *m)
+{
+    IR_VALUE index = check->args[0], load;
+    IR_INSN *insn;
+    RANGE r;
+    ROOT root;
+    long delta = 0;
+
+    if (range_of(index, &r, 0) && r.lo >= 0 && r.hi < check->imm) {
+	repl[check->id] = index;
+	return;
+    }
+    if (!make_range(&r, 0, check->imm - 1))
+	return;
+    set_range(index, &r);
+
+    load = base_value(index, 0);
+    if (load->op == IR_ARITH_IMM && (load->arop == B_ADD || load->arop == B_SUB)
+	&& load->imm >= -LIMIT && load->imm <= LIMIT) {
+	delta = load->arop == B_ADD ? load->imm : -load->imm;
+	load = base_value(load->args[0], 0);
+    }
+    if (load->op != IR_LOAD || load->block != check->block
+	|| !is_remat_addr(load->args[0])
+	|| !make_range(&r, -delta, check->imm - 1 - delta))
+	return;
+    root = root_of(load->args[0]);
+    for (insn = load->next; insn != check; insn = insn->next)
+	if (may_write(insn, &root))
+	    return;
+    add_fact(m, load->args[0], load->type, &r);
+}
+
+
+static void check_block (IR_BLOCK *b, FACTS *m)
+{
+    IR_INSN *insn;
+    FACT *e;
+    RANGE r;
+
+    for (insn = b->first; insn != NULL; insn = insn->next)
+	switch (insn->op) {
+	case IR_LOAD:
+	    if (is_remat_addr(insn->args[0])
+		&& (e = find_fact(m, insn->args[0], insn->type)) != NULL)
+		set_range(insn, &e->range);
+	    break;
+	case IR_STORE:
+	    kill_effects(m, insn);
+	    if (range_of(insn->args[1], &r, 0))
+		add_fact(m, insn->args[0], insn->type, &r);
+	    break;
+	case IR_CHECK_INDEX:
+	    check_index(insn, m);
+	    break;
+	default:
+	    kill_effects(m, insn);
+	    break;
+	}
+}
+
+
+static IR_VALUE replacement (IR_VALUE v)
+{
+    while (repl[v->id] != NULL)
+	v = repl[v->id];
+    return v;
+}
+
+
+void ir_remove_bounds_checks (IR_FUNC *f)
+{
+    FRAME *stack;
+    IR_BLOCK *b;
+    IR_INSN *insn, *next;
+    FACTS m;
+    int depth, i;
+
+    if (f->first == NULL)
+	return;
+    ranges = (RANGE *) realloc(ranges, (f->ninsns + 1) * sizeof(RANGE));
+    known = (char *) realloc(known, f->ninsns + 1);
+    repl = (IR_VALUE *) realloc(repl, (f->ninsns + 1) * sizeof(IR_VALUE));
+    first_child = (IR_BLOCK **) realloc(first_child,
+					(f->nblocks + 1) * sizeof(IR_BLOCK *));
+    next_sibling = (IR_BLOCK **) realloc(next_sibling,
+					 (f->nblocks + 1) * sizeof(IR_BLOCK *));
+    seen = (int *) realloc(seen, (f->nblocks + 1) * sizeof(int));
+    stack = (FRAME *) malloc((f->nblocks + 1) * sizeof(FRAME));
+    if (ranges == NULL || known == NULL || repl == NULL || first_child == NULL
+	|| next_sibling == NULL || seen == NULL || stack == NULL)
+	bug("bounds: out of memory");
+    memset(known, 0, f->ninsns + 1);
+    memset(repl, 0, (f->ninsns + 1) * sizeof(IR_VALUE));
+    memset(seen, 0, (f->nblocks + 1) * sizeof(int));
+    nchanges = 0;
+    walk = 0;
+
+    ir_find_dominators(f);
+    shared_frame = f->shared_frame;
+    find_escaped(f);
+    for (b = f->first; b != NULL; b = b->next)
+	first_child[b->index] = next_sibling[b->index] = NULL;
+    for (b = f->last; b != NULL; b = b->prev)
+	if (b->idom != NULL) {
+	    next_sibling[b->index] = first_child[b->idom->index];
+	    first_child[b->idom->index] = b;
+	}
+
+	/* Down the dominator tree, each block starting with what its
+	   immediate dominator ended with */
+    m.n = 0;
+    check_block(f->first, &m);
+    stack[0].block = f->first;
+    stack[0].child = first_child[f->first->index];
+    stack[0].mark = 0;
+    stack[0].out = (FACTS *) malloc(sizeof(FACTS));
+    if (stack[0].out == NULL)
+	bug("bounds: out of memory");
+    *stack[0].out = m;
+    depth = 1;
+    while (depth > 0) {
+	FRAME *top = &stack[depth - 1];
+
+	if (top->child == NULL) {
+	    undo_ranges(top->mark);
+	    free(top->out);
+	    depth--;
+	    continue;
+	}
+	b = top->child;
+	top->child = next_sibling[b->index];
+	m = *top->out;
+	kill_between(&m, b, top->block);
+	for_loop_fact(f, b, &m);
+	stack[depth].block = b;
+	stack[depth].child = first_child[b->index];
+	stack[depth].mark = nchanges;
+	check_block(b, &m);
+	stack[depth].out = (FACTS *) malloc(sizeof(FACTS));
+	if (stack[depth].out == NULL)
+	    bug("bounds: out of memory");
+	*stack[depth].out = m;
+	depth++;
+    }
+    free(stack);
+
+	/* The checks that go have no uses left */
+    for (b = f->first; b != NULL; b = b->next) {
+	for (i = 0; i < b->nstack; i++)
+	    b->stack[i] = replacement(b->stack[i]);
+	for (insn = b->first; insn != NULL; insn = insn->next)
+	    for (i = 0; i < insn->nargs; i++)
+		insn->args[i] = replacement(insn->args[i]);
+    }
+    for (b = f->first; b != NULL; b = b->next)
+	for (insn = b->first; insn != NULL; insn = next) {
+	    next = insn->next;
+	    if (repl[insn->id] != NULL)
+		ir_delete_insn(insn);
+	}
+}
@@ -0,0 +1,381 @@
+/****************************************************************/
+/*								*/
+/*	CSCE531 - "Pascal" Compiler				*/
+/*								*/
+/*	--dce.c--						*/
+/*								*/
+/*	Dead-code elimination on the SSA intermediate		*/
+/*	representation (see ir.h), enabled by -fdce.		*/
+/*								*/
+/****************************************************************/
+
+/*
+ * A conditional jump on a constant, as in "if false then" or "while true
+ * do", or a case dispatch on a constant selector, always goes the same
+ * way, so it becomes a plain jump (or falls through) and the edge it no
+ * longer takes goes.  The blocks that can then not be reached from the
+ * entry, and those that never could, such as the code after a break,
+ * lose their code and their edges.
+ *
+ * A store to a local variable that is never loaded, incremented or has
+ * its address taken for anything else is dead too, unless nested
+ * functions can see the frame.  The stored value is kept only if it is
+ * used otherwise; the lowering drops whatever computed it if that has no
+ * effect.
+ *
+ * This runs before the trivial phis are removed, so those left with one
+ * operand by the edges taken out go with them.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "ir.h"
+#include "message.h"
+
+/* How many phis const_value sees through, which also ends a cycle of them */
+#define MAX_PHIS 8
+
+/* The frame offsets of the local variables read somewhere */
+static long *read_vars = NULL;
+static int nread, read_size;
+
+
+/* Returns the one value the phi v stands for, or NULL if it has more */
+static IR_VALUE phi_value (IR_VALUE v)
+{
+    IR_VALUE same = NULL;
+    int i;
+
+    for (i = 0; i < v->nargs; i++) {
+	if (v->args[i] == v || v->args[i] == same)
+	    continue;
+	if (same != NULL)
+	    return NULL;
+	same = v->args[i];
+    }
+    return same;
+}
+
+
+/* Sets *val to the value of v and returns TRUE if it is an integer
+   constant, or a conversion or negation of one.  The phis are still
+   there, so one that has the same operand on every edge is seen
+   through. */
+static BOOLEAN const_value (IR_VALUE v, long *val)
+{
+    long x;
+    int n;
+
+    for (n = 0; v != NULL && v->op == IR_PHI; n++) {
+	if (n == MAX_PHIS)
+	    return FALSE;
+	v = phi_value(v);
+    }
+    if (v == NULL)
+	return FALSE;
+    switch (v->op) {
+    case IR_CONST_INT:
+	*val = v->imm;
+	return TRUE;
+    case IR_NEGATE:
+	if (!const_value(v->args[0], &x))
+	    return FALSE;
+	*val = -x;
+	return TRUE;
+    case IR_CONVERT:
+	if (!const_value(v->args[0], &x))
+	    return FALSE;
+	switch (v->type) {
+	case TYSIGNEDCHAR:
+	    *val = (signed char) x;
+	    return TRUE;
+	case TYUNSIGNEDCHAR:
+	    *val = (unsigned char) x;
+	    return TRUE;
+	case TYSIGNEDSHORTINT:
+	    *val = (short) x;
+	    return TRUE;
+	case TYUNSIGNEDSHORTINT:
+	    *val = (unsigned short) x;
+	    return TRUE;
+	case TYSIGNEDINT:
+	    *val = (int) x;
+	    return TRUE;
+	case TYUNSIGNEDINT:
+	    *val = (unsigned int) x;
+	    return TRUE;
+	case TYSIGNEDLONGINT:
+	case TYUNSIGNEDLONGINT:
+	    *val = x;
+	    return TRUE;
+	default:
+	    return FALSE;
+	}
+    default:
+	return FALSE;
+    }
+}
+
+
+/* Tells whether a arop b holds, for values of the type */
+static BOOLEAN holds (B_ARITH_REL_OP arop, TYPETAG type, long a, long b)
+{
+    if (type == TYUNSIGNEDINT || type == TYUNSIGNEDLONGINT || type == TYPTR) {
+	unsigned long ua = (unsigned long) a, ub = (unsigned long) b;
+
+	switch (arop) {
+	case B_LT:
+	    return ua < ub;
+	case B_LE:
+	    return ua <= ub;
+	case B_GT:
+	    return ua > ub;
+	case B_GE:
+	    return ua >= ub;
+	default:
+	    break;
+	}
+    }
+    switch (arop) {
+    case B_LT:
+	return a < b;
+    case B_LE:
+	return a <= b;
+    case B_GT:
+	return a > b;
+    case B_GE:
+	return a >= b;
+    case B_EQ:
+	return a == b;
+    default:
+	return a != b;
+    }
+}
+
+
+/* Returns the block the terminator term always goes to, or NULL if that
+   is not known; *jumps is set if it gets there by jumping */
+static IR_BLOCK *constant_target (IR_INSN *term, BOOLEAN *jumps)
+{
+    IR_BLOCK *fall = term->block->fall;
+    long a, b;
+    unsigned long index;
+    BOOLEAN taken;
+
+    switch (term->op) {
+    case IR_BRANCH:
+	if (!const_value(term->args[0], &a))
+	    return NULL;
+	taken = term->cond == B_ZERO ? a == 0 : a != 0;
+	break;
+    case IR_BRANCH_REL:
+	if (!const_value(term->args[0], &a) || !const_value(term->args[1], &b))
+	    return NULL;
+	taken = holds(term->arop, term->optype, a, b);
+	break;
+    case IR_BRANCH_REL_IMM:
+    case IR_DISPATCH:
+	if (!const_value(term->args[0], &a))
+	    return NULL;
+	taken = holds(term->arop, term->optype, a, term->imm);
+	break;
+    case IR_DISPATCH_BITS:
+	if (!const_value(term->args[0], &a))
+	    return NULL;
+	/* The subtraction wraps around, as the machine's does */
+	index = (unsigned long) a - term->imm;
+	taken = index < 32 && (term->mask >> index & 1);
+	break;
+    case IR_JUMP_TABLE:
+	if (!const_value(term->args[0], &a))
+	    return NULL;
+	index = (unsigned long) a - term->imm;
+	*jumps = TRUE;
+	if (index >= (unsigned long) term->ntargets - 1)
+	    return term->targets[term->ntargets - 1];
+	return term->targets[index];
+    default:
+	return NULL;
+    }
+    *jumps = taken;
+    return taken ? term->targets[0] : fall;
+}
+
+
+/* Tells whether v is on the operand stack on entry to b */
+static BOOLEAN on_entry (IR_BLOCK *b, IR_VALUE v)
+{
+    int i;
+
+    for (i = 0; i < b->nstack; i++)
+	if (b->stack[i] == v)
+	    return TRUE;
+    return FALSE;
+}
+
+
+/* Inserts a drop of v before insn */
+static void drop_before (IR_VALUE v, IR_INSN *insn)
+{
+    IR_INSN *drop = ir_new_insn(IR_DROP, v->type, 1);
+
+    drop->args[0] = v;
+    ir_insert_before(drop, insn);
+}
+
+
+/* Makes block b, which ends with term, go to only: by falling into it
+   if it can, or else by jumping */
+static void fold_branch (IR_BLOCK *b, IR_INSN *term, IR_BLOCK *to,
+			 BOOLEAN jumps)
+{
+    int i;
+
+	/* What the jump would have taken off the stack is dropped: the
+	   operand of a dispatch that pops when it jumps, or the operands of
+	   a branch that were there on entry to the block */
+    if (term->op == IR_DISPATCH || term->op == IR_DISPATCH_BITS) {
+	if (jumps && term->pop)
+	    drop_before(term->args[0], term);
+    }
+    else
+	for (i = term->nargs - 1; i >= 0; i--)
+	    if (on_entry(b, term->args[i]))
+		drop_before(term->args[i], term);
+
+    for (i = b->nsuccs - 1; i >= 0; i--)
+	if (b->succs[i] != to)
+	    ir_remove_edge(b, b->succs[i]);
+    if (to == b->fall || (b->fall == NULL && to == b->next)) {
+	b->fall = to;
+	ir_delete_insn(term);
+	return;
+    }
+    term->op = IR_JUMP;
+    term->type = term->optype = TYVOID;
+    term->pop = FALSE;
+    term->nargs = 0;
+    term->ntargets = 1;
+    term->targets[0] = to;
+}
+
+
+/* Takes out the code and the edges of the blocks that cannot be reached
+   from the entry */
+static void remove_unreachable (IR_FUNC *f)
+{
+    IR_BLOCK *b;
+    IR_INSN *insn, *next;
+
+    ir_find_dominators(f);
+    for (b = f->first; b != NULL; b = b->next) {
+	if (b->rpo >= 0)
+	    continue;
+	while (b->nsuccs > 0)
+	    ir_remove_edge(b, b->succs[b->nsuccs - 1]);
+    }
+    for (b = f->first; b != NULL; b = b->next) {
+	if (b->rpo >= 0)
+	    continue;
+	for (insn = b->first; insn != NULL; insn = next) {
+	    next = insn->next;
+	    ir_delete_insn(insn);
+	}
+	b->dead = TRUE;
+	b->fall = NULL;
+	b->nstack = 0;
+	b->label = b->dispatch_label = NULL;
+    }
+}
+
+
+static BOOLEAN is_read (long offset)
+{
+    int i;
+
+    for (i = 0; i < nread; i++)
+	if (read_vars[i] == offset)
+	    return TRUE;
+    return FALSE;
+}
+
+
+static void note_read (IR_VALUE v)
+{
+    if (v->op != IR_LOCAL_ADDR || is_read(v->imm))
+	return;
+    if (nread == read_size) {
+	read_size = read_size ? 2 * read_size : 16;
+	read_vars = (long *) realloc(read_vars, read_size * sizeof(long));
+	if (read_vars == NULL)
+	    bug("dce: out of memory");
+    }
+    read_vars[nread++] = v->imm;
+}
+
+
+/* Takes out the stores to local variables that nothing reads */
+static void remove_dead_stores (IR_FUNC *f)
+{
+    IR_BLOCK *b;
+    IR_INSN *insn, *next, *drop;
+    int i;
+
+    nread = 0;
+    for (b = f->first; b != NULL; b = b->next) {
+	for (i = 0; i < b->nstack; i++)
+	    note_read(b->stack[i]);
+	for (insn = b->first; insn != NULL; insn = insn->next)
+	    for (i = 0; i < insn->nargs; i++)
+		if (insn->op != IR_STORE || i != 0)
+		    note_read(insn->args[i]);
+    }
+
+    ir_count_uses(f);
+    for (b = f->first; b != NULL; b = b->next)
+	for (insn = b->first; insn != NULL; insn = next) {
+	    next = insn->next;
+	    if (insn->op != IR_STORE || insn->args[0]->op != IR_LOCAL_ADDR
+		|| is_read(insn->args[0]->imm))
+		continue;
+		/* The value of the store may only be dropped */
+	    for (drop = insn->next; drop != NULL; drop = drop->next)
+		if (drop->op == IR_DROP && drop->args[0] == insn)
+		    break;
+	    if (insn->nuses > (drop != NULL))
+		continue;
+	    if (drop != NULL) {
+		if (on_entry(b, insn->args[1]))
+		    drop->args[0] = insn->args[1];
+		else {
+		    if (next == drop)
+			next = drop->next;
+		    ir_delete_insn(drop);
+		}
+	    }
+	    ir_delete_insn(insn);
+	}
+}
+
+
+void ir_remove_dead_code (IR_FUNC *f)
+{
+    IR_BLOCK *b;
+    IR_INSN *term;
+    IR_BLOCK *to;
+    BOOLEAN jumps;
+
+    if (f->first == NULL)
+	return;
+    for (b = f->first; b != NULL; b = b->next) {
+	term = b->last;
+	if (b->dead || term == NULL || !ir_is_terminator(term))
+	    continue;
+	to = constant_target(term, &jumps);
+	if (to != NULL)
+	    fold_branch(b, term, to, jumps);
+    }
+    remove_unreachable(f);
+    if (!f->shared_frame)
+	remove_dead_stores(f);
+}
@@ -25,8 +25,11 @@ typedef int BOOLEAN;
 
 typedef void * ST_ID;	/* symbol table identifier abstraction */
 
-/* The current back-end include file */
+/* The current back-end include file (the Makefile overrides this
+   according to BACKEND) */
+#ifndef BACKEND_HEADER_FILE
 #define BACKEND_HEADER_FILE "backend-x86.h"
+#endif
 
 /* What system are we on? */
 #define SYS_LINUX
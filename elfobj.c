@@ -0,0 +1,1558 @@
+/****************************************************************/
+/*								*/
+/*	CSCE531 - "Pascal" Compiler				*/
+/*								*/
+/*	--elfobj.c--						*/
+/*								*/
+/*	Direct output of a relocatable ELF32 object file.	*/
+/*								*/
+/****************************************************************/
+
+/*
+ * With -felf, asm_flush hands each batch of buffered records to
+ * elf_assemble instead of printing them, and main calls elf_write at the
+ * end.  This is a small assembler for exactly the i386 code and directives
+ * that backend-x86.c emits (and the passes rewrite); anything else is a
+ * bug.  The records already hold each instruction's mnemonic and AT&T
+ * operands split apart, so there is no text to scan but the operands.
+ *
+ * Each batch is a function or the data around one.  Jumps to labels in the
+ * same batch or defined in an earlier one start out in their 2-byte form,
+ * and the batch is laid out again, growing the jumps that do not reach to
+ * their 5- or 6-byte form, until nothing changes; only then are the bytes
+ * emitted.  (gas also shortens jumps to functions defined later in the
+ * file, which cannot be done one batch at a time.)  Every other reference
+ * to a symbol is a 4-byte field with a fixup, resolved by elf_write: a
+ * pc-relative reference to a local label in the same section, or a jump
+ * to any symbol there, is patched in place, and anything else becomes a
+ * REL relocation, against
+ * the section symbol for local labels (with the label's offset as the
+ * addend in the field) or against the symbol itself for global and
+ * undefined ones.  Undefined symbols are taken to be global, as gas does.
+ *
+ * The instruction encodings are the ones gas picks, so objdump output can
+ * be compared with that of the assembled .s file.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <elf.h>
+#include "elfobj.h"
+#include "message.h"
+
+/* The sections that code and data go in, by index in sections[] (which is
+   also the ELF section number) */
+#define S_TEXT   1
+#define S_DATA   2
+#define S_BSS    3
+#define S_RODATA 4
+#define NSECTIONS 5
+
+typedef struct symbol {
+    char *name;
+    int sec;			/* 0 if undefined */
+    int value;
+    int size;
+    int type;			/* STT_NOTYPE, STT_FUNC, or STT_OBJECT */
+    BOOLEAN global;
+    BOOLEAN referenced;
+    int batch;			/* call of elf_assemble that defines it */
+    int index;			/* in .symtab */
+    struct symbol *next;	/* hash chain */
+} SYMBOL;
+
+/* A 4-byte field at offset in section sec that refers to sym.  The field
+   holds the addend, which for a pc-relative field is -4.  jump is TRUE for
+   the target of a jmp or jcc, which gas resolves in place even for a
+   global symbol if it is defined in the same section. */
+typedef struct {
+    int sec, offset;
+    SYMBOL *sym;
+    BOOLEAN pcrel;
+    BOOLEAN jump;
+} FIXUP;
+
+typedef struct {
+    char *name;
+    unsigned char *buf;
+    int size, buf_size;
+    int pos;			/* the layout position during a pass */
+    int align;
+    Elf32_Rel *rels;
+    int nrels, rels_size;
+} SECTION;
+
+static SECTION sections[NSECTIONS] = {
+    { "", NULL, 0, 0, 0, 0, NULL, 0, 0 },
+    { ".text", NULL, 0, 0, 0, 0, NULL, 0, 0 },
+    { ".data", NULL, 0, 0, 0, 0, NULL, 0, 0 },
+    { ".bss", NULL, 0, 0, 0, 0, NULL, 0, 0 },
+    { ".rodata", NULL, 0, 0, 0, 0, NULL, 0, 0 }
+};
+static int cur_sec = S_TEXT;
+
+#define HASH_SIZE 4096
+static SYMBOL *sym_hash[HASH_SIZE];
+static SYMBOL **syms = NULL;	/* in order of creation */
+static int nsyms = 0, syms_size = 0;
+
+static FIXUP *fixups = NULL;
+static int nfixups = 0, fixups_size = 0;
+
+/* TRUE while a batch is only being laid out (see elf_assemble) */
+static BOOLEAN sizing;
+
+/* The record being encoded, for error messages */
+static ASM_LIST cur_rec;
+
+
+static void *grow (void *p, int *size, int elem_size, int needed)
+{
+    if (needed <= *size)
+	return p;
+    while (*size < needed)
+	*size = *size ? 2 * *size : 256;
+    p = realloc(p, *size * elem_size);
+    if (p == NULL)
+	bug("elfobj: out of memory");
+    return p;
+}
+
+static void cannot_encode (void)
+{
+    int i;
+
+    if (cur_rec->kind != AK_INSN || cur_rec->text != NULL)
+	bug("elfobj: cannot encode \"%s\"", cur_rec->text);
+    msgn("BUG: elfobj: cannot encode \"%s", cur_rec->op);
+    for (i = 0; i < cur_rec->nargs; i++)
+	msgn("%s%s", i == 0 ? " " : ", ", cur_rec->args[i]);
+    bug("\"");
+}
+
+
+/* Symbols */
+
+static SYMBOL *lookup (char *name)
+{
+    unsigned int h = 0;
+    char *p;
+    SYMBOL *s;
+
+    for (p = name; *p != '\0'; p++)
+	h = h * 31 + (unsigned char) *p;
+    h %= HASH_SIZE;
+    for (s = sym_hash[h]; s != NULL; s = s->next)
+	if (!strcmp(s->name, name))
+	    return s;
+
+    s = (SYMBOL *) calloc(1, sizeof(SYMBOL));
+    if (s == NULL)
+	bug("elfobj: out of memory");
+    s->name = strdup(name);
+    s->next = sym_hash[h];
+    sym_hash[h] = s;
+    syms = (SYMBOL **) grow(syms, &syms_size, sizeof(SYMBOL *), nsyms + 1);
+    syms[nsyms++] = s;
+    return s;
+}
+
+/* Labels generated by the compiler never go in the symbol table */
+static BOOLEAN is_local_label (SYMBOL *s)
+{
+    return s->name[0] == '.' && s->name[1] == 'L';
+}
+
+
+/* Output */
+
+static void put_byte (int b)
+{
+    SECTION *s = &sections[cur_sec];
+
+    if (cur_sec == S_BSS)
+	bug("elfobj: data in .bss");
+    if (!sizing) {
+	s->buf = (unsigned char *) grow(s->buf, &s->buf_size, 1, s->pos + 1);
+	s->buf[s->pos] = b;
+    }
+    s->pos++;
+}
+
+static void put_half (int v)
+{
+    put_byte(v);
+    put_byte(v >> 8);
+}
+
+static void put_word (int v)
+{
+    put_byte(v);
+    put_byte(v >> 8);
+    put_byte(v >> 16);
+    put_byte(v >> 24);
+}
+
+/* Puts a 4-byte field holding addend, which refers to sym if that is not
+   NULL */
+static void put_ref (int addend, SYMBOL *sym, BOOLEAN pcrel)
+{
+    if (sym != NULL && !sizing) {
+	fixups = (FIXUP *) grow(fixups, &fixups_size, sizeof(FIXUP),
+				nfixups + 1);
+	fixups[nfixups].sec = cur_sec;
+	fixups[nfixups].offset = sections[cur_sec].pos;
+	fixups[nfixups].sym = sym;
+	fixups[nfixups].pcrel = pcrel;
+	fixups[nfixups].jump = FALSE;
+	nfixups++;
+	sym->referenced = TRUE;
+    }
+    put_word(addend);
+}
+
+/* The nops that gas pads code with */
+static char *text_fill[] = {
+    "", "\x90", "\x66\x90", "\x8d\x76\x00", "\x8d\x74\x26\x00",
+    "\x90\x8d\x74\x26\x00", "\x8d\xb6\x00\x00\x00\x00",
+    "\x8d\xb4\x26\x00\x00\x00\x00"
+};
+
+static void put_align (int align)
+{
+    SECTION *s = &sections[cur_sec];
+    int pad = (align - s->pos % align) % align, n, i;
+
+    if (align > s->align)
+	s->align = align;
+    if (cur_sec == S_BSS) {
+	s->pos += pad;
+	return;
+    }
+    while (pad > 0) {
+	n = cur_sec == S_TEXT ? (pad > 7 ? 7 : pad) : pad;
+	for (i = 0; i < n; i++)
+	    put_byte(cur_sec == S_TEXT ? (unsigned char) text_fill[n][i] : 0);
+	pad -= n;
+    }
+}
+
+
+/* Operands */
+
+typedef enum { O_REG, O_IMM, O_MEM } OPERAND_KIND;
+
+/* Register classes */
+#define R_GPR 0
+#define R_XMM 1
+#define R_ST  2
+
+typedef struct {
+    OPERAND_KIND kind;
+    BOOLEAN indirect;		/* "*" before a jump or call target */
+    int reg, size, cls;		/* register number, size, and class */
+    int value;			/* immediate or displacement */
+    SYMBOL *sym;		/* added to value, if not NULL */
+    int base, index, scale;	/* -1 for no base or index */
+} OPERAND;
+
+static struct {
+    char *name;
+    int reg, size;
+} gp_regs[] = {
+    { "eax", 0, 4 }, { "ecx", 1, 4 }, { "edx", 2, 4 }, { "ebx", 3, 4 },
+    { "esp", 4, 4 }, { "ebp", 5, 4 }, { "esi", 6, 4 }, { "edi", 7, 4 },
+    { "ax", 0, 2 }, { "cx", 1, 2 }, { "dx", 2, 2 }, { "bx", 3, 2 },
+    { "sp", 4, 2 }, { "bp", 5, 2 }, { "si", 6, 2 }, { "di", 7, 2 },
+    { "al", 0, 1 }, { "cl", 1, 1 }, { "dl", 2, 1 }, { "bl", 3, 1 },
+    { "ah", 4, 1 }, { "ch", 5, 1 }, { "dh", 6, 1 }, { "bh", 7, 1 },
+    { NULL, 0, 0 }
+};
+
+static void parse_reg (char *name, OPERAND *o)
+{
+    int i;
+
+    o->kind = O_REG;
+    if (!strncmp(name, "xmm", 3) && name[3] >= '0' && name[3] <= '7'
+	&& name[4] == '\0') {
+	o->cls = R_XMM;
+	o->reg = name[3] - '0';
+	o->size = 16;
+	return;
+    }
+    if (!strcmp(name, "st")) {
+	o->cls = R_ST;
+	o->reg = 0;
+	return;
+    }
+    if (!strncmp(name, "st(", 3) && name[3] >= '0' && name[3] <= '7'
+	&& !strcmp(name + 4, ")")) {
+	o->cls = R_ST;
+	o->reg = name[3] - '0';
+	return;
+    }
+    for (i = 0; gp_regs[i].name != NULL; i++)
+	if (!strcmp(name, gp_regs[i].name)) {
+	    o->cls = R_GPR;
+	    o->reg = gp_regs[i].reg;
+	    o->size = gp_regs[i].size;
+	    return;
+	}
+    cannot_encode();
+}
+
+/* Parses a sum of numbers and at most one symbol, the end of which is
+   *end (or the end of the string if end is NULL) */
+static void parse_expr (char *s, char *end, int *value, SYMBOL **sym)
+{
+    char name[256];
+    int sign = 1, n;
+
+    if (end == NULL)
+	end = s + strlen(s);
+    *value = 0;
+    *sym = NULL;
+    if (s == end)
+	cannot_encode();
+    while (s < end) {
+	if (*s == '+' || *s == '-') {
+	    sign = *s == '-' ? -1 : 1;
+	    s++;
+	}
+	if (isdigit((unsigned char) *s)) {
+	    char *p;
+	    *value += sign * (int) strtoul(s, &p, 0);
+	    s = p;
+	}
+	else {
+	    for (n = 0; s < end && (isalnum((unsigned char) *s) || *s == '_'
+				    || *s == '.' || *s == '$'); s++)
+		if (n < (int) sizeof(name) - 1)
+		    name[n++] = *s;
+	    name[n] = '\0';
+	    if (n == 0 || *sym != NULL || sign < 0)
+		cannot_encode();
+	    *sym = lookup(name);
+	}
+	while (s < end && isspace((unsigned char) *s))
+	    s++;
+	if (s < end && *s != '+' && *s != '-')
+	    cannot_encode();
+	sign = 1;
+    }
+}
+
+static int parse_index_reg (char *name)
+{
+    OPERAND o;
+
+    parse_reg(name, &o);
+    if (o.cls != R_GPR || o.size != 4)
+	cannot_encode();
+    return o.reg;
+}
+
+static void parse_operand (char *arg, OPERAND *o)
+{
+    char *open, *close, *comma, buf[32];
+
+    memset(o, 0, sizeof(OPERAND));
+    o->base = o->index = -1;
+    o->scale = 1;
+    if (*arg == '*') {
+	o->indirect = TRUE;
+	arg++;
+    }
+    if (*arg == '%') {
+	parse_reg(arg + 1, o);
+	return;
+    }
+    if (*arg == '$') {
+	o->kind = O_IMM;
+	parse_expr(arg + 1, NULL, &o->value, &o->sym);
+	return;
+    }
+
+    o->kind = O_MEM;
+    open = strchr(arg, '(');
+    if (open == NULL) {
+	parse_expr(arg, NULL, &o->value, &o->sym);
+	return;
+    }
+    if (open > arg)
+	parse_expr(arg, open, &o->value, &o->sym);
+    close = strchr(open, ')');
+    if (close == NULL || close[1] != '\0' || close - open >= (int) sizeof(buf))
+	cannot_encode();
+    memcpy(buf, open + 1, close - open - 1);
+    buf[close - open - 1] = '\0';
+
+	/* (base), (base,index), (base,index,scale), (,index,scale) */
+    comma = strchr(buf, ',');
+    if (comma != NULL)
+	*comma = '\0';
+    if (buf[0] != '\0') {
+	if (buf[0] != '%')
+	    cannot_encode();
+	o->base = parse_index_reg(buf + 1);
+    }
+    if (comma == NULL)
+	return;
+    arg = comma + 1;
+    comma = strchr(arg, ',');
+    if (comma != NULL) {
+	*comma = '\0';
+	o->scale = atoi(comma + 1);
+	if (o->scale != 1 && o->scale != 2 && o->scale != 4 && o->scale != 8)
+	    cannot_encode();
+    }
+    if (arg[0] != '%')
+	cannot_encode();
+    o->index = parse_index_reg(arg + 1);
+    if (o->index == 4)
+	cannot_encode();
+}
+
+static BOOLEAN fits_byte (int v)
+{
+    return v >= -128 && v <= 127;
+}
+
+static BOOLEAN is_gpr (OPERAND *o, int size)
+{
+    return o->kind == O_REG && o->cls == R_GPR && o->size == size;
+}
+
+static BOOLEAN is_rm (OPERAND *o, int size)
+{
+    return o->kind == O_MEM || is_gpr(o, size);
+}
+
+static BOOLEAN is_xmm_rm (OPERAND *o)
+{
+    return o->kind == O_MEM || (o->kind == O_REG && o->cls == R_XMM);
+}
+
+/* Puts the ModRM byte, and the SIB byte and displacement if needed, for
+   the register or opcode extension reg and the operand rm */
+static void put_modrm (int reg, OPERAND *rm)
+{
+    int mod;
+
+    if (rm->kind == O_REG) {
+	put_byte(0xc0 | reg << 3 | rm->reg);
+	return;
+    }
+    if (rm->kind != O_MEM)
+	cannot_encode();
+
+    if (rm->base < 0 && rm->index < 0) {
+	put_byte(reg << 3 | 5);
+	put_ref(rm->value, rm->sym, FALSE);
+	return;
+    }
+
+    if (rm->base < 0)
+	mod = 0;
+    else if (rm->sym == NULL && rm->value == 0 && rm->base != 5)
+	mod = 0;
+    else if (rm->sym == NULL && fits_byte(rm->value))
+	mod = 1;
+    else
+	mod = 2;
+
+    if (rm->index < 0 && rm->base != 4)
+	put_byte(mod << 6 | reg << 3 | rm->base);
+    else {
+	int ss = rm->scale == 8 ? 3 : rm->scale == 4 ? 2 : rm->scale == 2;
+	put_byte(mod << 6 | reg << 3 | 4);
+	put_byte(ss << 6 | (rm->index < 0 ? 4 : rm->index) << 3
+		 | (rm->base < 0 ? 5 : rm->base));
+    }
+
+    if (mod == 1)
+	put_byte(rm->value);
+    else if (mod == 2 || rm->base < 0)
+	put_ref(rm->value, rm->sym, FALSE);
+}
+
+static void put_imm (OPERAND *o, int size)
+{
+    if (size == 4)
+	put_ref(o->value, o->sym, FALSE);
+    else if (o->sym != NULL)
+	cannot_encode();
+    else if (size == 2)
+	put_half(o->value);
+    else
+	put_byte(o->value);
+}
+
+
+/* Instructions */
+
+/* If op is stem followed by the suffix b, w, or l, sets *size to 1, 2, or
+   4 and returns TRUE */
+static BOOLEAN has_suffix (char *op, char *stem, int *size)
+{
+    int n = strlen(stem);
+
+    if (strncmp(op, stem, n) || op[n] == '\0' || op[n + 1] != '\0')
+	return FALSE;
+    switch (op[n]) {
+    case 'b': *size = 1; return TRUE;
+    case 'w': *size = 2; return TRUE;
+    case 'l': *size = 4; return TRUE;
+    }
+    return FALSE;
+}
+
+static void put_size_prefix (int size)
+{
+    if (size == 2)
+	put_byte(0x66);
+}
+
+/* Condition codes, by their number in jcc and setcc opcodes */
+static char *cond_names[] = {
+    "o", "no", "b", "ae", "e", "ne", "be", "a",
+    "s", "ns", "p", "np", "l", "ge", "le", "g", NULL
+};
+
+static struct {
+    char *name;
+    int cc;
+} cond_aliases[] = {
+    { "c", 2 }, { "nae", 2 }, { "nb", 3 }, { "nc", 3 }, { "z", 4 },
+    { "nz", 5 }, { "na", 6 }, { "nbe", 7 }, { "pe", 10 }, { "po", 11 },
+    { "nge", 12 }, { "nl", 13 }, { "ng", 14 }, { "nle", 15 }, { NULL, 0 }
+};
+
+static int cond_code (char *name)
+{
+    int i;
+
+    for (i = 0; cond_names[i] != NULL; i++)
+	if (!strcmp(name, cond_names[i]))
+	    return i;
+    for (i = 0; cond_aliases[i].name != NULL; i++)
+	if (!strcmp(name, cond_aliases[i].name))
+	    return cond_aliases[i].cc;
+    return -1;
+}
+
+/* add, or, adc, sbb, and, sub, xor, and cmp, by opcode extension */
+static char *alu_ops[] = {
+    "add", "or", "adc", "sbb", "and", "sub", "xor", "cmp", NULL
+};
+
+/* rol, ror, rcl, rcr, shl, shr, sal, and sar, by opcode extension */
+static char *shift_ops[] = {
+    "rol", "ror", "rcl", "rcr", "shl", "shr", "sal", "sar", NULL
+};
+
+/* SSE2 arithmetic: mnemonic, prefix, and second opcode byte */
+static struct {
+    char *name;
+    int prefix, opcode;
+} sse_ops[] = {
+    { "addsd", 0xf2, 0x58 }, { "addss", 0xf3, 0x58 },
+    { "mulsd", 0xf2, 0x59 }, { "mulss", 0xf3, 0x59 },
+    { "subsd", 0xf2, 0x5c }, { "subss", 0xf3, 0x5c },
+    { "divsd", 0xf2, 0x5e }, { "divss", 0xf3, 0x5e },
+    { "cvtsd2ss", 0xf2, 0x5a }, { "cvtss2sd", 0xf3, 0x5a },
+    { "ucomisd", 0x66, 0x2e }, { "ucomiss", 0, 0x2e },
+    { "xorpd", 0x66, 0x57 }, { "xorps", 0, 0x57 },
+    { NULL, 0, 0 }
+};
+
+/* x87 instructions with a memory operand: mnemonic, opcode, and opcode
+   extension */
+static struct {
+    char *name;
+    int opcode, ext;
+} x87_mem_ops[] = {
+    { "flds", 0xd9, 0 }, { "fldl", 0xdd, 0 }, { "fld", 0xd9, 0 },
+    { "fsts", 0xd9, 2 }, { "fstl", 0xdd, 2 },
+    { "fstps", 0xd9, 3 }, { "fstpl", 0xdd, 3 },
+    { "fildl", 0xdb, 0 }, { "fildll", 0xdf, 5 },
+    { "fistpl", 0xdb, 3 }, { "fistpll", 0xdf, 7 },
+    { "fldcw", 0xd9, 5 }, { "fnstcw", 0xd9, 7 }, { "fnstsw", 0xdd, 7 },
+    { NULL, 0, 0 }
+};
+
+/* x87 instructions without operands */
+static struct {
+    char *name;
+    int b0, b1;
+} x87_ops[] = {
+    { "fld1", 0xd9, 0xe8 }, { "fldz", 0xd9, 0xee }, { "fchs", 0xd9, 0xe0 },
+    { "fucompp", 0xda, 0xe9 }, { NULL, 0, 0 }
+};
+
+/* x87 arithmetic that pops: "f<op>p %st, %st(i)" is the second byte plus
+   i, after 0xde.  (In AT&T syntax fsubp and fdivp have the operands of
+   Intel's fsubrp and fdivrp, and the other way around.) */
+static struct {
+    char *name;
+    int b1;
+} x87_pop_ops[] = {
+    { "faddp", 0xc0 }, { "fmulp", 0xc8 }, { "fsubp", 0xe0 },
+    { "fsubrp", 0xe8 }, { "fdivp", 0xf0 }, { "fdivrp", 0xf8 },
+    { NULL, 0 }
+};
+
+/* Puts a jump or call to a label; short is TRUE for the 2-byte form */
+static void put_branch (int cc, char *op, OPERAND *target, BOOLEAN short_form)
+{
+    if (target->kind != O_MEM || target->base >= 0 || target->index >= 0
+	|| target->sym == NULL)
+	cannot_encode();
+
+    if (short_form) {
+	put_byte(cc < 0 ? 0xeb : 0x70 + cc);
+	put_byte(sizing ? 0 : target->sym->value + target->value
+		 - (sections[cur_sec].pos + 1));
+	return;
+    }
+    if (!strcmp(op, "call"))
+	put_byte(0xe8);
+    else if (cc < 0)
+	put_byte(0xe9);
+    else {
+	put_byte(0x0f);
+	put_byte(0x80 + cc);
+    }
+    put_ref(target->value - 4, target->sym, TRUE);
+    if (!sizing && strcmp(op, "call"))
+	fixups[nfixups - 1].jump = TRUE;
+}
+
+/* If rec is a jump to a label, returns the label's symbol */
+static SYMBOL *jump_target (ASM_LIST rec)
+{
+    if (rec->op[0] != 'j' || rec->nargs != 1 || rec->args[0][0] == '*')
+	return NULL;
+    if (strcmp(rec->op, "jmp") && cond_code(rec->op + 1) < 0)
+	return NULL;
+    return lookup(rec->args[0]);
+}
+
+static void encode_insn (ASM_LIST rec, BOOLEAN short_form)
+{
+    char *op = rec->op;
+    OPERAND o[ASM_MAX_ARGS];
+    int n = rec->nargs, size, i, cc;
+
+    for (i = 0; i < n; i++)
+	parse_operand(rec->args[i], &o[i]);
+
+	/* Jumps and calls */
+    if (op[0] == 'j' && n == 1) {
+	cc = strcmp(op, "jmp") ? cond_code(op + 1) : -1;
+	if (cc < 0 && strcmp(op, "jmp"))
+	    cannot_encode();
+	if (o[0].indirect) {
+	    if (cc >= 0)
+		cannot_encode();
+	    put_byte(0xff);
+	    put_modrm(4, &o[0]);
+	}
+	else
+	    put_branch(cc, op, &o[0], short_form);
+	return;
+    }
+    if (!strcmp(op, "call") && n == 1) {
+	if (o[0].indirect) {
+	    put_byte(0xff);
+	    put_modrm(2, &o[0]);
+	}
+	else
+	    put_branch(-1, op, &o[0], FALSE);
+	return;
+    }
+
+	/* Instructions without operands */
+    if (n == 0) {
+	if (!strcmp(op, "ret"))
+	    put_byte(0xc3);
+	else if (!strcmp(op, "leave"))
+	    put_byte(0xc9);
+	else if (!strcmp(op, "cltd"))
+	    put_byte(0x99);
+	else if (!strcmp(op, "sahf"))
+	    put_byte(0x9e);
+	else if (!strcmp(op, "nop"))
+	    put_byte(0x90);
+	else if (!strcmp(op, "ud2")) {
+	    put_byte(0x0f);
+	    put_byte(0x0b);
+	}
+	else if (!strcmp(op, "fxch")) {
+	    put_byte(0xd9);
+	    put_byte(0xc9);
+	}
+	else {
+	    for (i = 0; x87_ops[i].name != NULL; i++)
+		if (!strcmp(op, x87_ops[i].name))
+		    break;
+	    if (x87_ops[i].name == NULL)
+		cannot_encode();
+	    put_byte(x87_ops[i].b0);
+	    put_byte(x87_ops[i].b1);
+	}
+	return;
+    }
+
+	/* mov */
+    if (has_suffix(op, "mov", &size) && n == 2) {
+	put_size_prefix(size);
+	if (o[0].kind == O_IMM && is_gpr(&o[1], size)) {
+	    put_byte((size == 1 ? 0xb0 : 0xb8) + o[1].reg);
+	    put_imm(&o[0], size);
+	}
+	else if (o[0].kind == O_IMM && o[1].kind == O_MEM) {
+	    put_byte(size == 1 ? 0xc6 : 0xc7);
+	    put_modrm(0, &o[1]);
+	    put_imm(&o[0], size);
+	}
+	else if (is_gpr(&o[0], size) && o[0].reg == 0 && o[1].kind == O_MEM
+		 && o[1].base < 0 && o[1].index < 0) {
+	    put_byte(size == 1 ? 0xa2 : 0xa3);
+	    put_ref(o[1].value, o[1].sym, FALSE);
+	}
+	else if (is_gpr(&o[1], size) && o[1].reg == 0 && o[0].kind == O_MEM
+		 && o[0].base < 0 && o[0].index < 0) {
+	    put_byte(size == 1 ? 0xa0 : 0xa1);
+	    put_ref(o[0].value, o[0].sym, FALSE);
+	}
+	else if (is_gpr(&o[0], size) && is_rm(&o[1], size)) {
+	    put_byte(size == 1 ? 0x88 : 0x89);
+	    put_modrm(o[0].reg, &o[1]);
+	}
+	else if (o[0].kind == O_MEM && is_gpr(&o[1], size)) {
+	    put_byte(size == 1 ? 0x8a : 0x8b);
+	    put_modrm(o[1].reg, &o[0]);
+	}
+	else
+	    cannot_encode();
+	return;
+    }
+
+	/* Sign and zero extension */
+    if ((!strcmp(op, "movsbl") || !strcmp(op, "movzbl") || !strcmp(op, "movswl")
+	 || !strcmp(op, "movzwl")) && n == 2) {
+	size = op[4] == 'b' ? 1 : 2;
+	if (!is_rm(&o[0], size) || !is_gpr(&o[1], 4))
+	    cannot_encode();
+	put_byte(0x0f);
+	put_byte((op[3] == 's' ? 0xbe : 0xb6) + (size == 2));
+	put_modrm(o[1].reg, &o[0]);
+	return;
+    }
+
+	/* Two-operand arithmetic */
+    for (i = 0; alu_ops[i] != NULL; i++)
+	if (has_suffix(op, alu_ops[i], &size))
+	    break;
+    if (alu_ops[i] != NULL && n == 2) {
+	put_size_prefix(size);
+	if (o[0].kind == O_IMM && is_rm(&o[1], size)) {
+	    if (size != 1 && o[0].sym == NULL && fits_byte(o[0].value)) {
+		put_byte(0x83);
+		put_modrm(i, &o[1]);
+		put_byte(o[0].value);
+	    }
+	    else if (is_gpr(&o[1], size) && o[1].reg == 0) {
+		put_byte(i << 3 | (size == 1 ? 4 : 5));
+		put_imm(&o[0], size);
+	    }
+	    else {
+		put_byte(size == 1 ? 0x80 : 0x81);
+		put_modrm(i, &o[1]);
+		put_imm(&o[0], size);
+	    }
+	}
+	else if (is_gpr(&o[0], size) && is_rm(&o[1], size)) {
+	    put_byte(i << 3 | (size == 1 ? 0 : 1));
+	    put_modrm(o[0].reg, &o[1]);
+	}
+	else if (o[0].kind == O_MEM && is_gpr(&o[1], size)) {
+	    put_byte(i << 3 | (size == 1 ? 2 : 3));
+	    put_modrm(o[1].reg, &o[0]);
+	}
+	else
+	    cannot_encode();
+	return;
+    }
+
+	/* test */
+    if (has_suffix(op, "test", &size) && n == 2) {
+	put_size_prefix(size);
+	if (o[0].kind == O_IMM && is_gpr(&o[1], size) && o[1].reg == 0) {
+	    put_byte(size == 1 ? 0xa8 : 0xa9);
+	    put_imm(&o[0], size);
+	}
+	else if (o[0].kind == O_IMM && is_rm(&o[1], size)) {
+	    put_byte(size == 1 ? 0xf6 : 0xf7);
+	    put_modrm(0, &o[1]);
+	    put_imm(&o[0], size);
+	}
+	else if (is_gpr(&o[0], size) && is_rm(&o[1], size)) {
+	    put_byte(size == 1 ? 0x84 : 0x85);
+	    put_modrm(o[0].reg, &o[1]);
+	}
+	else
+	    cannot_encode();
+	return;
+    }
+
+	/* One-operand arithmetic */
+    if ((has_suffix(op, "not", &size) || has_suffix(op, "neg", &size)
+	 || has_suffix(op, "mul", &size) || has_suffix(op, "div", &size)
+	 || has_suffix(op, "idiv", &size)
+	 || (has_suffix(op, "imul", &size) && n == 1)) && n == 1) {
+	if (!is_rm(&o[0], size))
+	    cannot_encode();
+	put_size_prefix(size);
+	put_byte(size == 1 ? 0xf6 : 0xf7);
+	put_modrm(op[0] == 'n' ? (op[1] == 'o' ? 2 : 3) :
+		  op[0] == 'm' ? 4 :
+		  op[1] == 'm' ? 5 :
+		  op[0] == 'd' ? 6 : 7, &o[0]);
+	return;
+    }
+
+	/* imul with two or three operands */
+    if (!strcmp(op, "imull") && (n == 2 || n == 3)) {
+	OPERAND *src = &o[n - 2], *dst = &o[n - 1];
+	if (n == 2 && o[0].kind == O_IMM)
+	    src = dst;
+	if (!is_gpr(dst, 4) || !is_rm(src, 4))
+	    cannot_encode();
+	if (n == 2 && o[0].kind != O_IMM) {
+	    put_byte(0x0f);
+	    put_byte(0xaf);
+	    put_modrm(dst->reg, src);
+	}
+	else if (o[0].kind != O_IMM)
+	    cannot_encode();
+	else if (o[0].sym == NULL && fits_byte(o[0].value)) {
+	    put_byte(0x6b);
+	    put_modrm(dst->reg, src);
+	    put_byte(o[0].value);
+	}
+	else {
+	    put_byte(0x69);
+	    put_modrm(dst->reg, src);
+	    put_imm(&o[0], 4);
+	}
+	return;
+    }
+
+	/* Shifts */
+    for (i = 0; shift_ops[i] != NULL; i++)
+	if (has_suffix(op, shift_ops[i], &size))
+	    break;
+    if (shift_ops[i] != NULL && (n == 1 || n == 2)) {
+	OPERAND *dst = &o[n - 1];
+	if (!is_rm(dst, size))
+	    cannot_encode();
+	put_size_prefix(size);
+	if (n == 1 || (o[0].kind == O_IMM && o[0].sym == NULL
+		       && o[0].value == 1)) {
+	    put_byte(size == 1 ? 0xd0 : 0xd1);
+	    put_modrm(i, dst);
+	}
+	else if (o[0].kind == O_IMM && o[0].sym == NULL) {
+	    put_byte(size == 1 ? 0xc0 : 0xc1);
+	    put_modrm(i, dst);
+	    put_byte(o[0].value);
+	}
+	else if (is_gpr(&o[0], 1) && o[0].reg == 1) {
+	    put_byte(size == 1 ? 0xd2 : 0xd3);
+	    put_modrm(i, dst);
+	}
+	else
+	    cannot_encode();
+	return;
+    }
+
+	/* lea, xchg, push, pop, bt */
+    if (!strcmp(op, "leal") && n == 2) {
+	if (o[0].kind != O_MEM || !is_gpr(&o[1], 4))
+	    cannot_encode();
+	put_byte(0x8d);
+	put_modrm(o[1].reg, &o[0]);
+	return;
+    }
+    if (!strcmp(op, "xchgl") && n == 2) {
+	if (is_gpr(&o[0], 4) && is_gpr(&o[1], 4)
+	    && (o[0].reg == 0 || o[1].reg == 0))
+	    put_byte(0x90 + o[0].reg + o[1].reg);
+	else if (is_gpr(&o[0], 4) && is_rm(&o[1], 4)) {
+	    put_byte(0x87);
+	    put_modrm(o[0].reg, &o[1]);
+	}
+	else if (o[0].kind == O_MEM && is_gpr(&o[1], 4)) {
+	    put_byte(0x87);
+	    put_modrm(o[1].reg, &o[0]);
+	}
+	else
+	    cannot_encode();
+	return;
+    }
+    if (!strcmp(op, "pushl") && n == 1) {
+	if (is_gpr(&o[0], 4))
+	    put_byte(0x50 + o[0].reg);
+	else if (o[0].kind == O_IMM && o[0].sym == NULL
+		 && fits_byte(o[0].value)) {
+	    put_byte(0x6a);
+	    put_byte(o[0].value);
+	}
+	else if (o[0].kind == O_IMM) {
+	    put_byte(0x68);
+	    put_imm(&o[0], 4);
+	}
+	else {
+	    put_byte(0xff);
+	    put_modrm(6, &o[0]);
+	}
+	return;
+    }
+    if (!strcmp(op, "popl") && n == 1) {
+	if (is_gpr(&o[0], 4))
+	    put_byte(0x58 + o[0].reg);
+	else if (o[0].kind == O_MEM) {
+	    put_byte(0x8f);
+	    put_modrm(0, &o[0]);
+	}
+	else
+	    cannot_encode();
+	return;
+    }
+    if (!strcmp(op, "btl") && n == 2) {
+	if (!is_rm(&o[1], 4))
+	    cannot_encode();
+	put_byte(0x0f);
+	if (is_gpr(&o[0], 4)) {
+	    put_byte(0xa3);
+	    put_modrm(o[0].reg, &o[1]);
+	}
+	else if (o[0].kind == O_IMM && o[0].sym == NULL) {
+	    put_byte(0xba);
+	    put_modrm(4, &o[1]);
+	    put_byte(o[0].value);
+	}
+	else
+	    cannot_encode();
+	return;
+    }
+
+	/* setcc */
+    if (!strncmp(op, "set", 3) && (cc = cond_code(op + 3)) >= 0 && n == 1) {
+	if (!is_rm(&o[0], 1))
+	    cannot_encode();
+	put_byte(0x0f);
+	put_byte(0x90 + cc);
+	put_modrm(0, &o[0]);
+	return;
+    }
+
+	/* SSE2 */
+    if ((!strcmp(op, "movsd") || !strcmp(op, "movss")) && n == 2) {
+	put_byte(op[4] == 'd' ? 0xf2 : 0xf3);
+	put_byte(0x0f);
+	if (o[1].kind == O_REG && o[1].cls == R_XMM && is_xmm_rm(&o[0])) {
+	    put_byte(0x10);
+	    put_modrm(o[1].reg, &o[0]);
+	}
+	else if (o[0].kind == O_REG && o[0].cls == R_XMM && o[1].kind == O_MEM) {
+	    put_byte(0x11);
+	    put_modrm(o[0].reg, &o[1]);
+	}
+	else
+	    cannot_encode();
+	return;
+    }
+    for (i = 0; sse_ops[i].name != NULL; i++)
+	if (!strcmp(op, sse_ops[i].name))
+	    break;
+    if (sse_ops[i].name != NULL && n == 2) {
+	if (!is_xmm_rm(&o[0]) || o[1].kind != O_REG || o[1].cls != R_XMM)
+	    cannot_encode();
+	if (sse_ops[i].prefix != 0)
+	    put_byte(sse_ops[i].prefix);
+	put_byte(0x0f);
+	put_byte(sse_ops[i].opcode);
+	put_modrm(o[1].reg, &o[0]);
+	return;
+    }
+    if ((!strcmp(op, "cvtsi2sd") || !strcmp(op, "cvtsi2ss")
+	 || !strcmp(op, "cvtsi2sdl") || !strcmp(op, "cvtsi2ssl")) && n == 2) {
+	if (!is_rm(&o[0], 4) || o[1].kind != O_REG || o[1].cls != R_XMM)
+	    cannot_encode();
+	put_byte(op[7] == 'd' ? 0xf2 : 0xf3);
+	put_byte(0x0f);
+	put_byte(0x2a);
+	put_modrm(o[1].reg, &o[0]);
+	return;
+    }
+    if ((!strcmp(op, "cvttsd2si") || !strcmp(op, "cvttss2si")) && n == 2) {
+	if (!is_xmm_rm(&o[0]) || !is_gpr(&o[1], 4))
+	    cannot_encode();
+	put_byte(op[5] == 'd' ? 0xf2 : 0xf3);
+	put_byte(0x0f);
+	put_byte(0x2c);
+	put_modrm(o[1].reg, &o[0]);
+	return;
+    }
+
+	/* x87 */
+    if (!strcmp(op, "fnstsw") && n == 1 && is_gpr(&o[0], 2) && o[0].reg == 0) {
+	put_byte(0xdf);
+	put_byte(0xe0);
+	return;
+    }
+    if (n == 1 && o[0].kind == O_MEM) {
+	for (i = 0; x87_mem_ops[i].name != NULL; i++)
+	    if (!strcmp(op, x87_mem_ops[i].name))
+		break;
+	if (x87_mem_ops[i].name == NULL)
+	    cannot_encode();
+	put_byte(x87_mem_ops[i].opcode);
+	put_modrm(x87_mem_ops[i].ext, &o[0]);
+	return;
+    }
+    if (n == 1 && o[0].kind == O_REG && o[0].cls == R_ST) {
+	if (!strcmp(op, "fld"))
+	    put_half(0xc0d9 + (o[0].reg << 8));
+	else if (!strcmp(op, "fstp"))
+	    put_half(0xd8dd + (o[0].reg << 8));
+	else if (!strcmp(op, "fxch"))
+	    put_half(0xc8d9 + (o[0].reg << 8));
+	else
+	    cannot_encode();
+	return;
+    }
+    if (n == 2 && o[0].kind == O_REG && o[0].cls == R_ST && o[0].reg == 0
+	&& o[1].kind == O_REG && o[1].cls == R_ST) {
+	for (i = 0; x87_pop_ops[i].name != NULL; i++)
+	    if (!strcmp(op, x87_pop_ops[i].name))
+		break;
+	if (x87_pop_ops[i].name == NULL)
+	    cannot_encode();
+	put_byte(0xde);
+	put_byte(x87_pop_ops[i].b1 + o[1].reg);
+	return;
+    }
+
+    cannot_encode();
+}
+
+
+/* Directives */
+
+/* Splits the operands of a directive at commas outside quotes.  Returns
+   the number of operands. */
+static int split_args (char *s, char *args[], int max)
+{
+    int n = 0;
+    BOOLEAN quoted = FALSE;
+    char *p;
+
+    while (isspace((unsigned char) *s))
+	s++;
+    if (*s == '\0')
+	return 0;
+    args[n++] = s;
+    for (p = s; *p != '\0'; p++) {
+	if (*p == '\\' && quoted && p[1] != '\0')
+	    p++;
+	else if (*p == '"')
+	    quoted = !quoted;
+	else if (*p == ',' && !quoted) {
+	    if (n == max)
+		cannot_encode();
+	    *p = '\0';
+	    for (s = p + 1; isspace((unsigned char) *s); s++)
+		;
+	    args[n++] = s;
+	    p = s - 1;
+	}
+    }
+    for (p = args[n - 1] + strlen(args[n - 1]);
+	 p > args[n - 1] && isspace((unsigned char) p[-1]); p--)
+	;
+    *p = '\0';
+    return n;
+}
+
+static void put_string (char *s)
+{
+    int c, i;
+
+    if (*s++ != '"')
+	cannot_encode();
+    while (*s != '"') {
+	if (*s == '\0')
+	    cannot_encode();
+	c = (unsigned char) *s++;
+	if (c == '\\') {
+	    c = (unsigned char) *s++;
+	    switch (c) {
+	    case 'n': c = '\n'; break;
+	    case 't': c = '\t'; break;
+	    case 'r': c = '\r'; break;
+	    case 'b': c = '\b'; break;
+	    case 'f': c = '\f'; break;
+	    case '\0': cannot_encode(); break;
+	    default:
+		if (c >= '0' && c <= '7') {
+		    c -= '0';
+		    for (i = 0; i < 2 && *s >= '0' && *s <= '7'; i++)
+			c = c * 8 + *s++ - '0';
+		}
+	    }
+	}
+	put_byte(c);
+    }
+    put_byte(0);
+}
+
+static void do_directive (ASM_LIST rec)
+{
+    char buf[1024], *name, *rest, *args[8];
+    int n, value, i;
+    SYMBOL *sym;
+
+    if (strlen(rec->text) >= sizeof(buf))
+	cannot_encode();
+    for (name = rec->text; isspace((unsigned char) *name); name++)
+	;
+    strcpy(buf, name);
+    for (rest = buf; *rest != '\0' && !isspace((unsigned char) *rest); rest++)
+	;
+    if (*rest != '\0')
+	*rest++ = '\0';
+    name = buf;
+
+    if (!strcmp(name, ".string")) {
+	while (isspace((unsigned char) *rest))
+	    rest++;
+	put_string(rest);
+	return;
+    }
+
+    n = split_args(rest, args, 8);
+    if (!strcmp(name, ".text") && n == 0)
+	cur_sec = S_TEXT;
+    else if (!strcmp(name, ".data") && n == 0)
+	cur_sec = S_DATA;
+    else if (!strcmp(name, ".bss") && n == 0)
+	cur_sec = S_BSS;
+    else if (!strcmp(name, ".section") && n >= 1) {
+	for (i = 1; i < NSECTIONS; i++)
+	    if (!strcmp(args[0], sections[i].name))
+		break;
+	if (i == NSECTIONS)
+	    cannot_encode();
+	cur_sec = i;
+    }
+    else if ((!strcmp(name, ".globl") || !strcmp(name, ".global")) && n == 1)
+	lookup(args[0])->global = TRUE;
+    else if (!strcmp(name, ".type") && n == 2) {
+	sym = lookup(args[0]);
+	if (!strcmp(args[1], "@function"))
+	    sym->type = STT_FUNC;
+	else if (!strcmp(args[1], "@object"))
+	    sym->type = STT_OBJECT;
+	else
+	    cannot_encode();
+    }
+    else if (!strcmp(name, ".size") && n == 2) {
+	sym = lookup(args[0]);
+	if (!strncmp(args[1], ".-", 2) && !strcmp(args[1] + 2, args[0])) {
+	    if (sym->sec != cur_sec)
+		cannot_encode();
+	    sym->size = sections[cur_sec].pos - sym->value;
+	}
+	else
+	    sym->size = atoi(args[1]);
+    }
+    else if ((!strcmp(name, ".align") || !strcmp(name, ".p2align")) && n == 1) {
+	value = atoi(args[0]);
+	if (name[1] == 'p')
+	    value = 1 << value;
+	if (value <= 0 || (value & (value - 1)) != 0)
+	    cannot_encode();
+	put_align(value);
+    }
+    else if (!strcmp(name, ".long") || !strcmp(name, ".int")) {
+	for (i = 0; i < n; i++) {
+	    parse_expr(args[i], NULL, &value, &sym);
+	    put_ref(value, sym, FALSE);
+	}
+    }
+    else if (!strcmp(name, ".value") || !strcmp(name, ".short")
+	     || !strcmp(name, ".byte")) {
+	for (i = 0; i < n; i++) {
+	    parse_expr(args[i], NULL, &value, &sym);
+	    if (sym != NULL)
+		cannot_encode();
+	    if (name[1] == 'b')
+		put_byte(value);
+	    else
+		put_half(value);
+	}
+    }
+    else if ((!strcmp(name, ".zero") || !strcmp(name, ".skip")) && n == 1) {
+	value = atoi(args[0]);
+	if (cur_sec == S_BSS)
+	    sections[S_BSS].pos += value;
+	else
+	    for (i = 0; i < value; i++)
+		put_byte(0);
+    }
+    else
+	cannot_encode();
+}
+
+
+/* Lays out recs[0] through recs[n-1] (just advancing the section
+   positions) if sizing is TRUE, or emits them if it is FALSE.  Jumps to
+   labels in the batch take their short form if short_jump[i] is TRUE. */
+static void do_pass (ASM_LIST recs[], int n, BOOLEAN short_jump[],
+		     int jump_pos[], int jump_sec[], int start_sec)
+{
+    SYMBOL *sym;
+    int i;
+
+    for (i = 1; i < NSECTIONS; i++)
+	sections[i].pos = sections[i].size;
+    cur_sec = start_sec;
+
+    for (i = 0; i < n; i++) {
+	cur_rec = recs[i];
+	if (cur_rec->deleted || cur_rec->kind == AK_COMMENT)
+	    continue;
+	switch (cur_rec->kind) {
+	case AK_LABEL:
+	    sym = lookup(cur_rec->op);
+	    sym->sec = cur_sec;
+	    sym->value = sections[cur_sec].pos;
+	    break;
+	case AK_DIRECTIVE:
+	    do_directive(cur_rec);
+	    break;
+	case AK_INSN:
+	    jump_pos[i] = sections[cur_sec].pos;
+	    jump_sec[i] = cur_sec;
+	    encode_insn(cur_rec, short_jump[i]);
+	    break;
+	default:
+	    break;
+	}
+    }
+
+    if (!sizing)
+	for (i = 1; i < NSECTIONS; i++)
+	    sections[i].size = sections[i].pos;
+}
+
+
+void elf_assemble (ASM_LIST recs[], int n)
+{
+    static int batch = 0;
+    BOOLEAN *short_jump, changed;
+    int *jump_pos, *jump_sec, start_sec = cur_sec, i, disp;
+    SYMBOL *sym;
+
+    if (n == 0)
+	return;
+    batch++;
+    short_jump = (BOOLEAN *) calloc(n, sizeof(BOOLEAN));
+    jump_pos = (int *) calloc(n, sizeof(int));
+    jump_sec = (int *) calloc(n, sizeof(int));
+    if (short_jump == NULL || jump_pos == NULL || jump_sec == NULL)
+	bug("elfobj: out of memory");
+
+    for (i = 0; i < n; i++)
+	if (!recs[i]->deleted && recs[i]->kind == AK_LABEL) {
+	    sym = lookup(recs[i]->op);
+	    if (sym->sec != 0 || sym->batch == batch)
+		error("Symbol \"%s\" is already defined", sym->name);
+	    sym->batch = batch;
+	}
+	/* Jumps to a function defined in an earlier batch (a tail call) may
+	 * be short as well */
+    for (i = 0; i < n; i++)
+	if (!recs[i]->deleted && recs[i]->kind == AK_INSN
+	    && (sym = jump_target(recs[i])) != NULL
+	    && (sym->batch == batch || sym->sec != 0))
+	    short_jump[i] = TRUE;
+
+	/* Lay out the batch until every short jump reaches */
+    sizing = TRUE;
+    do {
+	do_pass(recs, n, short_jump, jump_pos, jump_sec, start_sec);
+	changed = FALSE;
+	for (i = 0; i < n; i++) {
+	    if (!short_jump[i])
+		continue;
+	    sym = jump_target(recs[i]);
+	    disp = sym->value - (jump_pos[i] + 2);
+	    if (sym->sec != jump_sec[i] || !fits_byte(disp)) {
+		short_jump[i] = FALSE;
+		changed = TRUE;
+	    }
+	}
+    } while (changed);
+
+    sizing = FALSE;
+    do_pass(recs, n, short_jump, jump_pos, jump_sec, start_sec);
+
+    free(short_jump);
+    free(jump_pos);
+    free(jump_sec);
+}
+
+
+/* Writing the object file */
+
+static void add_rel (int sec, int offset, int sym_index, int type)
+{
+    SECTION *s = &sections[sec];
+
+    s->rels = (Elf32_Rel *) grow(s->rels, &s->rels_size, sizeof(Elf32_Rel),
+				 s->nrels + 1);
+    s->rels[s->nrels].r_offset = offset;
+    s->rels[s->nrels].r_info = ELF32_R_INFO(sym_index, type);
+    s->nrels++;
+}
+
+static int get_word (int sec, int offset)
+{
+    unsigned char *p = sections[sec].buf + offset;
+
+    return p[0] | p[1] << 8 | p[2] << 16 | p[3] << 24;
+}
+
+static void set_word (int sec, int offset, int v)
+{
+    unsigned char *p = sections[sec].buf + offset;
+
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+    p[3] = v >> 24;
+}
+
+/* A string table being built */
+typedef struct {
+    char *buf;
+    int size, buf_size;
+} STRTAB;
+
+static int add_string (STRTAB *t, char *s)
+{
+    int n = strlen(s) + 1, ret = t->size;
+
+    t->buf = (char *) grow(t->buf, &t->buf_size, 1, t->size + n);
+    memcpy(t->buf + t->size, s, n);
+    t->size += n;
+    return ret;
+}
+
+static void write_at (FILE *fp, long *pos, void *data, int size, int align)
+{
+    static char zeros[16];
+
+    while (*pos % align != 0) {
+	fwrite(zeros, 1, 1, fp);
+	(*pos)++;
+    }
+    fwrite(data, 1, size, fp);
+    *pos += size;
+}
+
+
+void elf_write (FILE *fp)
+{
+    Elf32_Ehdr eh;
+    Elf32_Shdr sh[NSECTIONS + NSECTIONS + 4];
+    Elf32_Sym *symtab, *es;
+    STRTAB strtab = { NULL, 0, 0 }, shstrtab = { NULL, 0, 0 };
+    int rel_index[NSECTIONS], nsh, note, symtab_sh, strtab_sh, shstrtab_sh;
+    int nsymtab, first_global = 1, i, j;
+    long pos;
+    FIXUP *f;
+    SYMBOL *s;
+
+	/* Number the symbols: the null symbol, the section symbols, local
+	 * symbols, then global ones */
+    symtab = (Elf32_Sym *) calloc(NSECTIONS + nsyms, sizeof(Elf32_Sym));
+    if (symtab == NULL)
+	bug("elfobj: out of memory");
+    add_string(&strtab, "");
+    nsymtab = 1;
+    for (i = 1; i < NSECTIONS; i++) {
+	es = &symtab[nsymtab++];
+	es->st_info = ELF32_ST_INFO(STB_LOCAL, STT_SECTION);
+	es->st_shndx = i;
+    }
+    for (j = 0; j < 2; j++) {
+	if (j == 1)
+	    first_global = nsymtab;
+	for (i = 0; i < nsyms; i++) {
+	    s = syms[i];
+	    if (s->sec == 0 && is_local_label(s))
+		continue;	/* reported below if it is used */
+	    if (s->sec == 0 && !s->global) {
+		    /* Only referenced symbols are kept when undefined */
+		if (!s->referenced)
+		    continue;
+		s->global = TRUE;
+	    }
+	    if (s->global != (j == 1) || is_local_label(s))
+		continue;
+	    s->index = nsymtab;
+	    es = &symtab[nsymtab++];
+	    es->st_name = add_string(&strtab, s->name);
+	    es->st_value = s->value;
+	    es->st_size = s->size;
+	    es->st_info = ELF32_ST_INFO(s->global ? STB_GLOBAL : STB_LOCAL,
+					s->type);
+	    es->st_shndx = s->sec;
+	}
+    }
+
+	/* Resolve the fixups */
+    for (i = 0; i < nfixups; i++) {
+	f = &fixups[i];
+	s = f->sym;
+	if (s->sec == 0 && is_local_label(s)) {
+	    error("Undefined label \"%s\"", s->name);
+	    continue;
+	}
+	if (s->global && !(f->jump && s->sec == f->sec))
+	    add_rel(f->sec, f->offset, s->index,
+		    f->pcrel ? R_386_PC32 : R_386_32);
+	else if (f->pcrel && s->sec == f->sec)
+	    set_word(f->sec, f->offset,
+		     get_word(f->sec, f->offset) + s->value - f->offset);
+	else {
+	    set_word(f->sec, f->offset, get_word(f->sec, f->offset) + s->value);
+	    add_rel(f->sec, f->offset, s->sec,
+		    f->pcrel ? R_386_PC32 : R_386_32);
+	}
+    }
+
+	/* Number the sections */
+    nsh = NSECTIONS;
+    for (i = 1; i < NSECTIONS; i++)
+	rel_index[i] = sections[i].nrels > 0 ? nsh++ : 0;
+    note = nsh++;
+    symtab_sh = nsh++;
+    strtab_sh = nsh++;
+    shstrtab_sh = nsh++;
+
+    memset(sh, 0, sizeof(sh));
+    add_string(&shstrtab, "");
+    for (i = 1; i < NSECTIONS; i++) {
+	char name[32];
+
+	sh[i].sh_name = add_string(&shstrtab, sections[i].name);
+	sh[i].sh_type = i == S_BSS ? SHT_NOBITS : SHT_PROGBITS;
+	sh[i].sh_flags = SHF_ALLOC | (i == S_TEXT ? SHF_EXECINSTR : 0)
+			 | (i == S_DATA || i == S_BSS ? SHF_WRITE : 0);
+	sh[i].sh_size = sections[i].size;
+	sh[i].sh_addralign = sections[i].align > 0 ? sections[i].align : 1;
+	if (rel_index[i] != 0) {
+	    j = rel_index[i];
+	    sprintf(name, ".rel%s", sections[i].name);
+	    sh[j].sh_name = add_string(&shstrtab, name);
+	    sh[j].sh_type = SHT_REL;
+	    sh[j].sh_flags = SHF_INFO_LINK;
+	    sh[j].sh_size = sections[i].nrels * sizeof(Elf32_Rel);
+	    sh[j].sh_link = symtab_sh;
+	    sh[j].sh_info = i;
+	    sh[j].sh_addralign = 4;
+	    sh[j].sh_entsize = sizeof(Elf32_Rel);
+	}
+    }
+    sh[note].sh_name = add_string(&shstrtab, ".note.GNU-stack");
+    sh[note].sh_type = SHT_PROGBITS;
+    sh[note].sh_addralign = 1;
+    sh[symtab_sh].sh_name = add_string(&shstrtab, ".symtab");
+    sh[symtab_sh].sh_type = SHT_SYMTAB;
+    sh[symtab_sh].sh_size = nsymtab * sizeof(Elf32_Sym);
+    sh[symtab_sh].sh_link = strtab_sh;
+    sh[symtab_sh].sh_info = first_global;
+    sh[symtab_sh].sh_addralign = 4;
+    sh[symtab_sh].sh_entsize = sizeof(Elf32_Sym);
+    sh[strtab_sh].sh_name = add_string(&shstrtab, ".strtab");
+    sh[strtab_sh].sh_type = SHT_STRTAB;
+    sh[strtab_sh].sh_size = strtab.size;
+    sh[strtab_sh].sh_addralign = 1;
+    sh[shstrtab_sh].sh_name = add_string(&shstrtab, ".shstrtab");
+    sh[shstrtab_sh].sh_type = SHT_STRTAB;
+    sh[shstrtab_sh].sh_size = shstrtab.size;
+    sh[shstrtab_sh].sh_addralign = 1;
+
+	/* Lay out the file: the header, the section contents, then the
+	 * section header table */
+    pos = sizeof(Elf32_Ehdr);
+    for (i = 1; i < nsh; i++) {
+	if (sh[i].sh_type == SHT_NOBITS) {
+	    sh[i].sh_offset = pos;
+	    continue;
+	}
+	pos = (pos + sh[i].sh_addralign - 1) / sh[i].sh_addralign
+	      * sh[i].sh_addralign;
+	sh[i].sh_offset = pos;
+	pos += sh[i].sh_size;
+    }
+    pos = (pos + 3) & ~3;
+
+    memset(&eh, 0, sizeof(eh));
+    memcpy(eh.e_ident, ELFMAG, SELFMAG);
+    eh.e_ident[EI_CLASS] = ELFCLASS32;
+    eh.e_ident[EI_DATA] = ELFDATA2LSB;
+    eh.e_ident[EI_VERSION] = EV_CURRENT;
+    eh.e_ident[EI_OSABI] = ELFOSABI_SYSV;
+    eh.e_type = ET_REL;
+    eh.e_machine = EM_386;
+    eh.e_version = EV_CURRENT;
+    eh.e_shoff = pos;
+    eh.e_ehsize = sizeof(Elf32_Ehdr);
+    eh.e_shentsize = sizeof(Elf32_Shdr);
+    eh.e_shnum = nsh;
+    eh.e_shstrndx = shstrtab_sh;
+
+    pos = 0;
+    write_at(fp, &pos, &eh, sizeof(eh), 1);
+    for (i = 1; i < nsh; i++) {
+	void *data = NULL;
+
+	if (sh[i].sh_type == SHT_NOBITS)
+	    continue;
+	if (i < NSECTIONS)
+	    data = sections[i].buf;
+	else if (i == symtab_sh)
+	    data = symtab;
+	else if (i == strtab_sh)
+	    data = strtab.buf;
+	else if (i == shstrtab_sh)
+	    data = shstrtab.buf;
+	else
+	    for (j = 1; j < NSECTIONS; j++)
+		if (rel_index[j] == i)
+		    data = sections[j].rels;
+	write_at(fp, &pos, data, sh[i].sh_size, sh[i].sh_addralign);
+    }
+    write_at(fp, &pos, sh, nsh * sizeof(Elf32_Shdr), 4);
+    fflush(fp);
+}
@@ -0,0 +1,29 @@
+/****************************************************************/
+/*								*/
+/*	CSCE531 - "Pascal" Compiler				*/
+/*								*/
+/*	--elfobj.h--						*/
+/*								*/
+/*	Direct output of a relocatable ELF32 object file	*/
+/*	(enabled by -felf).  The buffered i386 code is		*/
+/*	encoded here instead of being printed for the		*/
+/*	assembler.						*/
+/*								*/
+/****************************************************************/
+
+#ifndef ELFOBJ_H
+#define ELFOBJ_H
+
+#include <stdio.h>
+#include "asmbuf.h"
+
+/* Encodes the n records of recs (as asm_flush would print them) into the
+   object file being built.  Labels may be used before they are defined,
+   in this call or a later one. */
+void elf_assemble (ASM_LIST recs[], int n);
+
+/* Writes the object file built by the calls to elf_assemble to fp.  Call
+   once, after all code has been generated. */
+void elf_write (FILE *fp);
+
+#endif
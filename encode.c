@@ -1,4 +1,8 @@
+#include <stdlib.h>
 #include "encode.h"
+#include "functions.h"
+#include "inline.h"
+#include "options.h"
 
 // Directives that allow the type tags herein to match the Pascal types more closely.
 #define TYBOOL    TYSIGNEDCHAR
@@ -7,10 +11,13 @@
 #define TYSINGLE  TYFLOAT
 #define TYREAL    TYDOUBLE
 
+BOOLEAN is_int_constant_expr(EXPR expr);
+long get_int_constant(EXPR expr);
 void encode_arith_expr(EXPR expr);
 void encode_assn_expr(EXPR expr);
 void encode_cast_expr(EXPR expr);
 void encode_compare_expr(EXPR expr);
+B_ARITH_REL_OP get_compare_op(EXPR expr);
 void encode_signed_expr(EXPR expr);
 void encode_unary_func_expr(EXPR expr);
 void encode_variable_expr(EXPR expr);
@@ -92,7 +99,7 @@ int get_type_size(TYPE type)
     break;
     
     case TYPTR:
-      return 4;
+      return TARGET_PTR_SIZE;
     break;
     
     case TYBOOL:
@@ -104,7 +111,7 @@ int get_type_size(TYPE type)
     break;
     
     case TYINTEGER:
-      return 4;
+      return TARGET_LONG_SIZE;
     break;
     
     case TYCHAR:
@@ -150,7 +157,7 @@ int get_type_alignment(TYPE type)
     break;
     
     case TYPTR:
-      return 4;
+      return TARGET_PTR_SIZE;
     break;
     
     case TYBOOL:
@@ -162,7 +169,7 @@ int get_type_alignment(TYPE type)
     break;
     
     case TYINTEGER:
-      return 4;
+      return TARGET_LONG_SIZE;
     break;
     
     case TYCHAR:
@@ -197,18 +204,204 @@ int get_type_alignment(TYPE type)
 void start_main()
 {
     b_func_prologue("main");
+    if (opt_ssa)
+    {
+      ir_begin_function("main");
+    }
 }
 
 void end_main()
 {
+    if (opt_ssa)
+    {
+      int temps = ir_end_function();
+      ir_lower_function(temps ? b_alloc_local_vars(temps) : 0);
+    }
     b_func_epilogue("main");
 }
 
+/* -----=====----- COMMON SUBEXPRESSIONS -----=====----- */
+
+// With -fcse, equal subexpressions of a statement share one node (see
+// hash_cons in expr.c).  While a body is built as IR, a shared node is
+// encoded only the first time a top-level expression (a statement or a
+// condition) reaches it, and its value is pushed again after that.  A call
+// or an assignment encoded in between makes the values known so far stale,
+// and they are computed again.
+
+// A node of the top-level expression being encoded
+typedef struct
+{
+  EXPR expr;
+  int uses;    // the references to it from the expression's nodes
+  int value;   // the IR value computed for it, or -1
+  int gen;     // the value_gen it was computed in
+} SHARED_NODE;
+
+// The nodes of the expression, hashed by address
+static SHARED_NODE *shared_nodes = NULL;
+static int shared_size = 0, num_shared = 0;
+
+// The depth of encode_expression calls, and the number of calls and
+// assignments encoded so far
+static int expr_depth = 0;
+static int value_gen = 0;
+
+// Returns the entry of expr, adding it if add is set, or NULL
+static SHARED_NODE *find_shared(EXPR expr, BOOLEAN add)
+{
+  unsigned long i;
+  
+  if (add && 2 * (num_shared + 1) > shared_size)
+  {
+    SHARED_NODE *old = shared_nodes;
+    int old_size = shared_size, j;
+    
+    shared_size = shared_size ? 2 * shared_size : 64;
+    shared_nodes = (SHARED_NODE *) calloc(shared_size, sizeof(SHARED_NODE));
+    if (shared_nodes == NULL)
+      fatal("Out of memory");
+    num_shared = 0;
+    for (j = 0; j < old_size; j++)
+    {
+      if (old[j].expr != NULL)
+      {
+        *find_shared(old[j].expr, TRUE) = old[j];
+      }
+    }
+    free(old);
+  }
+  if (shared_size == 0)
+    return NULL;
+  
+  for (i = ((unsigned long)expr >> 4) & (shared_size - 1); shared_nodes[i].expr != NULL;
+       i = (i + 1) & (shared_size - 1))
+  {
+    if (shared_nodes[i].expr == expr)
+      return &shared_nodes[i];
+  }
+  if (!add)
+    return NULL;
+  
+  num_shared++;
+  shared_nodes[i].expr = expr;
+  shared_nodes[i].uses = 0;
+  shared_nodes[i].value = -1;
+  return &shared_nodes[i];
+}
+
+// Counts the references to each node of expr, going into each node once,
+// as it is encoded once
+static void count_uses(EXPR expr)
+{
+  EXPR_LIST arg;
+  
+  if (find_shared(expr, TRUE)->uses++ > 0)
+    return;
+  
+  switch (expr->expr_tag)
+  {
+    case E_ASSIGN:
+    case E_ARITH:
+    case E_COMPR:
+      count_uses(expr->left);
+      /* FALL THROUGH */
+    case E_SIGN:
+    case E_UNFUNC:
+    case E_CAST:
+      count_uses(expr->right);
+      break;
+    case E_ARRAY:
+      count_uses(expr->right);
+      /* FALL THROUGH */
+    case E_FUNC:
+      for (arg = expr->u.var_func_array.arguments; arg != NULL; arg = arg->next)
+      {
+        if (arg->base != NULL)
+          count_uses(arg->base);
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+// Tells whether a node costs more to compute again than to reuse.  A
+// variable's value is a single load either way.
+static BOOLEAN worth_sharing(EXPR expr)
+{
+  switch (expr->expr_tag)
+  {
+    case E_ARITH:
+    case E_SIGN:
+    case E_UNFUNC:
+    case E_ARRAY:
+      return TRUE;
+    case E_CAST:
+      return expr->u.cast_tag != CT_LDEREF || expr->right->expr_tag != E_VAR;
+    default:
+      return FALSE;
+  }
+}
+
+// Starts encoding the top-level expression expr, or a part of the one
+// being encoded
+static void enter_expression(EXPR expr)
+{
+  if (expr_depth++ > 0)
+    return;
+  
+  if (num_shared > 0)
+  {
+    memset(shared_nodes, 0, shared_size * sizeof(SHARED_NODE));
+    num_shared = 0;
+  }
+  if (opt_cse && ir_building())
+    count_uses(expr);
+}
+
+static void leave_expression(void)
+{
+  expr_depth--;
+}
+
 /* -----=====----- EXPRESSIONS -----=====----- */
+static void encode_node(EXPR expr);
+
 void encode_expression(EXPR expr)
 {
+  SHARED_NODE *node;
+  
   if (expr->expr_typetag == TYERROR) { return; }
+  
+  enter_expression(expr);
+  
+  node = find_shared(expr, FALSE);
+  if (node != NULL && (node->uses < 2 || !worth_sharing(expr)))
+    node = NULL;
+  
+  if (node != NULL && node->value >= 0 && node->gen == value_gen)
+  {
+    ir_reuse_value(node->value);
+  }
+  else
+  {
+    encode_node(expr);
+    if (node != NULL)
+    {
+      node->value = ir_top_value();
+      node->gen = value_gen;
+    }
+  }
+  
+  if (expr->expr_tag == E_FUNC || expr->expr_tag == E_ASSIGN)
+    value_gen++;
+  
+  leave_expression();
+}
 
+static void encode_node(EXPR expr)
+{
   switch (expr->expr_tag)
   {
     case E_ASSIGN:
@@ -221,18 +414,18 @@ void encode_expression(EXPR expr)
       encode_signed_expr(expr);
       break;
     case E_INTCONST:
-      b_push_const_int(expr->u.integer);
+      ir_push_const_int(expr->u.integer);
       break;
     case E_REALCONST:
-      b_push_const_double(expr->u.real);
+      ir_push_const_double(expr->u.real);
       break;
     case E_CHARCONST:
-      b_push_const_int(expr->u.character);
-      b_convert(TYINTEGER, TYCHAR);
+      ir_push_const_int(expr->u.character);
+      ir_convert(TYINTEGER, TYCHAR);
       break;
     case E_BOOLCONST:
-      b_push_const_int(expr->u.bool);
-      b_convert(TYINTEGER, TYBOOL);
+      ir_push_const_int(expr->u.bool);
+      ir_convert(TYINTEGER, TYBOOL);
       break;
     case E_COMPR:
       encode_compare_expr(expr);
@@ -258,21 +451,94 @@ void encode_expression(EXPR expr)
   }
 }
 
+// Tells whether expr is an integer expression made of constants only,
+// which get_int_constant can evaluate.
+BOOLEAN is_int_constant_expr(EXPR expr)
+{
+  if (expr->expr_typetag != TYINTEGER)
+    return FALSE;
+  
+  switch (expr->expr_tag)
+  {
+    case E_INTCONST:
+      return TRUE;
+    case E_SIGN:
+      return is_int_constant_expr(expr->right);
+    case E_ARITH:
+      if (expr->u.arith_tag == AR_RDIV ||
+          !is_int_constant_expr(expr->left) || !is_int_constant_expr(expr->right))
+        return FALSE;
+      // Leave division by zero to run time.
+      return (expr->u.arith_tag != AR_IDIV && expr->u.arith_tag != AR_MOD) ||
+             get_int_constant(expr->right) != 0;
+    default:
+      return FALSE;
+  }
+}
+
+// Gets the value of an expression that is_int_constant_expr accepts.  It is
+// worked out in Integer arithmetic, wrapping around as the machine does,
+// since get_expr_constant goes through a double, which cannot hold every
+// 64-bit Integer.
+long get_int_constant(EXPR expr)
+{
+  long left, right;
+  
+  switch (expr->expr_tag)
+  {
+    case E_INTCONST:
+      return expr->u.integer;
+    case E_SIGN:
+      right = get_int_constant(expr->right);
+      return expr->u.sign_tag == SI_MINUS ? (long)-(unsigned long)right : right;
+    default:
+      left = get_int_constant(expr->left);
+      right = get_int_constant(expr->right);
+      switch (expr->u.arith_tag)
+      {
+        case AR_ADD:
+          return (long)((unsigned long)left + right);
+        case AR_SUB:
+          return (long)((unsigned long)left - right);
+        case AR_MULT:
+          return (long)((unsigned long)left * right);
+        case AR_IDIV:
+          return right == -1 ? (long)-(unsigned long)left : left / right;
+        default:
+          return right == -1 ? 0 : left % right;
+      }
+  }
+}
+
 void encode_arith_expr(EXPR expr)
 {
   encode_expression(expr->left);
+  
+  // An integer constant on the right becomes an immediate operand, and
+  // division by it is done without a divide instruction.
+  if (expr->expr_typetag == TYINTEGER && expr->u.arith_tag != AR_RDIV &&
+      is_int_constant_expr(expr->right))
+  {
+    ir_arith_rel_op_const(expr->u.arith_tag == AR_ADD ? B_ADD :
+                         expr->u.arith_tag == AR_SUB ? B_SUB :
+                         expr->u.arith_tag == AR_MULT ? B_MULT :
+                         expr->u.arith_tag == AR_IDIV ? B_DIV : B_MOD,
+                         TYINTEGER, get_int_constant(expr->right));
+    return;
+  }
+  
   encode_expression(expr->right);
   
   switch (expr->u.arith_tag)
   {
     case AR_ADD:
-      b_arith_rel_op(B_ADD, expr->expr_typetag);
+      ir_arith_rel_op(B_ADD, expr->expr_typetag);
       break;
     case AR_SUB:
-      b_arith_rel_op(B_SUB, expr->expr_typetag);
+      ir_arith_rel_op(B_SUB, expr->expr_typetag);
       break;
     case AR_MULT:
-      b_arith_rel_op(B_MULT, expr->expr_typetag);
+      ir_arith_rel_op(B_MULT, expr->expr_typetag);
       break;
     case AR_IDIV:
       if (expr->expr_typetag != TYINTEGER)
@@ -281,7 +547,7 @@ void encode_arith_expr(EXPR expr)
       }
       else
       {
-        b_arith_rel_op(B_DIV, TYINTEGER);
+        ir_arith_rel_op(B_DIV, TYINTEGER);
       }
       break;
     case AR_RDIV:
@@ -291,11 +557,11 @@ void encode_arith_expr(EXPR expr)
       }
       else
       {
-        b_arith_rel_op(B_DIV, expr->expr_typetag);
+        ir_arith_rel_op(B_DIV, expr->expr_typetag);
       }
       break;
     case AR_MOD:
-      b_arith_rel_op(B_MOD, expr->expr_typetag);
+      ir_arith_rel_op(B_MOD, expr->expr_typetag);
       break;
     default:
       error("Unknown ARITH TAG encountered.");
@@ -305,7 +571,30 @@ void encode_arith_expr(EXPR expr)
 
 void encode_assn_expr(EXPR expr)
 {
-  encode_expression(expr->left);
+  // Assigning to a function's name sets its return value, from its own body
+  // or from a function nested in it
+  if (expr->left->expr_tag == E_FUNC)
+  {
+    ST_ID func_id = expr->left->u.var_func_array.var_id;
+    int level = active_function_level(func_id);
+    
+    if (level == 0)
+    {
+      error("Assignment to '%s' outside of its body", st_get_id_str(func_id));
+      return;
+    }
+    if (level == function_level())
+    {
+      encode_expression(expr->right);
+      ir_set_return(expr->expr_typetag);
+      return;
+    }
+    encode_frame_addr(level, function_result_slot(level));
+  }
+  else
+  {
+    encode_expression(expr->left);
+  }
   encode_expression(expr->right);
   
   switch (expr->expr_typetag)
@@ -316,8 +605,8 @@ void encode_assn_expr(EXPR expr)
     case TYPTR:
     case TYSINGLE:
     case TYREAL:
-      b_assign(expr->expr_typetag);
-      b_pop();
+      ir_assign(expr->expr_typetag);
+      ir_pop();
       break;
     default:
       break;
@@ -331,19 +620,19 @@ void encode_cast_expr(EXPR expr)
   switch (expr->u.cast_tag)
   {
     case CT_SGL_REAL:
-      b_convert(TYSINGLE, TYREAL);
+      ir_convert(TYSINGLE, TYREAL);
       break;
     case CT_REAL_SGL:
-      b_convert(TYREAL, TYSINGLE);
+      ir_convert(TYREAL, TYSINGLE);
       break;
     case CT_INT_REAL:
-      b_convert(TYINTEGER, TYREAL);
+      ir_convert(TYINTEGER, TYREAL);
       break;
     case CT_INT_SGL:
-      b_convert(TYINTEGER, TYSINGLE);
+      ir_convert(TYINTEGER, TYSINGLE);
       break;
     case CT_CHAR_INT:
-    	b_convert(TYCHAR, TYINTEGER);
+    	ir_convert(TYCHAR, TYINTEGER);
 	    break;
     case CT_LDEREF:
       switch (expr->expr_typetag)
@@ -354,7 +643,7 @@ void encode_cast_expr(EXPR expr)
         case TYPTR:
         case TYSINGLE:
         case TYREAL:
-          b_deref(expr->expr_typetag);
+          ir_deref(expr->expr_typetag);
           break;
         default:
           break;
@@ -380,7 +669,17 @@ void encode_compare_expr(EXPR expr)
   // Convert boolean and characters to integers, since that is what arith_rel_op expects.
   if (argType == TYCHAR || argType == TYBOOL)
   {
-    b_convert(argType, TYINTEGER);
+    ir_convert(argType, TYINTEGER);
+  }
+  
+  B_ARITH_REL_OP arop = get_compare_op(expr);
+  
+  // Compare against an integer constant on the right with an immediate operand.
+  if (expr->right->expr_tag == E_INTCONST && argType == TYINTEGER)
+  {
+    ir_arith_rel_op_const(arop, TYINTEGER, expr->right->u.integer);
+    ir_convert(TYINTEGER, TYBOOL);
+    return;
   }
   
   encode_expression(expr->right);
@@ -388,36 +687,104 @@ void encode_compare_expr(EXPR expr)
   // Convert boolean and characters to integers, since that is what arith_rel_op expects.
   if (argType == TYCHAR || argType == TYBOOL)
   {
-    b_convert(argType, TYINTEGER);
+    ir_convert(argType, TYINTEGER);
     argType = TYINTEGER;
   }
   
+  ir_arith_rel_op(arop, argType);
+  
+  ir_convert(TYINTEGER, TYBOOL);
+}
+
+B_ARITH_REL_OP get_compare_op(EXPR expr)
+{
   switch (expr->u.compr_tag)
   {
     case CM_EQUAL:
-      b_arith_rel_op(B_EQ, argType);
-      break;
+      return B_EQ;
     case CM_NEQUAL:
-      b_arith_rel_op(B_NE, argType);
-      break;
+      return B_NE;
     case CM_LESS:
-      b_arith_rel_op(B_LT, argType);
-      break;
+      return B_LT;
     case CM_GTEQL:
-      b_arith_rel_op(B_GE, argType);
-      break;
+      return B_GE;
     case CM_GREAT:
-      b_arith_rel_op(B_GT, argType);
-      break;
+      return B_GT;
     case CM_LSEQL:
-      b_arith_rel_op(B_LE, argType);
-      break;
+      return B_LE;
     default:
       bug("Unknown COMPR TAG encountered.");
-      break;
+      return B_EQ;
+  }
+}
+
+static void encode_cond_jump_operands(EXPR expr, BOOLEAN jump_if, char *label);
+
+void encode_cond_jump(EXPR expr, BOOLEAN jump_if, char *label)
+{
+  // The operands of a comparison are parts of one expression
+  enter_expression(expr);
+  encode_cond_jump_operands(expr, jump_if, label);
+  leave_expression();
+}
+
+static void encode_cond_jump_operands(EXPR expr, BOOLEAN jump_if, char *label)
+{
+  TYPETAG argType;
+  B_ARITH_REL_OP arop;
+  
+  if (expr->expr_tag != E_COMPR)
+  {
+    encode_expression(expr);
+    if (expr->expr_tag == E_VAR || expr->expr_tag == E_ARRAY)
+    {
+      ir_deref(TYBOOL);
+    }
+    ir_cond_jump(TYBOOL, jump_if ? B_NONZERO : B_ZERO, label);
+    return;
+  }
+  
+  // Only ordinal and pointer comparisons can branch on the flags directly;
+  // a real comparison must also treat NaN specially.
+  argType = expr->left->expr_typetag;
+  if (argType != TYINTEGER && argType != TYCHAR && argType != TYBOOL && argType != TYPTR)
+  {
+    encode_expression(expr);
+    ir_cond_jump(TYBOOL, jump_if ? B_NONZERO : B_ZERO, label);
+    return;
+  }
+  
+  arop = get_compare_op(expr);
+  if (!jump_if)
+  {
+    arop = arop == B_EQ ? B_NE :
+           arop == B_NE ? B_EQ :
+           arop == B_LT ? B_GE :
+           arop == B_GE ? B_LT :
+           arop == B_GT ? B_LE : B_GT;
+  }
+  
+  // Operands are pushed and converted as in encode_compare_expr
+  encode_expression(expr->left);
+  if (argType == TYCHAR || argType == TYBOOL)
+  {
+    ir_convert(argType, TYINTEGER);
+  }
+  
+  if (expr->right->expr_tag == E_INTCONST && argType == TYINTEGER)
+  {
+    ir_cond_jump_rel_const(arop, TYINTEGER, expr->right->u.integer, label);
+    return;
+  }
+  
+  encode_expression(expr->right);
+  if (argType == TYCHAR || argType == TYBOOL)
+  {
+    ir_convert(argType, TYINTEGER);
+    argType = TYINTEGER;
   }
   
-  b_convert(TYINTEGER, TYBOOL);
+  ir_cond_jump_rel(arop, argType, label);
 }
 
 void encode_signed_expr(EXPR expr)
@@ -430,7 +797,7 @@ void encode_signed_expr(EXPR expr)
       /* No op */
       break;
     case SI_MINUS:
-      b_negate(expr->expr_typetag);
+      ir_negate(expr->expr_typetag);
       break;
     default:
       bug("Unknown SIGN TAG encountered.");
@@ -446,12 +813,12 @@ void encode_unary_func_expr(EXPR expr)
       
       if (expr->right->expr_tag == E_VAR)
       {
-        b_deref(expr->right->expr_typetag);
+        ir_deref(expr->right->expr_typetag);
       }
       
       if (expr->right->expr_typetag != TYINTEGER)
       {
-        b_convert(expr->right->expr_typetag, TYINTEGER);
+        ir_convert(expr->right->expr_typetag, TYINTEGER);
       }
       break;
     case UF_CHR:
@@ -459,10 +826,10 @@ void encode_unary_func_expr(EXPR expr)
       
       if (expr->right->expr_tag == E_VAR)
       {
-        b_deref(expr->right->expr_typetag);
+        ir_deref(expr->right->expr_typetag);
       }
       
-      b_convert(TYINTEGER, TYCHAR);
+      ir_convert(TYINTEGER, TYCHAR);
       break;
     case UF_SUCC:
       encode_successor_func(expr->right);
@@ -475,36 +842,315 @@ void encode_unary_func_expr(EXPR expr)
 
 void encode_variable_expr(EXPR expr)
 {
-  char* gbl_var_id = st_get_id_str(expr->u.var_func_array.var_id);
+  ST_ID var_id = expr->u.var_func_array.var_id;
+  int block;
+  ST_DR record = st_lookup(var_id, &block);
+  
+  // Undeclared; new_expr_identifier has reported it
+  if (record == NULL)
+  {
+    return;
+  }
+  
+  if (record->tag == GDECL)
+  {
+    ir_push_ext_addr(st_get_id_str(var_id));
+    return;
+  }
+  
+  // Parameters and locals, possibly of an enclosing function
+  encode_frame_addr(block_function_level(block), record->u.decl.v.offset);
   
-  b_push_ext_addr(gbl_var_id);
+  // A var parameter holds the address of the variable
+  if (record->u.decl.is_ref)
+  {
+    ir_deref(TYPTR);
+  }
+}
+
+// Returns the number of arguments of a call
+static int count_call_args(EXPR expr)
+{
+  EXPR_LIST arguments = expr->u.var_func_array.arguments;
+  int num_args = 0;
+  while (arguments != NULL && arguments->base != NULL)
+  {
+    num_args++;
+    arguments = arguments->next;
+  }
+  return num_args;
+}
+
+// Puts the arguments of a call in args, in order (the actual parameter list
+// is built back to front), and the type each is passed as in arg_types:
+// that of its parameter, or its own if there is none
+static void get_call_args(EXPR expr, PARAM_LIST params, int num_args,
+                          EXPR args[], TYPETAG arg_types[])
+{
+  EXPR_LIST arguments = expr->u.var_func_array.arguments;
+  int loop_index;
+  for (loop_index = num_args - 1; loop_index >= 0; loop_index--)
+  {
+    args[loop_index] = arguments->base;
+    arguments = arguments->next;
+  }
+  
+  PARAM_LIST param = params;
+  for (loop_index = 0; loop_index < num_args; loop_index++)
+  {
+    arg_types[loop_index] = param ? ty_query(param->type) : args[loop_index]->expr_typetag;
+    param = param ? param->next : NULL;
+  }
+}
+
+// Pushes the value of an argument as arg_type, its parameter's type, or the
+// address of the variable for a var parameter
+static void encode_arg(EXPR arg, PARAM_LIST param, TYPETAG arg_type)
+{
+  if (param && param->is_ref)
+  {
+    // Var parameters are passed the address of the variable
+    ST_ID unresolved;
+    if ((arg->expr_tag != E_VAR && arg->expr_tag != E_ARRAY)
+        || arg->expr_typetag != ty_query(ty_query_ptr(param->type, &unresolved)))
+      error("Var parameter '%s' needs a variable of its type", st_get_id_str(param->id));
+    encode_expression(arg);
+    return;
+  }
+  
+  encode_expression(arg);
+  if (arg->expr_tag == E_VAR || arg->expr_tag == E_ARRAY)
+    ir_deref(arg->expr_typetag);
+  if (arg->expr_typetag != arg_type)
+  {
+    if ((arg->expr_typetag == TYINTEGER || arg->expr_typetag == TYSINGLE
+         || arg->expr_typetag == TYREAL)
+        && (arg_type == TYSINGLE || arg_type == TYREAL))
+      ir_convert(arg->expr_typetag, arg_type);
+    else
+      error("Incompatible type for parameter '%s'", st_get_id_str(param->id));
+  }
+}
+
+// Returns the type an argument of type arg_type is passed as, promoted as
+// in C, and converts the value on top of the stack to it if convert is set
+static TYPETAG promote_arg(TYPETAG arg_type, BOOLEAN convert)
+{
+  TYPETAG promoted = arg_type;
+  if (arg_type == TYCHAR || arg_type == TYBOOL)
+    promoted = TYINTEGER;
+  else if (arg_type == TYSINGLE)
+    promoted = TYREAL;
+  
+  if (convert && promoted != arg_type)
+    ir_convert(arg_type, promoted);
+  return promoted;
 }
 
 void encode_function_call(EXPR expr)
 {
   ST_ID func_id = expr->u.var_func_array.var_id;
-  char* func_name = st_get_id_str(func_id);
+  int block;
+  ST_DR func_rec = st_lookup(func_id, &block);
   
-  EXPR_LIST arguments = expr->u.var_func_array.arguments;
+  PARAM_LIST params;
+  BOOLEAN check_args;
+  ty_query_func(func_rec->u.decl.type, &params, &check_args);
   
+  // new_expr_var_funccall checks the arguments of a call in parentheses,
+  // and a call without them must need none
+  if (expr->u.var_func_array.arguments == NULL && params != NULL)
+  {
+    int num_params = 0;
+    PARAM_LIST param;
+    for (param = params; param != NULL; param = param->next)
+      num_params++;
+    error("Function '%s' expected %d arguments, received 0", st_get_id_str(func_id), num_params);
+  }
+  
+  if (inline_call(expr))
+  {
+    return;
+  }
+  
+  char* func_name = func_rec->u.decl.v.global_func_name;
+  int num_args = count_call_args(expr);
+  EXPR args[num_args];
+  TYPETAG arg_types[num_args];
+  int loop_index;
+  get_call_args(expr, params, num_args, args, arg_types);
+  
+  // Each argument takes a whole stack word, and reals take 8 bytes
   int sum = 0;
-  while (arguments != NULL && arguments->base != NULL)
+  for (loop_index = 0; loop_index < num_args; loop_index++)
   {
-    TYPE t = ty_build_basic(arguments->base->expr_typetag);
-    sum += get_type_size(t);
-    arguments = arguments->next;
+    if (arg_types[loop_index] == TYREAL || arg_types[loop_index] == TYSINGLE)
+      sum += 8;
+    else
+      sum += TARGET_PTR_SIZE;
   }
   
-  b_alloc_arglist(sum);
+  ir_alloc_arglist(sum);
   
-  while (arguments != NULL && arguments->base != NULL)
+  PARAM_LIST param = params;
+  for (loop_index = 0; loop_index < num_args; loop_index++)
   {
-    encode_expression(arguments->base);
-    b_load_arg(arguments->base->expr_typetag);
-    arguments = arguments->next;
+    EXPR arg = args[loop_index];
+    TYPETAG arg_type = arg_types[loop_index];
+    
+    if (param && param->is_ref)
+    {
+      encode_arg(arg, param, arg_type);
+      ir_load_arg(TYPTR);
+    }
+    else if (opt_direct_args && arg->expr_tag == E_INTCONST && arg_type == TYINTEGER)
+    {
+      ir_load_arg_const_int(arg->u.integer);
+    }
+    else
+    {
+      encode_arg(arg, param, arg_type);
+      ir_load_arg(promote_arg(arg_type, TRUE));
+    }
+    param = param ? param->next : NULL;
+  }
+  
+  ir_funcall_by_name(func_name, expr->expr_typetag);
+}
+
+// The last call statement encoded by encode_statement_expr, and the marks
+// before and after its code
+static EXPR tail_stmt = NULL;
+static int tail_start, tail_end;
+
+void encode_statement_expr(EXPR expr)
+{
+  int start = ir_code_mark();
+  encode_expression(expr);
+  inline_note_statement(expr, start, ir_code_mark());
+  
+  tail_stmt = NULL;
+  if (expr->expr_tag == E_FUNC
+      || (expr->expr_tag == E_ASSIGN && expr->left->expr_tag == E_FUNC))
+  {
+    tail_stmt = expr;
+    tail_start = start;
+    tail_end = ir_code_mark();
+  }
+}
+
+// Tells whether the argument of a var parameter is a variable in the
+// frame of the current function, which a tail call must not pass on
+static BOOLEAN is_current_frame_var(EXPR arg)
+{
+  // An array element is in the frame of the array
+  while (arg->expr_tag == E_ARRAY)
+    arg = arg->right;
+  if (arg->expr_tag != E_VAR)
+    return FALSE;
+  
+  int block;
+  ST_DR record = st_lookup(arg->u.var_func_array.var_id, &block);
+  
+  return record != NULL && (record->tag == LDECL || record->tag == PDECL)
+    && !record->u.decl.is_ref && block_function_level(block) == function_level();
+}
+
+BOOLEAN encode_tail_call()
+{
+  EXPR call = tail_stmt;
+  tail_stmt = NULL;
+  if (!opt_tail_calls || call == NULL || call->expr_typetag == TYERROR)
+    return FALSE;
+  
+  // Either a procedure call ending a procedure, or the function's result
+  // set to a call returning the same type
+  TYPETAG return_type = current_function_return_type();
+  if (call->expr_tag == E_ASSIGN)
+  {
+    if (active_function_level(call->left->u.var_func_array.var_id) != function_level()
+        || call->right->expr_tag != E_FUNC || call->right->expr_typetag != return_type)
+      return FALSE;
+    call = call->right;
+  }
+  else if (return_type != TYVOID || call->expr_typetag != TYVOID)
+  {
+    return FALSE;
+  }
+  
+  // An expanded call is better still
+  if (inline_possible(call))
+    return FALSE;
+  
+  ST_ID func_id = call->u.var_func_array.var_id;
+  int block;
+  ST_DR func_rec = st_lookup(func_id, &block);
+  char *func_name = func_rec->u.decl.v.global_func_name;
+  BOOLEAN self = !strcmp(func_name, current_function_name());
+  
+  PARAM_LIST params, param;
+  BOOLEAN check_args;
+  ty_query_func(func_rec->u.decl.type, &params, &check_args);
+  
+  int num_args = count_call_args(call);
+  EXPR args[num_args];
+  TYPETAG arg_types[num_args];
+  int offsets[num_args];
+  int loop_index;
+  get_call_args(call, params, num_args, args, arg_types);
+  
+  // Nothing passed by reference may live in the frame, which the callee
+  // reuses
+  param = params;
+  for (loop_index = 0; loop_index < num_args; loop_index++)
+  {
+    if (param && param->is_ref && is_current_frame_var(args[loop_index]))
+      return FALSE;
+    param = param ? param->next : NULL;
+  }
+  
+  if (self)
+  {
+    // The new values go straight into the parameters
+    param = params;
+    for (loop_index = 0; loop_index < num_args; loop_index++)
+    {
+      if (param == NULL)
+        return FALSE;
+      offsets[loop_index] = st_lookup(param->id, &block)->u.decl.v.offset;
+      param = param->next;
+    }
+    if (param != NULL)
+      return FALSE;
+  }
+  else
+  {
+    // A function nested in this one needs its frame, and the arguments
+    // must fit where this function's own were passed
+    TYPETAG promoted[num_args];
+    if (block_function_level(block) == function_level())
+      return FALSE;
+    for (loop_index = 0; loop_index < num_args; loop_index++)
+      promoted[loop_index] = promote_arg(arg_types[loop_index], FALSE);
+    if (!b_tail_call_fits(num_args, promoted))
+      return FALSE;
   }
   
-  b_funcall_by_name(func_name, expr->expr_typetag);
+  if (!ir_retract_code(tail_start, tail_end))
+    return FALSE;
+  
+  param = params;
+  for (loop_index = 0; loop_index < num_args; loop_index++)
+  {
+    encode_arg(args[loop_index], param, arg_types[loop_index]);
+    if (!self)
+      arg_types[loop_index] = promote_arg(arg_types[loop_index], TRUE);
+    param = param ? param->next : NULL;
+  }
+  
+  if (self)
+    return ir_tail_call_self(num_args, arg_types, offsets);
+  return ir_tail_call_by_name(func_name, num_args, arg_types);
 }
 
 void encode_array(EXPR expr)
@@ -586,15 +1232,28 @@ void encode_array(EXPR expr)
       
       if (the_expr->expr_tag == E_VAR || the_expr->expr_tag == E_ARRAY)
       {
-        b_deref(the_expr->expr_typetag);
+        ir_deref(the_expr->expr_typetag);
       }
       
       // Compute the offset from the starting index of the current dimension
-      b_push_const_int(lower_bounds[loop_index]);
-      
-      b_arith_rel_op(B_SUB, TYINTEGER);
-      
-      b_ptr_arith_op(B_ADD, TYINTEGER, sizes[loop_index]);
+      ir_arith_rel_op_const(B_SUB, TYINTEGER, lower_bounds[loop_index]);
+
+      // With -fbounds-checks, the offset must be below the number of elements;
+      // a constant index is checked here instead if -fbounds-elim is on.
+      if (opt_bounds_checks)
+      {
+        long index = is_int_constant_expr(the_expr) ?
+                     get_int_constant(the_expr) : 0;
+
+        if (!opt_bounds_elim || !is_int_constant_expr(the_expr) ||
+            index < lower_bounds[loop_index] ||
+            index >= (long)lower_bounds[loop_index] + number_elems[loop_index])
+        {
+          ir_check_index(TYINTEGER, number_elems[loop_index]);
+        }
+      }
+
+      ir_ptr_arith_op(B_ADD, TYINTEGER, sizes[loop_index]);
     }
     
     
@@ -610,48 +1269,43 @@ void encode_successor_func(EXPR child_expr)
         encode_expression(child_expr);
         if (child_expr->expr_typetag == TYCHAR)
         {
-          b_convert(TYCHAR, TYINTEGER);
-          b_push_const_int(1);
-          b_arith_rel_op(B_ADD, TYINTEGER);
-          b_convert(TYINTEGER, TYCHAR);
+          ir_convert(TYCHAR, TYINTEGER);
+          ir_arith_rel_op_const(B_ADD, TYINTEGER, 1);
+          ir_convert(TYINTEGER, TYCHAR);
         }
         else
         {
-          b_push_const_int(1);
-          b_arith_rel_op(B_ADD, TYINTEGER);
+          ir_arith_rel_op_const(B_ADD, TYINTEGER, 1);
         }
       }
       break;
     case E_VAR:
       {
         encode_expression(child_expr);
-        b_deref(child_expr->expr_typetag);
+        ir_deref(child_expr->expr_typetag);
         if (child_expr->expr_typetag == TYCHAR)
         {
-          b_convert(TYCHAR, TYINTEGER);
-          b_push_const_int(1);
-          b_arith_rel_op(B_ADD, TYINTEGER);
-          b_convert(TYINTEGER, TYCHAR);
+          ir_convert(TYCHAR, TYINTEGER);
+          ir_arith_rel_op_const(B_ADD, TYINTEGER, 1);
+          ir_convert(TYINTEGER, TYCHAR);
         }
         else
         {
-          b_push_const_int(1);
-          b_arith_rel_op(B_ADD, TYINTEGER);
+          ir_arith_rel_op_const(B_ADD, TYINTEGER, 1);
         }
       }
       break;
     case E_CHARCONST:
       {
         encode_expression(child_expr);
-        b_convert(TYCHAR, TYINTEGER);
-        b_push_const_int(1);
-        b_arith_rel_op(B_ADD, TYINTEGER);
-        b_convert(TYINTEGER, TYCHAR);
+        ir_convert(TYCHAR, TYINTEGER);
+        ir_arith_rel_op_const(B_ADD, TYINTEGER, 1);
+        ir_convert(TYINTEGER, TYCHAR);
       }
       break;
     case E_INTCONST:
       {
-        b_push_const_int(child_expr->u.integer + 1);
+        ir_push_const_int(child_expr->u.integer + 1);
       }
       break;
     default:
@@ -669,48 +1323,43 @@ void encode_predecessor_func(EXPR child_expr)
         encode_expression(child_expr);
         if (child_expr->expr_typetag == TYCHAR)
         {
-          b_convert(TYCHAR, TYINTEGER);
-          b_push_const_int(-1);
-          b_arith_rel_op(B_ADD, TYINTEGER);
-          b_convert(TYINTEGER, TYCHAR);
+          ir_convert(TYCHAR, TYINTEGER);
+          ir_arith_rel_op_const(B_ADD, TYINTEGER, -1);
+          ir_convert(TYINTEGER, TYCHAR);
         }
         else
         {
-          b_push_const_int(-1);
-          b_arith_rel_op(B_ADD, TYINTEGER);
+          ir_arith_rel_op_const(B_ADD, TYINTEGER, -1);
         }
       }
       break;
     case E_VAR:
       {
         encode_expression(child_expr);
-        b_deref(child_expr->expr_typetag);
+        ir_deref(child_expr->expr_typetag);
         if (child_expr->expr_typetag == TYCHAR)
         {
-          b_convert(TYCHAR, TYINTEGER);
-          b_push_const_int(-1);
-          b_arith_rel_op(B_ADD, TYINTEGER);
-          b_convert(TYINTEGER, TYCHAR);
+          ir_convert(TYCHAR, TYINTEGER);
+          ir_arith_rel_op_const(B_ADD, TYINTEGER, -1);
+          ir_convert(TYINTEGER, TYCHAR);
         }
         else
         {
-          b_push_const_int(-1);
-          b_arith_rel_op(B_ADD, TYINTEGER);
+          ir_arith_rel_op_const(B_ADD, TYINTEGER, -1);
         }
       }
       break;
     case E_CHARCONST:
       {
         encode_expression(child_expr);
-        b_convert(TYCHAR, TYINTEGER);
-        b_push_const_int(-1);
-        b_arith_rel_op(B_ADD, TYINTEGER);
-        b_convert(TYINTEGER, TYCHAR);
+        ir_convert(TYCHAR, TYINTEGER);
+        ir_arith_rel_op_const(B_ADD, TYINTEGER, -1);
+        ir_convert(TYINTEGER, TYCHAR);
       }
       break;
     case E_INTCONST:
       {
-        b_push_const_int(child_expr->u.integer - 1);
+        ir_push_const_int(child_expr->u.integer - 1);
       }
       break;
     default:
@@ -770,3 +1419,265 @@ char *get_last_label() {
   
   return to_return;
 }
+
+// Case statements.  The arms are emitted first, and the code that picks
+// one (the dispatch) after them, once all the labels are known:
+//
+//        <selector>
+//        jmp  dispatch
+//   arm: <statement>                   (one per case element)
+//        jmp  end
+//   else:<statements>                  (if there is an else part)
+//        jmp  end
+//   dispatch:
+//        <pops the selector and jumps to an arm, else, or end>
+//   end:
+//
+// The dispatch sorts the labelled ranges and then, for each run of them,
+// uses a jump table if the run is dense, bit tests if it falls in a
+// 32-value window and has few arms, a chain of compares if it is tiny,
+// and otherwise splits it in two with one compare (a binary search).
+
+#define MAX_CASE_NEST 64
+#define CASE_TINY 3               // ranges dispatched by plain compares
+#define CASE_BIT_TARGETS 3        // arms that bit tests are used for
+#define CASE_TABLE_MIN 4          // ranges needed for a jump table
+#define CASE_TABLE_MAX 4096       // largest jump table
+#define CASE_TABLE_DENSITY 40     // percent of a table that must be used
+
+typedef struct
+{
+  long lo, hi;
+  char *label;
+} CASE_RANGE;
+
+typedef struct
+{
+  CASE_RANGE *ranges;
+  int nranges, size;
+  char *dispatch_label;
+  char *end_label;
+  char *else_label;
+  char *nomatch_label;            // pops the selector, then goes to default
+} CASE_STATE;
+
+static CASE_STATE case_states[MAX_CASE_NEST];
+static int case_nest = -1;
+
+void encode_case_begin()
+{
+  CASE_STATE *cs;
+
+  if (case_nest + 1 == MAX_CASE_NEST)
+  {
+    bug("Case statements nested too deeply");
+  }
+  cs = &case_states[++case_nest];
+  cs->nranges = 0;
+  cs->dispatch_label = new_symbol();
+  cs->end_label = new_symbol();
+  cs->else_label = NULL;
+  cs->nomatch_label = NULL;
+
+  ir_jump(cs->dispatch_label);
+}
+
+// Gets the value of a case constant.  Integer constants are worked out by
+// get_int_constant, as get_expr_constant cannot hold every 64-bit Integer.
+long get_case_constant(EXPR expr)
+{
+  if (is_int_constant_expr(expr))
+  {
+    return get_int_constant(expr);
+  }
+  return (long) get_expr_constant(expr);
+}
+
+void encode_case_range(long lo, long hi, char *label)
+{
+  CASE_STATE *cs = &case_states[case_nest];
+
+  if (cs->nranges == cs->size)
+  {
+    cs->size = cs->size ? 2 * cs->size : 16;
+    cs->ranges = (CASE_RANGE*) realloc(cs->ranges, cs->size * sizeof(CASE_RANGE));
+    if (cs->ranges == NULL)
+    {
+      bug("encode_case_range: out of memory");
+    }
+  }
+  cs->ranges[cs->nranges].lo = lo;
+  cs->ranges[cs->nranges].hi = hi;
+  cs->ranges[cs->nranges].label = label;
+  cs->nranges++;
+}
+
+void encode_case_arm(char *label)
+{
+  ir_dispatch_label(label, case_states[case_nest].dispatch_label);
+}
+
+void encode_case_arm_end()
+{
+  ir_jump(case_states[case_nest].end_label);
+}
+
+void encode_case_else()
+{
+  CASE_STATE *cs = &case_states[case_nest];
+
+  cs->else_label = new_symbol();
+  ir_dispatch_label(cs->else_label, cs->dispatch_label);
+}
+
+static int compare_case_ranges(const void *a, const void *b)
+{
+  const CASE_RANGE *ra = (const CASE_RANGE*) a;
+  const CASE_RANGE *rb = (const CASE_RANGE*) b;
+
+  return ra->lo < rb->lo ? -1 : ra->lo > rb->lo;
+}
+
+// Where to go, selector still on the stack, when no range matches
+static char *case_nomatch_label(CASE_STATE *cs)
+{
+  if (cs->nomatch_label == NULL)
+  {
+    cs->nomatch_label = new_symbol();
+  }
+  return cs->nomatch_label;
+}
+
+// Emits the dispatch for ranges first through last - 1, which are sorted
+static void encode_case_search(CASE_STATE *cs, int first, int last)
+{
+  CASE_RANGE *r = cs->ranges;
+  char *default_label = cs->else_label ? cs->else_label : cs->end_label;
+  unsigned long width;            // the span of the values, less one
+  unsigned long values = 0;
+  char *targets[CASE_BIT_TARGETS];
+  int ntargets = 0;
+  int i, j;
+
+  if (last - first <= CASE_TINY)
+  {
+    for (i = first; i < last; i++)
+    {
+      if (r[i].lo == r[i].hi)
+      {
+        ir_dispatch(B_EQ, TYSIGNEDLONGINT, r[i].lo, r[i].label, TRUE);
+      }
+      else
+      {
+        char *next = new_symbol();
+        ir_dispatch(B_LT, TYSIGNEDLONGINT, r[i].lo, next, FALSE);
+        ir_dispatch(B_LE, TYSIGNEDLONGINT, r[i].hi, r[i].label, TRUE);
+        ir_label(next);
+      }
+    }
+    ir_jump(case_nomatch_label(cs));
+    return;
+  }
+
+  // Worked out unsigned, as the labels may be 64-bit Integers far apart;
+  // values is only used when the span is small
+  width = (unsigned long) r[last - 1].hi - (unsigned long) r[first].lo;
+  for (i = first; i < last; i++)
+  {
+    values += (unsigned long) r[i].hi - (unsigned long) r[i].lo + 1;
+    for (j = 0; j < ntargets && j < CASE_BIT_TARGETS && targets[j] != r[i].label; j++)
+      ;
+    if (j == ntargets)
+    {
+      if (ntargets < CASE_BIT_TARGETS)
+      {
+        targets[j] = r[i].label;
+      }
+      ntargets++;
+    }
+  }
+
+  // One bt per arm tests all of its values in the window
+  if (width < 32 && ntargets <= CASE_BIT_TARGETS)
+  {
+    for (j = 0; j < ntargets; j++)
+    {
+      unsigned int mask = 0;
+      for (i = first; i < last; i++)
+      {
+        if (r[i].label == targets[j])
+        {
+          int v;
+          for (v = r[i].lo - r[first].lo; v <= r[i].hi - r[first].lo; v++)
+          {
+            mask |= 1u << v;
+          }
+        }
+      }
+      ir_dispatch_bits(TYSIGNEDLONGINT, r[first].lo, mask, targets[j], TRUE);
+    }
+    ir_jump(case_nomatch_label(cs));
+    return;
+  }
+
+  if (last - first >= CASE_TABLE_MIN && width < CASE_TABLE_MAX
+      && values * 100 >= (width + 1) * CASE_TABLE_DENSITY)
+  {
+    char **table = (char**) malloc((width + 1) * sizeof(char*));
+    int k = 0;
+
+    if (table == NULL)
+    {
+      bug("encode_case_search: out of memory");
+    }
+    for (i = first; i < last; i++)
+    {
+      // Holes go straight to the default, which b_jump_table has popped for
+      while (r[first].lo + k < r[i].lo)
+      {
+        table[k++] = default_label;
+      }
+      while (k <= r[i].hi - r[first].lo)
+      {
+        table[k++] = r[i].label;
+      }
+    }
+    ir_jump_table(TYSIGNEDLONGINT, r[first].lo, (int) width + 1, table, default_label);
+    free(table);
+    return;
+  }
+
+  // Split in two, and search each half
+  {
+    int mid = first + (last - first) / 2;
+    char *low_half = new_symbol();
+
+    ir_dispatch(B_LT, TYSIGNEDLONGINT, r[mid].lo, low_half, FALSE);
+    encode_case_search(cs, mid, last);
+    ir_label(low_half);
+    encode_case_search(cs, first, mid);
+  }
+}
+
+void encode_case_end()
+{
+  CASE_STATE *cs = &case_states[case_nest];
+
+  if (cs->else_label != NULL)
+  {
+    ir_jump(cs->end_label);
+  }
+
+  ir_label(cs->dispatch_label);
+  qsort(cs->ranges, cs->nranges, sizeof(CASE_RANGE), compare_case_ranges);
+  encode_case_search(cs, 0, cs->nranges);
+  if (cs->nomatch_label != NULL)
+  {
+    ir_label(cs->nomatch_label);
+    ir_pop();
+    ir_jump(cs->else_label ? cs->else_label : cs->end_label);
+  }
+  ir_label(cs->end_label);
+
+  case_nest--;
+}
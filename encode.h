@@ -1,8 +1,9 @@
 #ifndef ENCODE_H
 #define ENCODE_H
 
-#include "backend-x86.h"
 #include "defs.h"
+#include BACKEND_HEADER_FILE
+#include "ir.h"
 #include "expr.h"
 #include "types.h"
 #include "symtab.h"
@@ -12,12 +13,41 @@
 void encode(ST_ID id);
 void encode_decl_from_type(TYPE type);
 void encode_expression(EXPR expr);
+
+// Encodes an assignment or procedure call statement.  The last one is kept
+// for encode_tail_call.
+void encode_statement_expr(EXPR expr);
+
+// If the last statement of the current function's body was a call that
+// can be made a tail call (with -ftail-calls), replaces its code with one.
+// The call may be in the last branch of an if statement that ends the
+// body, in which case the other branches still reach the end.  Returns
+// TRUE if nothing does any more.  Call it at the end of each function
+// body, before the return value is loaded.
+BOOLEAN encode_tail_call();
+
+// Encodes a boolean condition and jumps to label if its value is jump_if.
+// Comparisons of ordinals and pointers branch on the compare directly.
+void encode_cond_jump(EXPR expr, BOOLEAN jump_if, char *label);
 int get_type_size(TYPE type);
 int get_type_alignment(TYPE type);
 
 void start_main();
 void end_main();
 
+// Case statements: after the selector has been encoded, call
+// encode_case_begin, then for each case element encode_case_range for each
+// of its ranges, encode_case_arm before its statement and
+// encode_case_arm_end after it, then encode_case_else before the else part
+// if there is one, and encode_case_end last.
+void encode_case_begin();
+long get_case_constant(EXPR expr);
+void encode_case_range(long lo, long hi, char *label);
+void encode_case_arm(char *label);
+void encode_case_arm_end();
+void encode_case_else();
+void encode_case_end();
+
 //store last loop exit label for break statements
 void store_label(char* label);
 
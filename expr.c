@@ -14,7 +14,12 @@
  * Purpose: CSCE 531 (Compiler Construction) Project
  */
  
+#include <limits.h>
+#include <string.h>
 #include "expr.h"
+#include "options.h"
+#include "defs.h"
+#include BACKEND_HEADER_FILE
 
 #define COMPLETELY_INCOMPATIBLE -1
 #define COMPLETELY_COMPATIBLE    0
@@ -41,6 +46,8 @@
  */
 int require_type_conversion(EXPR left, EXPR right, int precedence, TYPETAG *required);
 CASTTAG get_cast_constant(TYPETAG from, TYPETAG to);
+static EXPR hash_cons(EXPR expr);
+static void forget_nodes(void);
 
 int debug = 0; //set to 1 for debug messages
 
@@ -94,6 +101,9 @@ EXPR new_expr_assign(EXPR left, EXPR right)
 	newExpr->right = modifiedRight;
 	if (debug == 1) msg("new_expr_assign");
 
+	// What comes after the assignment may see other values.
+	forget_nodes();
+
 	return newExpr;
 }
 
@@ -147,7 +157,7 @@ EXPR new_expr_arith(EXPR left, ARITHTAG t, EXPR right)
 	newExpr->right = modifiedRight;
 	if (debug == 1) msg("new_expr_arith: ARITHTAG %i", newExpr->u.arith_tag);
 
-	return newExpr;
+	return hash_cons(simplify_expr(newExpr));
 }
 
 /* New signed expression */
@@ -176,7 +186,7 @@ EXPR new_expr_sign(int sign, EXPR right)
 	newExpr->right = modifiedRight;
 	if (debug ==1) msg("new_expr_sign: SIGNTAG %i", newExpr->u.sign_tag);
 
-	return newExpr;
+	return hash_cons(simplify_expr(newExpr));
 }
 
 /* New int const expression */
@@ -191,7 +201,7 @@ EXPR new_expr_intconst(long i)
 	if (debug == 1) msg("new_expr_intconst %li", newExpr->u.integer);
 
 
-	return newExpr;
+	return hash_cons(newExpr);
 }
 
 /* New real const expression */
@@ -205,7 +215,7 @@ EXPR new_expr_realconst(double d)
 	newExpr->u.real = d;
 	if (debug == 1) msg("new_expr_realconst %f", newExpr->u.real);
 
-	return newExpr;
+	return hash_cons(newExpr);
 }
 
 /* new character constant expression */
@@ -218,7 +228,7 @@ EXPR new_expr_strconst(char *str)
     newExpr->u.character = str[0];
     if (debug) msg("new_expr_strconst %s", newExpr->u.character);
     
-    return newExpr;
+    return hash_cons(newExpr);
 }
 
 /* New boolean constant (i.e. TRUE or FALSE). */
@@ -231,7 +241,7 @@ EXPR new_expr_boolconst(int bool)
     newExpr->u.bool = bool;
     if (debug == 1) msg("new_expr_boolconst %s", (bool == 0) ? "false" : "true");
     
-    return newExpr;
+    return hash_cons(newExpr);
 }
 
 /* New boolean expression */
@@ -284,7 +294,7 @@ EXPR new_expr_compr(EXPR left, COMPRTAG t, EXPR right)
 	newExpr->right = modifiedRight;
 	if (debug == 1) msg("new_expr_compr: COMPRTAG %i", newExpr->u.compr_tag);
 
-	return newExpr;
+	return hash_cons(simplify_expr(newExpr));
 }
 
 /* New unary function expression */
@@ -330,7 +340,7 @@ EXPR new_expr_unfunc(UNFUNCTAG t, EXPR_LIST rightList)
 	
 	if (debug == 1) msg("new_expr_unfunc: UNFUNCTAG %i", newExpr->u.unfunc_tag);
 
-	return newExpr;
+	return hash_cons(simplify_expr(newExpr));
 }
 
 /* New global variable or function call expression */
@@ -352,9 +362,10 @@ EXPR new_expr_identifier(ST_ID id)
     }
     else
     {
-        if (record->tag != GDECL)
+        if (record->tag != GDECL && record->tag != LDECL
+            && record->tag != PDECL && record->tag != FDECL)
         {
-            error("'%s' is not a globally-defined variable.", st_get_id_str(id));
+            error("'%s' is not a variable or function.", st_get_id_str(id));
         }
         else
         {
@@ -375,10 +386,11 @@ EXPR new_expr_identifier(ST_ID id)
     newExpr->expr_typetag = var_typetag;
     newExpr->expr_fulltype = var_type;
     newExpr->u.var_func_array.var_id = id;
+    newExpr->u.var_func_array.arguments = NULL;
 	
 	if (debug == 1) msg("new_expr_identifier var/func");
 
-	return newExpr;
+	return hash_cons(newExpr);
 }
 
 EXPR new_expr_var_funccall(EXPR base, EXPR_LIST arguments)
@@ -387,7 +399,7 @@ EXPR new_expr_var_funccall(EXPR base, EXPR_LIST arguments)
 
     if (base->expr_tag == E_VAR)
     {
-        if (arguments) { error("'%s' is a variable, but it's being treated as a function!", base->u.var_func_array.var_id); }
+        if (arguments) { error("'%s' is a variable, but it's being treated as a function!", st_get_id_str(base->u.var_func_array.var_id)); }
         
         toReturn = base;
     }
@@ -424,6 +436,8 @@ EXPR new_expr_var_funccall(EXPR base, EXPR_LIST arguments)
         toReturn->u.var_func_array.var_id = base->u.var_func_array.var_id;
         toReturn->u.var_func_array.arguments = arguments;
         
+        // The call may change any variable.
+        forget_nodes();
     }
     
     return toReturn;
@@ -450,6 +464,8 @@ EXPR new_expr_array(EXPR base, EXPR_LIST indices)
   
   newExpr->right = base;
   newExpr->u.var_func_array.arguments = indices;
+  
+  return hash_cons(newExpr);
 }
 
 EXPR new_expr_subrange(EXPR low, EXPR high)
@@ -495,7 +511,7 @@ EXPR new_expr_cast(CASTTAG t, EXPR right)
     
     if (debug == 1) msg("new_expr_cast: CASTTAG %d", t); //ty_print_typetag(right->expr_typetag); msg(""); }
     
-    return newExpr;
+    return hash_cons(simplify_expr(newExpr));
 }
 
 EXPR_LIST new_expr_list(EXPR item)
@@ -678,7 +694,7 @@ double get_expr_constant(EXPR expr)
 				break;
 				
 				case AR_IDIV:
-				return (int)get_expr_constant(expr->left) / (int)get_expr_constant(expr->right);	
+				return (long)get_expr_constant(expr->left) / (long)get_expr_constant(expr->right);	
 				break;
 				
 				case AR_RDIV:
@@ -686,7 +702,7 @@ double get_expr_constant(EXPR expr)
 				break;
 				
 				case AR_MOD:
-				return (int)get_expr_constant(expr->left) % (int)get_expr_constant(expr->right);	
+				return (long)get_expr_constant(expr->left) % (long)get_expr_constant(expr->right);	
 				break;
 			}
 		break;
@@ -733,6 +749,458 @@ double get_expr_constant(EXPR expr)
 	}	
 }
 
+/* -----=====----- SIMPLIFICATION -----=====----- */
+
+// The least Integer, which overflows when divided by -1.
+#define INTEGER_MIN (TARGET_LONG_SIZE == 8 ? LONG_MIN : INT_MIN)
+
+// Wraps an Integer result, computed unsigned so that it cannot overflow,
+// around to the size of an Integer, as the machine arithmetic does.
+static long wrap_integer(unsigned long value)
+{
+    if (TARGET_LONG_SIZE == 8)
+    {
+        return (long)value;
+    }
+    return (long)(int)(unsigned int)value;
+}
+
+static BOOLEAN is_int_value(EXPR expr, long value)
+{
+    return expr->expr_tag == E_INTCONST && expr->u.integer == value;
+}
+
+// Tells whether evaluating expr may do more than compute its value, so
+// that it must not be dropped even when its value is not needed.
+static BOOLEAN has_side_effects(EXPR expr)
+{
+    EXPR_LIST index;
+    
+    switch (expr->expr_tag)
+    {
+        case E_ASSIGN:
+        case E_FUNC:
+            return TRUE;
+        case E_ARITH:
+        case E_COMPR:
+            return has_side_effects(expr->left) || has_side_effects(expr->right);
+        case E_SIGN:
+        case E_UNFUNC:
+        case E_CAST:
+            return has_side_effects(expr->right);
+        case E_ARRAY:
+            for (index = expr->u.var_func_array.arguments; index != NULL; index = index->next)
+            {
+                if (index->base != NULL && has_side_effects(index->base))
+                {
+                    return TRUE;
+                }
+            }
+            return has_side_effects(expr->right);
+        default:
+            return FALSE;
+    }
+}
+
+// Gets the value of a constant for comparing it; chars compare unsigned.
+static BOOLEAN get_compare_constant(EXPR expr, double *value)
+{
+    switch (expr->expr_tag)
+    {
+        case E_INTCONST:  *value = expr->u.integer; return TRUE;
+        case E_REALCONST: *value = expr->u.real; return TRUE;
+        case E_CHARCONST: *value = (unsigned char)expr->u.character; return TRUE;
+        case E_BOOLCONST: *value = expr->u.bool; return TRUE;
+        default: return FALSE;
+    }
+}
+
+static EXPR new_expr_charconst(long c)
+{
+    char str[2] = { (char)c, '\0' };
+    return new_expr_strconst(str);
+}
+
+static EXPR simplify_arith(EXPR expr)
+{
+    EXPR left = expr->left;
+    EXPR right = expr->right;
+    ARITHTAG tag = expr->u.arith_tag;
+    
+    if (expr->expr_typetag == TYREAL && left->expr_tag == E_REALCONST
+        && right->expr_tag == E_REALCONST)
+    {
+        // Real division is left alone, as is anything that could trap.
+        switch (tag)
+        {
+            case AR_ADD:  return new_expr_realconst(left->u.real + right->u.real);
+            case AR_SUB:  return new_expr_realconst(left->u.real - right->u.real);
+            case AR_MULT: return new_expr_realconst(left->u.real * right->u.real);
+            default:      return expr;
+        }
+    }
+    
+    if (expr->expr_typetag != TYINTEGER || tag == AR_RDIV)
+    {
+        return expr;
+    }
+    
+    if (left->expr_tag == E_INTCONST && right->expr_tag == E_INTCONST)
+    {
+        long l = left->u.integer, r = right->u.integer;
+        
+        switch (tag)
+        {
+            case AR_ADD:  return new_expr_intconst(wrap_integer((unsigned long)l + r));
+            case AR_SUB:  return new_expr_intconst(wrap_integer((unsigned long)l - r));
+            case AR_MULT: return new_expr_intconst(wrap_integer((unsigned long)l * r));
+            default:
+                // Division by zero and overflow are left to run time.
+                if (r == 0 || (l == INTEGER_MIN && r == -1))
+                {
+                    return expr;
+                }
+                return new_expr_intconst(tag == AR_IDIV ? l / r : l % r);
+        }
+    }
+    
+    switch (tag)
+    {
+        case AR_ADD:
+            if (is_int_value(right, 0)) { return left; }
+            if (is_int_value(left, 0)) { return right; }
+            break;
+        case AR_SUB:
+            if (is_int_value(right, 0)) { return left; }
+            break;
+        case AR_MULT:
+            if (is_int_value(right, 1)) { return left; }
+            if (is_int_value(left, 1)) { return right; }
+            if ((is_int_value(right, 0) && !has_side_effects(left))
+                || (is_int_value(left, 0) && !has_side_effects(right)))
+            {
+                return new_expr_intconst(0);
+            }
+            break;
+        case AR_IDIV:
+            if (is_int_value(right, 1)) { return left; }
+            break;
+        case AR_MOD:
+            if (is_int_value(right, 1) && !has_side_effects(left))
+            {
+                return new_expr_intconst(0);
+            }
+            break;
+        default:
+            break;
+    }
+    
+    // (x + c1) - c2 and the like add up their constants into one.
+    if ((tag == AR_ADD || tag == AR_SUB) && right->expr_tag == E_INTCONST
+        && left->expr_tag == E_ARITH && left->expr_typetag == TYINTEGER
+        && (left->u.arith_tag == AR_ADD || left->u.arith_tag == AR_SUB)
+        && left->right->expr_tag == E_INTCONST)
+    {
+        long c1 = left->right->u.integer, c2 = right->u.integer;
+        long c = wrap_integer((left->u.arith_tag == AR_ADD ? (unsigned long)c1 : -(unsigned long)c1)
+                              + (tag == AR_ADD ? (unsigned long)c2 : -(unsigned long)c2));
+        
+        if (c == 0)
+        {
+            return left->left;
+        }
+        
+        EXPR newExpr = (EXPR) malloc(sizeof(expression));
+        *newExpr = *expr;
+        newExpr->left = left->left;
+        newExpr->u.arith_tag = AR_ADD;
+        newExpr->right = new_expr_intconst(c);
+        return newExpr;
+    }
+    
+    return expr;
+}
+
+static EXPR simplify_sign(EXPR expr)
+{
+    EXPR right = expr->right;
+    
+    if (expr->u.sign_tag == SI_PLUS)
+    {
+        return right;
+    }
+    if (right->expr_tag == E_INTCONST)
+    {
+        return new_expr_intconst(wrap_integer(-(unsigned long)right->u.integer));
+    }
+    if (right->expr_tag == E_REALCONST)
+    {
+        return new_expr_realconst(-right->u.real);
+    }
+    return expr;
+}
+
+static EXPR simplify_compr(EXPR expr)
+{
+    double l, r;
+    
+    if (expr->left->expr_typetag != expr->right->expr_typetag
+        || !get_compare_constant(expr->left, &l)
+        || !get_compare_constant(expr->right, &r))
+    {
+        return expr;
+    }
+    
+    switch (expr->u.compr_tag)
+    {
+        case CM_EQUAL:  return new_expr_boolconst(l == r);
+        case CM_NEQUAL: return new_expr_boolconst(l != r);
+        case CM_LESS:   return new_expr_boolconst(l < r);
+        case CM_GTEQL:  return new_expr_boolconst(l >= r);
+        case CM_GREAT:  return new_expr_boolconst(l > r);
+        case CM_LSEQL:  return new_expr_boolconst(l <= r);
+        default:        return expr;
+    }
+}
+
+static EXPR simplify_cast(EXPR expr)
+{
+    EXPR right = expr->right;
+    
+    switch (expr->u.cast_tag)
+    {
+        case CT_INT_REAL:
+            if (right->expr_tag == E_INTCONST)
+            {
+                return new_expr_realconst((double)right->u.integer);
+            }
+            break;
+        case CT_CHAR_INT:
+            if (right->expr_tag == E_CHARCONST)
+            {
+                return new_expr_intconst((unsigned char)right->u.character);
+            }
+            break;
+        case CT_REAL_SGL:
+            // Integer to Real is exact, and so is Single to Real, so the
+            // Real in between changes nothing.
+            if (right->expr_tag == E_CAST && right->u.cast_tag == CT_INT_REAL)
+            {
+                return new_expr_cast(CT_INT_SGL, right->right);
+            }
+            if (right->expr_tag == E_CAST && right->u.cast_tag == CT_SGL_REAL)
+            {
+                return right->right;
+            }
+            break;
+        default:
+            break;
+    }
+    return expr;
+}
+
+static EXPR simplify_unfunc(EXPR expr)
+{
+    EXPR right = expr->right;
+    
+    if (right->expr_tag == E_INTCONST && right->expr_typetag == TYINTEGER)
+    {
+        switch (expr->u.unfunc_tag)
+        {
+            case UF_ORD:  return right;
+            case UF_CHR:  return new_expr_charconst(right->u.integer);
+            case UF_SUCC: return new_expr_intconst(wrap_integer((unsigned long)right->u.integer + 1));
+            case UF_PRED: return new_expr_intconst(wrap_integer((unsigned long)right->u.integer - 1));
+        }
+    }
+    else if (right->expr_tag == E_CHARCONST)
+    {
+        switch (expr->u.unfunc_tag)
+        {
+            case UF_ORD:  return new_expr_intconst((unsigned char)right->u.character);
+            case UF_SUCC: return new_expr_charconst(right->u.character + 1);
+            case UF_PRED: return new_expr_charconst(right->u.character - 1);
+            default:      break;
+        }
+    }
+    else if (right->expr_tag == E_BOOLCONST && expr->u.unfunc_tag == UF_ORD)
+    {
+        return new_expr_intconst(right->u.bool);
+    }
+    return expr;
+}
+
+EXPR simplify_expr(EXPR expr)
+{
+    if (!opt_simplify)
+    {
+        return expr;
+    }
+    
+    switch (expr->expr_tag)
+    {
+        case E_ARITH:  return simplify_arith(expr);
+        case E_SIGN:   return simplify_sign(expr);
+        case E_COMPR:  return simplify_compr(expr);
+        case E_CAST:   return simplify_cast(expr);
+        case E_UNFUNC: return simplify_unfunc(expr);
+        default:       return expr;
+    }
+}
+
+/* -----=====----- HASH CONSING -----=====----- */
+
+// With -fcse, a node equal to one built since the last assignment or call
+// is not built again: the constructors return the old one instead, so the
+// trees of a statement share their common subexpressions, which
+// encode_expression then computes once.  Calls and assignments are never
+// shared.
+
+#define CSE_BUCKETS 211
+
+typedef struct cse_entry
+{
+    EXPR expr;
+    struct cse_entry *next;
+} CSE_ENTRY;
+
+static CSE_ENTRY *cse_buckets[CSE_BUCKETS];
+
+// Tells whether two nodes, whose children are shared already, are equal.
+static BOOLEAN same_node(EXPR a, EXPR b)
+{
+    EXPR_LIST la, lb;
+    
+    if (a->expr_tag != b->expr_tag || a->expr_typetag != b->expr_typetag)
+    {
+        return FALSE;
+    }
+    
+    switch (a->expr_tag)
+    {
+        case E_INTCONST:
+            return a->u.integer == b->u.integer;
+        case E_REALCONST:
+            return memcmp(&a->u.real, &b->u.real, sizeof(double)) == 0;
+        case E_CHARCONST:
+            return a->u.character == b->u.character;
+        case E_BOOLCONST:
+            return a->u.bool == b->u.bool;
+        case E_VAR:
+            return a->u.var_func_array.var_id == b->u.var_func_array.var_id
+                && a->expr_fulltype == b->expr_fulltype;
+        case E_ARITH:
+            return a->u.arith_tag == b->u.arith_tag
+                && a->left == b->left && a->right == b->right;
+        case E_COMPR:
+            return a->u.compr_tag == b->u.compr_tag
+                && a->left == b->left && a->right == b->right;
+        case E_SIGN:
+            return a->u.sign_tag == b->u.sign_tag && a->right == b->right;
+        case E_UNFUNC:
+            return a->u.unfunc_tag == b->u.unfunc_tag && a->right == b->right;
+        case E_CAST:
+            return a->u.cast_tag == b->u.cast_tag && a->right == b->right;
+        case E_ARRAY:
+            if (a->right != b->right || a->expr_fulltype != b->expr_fulltype)
+            {
+                return FALSE;
+            }
+            for (la = a->u.var_func_array.arguments, lb = b->u.var_func_array.arguments;
+                 la != NULL && lb != NULL; la = la->next, lb = lb->next)
+            {
+                if (la->base != lb->base)
+                {
+                    return FALSE;
+                }
+            }
+            return la == NULL && lb == NULL;
+        default:
+            return FALSE;
+    }
+}
+
+static unsigned int node_hash(EXPR expr)
+{
+    unsigned long hash = expr->expr_tag * 31 + expr->expr_typetag;
+    EXPR_LIST list;
+    
+    switch (expr->expr_tag)
+    {
+        case E_INTCONST:
+            return (hash * 31 + expr->u.integer) % CSE_BUCKETS;
+        case E_CHARCONST:
+            return (hash * 31 + expr->u.character) % CSE_BUCKETS;
+        case E_BOOLCONST:
+            return (hash * 31 + expr->u.bool) % CSE_BUCKETS;
+        case E_VAR:
+            return (hash * 31 + (unsigned long)expr->u.var_func_array.var_id) % CSE_BUCKETS;
+        case E_ARITH:
+        case E_COMPR:
+            hash = hash * 31 + (unsigned long)expr->left;
+            /* FALL THROUGH */
+        case E_SIGN:
+        case E_UNFUNC:
+        case E_CAST:
+            return (hash * 31 + (unsigned long)expr->right) % CSE_BUCKETS;
+        case E_ARRAY:
+            hash = hash * 31 + (unsigned long)expr->right;
+            for (list = expr->u.var_func_array.arguments; list != NULL; list = list->next)
+            {
+                hash = hash * 31 + (unsigned long)list->base;
+            }
+            return hash % CSE_BUCKETS;
+        default:
+            return hash % CSE_BUCKETS;
+    }
+}
+
+// Returns the node equal to expr that was built before, if there is one,
+// and otherwise expr, which later ones will be compared with.
+static EXPR hash_cons(EXPR expr)
+{
+    unsigned int bucket;
+    CSE_ENTRY *entry;
+    
+    if (!opt_cse || expr->expr_tag == E_FUNC || expr->expr_tag == E_ASSIGN
+        || expr->expr_tag == E_SUBRANGE)
+    {
+        return expr;
+    }
+    
+    bucket = node_hash(expr);
+    for (entry = cse_buckets[bucket]; entry != NULL; entry = entry->next)
+    {
+        if (entry->expr == expr || same_node(entry->expr, expr))
+        {
+            return entry->expr;
+        }
+    }
+    
+    entry = (CSE_ENTRY *) malloc(sizeof(CSE_ENTRY));
+    entry->expr = expr;
+    entry->next = cse_buckets[bucket];
+    cse_buckets[bucket] = entry;
+    return expr;
+}
+
+// Starts over, so that nothing built so far is shared with what comes next.
+static void forget_nodes(void)
+{
+    CSE_ENTRY *entry, *next;
+    int bucket;
+    
+    for (bucket = 0; bucket < CSE_BUCKETS; bucket++)
+    {
+        for (entry = cse_buckets[bucket]; entry != NULL; entry = next)
+        {
+            next = entry->next;
+            free(entry);
+        }
+        cse_buckets[bucket] = NULL;
+    }
+}
+
 BOOLEAN isCaseableType(TYPETAG type)
 {
   if (!isOrdinalType(type))
@@ -753,7 +1221,7 @@ BOOLEAN isCaseableType(TYPETAG type)
 #define NO_VALUE -1000000
 #define MAX_BLOCKS 64
 #define MAX_CONSTS 1024
-int case_lists[MAX_BLOCKS][MAX_CONSTS];
+long case_lists[MAX_BLOCKS][MAX_CONSTS];
 int list_sizes[MAX_BLOCKS];
 
 int currentBlock = -1;
@@ -778,14 +1246,14 @@ void enter_case_block()
     list_sizes[currentBlock] = 0;
 }
 
-BOOLEAN check_subrange(int lo, int hi)
+BOOLEAN check_subrange(long lo, long hi)
 {
     int index;
     int list_size = list_sizes[currentBlock];
     
     for (index = 0; index < list_size; index++)
     {
-        int constant = case_lists[currentBlock][index];
+        long constant = case_lists[currentBlock][index];
 
         if (constant >= lo && constant <= hi)
         {
@@ -796,14 +1264,14 @@ BOOLEAN check_subrange(int lo, int hi)
     return TRUE;
 }
 
-BOOLEAN check_constant(int i)
+BOOLEAN check_constant(long i)
 {
     int index;
     int list_size = list_sizes[currentBlock];
     
     for (index = 0; index < list_size; index++)
     {
-        int constant = case_lists[currentBlock][index];
+        long constant = case_lists[currentBlock][index];
 
         if (constant == i)
         {
@@ -814,7 +1282,7 @@ BOOLEAN check_constant(int i)
     return TRUE;
 }
 
-void add_subrange(int lo, int hi)
+void add_subrange(long lo, long hi)
 {
     int index;
     int list_size = list_sizes[currentBlock];
@@ -828,7 +1296,7 @@ void add_subrange(int lo, int hi)
     list_sizes[currentBlock] += size_to_add;
 }
 
-void add_constant(int i)
+void add_constant(long i)
 {
     int list_size = list_sizes[currentBlock];
     
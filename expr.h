@@ -37,7 +37,7 @@
  *     E_PTR        - A pointer.
  *     E_COMPR      - A comparison expression (involving >, <, =, <>, <=, >=).
  *     E_UNFUNC     - A unary function (ord, chr, succ, pred).
- *     E_VAR        - A [global] variable. TODO: update for 100% level.
+ *     E_VAR        - A variable (global, local or parameter).
  *     E_FUNC       - A function call.
  *     E_ARRAY      - An array.
  *     E_CAST       - Inserted to cast types prior to operation.
@@ -150,6 +150,9 @@ EXPR new_expr_arith(EXPR left, ARITHTAG t, EXPR right);
 /* New casting expression */
 EXPR new_expr_cast(CASTTAG t, EXPR right);
 
+/* Returns the cast that converts a numeric value of type from to type to */
+CASTTAG get_cast_constant(TYPETAG from, TYPETAG to);
+
 /* New signed expression */
 EXPR new_expr_sign(int sign, EXPR right);
 
@@ -186,14 +189,21 @@ EXPR_LIST append_to_expr_list(EXPR_LIST base, EXPR newItem);
 
 double get_expr_constant(EXPR expr);
 
+/* Returns a simpler expression with the same value as expr, which is
+ * built but not yet encoded: constant operands are folded, and integer
+ * identities such as x*1, x+0 and x*0 are applied.  Returns expr itself
+ * when there is nothing to do, or when -fsimplify is off.  The new_expr_*
+ * functions call it on the nodes they build. */
+EXPR simplify_expr(EXPR expr);
+
 EXPR parse_expr_for_case(EXPR expr);
 
 void enter_case_block();
 void exit_case_block();
 
-BOOLEAN check_subrange(int lo, int hi);
-BOOLEAN check_constant(int i);
+BOOLEAN check_subrange(long lo, long hi);
+BOOLEAN check_constant(long i);
 
-void add_subrange(int lo, int hi);
-void add_constant(int i);
+void add_subrange(long lo, long hi);
+void add_constant(long i);
 #endif
@@ -0,0 +1,650 @@
+/****************************************************************/
+/*								*/
+/*	CSCE531 - "Pascal" Compiler				*/
+/*								*/
+/*	--frame.c--						*/
+/*								*/
+/*	Frame pointer omission and stack alignment tracking.	*/
+/*								*/
+/****************************************************************/
+
+/*
+ * b_func_prologue always builds a frame:
+ *
+ *	pushl	%ebp
+ *	movl	%esp, %ebp
+ *
+ * and every parameter, local variable and return value slot is then
+ * addressed as N(%ebp), while the expression stack moves %esp up and down
+ * below them.  A function that calls nothing (a leaf) does not need %ebp
+ * as long as the distance from %esp to the frame is known at each point,
+ * and for the stack machine's code it always is: %esp only moves by
+ * constants (addl/subl, pushl/popl), and the depth is the same on every
+ * path into a label.  This pass computes that depth by walking the
+ * function's code in order, recording the depth at each jump for its
+ * target label and repeating until every label is known, then rewrites
+ * the function:
+ *
+ *	pushl	%ebp	  -->	subl	$4, %esp
+ *	movl	%esp, %ebp  -->	(nothing)
+ *	N(%ebp)		  -->	N+D-4(%esp)
+ *	leave		  -->	addl	$D, %esp
+ *
+ * where D is the depth (the number of bytes below the return address) at
+ * that instruction.  The word in place of the saved %ebp keeps %esp
+ * 8-byte aligned as before, so doubles on the stack stay aligned; the
+ * peephole pass folds it into the first stack adjustment.  A function
+ * that never moves %esp itself needs no such word, and loses the
+ * subl/addl pair as well.
+ *
+ * The return value slot of a Pascal function is normally stored into by
+ * b_set_return and loaded into %eax (or %st(0)) by b_prepare_return.  The
+ * peephole pass is run first, so when the value is stored and loaded
+ * back at once, the load is forwarded to a register move and the slot is
+ * only written.  A real value stored from %st(0) with fstpl and loaded
+ * back at once with fldl simply stays in %st(0), and both go.  In either
+ * case, if the slot is then only written, the stores and the slot's
+ * allocation are deleted, and the variables below the slot move up to
+ * take its place.
+ *
+ * The pass gives up, leaving the function as is, if the function makes a
+ * call, uses %ebp other than as N(%ebp), changes %esp in any other way,
+ * has an indirect jump, or has code whose depth cannot be determined.
+ * In long mode the registers are %rbp and %rsp and a word is 8 bytes.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "frame.h"
+#include "peephole.h"
+#include "options.h"
+#include "message.h"
+
+/* Depth of code that cannot be reached by falling through */
+#define UNKNOWN INT_MIN
+
+/* Registers, instructions, and word size of the target */
+static char *fp_reg, *sp_reg, *sfx, *add_op, *sub_op;
+static int word;
+
+/* Size of the word that replaces the saved frame pointer (0 if none) */
+static int pad;
+
+/* The depth at each label, as far as it is known, with the labels
+   hashed by name */
+#define LABEL_HASH 1024
+static char **label_name = NULL;
+static int *label_depth = NULL, *label_next = NULL;
+static int label_hash[LABEL_HASH];
+static int nlabels = 0, labels_size = 0;
+
+
+static unsigned int hash_label (char *name)
+{
+    unsigned int h = 0;
+
+    for ( ; *name != '\0'; name++)
+	h = h * 31 + (unsigned char) *name;
+    return h % LABEL_HASH;
+}
+
+static void clear_labels (void)
+{
+    int i;
+
+    for (i = 0; i < LABEL_HASH; i++)
+	label_hash[i] = -1;
+    nlabels = 0;
+}
+
+static int *find_label (char *name)
+{
+    int i;
+
+    if (nlabels == 0)
+	return NULL;
+    for (i = label_hash[hash_label(name)]; i >= 0; i = label_next[i])
+	if (!strcmp(label_name[i], name))
+	    return &label_depth[i];
+    return NULL;
+}
+
+static void add_label (char *name, int depth)
+{
+    unsigned int h = hash_label(name);
+
+    if (nlabels == 0)
+	clear_labels();
+    if (nlabels == labels_size) {
+	labels_size = labels_size ? 2*labels_size : 64;
+	label_name = (char **) realloc(label_name,
+				       labels_size * sizeof(char *));
+	label_depth = (int *) realloc(label_depth, labels_size * sizeof(int));
+	label_next = (int *) realloc(label_next, labels_size * sizeof(int));
+	if (label_name == NULL || label_depth == NULL || label_next == NULL)
+	    bug("frame: out of memory");
+    }
+    label_name[nlabels] = name;
+    label_depth[nlabels] = depth;
+    label_next[nlabels] = label_hash[h];
+    label_hash[h] = nlabels++;
+}
+
+/* If arg is a memory operand N(fp) or (fp), sets *offset to N and returns
+   TRUE */
+static BOOLEAN fp_operand (char *arg, int *offset)
+{
+    int len = strlen(arg), base = len - strlen(fp_reg) - 2;
+    char *end;
+
+    if (base < 0 || arg[base] != '(' || strncmp(arg + base + 1, fp_reg,
+						 strlen(fp_reg))
+	|| arg[len-1] != ')')
+	return FALSE;
+    if (base == 0) {
+	*offset = 0;
+	return TRUE;
+    }
+    *offset = strtol(arg, &end, 10);
+    return end == arg + base;
+}
+
+/* Tells whether rec is a live .cfi directive whose name starts with
+   name */
+static BOOLEAN is_cfi (ASM_LIST rec, char *name)
+{
+    char *s;
+
+    if (rec->deleted || rec->kind != AK_DEBUG)
+	return FALSE;
+    for (s = rec->text; *s == '\t' || *s == ' '; s++)
+	;
+    return !strncmp(s, name, strlen(name));
+}
+
+/* If rec adds a constant to or subtracts a constant from the stack
+   pointer, sets *amount to the signed change and returns TRUE */
+static BOOLEAN sp_adjust (ASM_LIST rec, int *amount)
+{
+    char *end;
+
+    if (rec->kind != AK_INSN || rec->nargs != 2 || rec->args[0][0] != '$'
+	|| strcmp(rec->args[1], sp_reg) || strlen(rec->op) != 4
+	|| rec->op[3] != *sfx)
+	return FALSE;
+    *amount = strtol(rec->args[0] + 1, &end, 10);
+    if (*end != '\0')
+	return FALSE;
+    if (!strncmp(rec->op, "sub", 3))
+	*amount = -*amount;
+    else if (strncmp(rec->op, "add", 3))
+	return FALSE;
+    return TRUE;
+}
+
+/* Tells whether the instruction can be part of a frameless function */
+static BOOLEAN frameless_ok (ASM_LIST rec)
+{
+    int i, offset, amount;
+
+    if (!strncmp(rec->op, "call", 4))
+	return FALSE;
+    if (rec->op[0] == 'j' && (rec->nargs != 1 || rec->args[0][0] == '*'))
+	return FALSE;
+    for (i = 0; i < rec->nargs; i++)
+	if (strstr(rec->args[i], fp_reg) != NULL
+	    && !fp_operand(rec->args[i], &offset))
+	    return FALSE;
+    if (rec->nargs > 0 && !strcmp(rec->args[rec->nargs-1], sp_reg)
+	&& !sp_adjust(rec, &amount))
+	return FALSE;
+    return TRUE;
+}
+
+/* Walks the function body recs[i..n-1] in order, tracking the depth and
+   recording the depth at each label; sets *changed if a label is added.
+   If strict, code of unknown depth is an error.  If rewrite, rewrites the
+   code as it goes, moving variables below slot_offset up by slot_size.
+   Returns FALSE if the depth is inconsistent. */
+static BOOLEAN walk (ASM_LIST recs[], int n, int i, BOOLEAN strict,
+		     BOOLEAN rewrite, int slot_offset, int slot_size,
+		     BOOLEAN *changed)
+{
+    int depth = pad, offset, amount, k, *ld;
+    ASM_LIST rec;
+    char *s;
+
+    for ( ; i < n; i++) {
+	rec = recs[i];
+	if (rec->deleted || rec->kind == AK_COMMENT
+	    || rec->kind == AK_DIRECTIVE || rec->kind == AK_DEBUG)
+	    continue;
+
+	if (rec->kind == AK_LABEL) {
+	    if ((ld = find_label(rec->op)) != NULL) {
+		if (depth != UNKNOWN && depth != *ld)
+		    return FALSE;
+		depth = *ld;
+	    }
+	    else if (depth != UNKNOWN) {
+		add_label(rec->op, depth);
+		*changed = TRUE;
+	    }
+	    continue;
+	}
+
+	if (depth == UNKNOWN) {
+	    if (strict)
+		return FALSE;
+	    continue;
+	}
+
+	if (rewrite)
+	    for (k = 0; k < rec->nargs; k++)
+		if (fp_operand(rec->args[k], &offset)) {
+		    if (offset < slot_offset)
+			offset += slot_size;
+		    offset += depth - word;
+		    s = (char *) malloc(strlen(sp_reg) + 16);
+		    if (s == NULL)
+			bug("frame: out of memory");
+		    if (offset == 0)
+			sprintf(s, "(%s)", sp_reg);
+		    else
+			sprintf(s, "%d(%s)", offset, sp_reg);
+		    rec->args[k] = s;
+		    rec->text = NULL;
+		}
+
+	if (sp_adjust(rec, &amount))
+	    depth -= amount;
+	else if (!strncmp(rec->op, "push", 4))
+	    depth += word;
+	else if (!strncmp(rec->op, "pop", 3))
+	    depth -= word;
+	else if (!strcmp(rec->op, "leave")) {
+	    if (rewrite && depth == 0)
+		rec->deleted = TRUE;
+	    else if (rewrite) {
+		s = (char *) malloc(24);
+		if (s == NULL)
+		    bug("frame: out of memory");
+		sprintf(s, "$%d", depth);
+		asm_set_insn(rec, add_op, s, sp_reg);
+	    }
+	    depth = 0;
+	}
+	else if (!strcmp(rec->op, "ret")) {
+	    if (depth != 0)
+		return FALSE;
+	    depth = UNKNOWN;
+	}
+	else if (!strcmp(rec->op, "ud2"))
+	    depth = UNKNOWN;
+	else if (rec->op[0] == 'j') {
+	    if ((ld = find_label(rec->args[0])) != NULL) {
+		if (*ld != depth)
+		    return FALSE;
+	    }
+	    else {
+		add_label(rec->args[0], depth);
+		*changed = TRUE;
+	    }
+	    if (!strcmp(rec->op, "jmp"))
+		depth = UNKNOWN;
+	}
+
+	if (depth != UNKNOWN && depth < 0)
+	    return FALSE;
+    }
+    return TRUE;
+}
+
+/* Sets up the registers, instructions, and word size above */
+static void set_target (BOOLEAN long_mode)
+{
+    fp_reg = long_mode ? "%rbp" : "%ebp";
+    sp_reg = long_mode ? "%rsp" : "%esp";
+    sfx = long_mode ? "q" : "l";
+    add_op = long_mode ? "addq" : "addl";
+    sub_op = long_mode ? "subq" : "subl";
+    word = long_mode ? 8 : 4;
+}
+
+/* Finds the depth at every label, then checks the whole body */
+static BOOLEAN find_depths (ASM_LIST recs[], int n, int i)
+{
+    BOOLEAN changed;
+
+    nlabels = 0;
+    do {
+	changed = FALSE;
+	if (!walk(recs, n, i, FALSE, FALSE, INT_MIN, 0, &changed))
+	    return FALSE;
+    } while (changed);
+    return walk(recs, n, i, TRUE, FALSE, INT_MIN, 0, &changed);
+}
+
+/* Returns the size of the pad that replaces the saved frame pointer: a
+   word if the body recs[i..n-1] moves the stack pointer, else 0 */
+static int stack_pad (ASM_LIST recs[], int n, int i)
+{
+    int amount;
+
+    for ( ; i < n; i++)
+	if (!recs[i]->deleted && recs[i]->kind == AK_INSN
+	    && (sp_adjust(recs[i], &amount) || !strncmp(recs[i]->op, "push", 4)))
+	    return word;
+    return 0;
+}
+
+/* Tells whether every access to the return value slot is a store */
+static BOOLEAN slot_write_only (ASM_LIST recs[], int n, int i,
+				int slot_offset, int slot_size)
+{
+    int k, offset;
+
+    for ( ; i < n; i++) {
+	if (recs[i]->deleted || recs[i]->kind != AK_INSN)
+	    continue;
+	for (k = 0; k < recs[i]->nargs; k++)
+	    if (fp_operand(recs[i]->args[k], &offset)
+		&& offset >= slot_offset && offset < slot_offset + slot_size
+		&& (k != 1 || strncmp(recs[i]->op, "mov", 3)
+		    || strchr(recs[i]->args[0], '(') != NULL))
+		return FALSE;
+    }
+    return TRUE;
+}
+
+
+/* Deletes a store of %st(0) to the return value slot (fstpl) that the
+   value is loaded straight back from (fldl), with at most stack pointer
+   adjustments in between, so that the value stays in %st(0).  A label in
+   between would let other paths reach the load. */
+static void keep_in_st0 (ASM_LIST recs[], int n, int i, int slot_offset)
+{
+    int store = -1, offset, amount;
+    ASM_LIST rec;
+
+    for ( ; i < n; i++) {
+	rec = recs[i];
+	if (rec->deleted || rec->kind == AK_COMMENT || rec->kind == AK_DEBUG)
+	    continue;
+	if (rec->kind == AK_INSN && rec->nargs == 1
+	    && fp_operand(rec->args[0], &offset) && offset == slot_offset) {
+	    if (!strncmp(rec->op, "fstp", 4)) {
+		store = i;
+		continue;
+	    }
+	    if (store >= 0 && !strncmp(rec->op, "fld", 3)
+		&& !strcmp(rec->op + 3, recs[store]->op + 4))
+		rec->deleted = recs[store]->deleted = TRUE;
+	}
+	else if (sp_adjust(rec, &amount))
+	    continue;
+	store = -1;
+    }
+}
+
+BOOLEAN omit_frame_pointer (ASM_LIST recs[], int n, BOOLEAN long_mode,
+			    int slot_rec, int slot_offset, int slot_size)
+{
+    int push, mov, i, k, offset, amount;
+    BOOLEAN changed;
+    char *s;
+
+    set_target(long_mode);
+
+    if (opt_peephole)
+	peephole(recs, n, long_mode);
+
+	/* Find the prologue */
+    for (push = 0; push < n; push++)
+	if (!recs[push]->deleted && recs[push]->kind == AK_INSN)
+	    break;
+    for (mov = push + 1; mov < n; mov++)
+	if (!recs[mov]->deleted && recs[mov]->kind == AK_INSN)
+	    break;
+    if (mov >= n
+	|| strncmp(recs[push]->op, "push", 4) || recs[push]->nargs != 1
+	|| strcmp(recs[push]->args[0], fp_reg)
+	|| strncmp(recs[mov]->op, "mov", 3) || recs[mov]->nargs != 2
+	|| strcmp(recs[mov]->args[0], sp_reg)
+	|| strcmp(recs[mov]->args[1], fp_reg))
+	return FALSE;
+
+    for (i = mov + 1; i < n; i++)
+	if (!recs[i]->deleted && recs[i]->kind == AK_INSN
+	    && !frameless_ok(recs[i]))
+	    return FALSE;
+    pad = stack_pad(recs, n, mov + 1);
+    if (!find_depths(recs, n, mov + 1))
+	return FALSE;
+
+    if (slot_rec > mov && slot_rec < n)
+	keep_in_st0(recs, n, mov + 1, slot_offset);
+
+	/* Remove the return value slot if nothing reads it.  Its
+	 * allocation is in straight-line code before any label, so this
+	 * shifts the depth everywhere after it by the same amount.  The
+	 * peephole pass may have merged the allocation with the one for
+	 * the local variables that follows it. */
+    if (slot_rec > mov && slot_rec < n && !recs[slot_rec]->deleted
+	&& sp_adjust(recs[slot_rec], &amount) && amount <= -slot_size
+	&& slot_write_only(recs, n, mov + 1, slot_offset, slot_size)) {
+	if (amount == -slot_size)
+	    recs[slot_rec]->deleted = TRUE;
+	else {
+	    s = (char *) malloc(24);
+	    if (s == NULL)
+		bug("frame: out of memory");
+	    sprintf(s, "$%d", -amount - slot_size);
+	    asm_set_insn(recs[slot_rec], sub_op, s, sp_reg);
+	}
+	for (i = mov + 1; i < n; i++)
+	    if (!recs[i]->deleted && recs[i]->kind == AK_INSN)
+		for (k = 0; k < recs[i]->nargs; k++)
+		    if (fp_operand(recs[i]->args[k], &offset)
+			&& offset >= slot_offset
+			&& offset < slot_offset + slot_size)
+			recs[i]->deleted = TRUE;
+	pad = stack_pad(recs, n, mov + 1);
+	if (!find_depths(recs, n, mov + 1))
+	    bug("frame: depth changed by removing the return value slot");
+    }
+    else
+	slot_offset = INT_MIN;
+
+    walk(recs, n, mov + 1, TRUE, TRUE, slot_offset, slot_size, &changed);
+
+    if (pad > 0) {
+	s = (char *) malloc(8);
+	if (s == NULL)
+	    bug("frame: out of memory");
+	sprintf(s, "$%d", pad);
+	asm_set_insn(recs[push], sub_op, s, sp_reg);
+    }
+    else
+	recs[push]->deleted = TRUE;
+    recs[mov]->deleted = TRUE;
+
+	/* With -g, the directives that describe the frame go as well;
+	 * frame_cfi describes the new code once it is final */
+    for (i = 0; i < n; i++)
+	if (is_cfi(recs[i], ".cfi_") && !is_cfi(recs[i], ".cfi_startproc")
+	    && !is_cfi(recs[i], ".cfi_endproc"))
+	    recs[i]->deleted = TRUE;
+    return TRUE;
+}
+
+
+/*
+ * Call frame information for -g.  The back end describes the frame of a
+ * function with .cfi directives: the canonical frame address (CFA) is
+ * the frame pointer plus two words from the prologue on, and the stack
+ * pointer plus one word after each leave.  omit_frame_pointer deletes
+ * these, and then the CFA must follow the stack pointer instead, through
+ * every push, pop and adjustment of it.  The depth found by walk() gives
+ * exactly that, but the peephole pass still merges and deletes stack
+ * adjustments after omit_frame_pointer, so it is found again here, on
+ * the final code, and each record after which the depth has changed gets
+ * a .cfi_def_cfa_offset (its cfa_offset).  The depth at a label comes
+ * from the jumps to it, which also covers code after a ret.
+ */
+
+void frame_cfi (ASM_LIST recs[], int n, BOOLEAN long_mode)
+{
+    int start, end, i, depth, cfa, amount, *ld;
+    BOOLEAN framed;
+    ASM_LIST rec;
+
+    set_target(long_mode);
+    for (start = 0; start < n; start = end + 1) {
+	while (start < n && !is_cfi(recs[start], ".cfi_startproc"))
+	    start++;
+	framed = FALSE;
+	for (end = start + 1; end < n && !is_cfi(recs[end], ".cfi_endproc");
+	     end++)
+	    if (is_cfi(recs[end], ".cfi_def_cfa_register"))
+		framed = TRUE;
+	if (end >= n || framed)
+	    continue;
+
+	pad = 0;
+	if (!find_depths(recs, end, start + 1))
+	    bug("frame_cfi: depth of frameless code is unknown");
+	depth = cfa = 0;
+	for (i = start + 1; i < end; i++) {
+	    rec = recs[i];
+	    if (rec->deleted)
+		continue;
+	    if (rec->kind == AK_LABEL) {
+		if ((ld = find_label(rec->op)) != NULL)
+		    depth = *ld;
+	    }
+	    else if (rec->kind != AK_INSN || depth == UNKNOWN)
+		continue;
+	    else if (sp_adjust(rec, &amount))
+		depth -= amount;
+	    else if (!strncmp(rec->op, "push", 4))
+		depth += word;
+	    else if (!strncmp(rec->op, "pop", 3))
+		depth -= word;
+	    else if (!strcmp(rec->op, "ret") || !strcmp(rec->op, "jmp")
+		     || !strcmp(rec->op, "ud2"))
+		depth = UNKNOWN;
+
+	    if (depth != UNKNOWN && depth != cfa) {
+		rec->cfa_offset = depth + word;
+		cfa = depth;
+	    }
+	}
+    }
+}
+
+
+/*
+ * The stack alignment at a call.  Every call is made with the stack
+ * pointer 16-byte aligned, so on entry to a function the stack pointer
+ * lies one word (the return address) below a 16-byte boundary.  From
+ * there the depth below that boundary is tracked through the code of the
+ * function emitted so far, the same way as above, except that the walk
+ * is done once, in order, as the code is generated: a label takes the
+ * depth of the code falling into it and of the jumps to it seen so far,
+ * and is of unknown depth if these disagree or there are none.  main's
+ * "andl $-16" starts over at a boundary.  The walk picks up where it left
+ * off on each call, so a function is walked only once in all.
+ */
+
+/* How far the walk has got, and the depth there */
+static int align_pos = 0, align_depth;
+
+
+void stack_align_reset (void)
+{
+    align_pos = 0;
+    nlabels = 0;
+}
+
+
+/* Records the depth at a jump to the label */
+static void align_jump (char *label)
+{
+    int *ld = find_label(label);
+
+    if (ld == NULL)
+	add_label(label, align_depth);
+    else if (*ld != align_depth)
+	*ld = UNKNOWN;
+}
+
+
+int stack_align_pad (ASM_LIST recs[], int n, BOOLEAN long_mode)
+{
+    ASM_LIST rec;
+    int amount, *ld;
+
+    set_target(long_mode);
+    if (align_pos == 0)
+	align_depth = word;
+
+    for ( ; align_pos < n; align_pos++) {
+	rec = recs[align_pos];
+	if (rec->kind == AK_COMMENT || rec->kind == AK_DIRECTIVE
+	    || rec->kind == AK_DEBUG)
+	    continue;
+
+	if (rec->kind == AK_LABEL) {
+	    if ((ld = find_label(rec->op)) == NULL)
+		add_label(rec->op, align_depth);
+	    else if (align_depth == UNKNOWN || align_depth == *ld)
+		align_depth = *ld;
+	    else
+		align_depth = *ld = UNKNOWN;
+	    continue;
+	}
+
+	if (rec->op[0] == 'j') {
+	    if (rec->nargs == 1 && rec->args[0][0] != '*')
+		align_jump(rec->args[0]);
+	    if (!strcmp(rec->op, "jmp"))
+		align_depth = UNKNOWN;
+	}
+	else if (align_depth == UNKNOWN)
+	    ;
+	else if (sp_adjust(rec, &amount))
+	    align_depth -= amount;
+	else if (!strncmp(rec->op, "push", 4))
+	    align_depth += word;
+	else if (!strncmp(rec->op, "pop", 3))
+	    align_depth -= word;
+	else if (!strncmp(rec->op, "and", 3) && rec->nargs == 2
+		 && !strcmp(rec->args[0], "$-16")
+		 && !strcmp(rec->args[1], sp_reg))
+	    align_depth = 0;
+	else if (!strcmp(rec->op, "leave") || !strcmp(rec->op, "ret")
+		 || !strcmp(rec->op, "ud2")
+		 || (rec->nargs > 0 && !strcmp(rec->args[rec->nargs-1], sp_reg)))
+	    align_depth = UNKNOWN;
+    }
+
+    if (align_depth == UNKNOWN)
+	return -1;
+    return (16 - align_depth % 16) % 16;
+}
+
+
+void stack_align_label (ASM_LIST recs[], int n, BOOLEAN long_mode,
+			char *label, char *from, int pop)
+{
+    int *ld;
+
+    stack_align_pad(recs, n, long_mode);
+    if (find_label(label) != NULL)
+	return;
+    ld = find_label(from);
+    add_label(label, ld == NULL || *ld == UNKNOWN ? UNKNOWN : *ld - pop);
+}
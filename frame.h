@@ -0,0 +1,53 @@
+/****************************************************************/
+/*								*/
+/*	CSCE531 - "Pascal" Compiler				*/
+/*								*/
+/*	--frame.h--						*/
+/*								*/
+/*	Frame pointer omission for leaf functions (enabled by	*/
+/*	-fomit-frame-pointer) with its call frame information	*/
+/*	(-g), and stack alignment tracking for calls (enabled	*/
+/*	by -fdirect-args).					*/
+/*								*/
+/****************************************************************/
+
+#ifndef FRAME_H
+#define FRAME_H
+
+#include "asmbuf.h"
+
+/* Rewrites the buffered code of one function, recs[0] through recs[n-1],
+   to run without a frame pointer if it is a leaf function (one that makes
+   no calls) and the stack depth is known at every instruction.  If
+   slot_rec is not -1, recs[slot_rec] is the instruction that allocated
+   the return value slot of slot_size bytes at slot_offset from the frame
+   pointer; if the slot is only ever written, it is removed as well.
+   long_mode is TRUE for x86-64 code.  Returns TRUE if the code was
+   changed, FALSE if it was left alone. */
+BOOLEAN omit_frame_pointer (ASM_LIST recs[], int n, BOOLEAN long_mode,
+			    int slot_rec, int slot_offset, int slot_size);
+
+/* With -g, makes the call frame information of each function in recs[0]
+   through recs[n-1] that runs without a frame pointer follow the stack
+   pointer, by setting the cfa_offset of the records that move it.  Call
+   it on the final code, just before it is printed. */
+void frame_cfi (ASM_LIST recs[], int n, BOOLEAN long_mode);
+
+/* Starts tracking the stack alignment of a new function (see
+   stack_align_pad).  Call it from the function's prologue. */
+void stack_align_reset (void);
+
+/* Returns the number of bytes by which the stack pointer must be lowered
+   to be 16-byte aligned at the end of recs[0] through recs[n-1], the code
+   of the current function so far, or -1 if that is not known.  Each call
+   carries on from the n of the last one, which it must not be less than,
+   until stack_align_reset is called. */
+int stack_align_pad (ASM_LIST recs[], int n, BOOLEAN long_mode);
+
+/* Tells stack_align_pad that label, which has not been emitted yet, will
+   be reached by a jump from the code at label from, emitted even later,
+   after pop bytes are popped.  recs and n are as for stack_align_pad. */
+void stack_align_label (ASM_LIST recs[], int n, BOOLEAN long_mode,
+			char *label, char *from, int pop);
+
+#endif
@@ -14,7 +14,57 @@
  * Purpose: CSCE 531 (Compiler Construction) Project
  */
 
+#include <stdio.h>
+#include <string.h>
 #include "functions.h"
+#include "encode.h"
+#include "inline.h"
+#include "options.h"
+
+/* The function definitions being compiled, innermost last.  The function
+ * at index i has nesting level i+1 and its parameters and locals are in
+ * symbol table block i+2 (0 is the install block, 1 the global one).
+ *
+ *    id          - its name
+ *    name        - the name of its code
+ *    returnType  - its return type (TYVOID for a procedure)
+ *    localOffset - offset of the lowest local variable allocated so far
+ *    localBase   - offset below which the local variables start
+ *    resultSlot  - offset of the return value slot (0 for a procedure)
+ *    upLevel     - whether nested functions use its parameters or locals,
+ *                  in which case its frame is kept in the display
+ */
+typedef struct
+{
+   ST_ID id;
+   char *name;
+   TYPETAG returnType;
+   int localOffset;
+   int localBase;
+   int resultSlot;
+   BOOLEAN upLevel;
+} FUNCTION_FRAME;
+
+static FUNCTION_FRAME frames[BS_DEPTH];
+static int frameCount = 0;
+
+/* Returns the name of the code of the function id declared in the
+ * current block: the name itself at the global level, and the name
+ * qualified by the enclosing function's otherwise, since nested functions
+ * in different places may have the same name. */
+static char *function_code_name(ST_ID id)
+{
+   char *name = st_get_id_str(id);
+   if(frameCount == 0)
+   {
+      return name;
+   }
+   
+   char *outer = frames[frameCount - 1].name;
+   char *qualified = (char *)malloc(strlen(outer) + strlen(name) + 2);
+   sprintf(qualified, "%s.%s", outer, name);
+   return qualified;
+}
 
 ST_DR declare_forward_function(ST_ID id, PARAM_LIST params, TYPE returnType)
 {
@@ -23,7 +73,7 @@ ST_DR declare_forward_function(ST_ID id, PARAM_LIST params, TYPE returnType)
    rec->u.decl.type = ty_build_func(returnType, params, FALSE);
    rec->u.decl.sc = NO_SC;
    rec->u.decl.is_ref = FALSE;
-   rec->u.decl.v.global_func_name = st_get_id_str(id);
+   rec->u.decl.v.global_func_name = function_code_name(id);
    rec->u.decl.err = FALSE;
    return rec;
 }
@@ -72,14 +122,15 @@ ST_DR install_function_decl(typedef_item_p funcDef)
    TYPE funcType = funcDef->old_type;
    int blockNum = 0;
    ST_DR foundRec = st_lookup(id, &blockNum);
-   if(foundRec == NULL)
+   //A function may hide anything of the same name in enclosing blocks
+   if(foundRec == NULL || blockNum != st_get_cur_block())
    {
       ST_DR rec = stdr_alloc();
       rec->tag = FDECL;
       rec->u.decl.type = funcType;
       rec->u.decl.sc = NO_SC;
       rec->u.decl.is_ref = FALSE;
-      rec->u.decl.v.global_func_name = st_get_id_str(id);
+      rec->u.decl.v.global_func_name = function_code_name(id);
       rec->u.decl.err = FALSE;
       st_install(id, rec);
       return rec;
@@ -151,11 +202,24 @@ DIR_LIST append_to_dir_list(DIR_LIST list, DIRECTIVETYPE type)
 
 void enter_function_block(typedef_item_p funcDef)
 {
+   int block;
+   char *name = st_lookup(funcDef->new_def, &block)->u.decl.v.global_func_name;
+   
    st_enter_block();
    PARAM_LIST params = NULL;
    BOOLEAN check_args = FALSE;
    TYPE returnValue = ty_query_func(funcDef->old_type, &params, &check_args);
    
+   if(frameCount == BS_DEPTH)
+   {
+      fatal("Functions nested too deeply");
+   }
+   FUNCTION_FRAME *frame = &frames[frameCount++];
+   frame->id = funcDef->new_def;
+   frame->name = name;
+   frame->returnType = ty_query(returnValue);
+   frame->upLevel = FALSE;
+   
    //Setup for calculating offset value
    b_init_formal_param_offset();
 
@@ -164,11 +228,15 @@ void enter_function_block(typedef_item_p funcDef)
    //create parameter record for each parameter and store
    while(param != NULL)
    {
-   	message(st_get_id_str(param->id));
-   	//ty_print_typetag(ty_query(param->type));
       ST_DR rec = stdr_alloc();
       rec->tag = PDECL;
       rec->u.decl.type = param->type;
+      //Var parameters are pointers to the variable, which is what is named
+      if(param->is_ref)
+      {
+         ST_ID unresolved;
+         rec->u.decl.type = ty_query_ptr(param->type, &unresolved);
+      }
       rec->u.decl.sc = param->sc;
       rec->u.decl.is_ref = param->is_ref;
       rec->u.decl.v.offset = b_get_formal_param_offset(ty_query(param->type));      
@@ -176,6 +244,15 @@ void enter_function_block(typedef_item_p funcDef)
       st_install(param->id, rec);
       param = param->next;
    } 
+   
+   //Locals go below the return value slot, if any (see b_get_local_var_offset)
+   frame->localBase = b_get_local_var_offset();
+   frame->resultSlot = 0;
+   if(ty_query(returnValue) != TYVOID)
+   {
+      frame->resultSlot = frame->localBase - 8;
+   }
+   frame->localOffset = frame->resultSlot ? frame->resultSlot : frame->localBase;
 }
 
 void exit_function_block(typedef_item_p funcDef)
@@ -185,12 +262,28 @@ void exit_function_block(typedef_item_p funcDef)
    TYPE funcType = funcDef->old_type;
    TYPE returnType = ty_query_func(funcType, &params, &check_args);
    
-   if(ty_query(returnType) != TYVOID)
+   inline_end_body(funcDef->new_def);
+   BOOLEAN tailCalled = encode_tail_call();
+   
+   //With -fssa, the code is generated now, after the temporaries it needs
+   if(opt_ssa)
+   {
+      int temps = ir_end_function();
+      int tempOffset = temps ? b_alloc_local_vars(temps) : 0;
+      if(opt_tail_calls)
+      {
+         b_func_body();
+      }
+      ir_lower_function(tempOffset);
+   }
+   
+   //A tail call leaves the return value as the callee returns it
+   if(!tailCalled && ty_query(returnType) != TYVOID)
    {
 		b_prepare_return(ty_query(returnType));
 	}
 	
-	b_func_epilogue(st_get_id_str(funcDef->new_def));   
+	b_func_epilogue(frames[--frameCount].name);   
    st_exit_block();
 }
 
@@ -203,9 +296,6 @@ void encode_function_def(typedef_item_p funcDef)
    PARAM_LIST param = params;
    while(param != NULL)
    {
-   	message(st_get_id_str(param->id));
-   	//ty_print_typetag(ty_query(param->type));
-   	
    	int offset = b_store_formal_param(ty_query(param->type));
    	int block;
    	if(offset != st_lookup(param->id, &block)->u.decl.v.offset)
@@ -215,9 +305,107 @@ void encode_function_def(typedef_item_p funcDef)
    	param = param->next;  
    }
    
+   FUNCTION_FRAME *frame = &frames[frameCount - 1];
    if(ty_query(returnType) != TYVOID)
    {
    	b_alloc_return_value();
+   	if(b_get_local_var_offset() != frame->resultSlot)
+   	{
+   		bug("Return value slot mismatch: %s", frame->name);
+   	}
+   }
+   
+   int top = frame->resultSlot ? frame->resultSlot : frame->localBase;
+   b_alloc_local_vars(top - frame->localOffset);
+   
+   //Nested functions find this frame through the display
+   if(frame->upLevel)
+   {
+   	b_enter_display(frameCount);
+   }
+   
+   //Self-recursive tail calls jump back to here, past the temporaries
+   //that -fssa allocates once the body is built
+   if(opt_ssa)
+   {
+   	ir_begin_function(frame->name);
+   	for(param = params; param != NULL; param = param->next)
+   	{
+   		int block;
+   		ir_param(st_lookup(param->id, &block)->u.decl.v.offset);
+   	}
+   	if(frame->upLevel)
+   	{
+   		ir_share_frame();
+   	}
+   }
+   else if(opt_tail_calls)
+   {
+   	b_func_body();
+   }
+   inline_begin_body();
+}
+
+int alloc_local_var(TYPE type)
+{
+   FUNCTION_FRAME *frame = &frames[frameCount - 1];
+   int align = get_type_alignment(type);
+   int offset = frame->localOffset - get_type_size(type);
+   
+   //Round down to the alignment of the type
+   offset -= ((offset % align) + align) % align;
+   frame->localOffset = offset;
+   return offset;
+}
+
+int function_level(void)
+{
+   return frameCount;
+}
+
+int block_function_level(int block)
+{
+   return block - 1;
+}
+
+int active_function_level(ST_ID id)
+{
+   int level;
+   for(level = frameCount; level > 0; level--)
+   {
+      if(frames[level - 1].id == id)
+      {
+         return level;
+      }
+   }
+   return 0;
+}
+
+int function_result_slot(int level)
+{
+   return frames[level - 1].resultSlot;
+}
+
+char *current_function_name(void)
+{
+   return frames[frameCount - 1].name;
+}
+
+TYPETAG current_function_return_type(void)
+{
+   return frames[frameCount - 1].returnType;
+}
+
+void encode_frame_addr(int level, int offset)
+{
+   if(level == frameCount)
+   {
+      ir_push_loc_addr(offset);
+   }
+   else
+   {
+      frames[level - 1].upLevel = TRUE;
+      ir_push_display_addr(level, offset);
    }
 }
 
@@ -24,6 +24,35 @@ void enter_function_block(typedef_item_p params);
 void exit_function_block(typedef_item_p funcTypeDef);
 void encode_function_def(typedef_item_p funcDef);
 int size_of_vars(stid_list list);
+
+/* Allocates a local variable of the type in the current function and
+   returns its offset from the frame pointer */
+int alloc_local_var(TYPE type);
+
+/* Nesting levels: 0 for the main program, 1 for the functions declared
+   in it, and so on.  function_level returns the level of the function
+   being compiled, block_function_level that of the function whose
+   parameters and locals are in a symbol table block, and
+   active_function_level that of the function id if it is being
+   compiled (0 if it is not). */
+int function_level(void);
+int block_function_level(int block);
+int active_function_level(ST_ID id);
+
+/* Returns the offset of the return value slot of the function being
+   compiled at the level */
+int function_result_slot(int level);
+
+/* Return the name of the code of the function being compiled and its
+   return type (TYVOID for a procedure) */
+char *current_function_name(void);
+TYPETAG current_function_return_type(void);
+
+/* Pushes the address at the offset from the frame pointer of the
+   function being compiled at the level, which is either the current
+   function or one it is nested in.  The latter is found through the
+   display (see b_enter_display). */
+void encode_frame_addr(int level, int offset);
 DIR_LIST create_dir_list(DIRECTIVETYPE type);
 DIR_LIST append_to_dir_list(DIR_LIST list, DIRECTIVETYPE type);
 
@@ -188,7 +188,6 @@ void yyerror(char *);
 %type <y_for_dir> for_direction
 
 %type <y_boolean> optional_semicolon_or_else_branch
-%type <y_string> case_element
 %type <y_expr> constant number unsigned_number constant_literal string predefined_literal
 
 %type <y_expr_list> index_expression_list actual_parameter_list optional_par_actual_parameter_list
@@ -594,6 +593,7 @@ function_declaration:
       //Generate function declaration with directives
       ST_DR rec = apply_directives($1, $3);
       st_install($1->new_def, rec);
+      $$ = 0;
     }
   | function_heading semi { 
       //Generate function declaration with local definition
@@ -603,9 +603,9 @@ function_declaration:
 	   int block;
       b_func_prologue(st_lookup($1->new_def, &block)->u.decl.v.global_func_name);
       encode_function_def($1);
-      b_alloc_local_vars($4);
   } statement_part semi {
       exit_function_block($1);
+      $$ = 0;
   }
   ;
 
@@ -700,8 +700,7 @@ simple_if:
     LEX_IF boolean_expression LEX_THEN
     {
         char *after_if_label = new_symbol();
-        encode_expression($2);
-        b_cond_jump(TYSIGNEDCHAR, B_ZERO, after_if_label);
+        encode_cond_jump($2, FALSE, after_if_label);
         
         $<y_string>$ = after_if_label;
     }
@@ -715,20 +714,19 @@ if_statement:
     simple_if LEX_ELSE
     {
         char *end_label = new_symbol();
-        b_jump(end_label);
-        b_label($1); 
+        ir_jump(end_label);
+        ir_label($1); 
         $<y_string>$ = end_label;
     }
     statement
     {
-        b_label($<y_string>3);
+        ir_label($<y_string>3);
     }
-  | simple_if %prec prec_if { b_label($1); }
+  | simple_if %prec prec_if { ir_label($1); }
   ;
 
 case_statement:
     LEX_CASE expression LEX_OF {
-      char *end_label = new_symbol();
       if (!isOrdinalType($2->expr_typetag))
       {
         error("Case expression is not of ordinal type");
@@ -738,30 +736,25 @@ case_statement:
       EXPR expr = parse_expr_for_case($2);
       
       encode_expression(expr);
-      $<y_string>$ = end_label;      
+      encode_case_begin();
     } case_element_list optional_semicolon_or_else_branch LEX_END {
-    	if($6 == FALSE)
-    	{
-      	b_pop();
-      }
       exit_case_block();
-      b_label($<y_string>4);
+      encode_case_end();
     }
   ;
 
 optional_semicolon_or_else_branch:
     optional_semicolon { $$ = FALSE; } //Pass false, no else statement
-  | case_default { b_pop(); } statement_sequence { $$ = TRUE;} //Pass true, else statement exists
+  | case_default { encode_case_else(); } statement_sequence { $$ = TRUE;} //Pass true, else statement exists
   ;
 
 case_element_list:
-    case_element { b_jump($<y_string>0); b_label($1); }
-  | case_element_list semi case_element { b_jump($<y_string>0); b_label($3); }
+    case_element { encode_case_arm_end(); }
+  | case_element_list semi case_element { encode_case_arm_end(); }
   ;
 
 case_element:
     case_constant_list {
-    	char *end_label = new_symbol();
     	char *statement_label = new_symbol();
     	
     	EXPR_LIST list = $1;
@@ -774,17 +767,13 @@ case_element:
     		}
     		else if (expr->expr_tag == E_SUBRANGE)
     		{
-    			int lo = (int)get_expr_constant(expr->left);
-    			int hi = (int)get_expr_constant(expr->right);
+    			long lo = get_case_constant(expr->left);
+    			long hi = get_case_constant(expr->right);
     			
     			if (check_subrange(lo, hi))
     			{
     				add_subrange(lo, hi);
-    				
-		  		  char* next_dispatch = new_symbol();
-				    b_dispatch(B_LT, TYSIGNEDLONGINT, lo, next_dispatch, FALSE);
-				    b_dispatch(B_LE, TYSIGNEDLONGINT, hi, statement_label, TRUE);
-				    b_label(next_dispatch);
+    				encode_case_range(lo, hi, statement_label);
 				  }
 				  else
 				  {
@@ -793,12 +782,12 @@ case_element:
     		}
     		else
     		{
-    			int i = (int)get_expr_constant(expr);
+    			long i = get_case_constant(expr);
     			
     			if (check_constant(i))
     			{
     				add_constant(i);
-    		  	b_dispatch(B_EQ, TYSIGNEDLONGINT, i, statement_label, TRUE);
+    				encode_case_range(i, i, statement_label);
     		  }
     		  else
     		  {
@@ -808,12 +797,9 @@ case_element:
     		list = list->next;
     	}
     	
-    	b_jump(end_label);
-    	b_label(statement_label);
-    	$<y_string>$ = end_label;
-    } ':' statement {
-    	$$ = $<y_string>2;
-    }
+    	// The selector is dispatched on once all the labels are known
+    	encode_case_arm(statement_label);
+    } ':' statement
   ;
 
 case_default:
@@ -828,7 +814,23 @@ repetitive_statement:
   ;
 
 repeat_statement:
-    LEX_REPEAT statement_sequence LEX_UNTIL boolean_expression
+    LEX_REPEAT
+    {
+        char *repeat_after_label = new_symbol();
+        char *repeat_top_label = new_symbol();
+        store_label(repeat_after_label);
+        
+        ir_label(repeat_top_label);
+        
+        control_labels lbls = {repeat_top_label, repeat_after_label};
+        $<y_control>$ = lbls;
+    }
+    statement_sequence LEX_UNTIL boolean_expression
+    {
+        control_labels lbls = $<y_control>2;
+        encode_cond_jump($5, FALSE, lbls.conditional_label);
+        ir_label(lbls.after_label);
+    }
   ;
 
 while_statement:
@@ -838,9 +840,8 @@ while_statement:
         char *while_cond_label = new_symbol();
         store_label(while_after_label);
         
-        b_label(while_cond_label);
-        encode_expression($2);
-        b_cond_jump(TYSIGNEDCHAR, B_ZERO, while_after_label);
+        ir_label(while_cond_label);
+        encode_cond_jump($2, FALSE, while_after_label);
         
         control_labels lbls = {while_cond_label, while_after_label};
         $<y_control>$ = lbls;
@@ -848,8 +849,8 @@ while_statement:
     statement
     {
         control_labels lbls = $<y_control>4;
-        b_jump(lbls.conditional_label);
-        b_label(lbls.after_label);
+        ir_jump(lbls.conditional_label);
+        ir_label(lbls.after_label);
     }
   ;
 
@@ -874,35 +875,34 @@ for_statement:
         }
         
         encode_expression($6);
-        if ($6->expr_tag == E_VAR || $6->expr_tag == E_ARRAY) { b_deref($6->expr_typetag); }
+        if ($6->expr_tag == E_VAR || $6->expr_tag == E_ARRAY) { ir_deref($6->expr_typetag); }
         
         if ($6->expr_typetag == TYUNSIGNEDCHAR || $6->expr_typetag == TYSIGNEDCHAR)
         {
-          b_convert($6->expr_typetag, TYSIGNEDLONGINT);
+          ir_convert($6->expr_typetag, TYSIGNEDLONGINT);
         }
         
-        b_duplicate(TYSIGNEDLONGINT);
+        ir_duplicate(TYSIGNEDLONGINT);
         
         encode_expression($2);
         encode_expression($4);
-        b_assign($2->expr_typetag);
+        ir_assign($2->expr_typetag);
         
-        b_label(for_cond_label);
+        ir_label(for_cond_label);
         
         if ($2->expr_typetag == TYUNSIGNEDCHAR || $2->expr_typetag == TYSIGNEDCHAR)
         {
-          b_convert($6->expr_typetag, TYSIGNEDLONGINT);
+          ir_convert($6->expr_typetag, TYSIGNEDLONGINT);
         }
         
         if ($5 == FOR_TO)
         {
-            b_arith_rel_op(B_LT, TYSIGNEDLONGINT);
+            ir_cond_jump_rel(B_LT, TYSIGNEDLONGINT, for_exit_label);
         }
         else //if ($5 == FOR_DOWNTO)
         {
-            b_arith_rel_op(B_GT, TYSIGNEDLONGINT);
+            ir_cond_jump_rel(B_GT, TYSIGNEDLONGINT, for_exit_label);
         }
-        b_cond_jump(TYSIGNEDLONGINT, B_NONZERO, for_exit_label);
         
         control_labels lbls = { for_cond_label, for_exit_label };
         
@@ -913,17 +913,17 @@ for_statement:
     {
         control_labels lbls = $<y_control>8;
         
-        b_duplicate(TYSIGNEDLONGINT);
+        ir_duplicate(TYSIGNEDLONGINT);
         
         encode_expression($2);
         
         B_INC_DEC_OP idop = ($5 == FOR_TO) ? B_PRE_INC : B_PRE_DEC;
         
-        b_inc_dec($2->expr_typetag, idop, 0);
+        ir_inc_dec($2->expr_typetag, idop, 0);
         
-        b_jump(lbls.conditional_label);
-        b_label(lbls.after_label);
-        b_pop();
+        ir_jump(lbls.conditional_label);
+        ir_label(lbls.after_label);
+        ir_pop();
     }
   ;
 
@@ -934,7 +934,7 @@ for_direction:
 
 simple_statement:
     empty_statement { /* do nothing */ }
-  | assignment_or_call_statement { encode_expression($1); }
+  | assignment_or_call_statement { encode_statement_expr($1); }
   | standard_procedure_statement { printf("Standard Procedure"); }
   | statement_extensions { /* ignore */ }
   ;
@@ -1052,7 +1052,7 @@ return_statement:
   ;
 
 break_statement:
-    BREAK   { char *last_loop_label = get_last_label(); b_jump(last_loop_label); }
+    BREAK   { char *last_loop_label = get_last_label(); ir_jump(last_loop_label); }
   ;
 
 continue_statement:
@@ -0,0 +1,664 @@
+/****************************************************************/
+/*								*/
+/*	CSCE531 - "Pascal" Compiler				*/
+/*								*/
+/*	--gvn.c--						*/
+/*								*/
+/*	Global value numbering and redundant load elimination	*/
+/*	on the SSA intermediate representation (see ir.h),	*/
+/*	enabled by -fgvn.					*/
+/*								*/
+/****************************************************************/
+
+/*
+ * The blocks are walked down the dominator tree.  Each value gets the
+ * number of the first value seen to compute the same thing from operands
+ * with the same numbers, and that first value is kept in a table while
+ * the blocks it dominates are walked.  A load gets the number of the
+ * value last loaded from or stored to an address with the same number,
+ * if nothing that may have changed the variable came in between.  That
+ * is remembered per block: a block starts with what its immediate
+ * dominator ended with, less what the blocks on the paths between them
+ * (the whole loop, for a loop header) may store to.
+ *
+ * A local variable, or array, can only be changed by a store to it,
+ * unless its address is taken for anything but loading, storing and
+ * indexing (as for a var parameter), or nested functions can see the
+ * frame.  Then, like globals and the variables of enclosing functions, it
+ * may also be changed through a pointer, which includes every var
+ * parameter, and by any call.
+ *
+ * A value with the number of an earlier one is replaced by it where that
+ * saves work: the lowering has to keep the earlier value in a temporary,
+ * so constants, addresses and single operations on them, such as a load
+ * of a plain variable, which cost no more to compute again, are left
+ * alone.  The values the front end left
+ * on the operand stack across a jump must stay there, so they are never
+ * replaced nor used as replacements.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "ir.h"
+#include "message.h"
+
+/* The number of loaded values remembered, and of blocks looked through
+   for stores between a block and its immediate dominator */
+#define MAX_MEM 32
+#define MAX_WALK 64
+
+#define HASH_SIZE 1021
+
+/* What an address points into: a variable of the frame, a global, a
+   variable of an enclosing function, or anything */
+typedef enum { ROOT_LOCAL, ROOT_GLOBAL, ROOT_DISPLAY, ROOT_UNKNOWN } ROOT_KIND;
+
+typedef struct {
+    ROOT_KIND kind;
+    long offset;
+    char *name;
+    int level;
+} ROOT;
+
+/* A value in memory at an address with number addr */
+typedef struct {
+    int addr;
+    TYPETAG type;
+    IR_VALUE value;
+    ROOT root;
+} MEM;
+
+typedef struct {
+    int n;
+    MEM mem[MAX_MEM];
+} MEMORY;
+
+/* A block of the dominator tree being walked, with the memory it ends
+   with and the next of its children to walk */
+typedef struct {
+    IR_BLOCK *block;
+    IR_BLOCK *child;
+    int mark;
+    MEMORY *out;
+} FRAME;
+
+/* For each value, indexed by id: the value whose number it has (NULL if
+   its own), and what replaces it (NULL if nothing) */
+static IR_VALUE *leader = NULL, *repl = NULL;
+
+/* Values that must stay on the operand stack, indexed by id */
+static char *pinned = NULL;
+
+/* The table of values by what they compute, and the buckets added to, in
+   order, so that the entries of a subtree can be taken out */
+typedef struct entry {
+    IR_VALUE value;
+    struct entry *next;
+} ENTRY;
+static ENTRY *buckets[HASH_SIZE];
+static int *added = NULL;
+static int nadded, added_size;
+
+/* The frame offsets of the local variables whose addresses are taken
+   for more than loading, storing and indexing */
+static long *escaped = NULL;
+static int nescaped, escaped_size;
+static BOOLEAN shared_frame;
+
+/* The children of each block in the dominator tree, indexed by index */
+static IR_BLOCK **first_child = NULL, **next_sibling = NULL;
+
+/* The blocks seen by kill_between, marked with the walk they were seen in */
+static int *seen = NULL;
+static int walk;
+
+
+static void *gvn_alloc (void *p, int *size, int n, size_t elsize)
+{
+    if (n < *size)
+	return p;
+    *size = *size ? 2 * *size : 16;
+    p = realloc(p, *size * elsize);
+    if (p == NULL)
+	bug("gvn: out of memory");
+    return p;
+}
+
+
+static int number (IR_VALUE v)
+{
+    return leader[v->id] != NULL ? leader[v->id]->id : v->id;
+}
+
+
+static BOOLEAN is_remat (IR_VALUE v)
+{
+    switch (v->op) {
+    case IR_CONST_INT:
+    case IR_CONST_REAL:
+    case IR_GLOBAL_ADDR:
+    case IR_LOCAL_ADDR:
+    case IR_DISPLAY_ADDR:
+	return TRUE;
+    default:
+	return FALSE;
+    }
+}
+
+
+/* Tells whether v costs no more to compute again than to keep: it is a
+   constant or an address, or one operation on those */
+static BOOLEAN is_cheap (IR_VALUE v)
+{
+    int i;
+
+    if (is_remat(v))
+	return TRUE;
+    for (i = 0; i < v->nargs; i++)
+	if (!is_remat(v->args[i]))
+	    return FALSE;
+    return TRUE;
+}
+
+
+static void find_pinned (IR_FUNC *f)
+{
+    IR_BLOCK *b;
+    IR_INSN *insn;
+    int i;
+
+    pinned = (char *) realloc(pinned, f->ninsns + 1);
+    if (pinned == NULL)
+	bug("gvn: out of memory");
+    memset(pinned, 0, f->ninsns + 1);
+    for (b = f->first; b != NULL; b = b->next) {
+	for (i = 0; i < b->nstack; i++)
+	    pinned[b->stack[i]->id] = TRUE;
+	for (insn = b->first; insn != NULL; insn = insn->next)
+	    if (insn->op == IR_PHI)
+		for (i = 0; i < insn->nargs; i++)
+		    pinned[insn->args[i]->id] = TRUE;
+    }
+}
+
+
+/* Pure values */
+
+static BOOLEAN commutes (IR_INSN *insn)
+{
+    if (insn->op != IR_ARITH)
+	return FALSE;
+    switch (insn->arop) {
+    case B_ADD:
+    case B_MULT:
+    case B_EQ:
+    case B_NE:
+	return TRUE;
+    default:
+	return FALSE;
+    }
+}
+
+
+/* Tells whether insn has no effect and gives a value that depends only
+   on its operands */
+static BOOLEAN is_pure (IR_INSN *insn)
+{
+    switch (insn->op) {
+    case IR_CONST_INT:
+    case IR_CONST_REAL:
+    case IR_GLOBAL_ADDR:
+    case IR_LOCAL_ADDR:
+    case IR_DISPLAY_ADDR:
+    case IR_CONVERT:
+    case IR_NEGATE:
+    case IR_ARITH:
+    case IR_ARITH_IMM:
+    case IR_PTR_ARITH:
+	return TRUE;
+    default:
+	return FALSE;
+    }
+}
+
+
+static unsigned hash (IR_INSN *insn)
+{
+    unsigned h = insn->op * 31u + insn->type * 7u + insn->optype
+	+ insn->arop * 13u + (unsigned) insn->imm + insn->level;
+    char *s;
+    int i;
+
+    if (insn->name != NULL)
+	for (s = insn->name; *s; s++)
+	    h = h * 31u + (unsigned char) *s;
+    if (insn->op == IR_CONST_REAL)
+	h += (unsigned) (insn->real * 1024.0);
+	/* The operands are summed so that a commuted operation matches */
+    for (i = 0; i < insn->nargs; i++)
+	h += (unsigned) number(insn->args[i]) * 17u;
+    return h % HASH_SIZE;
+}
+
+
+/* Tells whether pure instructions a and b compute the same value */
+static BOOLEAN same_value (IR_INSN *a, IR_INSN *b)
+{
+    if (a->op != b->op || a->type != b->type || a->optype != b->optype
+	|| a->arop != b->arop || a->imm != b->imm || a->level != b->level
+	|| a->nargs != b->nargs)
+	return FALSE;
+    if (a->op == IR_CONST_REAL && memcmp(&a->real, &b->real, sizeof(double)))
+	return FALSE;
+    if ((a->name == NULL) != (b->name == NULL)
+	|| (a->name != NULL && strcmp(a->name, b->name)))
+	return FALSE;
+    switch (a->nargs) {
+    case 0:
+	return TRUE;
+    case 1:
+	return number(a->args[0]) == number(b->args[0]);
+    default:
+	if (number(a->args[0]) == number(b->args[0])
+	    && number(a->args[1]) == number(b->args[1]))
+	    return TRUE;
+	return commutes(a) && number(a->args[0]) == number(b->args[1])
+	    && number(a->args[1]) == number(b->args[0]);
+    }
+}
+
+
+static IR_VALUE find_value (IR_INSN *insn)
+{
+    ENTRY *e;
+
+    for (e = buckets[hash(insn)]; e != NULL; e = e->next)
+	if (same_value(e->value, insn))
+	    return e->value;
+    return NULL;
+}
+
+
+static void add_value (IR_INSN *insn)
+{
+    unsigned h = hash(insn);
+    ENTRY *e = (ENTRY *) malloc(sizeof(ENTRY));
+
+    if (e == NULL)
+	bug("gvn: out of memory");
+    e->value = insn;
+    e->next = buckets[h];
+    buckets[h] = e;
+    added = gvn_alloc(added, &added_size, nadded, sizeof(int));
+    added[nadded++] = h;
+}
+
+
+/* Takes out the entries added since there were mark of them */
+static void remove_values (int mark)
+{
+    while (nadded > mark) {
+	int h = added[--nadded];
+	ENTRY *e = buckets[h];
+
+	buckets[h] = e->next;
+	free(e);
+    }
+}
+
+
+/* Memory */
+
+static ROOT root_of (IR_VALUE addr)
+{
+    ROOT r;
+
+    while (addr->op == IR_PTR_ARITH || addr->op == IR_DUP)
+	addr = addr->args[0];
+    memset(&r, 0, sizeof(r));
+    switch (addr->op) {
+    case IR_LOCAL_ADDR:
+	r.kind = ROOT_LOCAL;
+	r.offset = addr->imm;
+	break;
+    case IR_GLOBAL_ADDR:
+	r.kind = ROOT_GLOBAL;
+	r.name = addr->name;
+	break;
+    case IR_DISPLAY_ADDR:
+	r.kind = ROOT_DISPLAY;
+	r.offset = addr->imm;
+	r.level = addr->level;
+	break;
+    default:
+	r.kind = ROOT_UNKNOWN;
+	break;
+    }
+    return r;
+}
+
+
+static BOOLEAN is_escaped (long offset)
+{
+    int i;
+
+    for (i = 0; i < nescaped; i++)
+	if (escaped[i] == offset)
+	    return TRUE;
+    return FALSE;
+}
+
+
+/* Notes that the address v, if of a local variable, is used for more than
+   loading and storing */
+static void escape (IR_VALUE v)
+{
+    ROOT r = root_of(v);
+
+    if (v->op != IR_LOCAL_ADDR && v->op != IR_PTR_ARITH && v->op != IR_DUP)
+	return;
+    if (r.kind != ROOT_LOCAL || is_escaped(r.offset))
+	return;
+    escaped = gvn_alloc(escaped, &escaped_size, nescaped, sizeof(long));
+    escaped[nescaped++] = r.offset;
+}
+
+
+/* Finds the local variables whose addresses, or the addresses of whose
+   elements, are passed on, stored or kept on the stack */
+static void find_escaped (IR_FUNC *f)
+{
+    IR_BLOCK *b;
+    IR_INSN *insn;
+    int i;
+
+    nescaped = 0;
+    for (b = f->first; b != NULL; b = b->next) {
+	for (i = 0; i < b->nstack; i++)
+	    escape(b->stack[i]);
+	for (insn = b->first; insn != NULL; insn = insn->next)
+	    for (i = 0; i < insn->nargs; i++) {
+		if (i == 0 && (insn->op == IR_LOAD || insn->op == IR_STORE
+			       || insn->op == IR_INC_DEC || insn->op == IR_DUP
+			       || insn->op == IR_PTR_ARITH))
+		    continue;
+		escape(insn->args[i]);
+	    }
+    }
+}
+
+
+/* Tells whether the variable can be changed through a pointer or by a
+   call */
+static BOOLEAN is_visible (ROOT *r)
+{
+    return r->kind != ROOT_LOCAL || shared_frame || is_escaped(r->offset);
+}
+
+
+static BOOLEAN same_root (ROOT *a, ROOT *b)
+{
+    if (a->kind != b->kind)
+	return FALSE;
+    switch (a->kind) {
+    case ROOT_LOCAL:
+	return a->offset == b->offset;
+    case ROOT_GLOBAL:
+	return !strcmp(a->name, b->name);
+    case ROOT_DISPLAY:
+	return a->level == b->level && a->offset == b->offset;
+    default:
+	return FALSE;
+    }
+}
+
+
+/* Forgets the values in m that a store to a variable with root r may
+   change, or with r NULL, that a call may */
+static void kill (MEMORY *m, ROOT *r)
+{
+    int i, n = 0;
+
+    for (i = 0; i < m->n; i++) {
+	ROOT *e = &m->mem[i].root;
+
+	if (r == NULL ? is_visible(e)
+	    : same_root(e, r) || (r->kind == ROOT_UNKNOWN && is_visible(e))
+	      || (e->kind == ROOT_UNKNOWN && is_visible(r)))
+	    continue;
+	m->mem[n++] = m->mem[i];
+    }
+    m->n = n;
+}
+
+
+static void kill_effects (MEMORY *m, IR_INSN *insn)
+{
+    ROOT r;
+
+    switch (insn->op) {
+    case IR_STORE:
+    case IR_INC_DEC:
+	r = root_of(insn->args[0]);
+	kill(m, &r);
+	break;
+    case IR_CALL:
+    case IR_TAIL_SELF:
+    case IR_TAIL_CALL:
+	kill(m, NULL);
+	break;
+    default:
+	break;
+    }
+}
+
+
+static MEM *find_mem (MEMORY *m, IR_VALUE addr, TYPETAG type)
+{
+    int i;
+
+    for (i = 0; i < m->n; i++)
+	if (m->mem[i].addr == number(addr) && m->mem[i].type == type)
+	    return &m->mem[i];
+    return NULL;
+}
+
+
+/* Remembers that value is in memory at addr */
+static void add_mem (MEMORY *m, IR_VALUE addr, TYPETAG type, IR_VALUE value)
+{
+    MEM *e = find_mem(m, addr, type);
+
+    if (e == NULL) {
+	if (m->n == MAX_MEM) {
+	    memmove(&m->mem[0], &m->mem[1], (MAX_MEM - 1) * sizeof(MEM));
+	    m->n--;
+	}
+	e = &m->mem[m->n++];
+    }
+    e->addr = number(addr);
+    e->type = type;
+    e->value = value;
+    e->root = root_of(addr);
+}
+
+
+/* Forgets the values in m that the blocks on the paths from d to its
+   child c in the dominator tree may change */
+static void kill_between (MEMORY *m, IR_BLOCK *c, IR_BLOCK *d)
+{
+    IR_BLOCK **work, *b;
+    IR_INSN *insn;
+    int nwork = 0, nseen = 0, i;
+
+    if (c->npreds == 1 && c->preds[0] == d)
+	return;
+    walk++;
+    work = (IR_BLOCK **) malloc((MAX_WALK + c->npreds) * sizeof(IR_BLOCK *));
+    if (work == NULL)
+	bug("gvn: out of memory");
+    for (i = 0; i < c->npreds; i++)
+	if (c->preds[i] != d && seen[c->preds[i]->index] != walk) {
+	    seen[c->preds[i]->index] = walk;
+	    work[nwork++] = c->preds[i];
+	}
+    while (nwork > 0) {
+	b = work[--nwork];
+	if (++nseen > MAX_WALK) {
+	    m->n = 0;
+	    break;
+	}
+	for (insn = b->first; insn != NULL; insn = insn->next)
+	    kill_effects(m, insn);
+	for (i = 0; i < b->npreds; i++) {
+	    IR_BLOCK *p = b->preds[i];
+
+	    if (p == d || seen[p->index] == walk)
+		continue;
+	    seen[p->index] = walk;
+	    if (nwork == MAX_WALK + c->npreds) {
+		m->n = 0;
+		nwork = 0;
+		break;
+	    }
+	    work[nwork++] = p;
+	}
+    }
+    free(work);
+}
+
+
+/* Numbers the values of block b, which starts with memory m */
+static void number_block (IR_BLOCK *b, MEMORY *m)
+{
+    IR_INSN *insn;
+    IR_VALUE same;
+    MEM *e;
+
+    for (insn = b->first; insn != NULL; insn = insn->next) {
+	same = NULL;
+	if (is_pure(insn)) {
+	    same = find_value(insn);
+	    if (same == NULL)
+		add_value(insn);
+	}
+	else
+	    switch (insn->op) {
+	    case IR_LOAD:
+		e = find_mem(m, insn->args[0], insn->type);
+		if (e != NULL)
+		    same = e->value;
+		else
+		    add_mem(m, insn->args[0], insn->type, insn);
+		break;
+	    case IR_STORE:
+		kill_effects(m, insn);
+		add_mem(m, insn->args[0], insn->type, insn);
+		leader[insn->id] = leader[insn->args[1]->id] != NULL
+		    ? leader[insn->args[1]->id] : insn->args[1];
+		break;
+	    case IR_DUP:
+		leader[insn->id] = leader[insn->args[0]->id] != NULL
+		    ? leader[insn->args[0]->id] : insn->args[0];
+		break;
+	    default:
+		kill_effects(m, insn);
+		break;
+	    }
+	if (same == NULL)
+	    continue;
+	leader[insn->id] = leader[same->id] != NULL ? leader[same->id] : same;
+	if (!is_cheap(insn) && !pinned[insn->id] && !pinned[same->id])
+	    repl[insn->id] = same;
+    }
+}
+
+
+void ir_number_values (IR_FUNC *f)
+{
+    FRAME *stack;
+    IR_BLOCK *b;
+    IR_INSN *insn, *next;
+    MEMORY m;
+    int depth = 0, i;
+
+    if (f->first == NULL)
+	return;
+    leader = (IR_VALUE *) realloc(leader, (f->ninsns + 1) * sizeof(IR_VALUE));
+    repl = (IR_VALUE *) realloc(repl, (f->ninsns + 1) * sizeof(IR_VALUE));
+    first_child = (IR_BLOCK **) realloc(first_child,
+					(f->nblocks + 1) * sizeof(IR_BLOCK *));
+    next_sibling = (IR_BLOCK **) realloc(next_sibling,
+					 (f->nblocks + 1) * sizeof(IR_BLOCK *));
+    seen = (int *) realloc(seen, (f->nblocks + 1) * sizeof(int));
+    stack = (FRAME *) malloc((f->nblocks + 1) * sizeof(FRAME));
+    if (leader == NULL || repl == NULL || first_child == NULL
+	|| next_sibling == NULL || seen == NULL || stack == NULL)
+	bug("gvn: out of memory");
+    memset(leader, 0, (f->ninsns + 1) * sizeof(IR_VALUE));
+    memset(repl, 0, (f->ninsns + 1) * sizeof(IR_VALUE));
+    memset(seen, 0, (f->nblocks + 1) * sizeof(int));
+    walk = 0;
+
+    ir_find_dominators(f);
+    find_pinned(f);
+    shared_frame = f->shared_frame;
+    find_escaped(f);
+    for (b = f->first; b != NULL; b = b->next)
+	first_child[b->index] = next_sibling[b->index] = NULL;
+    for (b = f->last; b != NULL; b = b->prev)
+	if (b->idom != NULL) {
+	    next_sibling[b->index] = first_child[b->idom->index];
+	    first_child[b->idom->index] = b;
+	}
+
+	/* Down the dominator tree, each block starting with the memory its
+	   immediate dominator ended with */
+    m.n = 0;
+    number_block(f->first, &m);
+    stack[0].block = f->first;
+    stack[0].child = first_child[f->first->index];
+    stack[0].mark = 0;
+    stack[0].out = (MEMORY *) malloc(sizeof(MEMORY));
+    if (stack[0].out == NULL)
+	bug("gvn: out of memory");
+    *stack[0].out = m;
+    depth = 1;
+    while (depth > 0) {
+	FRAME *top = &stack[depth - 1];
+
+	if (top->child == NULL) {
+	    remove_values(top->mark);
+	    free(top->out);
+	    depth--;
+	    continue;
+	}
+	b = top->child;
+	top->child = next_sibling[b->index];
+	m = *top->out;
+	kill_between(&m, b, top->block);
+	stack[depth].block = b;
+	stack[depth].child = first_child[b->index];
+	stack[depth].mark = nadded;
+	number_block(b, &m);
+	stack[depth].out = (MEMORY *) malloc(sizeof(MEMORY));
+	if (stack[depth].out == NULL)
+	    bug("gvn: out of memory");
+	*stack[depth].out = m;
+	depth++;
+    }
+    free(stack);
+
+	/* The values replaced have no uses left */
+    for (b = f->first; b != NULL; b = b->next)
+	for (insn = b->first; insn != NULL; insn = insn->next)
+	    for (i = 0; i < insn->nargs; i++)
+		if (repl[insn->args[i]->id] != NULL)
+		    insn->args[i] = repl[insn->args[i]->id];
+    for (b = f->first; b != NULL; b = b->next)
+	for (insn = b->first; insn != NULL; insn = next) {
+	    next = insn->next;
+	    if (repl[insn->id] != NULL)
+		ir_delete_insn(insn);
+	}
+}
@@ -0,0 +1,658 @@
+/*
+ * INLINE.C
+ *
+ * Inline expansion of calls of small procedures and functions (see
+ * inline.h).  Getters and setters are the typical case: a call costs far
+ * more than their bodies, and once expanded, constant arguments are
+ * folded like any other constant operand.
+ *
+ * A body can be kept if it is a sequence of assignments and procedure
+ * calls of at most opt_inline_limit expression nodes in all, that names
+ * nothing but the function's own parameters and global identifiers.  A
+ * function's body must end with the assignment of its result, and
+ * otherwise not name the function.  At a call, each name must still mean
+ * what it did in the body, since the trees are encoded in the caller's
+ * scope.
+ *
+ * Parameters are bound by substitution.  A var parameter stands for its
+ * argument, which must be a variable.  A value parameter stands for its
+ * argument's value, which must have no side effects, and which must not
+ * be assigned to in the body.  Unless it is a constant, its uses must
+ * also all come before anything that might change it, and a computed
+ * value may only be used once, so that it is evaluated the same number
+ * of times as it would be for a call, or fewer.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "inline.h"
+#include "encode.h"
+#include "functions.h"
+#include "options.h"
+
+// Directives that allow the type tags herein to match the Pascal types more closely.
+#define TYINTEGER TYSIGNEDLONGINT
+#define TYSINGLE  TYFLOAT
+#define TYREAL    TYDOUBLE
+
+// A global identifier named in a body, and what it named there
+typedef struct
+{
+  ST_ID id;
+  ST_DR record;
+} INLINE_NAME;
+
+// A body kept for expansion
+typedef struct inline_body
+{
+  ST_DR func_rec;        // the function's record, which calls find
+  ST_ID func_id;
+  PARAM_LIST params;
+  BOOLEAN is_function;
+  EXPR *stmts;           // for a function, the result assignment is last
+  int num_stmts;
+  INLINE_NAME *names;
+  int num_names;
+  BOOLEAN expanding;     // being expanded, so not again within itself
+  struct inline_body *next;
+} INLINE_BODY;
+
+static INLINE_BODY *bodies = NULL;
+
+// The statements of the body being compiled, and the code mark after the
+// last one.  keeping is FALSE once the body cannot be kept.
+static BOOLEAN keeping = FALSE;
+static EXPR *cur_stmts = NULL;
+static int cur_num_stmts = 0, cur_stmts_size = 0;
+static int cur_nodes, cur_end;
+
+// The names found in a body by collect_names
+static INLINE_NAME *found_names = NULL;
+static int num_found_names = 0, found_names_size = 0;
+
+/* -----=====----- TREE WALKS -----=====----- */
+
+// Returns the number of nodes of a tree
+static int count_nodes(EXPR expr)
+{
+  EXPR_LIST arg;
+  int count = 1;
+
+  switch (expr->expr_tag)
+  {
+    case E_ASSIGN:
+    case E_ARITH:
+    case E_COMPR:
+      return count + count_nodes(expr->left) + count_nodes(expr->right);
+    case E_SIGN:
+    case E_UNFUNC:
+    case E_CAST:
+      return count + count_nodes(expr->right);
+    case E_ARRAY:
+      count += count_nodes(expr->right);
+      /* FALL THROUGH */
+    case E_FUNC:
+      for (arg = expr->u.var_func_array.arguments; arg != NULL && arg->base != NULL; arg = arg->next)
+        count += count_nodes(arg->base);
+      return count;
+    default:
+      return count;
+  }
+}
+
+// Tells whether a tree contains a call or an assignment
+static BOOLEAN has_effects(EXPR expr)
+{
+  EXPR_LIST arg;
+
+  switch (expr->expr_tag)
+  {
+    case E_ASSIGN:
+    case E_FUNC:
+      return TRUE;
+    case E_ARITH:
+    case E_COMPR:
+      return has_effects(expr->left) || has_effects(expr->right);
+    case E_SIGN:
+    case E_UNFUNC:
+    case E_CAST:
+      return has_effects(expr->right);
+    case E_ARRAY:
+      if (has_effects(expr->right))
+        return TRUE;
+      for (arg = expr->u.var_func_array.arguments; arg != NULL && arg->base != NULL; arg = arg->next)
+        if (has_effects(arg->base))
+          return TRUE;
+      return FALSE;
+    default:
+      return FALSE;
+  }
+}
+
+// Tells whether a tree contains a call
+static BOOLEAN has_call(EXPR expr)
+{
+  EXPR_LIST arg;
+
+  switch (expr->expr_tag)
+  {
+    case E_FUNC:
+      return TRUE;
+    case E_ASSIGN:
+    case E_ARITH:
+    case E_COMPR:
+      return has_call(expr->left) || has_call(expr->right);
+    case E_SIGN:
+    case E_UNFUNC:
+    case E_CAST:
+      return has_call(expr->right);
+    case E_ARRAY:
+      if (has_call(expr->right))
+        return TRUE;
+      for (arg = expr->u.var_func_array.arguments; arg != NULL && arg->base != NULL; arg = arg->next)
+        if (has_call(arg->base))
+          return TRUE;
+      return FALSE;
+    default:
+      return FALSE;
+  }
+}
+
+// Returns the number of uses of the identifier id in a tree
+static int count_uses(EXPR expr, ST_ID id)
+{
+  EXPR_LIST arg;
+  int count = 0;
+
+  switch (expr->expr_tag)
+  {
+    case E_VAR:
+      return expr->u.var_func_array.var_id == id;
+    case E_ASSIGN:
+    case E_ARITH:
+    case E_COMPR:
+      return count_uses(expr->left, id) + count_uses(expr->right, id);
+    case E_SIGN:
+    case E_UNFUNC:
+    case E_CAST:
+      return count_uses(expr->right, id);
+    case E_ARRAY:
+      count = count_uses(expr->right, id);
+      /* FALL THROUGH */
+    case E_FUNC:
+      for (arg = expr->u.var_func_array.arguments; arg != NULL && arg->base != NULL; arg = arg->next)
+        count += count_uses(arg->base, id);
+      return count;
+    default:
+      return 0;
+  }
+}
+
+// Returns the variable an l-value expression is part of
+static EXPR root_variable(EXPR expr)
+{
+  while (expr->expr_tag == E_ARRAY)
+    expr = expr->right;
+  return expr;
+}
+
+static BOOLEAN assigns(EXPR expr, ST_ID id);
+
+// Tells whether a call passes the variable id to a var parameter, or
+// assigns to it in an argument
+static BOOLEAN passes_by_ref(EXPR call, ST_ID id)
+{
+  int block, num_args = 0, i;
+  ST_DR func_rec = st_lookup(call->u.var_func_array.var_id, &block);
+  PARAM_LIST params, param;
+  BOOLEAN check_args;
+  EXPR_LIST arg;
+
+  ty_query_func(func_rec->u.decl.type, &params, &check_args);
+  for (arg = call->u.var_func_array.arguments; arg != NULL && arg->base != NULL; arg = arg->next)
+    num_args++;
+
+  // The actual parameter list is built back to front
+  EXPR args[num_args + 1];
+  for (i = num_args - 1, arg = call->u.var_func_array.arguments; i >= 0; i--, arg = arg->next)
+    args[i] = arg->base;
+
+  for (i = 0, param = params; i < num_args; i++, param = param ? param->next : NULL)
+  {
+    if ((param == NULL || param->is_ref)
+        && (args[i]->expr_tag == E_VAR || args[i]->expr_tag == E_ARRAY)
+        && root_variable(args[i])->u.var_func_array.var_id == id)
+      return TRUE;
+    if (assigns(args[i], id))
+      return TRUE;
+  }
+  return FALSE;
+}
+
+// Tells whether a tree assigns to the identifier id, or passes it to a
+// var parameter
+static BOOLEAN assigns(EXPR expr, ST_ID id)
+{
+  EXPR_LIST arg;
+
+  switch (expr->expr_tag)
+  {
+    case E_ASSIGN:
+      if (expr->left->expr_tag != E_FUNC && root_variable(expr->left)->u.var_func_array.var_id == id)
+        return TRUE;
+      return assigns(expr->left, id) || assigns(expr->right, id);
+    case E_ARITH:
+    case E_COMPR:
+      return assigns(expr->left, id) || assigns(expr->right, id);
+    case E_SIGN:
+    case E_UNFUNC:
+    case E_CAST:
+      return assigns(expr->right, id);
+    case E_ARRAY:
+      if (assigns(expr->right, id))
+        return TRUE;
+      for (arg = expr->u.var_func_array.arguments; arg != NULL && arg->base != NULL; arg = arg->next)
+        if (assigns(arg->base, id))
+          return TRUE;
+      return FALSE;
+    case E_FUNC:
+      return passes_by_ref(expr, id);
+    default:
+      return FALSE;
+  }
+}
+
+// Adds the identifiers named in a tree to found_names, except for the
+// parameters of the current function.  Returns FALSE if it names anything
+// else that a body cannot: the function itself, or other identifiers of
+// the function's block.
+static BOOLEAN collect_names(EXPR expr, ST_ID func_id)
+{
+  EXPR_LIST arg;
+  ST_DR record;
+  int block;
+
+  switch (expr->expr_tag)
+  {
+    case E_VAR:
+    case E_FUNC:
+      if (expr->u.var_func_array.var_id == func_id)
+        return FALSE;
+      record = st_lookup(expr->u.var_func_array.var_id, &block);
+      if (record == NULL)
+        return FALSE;
+      if (block == st_get_cur_block())
+      {
+        if (record->tag != PDECL)
+          return FALSE;
+      }
+      else
+      {
+        if (num_found_names == found_names_size)
+        {
+          found_names_size = found_names_size ? 2 * found_names_size : 16;
+          found_names = (INLINE_NAME *) realloc(found_names, found_names_size * sizeof(INLINE_NAME));
+        }
+        found_names[num_found_names].id = expr->u.var_func_array.var_id;
+        found_names[num_found_names].record = record;
+        num_found_names++;
+      }
+      if (expr->expr_tag == E_VAR)
+        return TRUE;
+      for (arg = expr->u.var_func_array.arguments; arg != NULL && arg->base != NULL; arg = arg->next)
+        if (!collect_names(arg->base, func_id))
+          return FALSE;
+      return TRUE;
+    case E_ASSIGN:
+    case E_ARITH:
+    case E_COMPR:
+      return collect_names(expr->left, func_id) && collect_names(expr->right, func_id);
+    case E_SIGN:
+    case E_UNFUNC:
+    case E_CAST:
+      return collect_names(expr->right, func_id);
+    case E_ARRAY:
+      if (!collect_names(expr->right, func_id))
+        return FALSE;
+      for (arg = expr->u.var_func_array.arguments; arg != NULL && arg->base != NULL; arg = arg->next)
+        if (!collect_names(arg->base, func_id))
+          return FALSE;
+      return TRUE;
+    case E_INTCONST:
+    case E_REALCONST:
+    case E_CHARCONST:
+    case E_BOOLCONST:
+      return TRUE;
+    default:
+      return FALSE;
+  }
+}
+
+/* -----=====----- KEEPING BODIES -----=====----- */
+
+void inline_begin_body()
+{
+  keeping = opt_inline && function_level() == 1;
+  cur_num_stmts = 0;
+  cur_nodes = 0;
+  cur_end = ir_code_mark();
+}
+
+void inline_note_statement(EXPR stmt, int start, int end)
+{
+  if (!keeping)
+    return;
+
+  // Anything else in between is a statement that cannot be kept
+  cur_nodes += count_nodes(stmt);
+  if (stmt->expr_typetag == TYERROR || !ir_code_is_empty(cur_end, start)
+      || cur_nodes > opt_inline_limit)
+  {
+    keeping = FALSE;
+    return;
+  }
+
+  if (cur_num_stmts == cur_stmts_size)
+  {
+    cur_stmts_size = cur_stmts_size ? 2 * cur_stmts_size : 16;
+    cur_stmts = (EXPR *) realloc(cur_stmts, cur_stmts_size * sizeof(EXPR));
+  }
+  cur_stmts[cur_num_stmts++] = stmt;
+  cur_end = end;
+}
+
+void inline_end_body(ST_ID func_id)
+{
+  if (!keeping)
+    return;
+  keeping = FALSE;
+  if (!ir_code_is_empty(cur_end, ir_code_mark()))
+    return;
+
+  int block;
+  ST_DR func_rec = st_lookup(func_id, &block);
+  PARAM_LIST params;
+  BOOLEAN check_args;
+  TYPE return_type = ty_query_func(func_rec->u.decl.type, &params, &check_args);
+  BOOLEAN is_function = ty_query(return_type) != TYVOID;
+  int num_effects = cur_num_stmts;
+  int i;
+
+  // A function ends by setting its result, and the other statements are
+  // assignments and procedure calls
+  if (is_function)
+  {
+    EXPR last = cur_num_stmts > 0 ? cur_stmts[cur_num_stmts - 1] : NULL;
+    if (last == NULL || last->expr_tag != E_ASSIGN || last->left->expr_tag != E_FUNC
+        || last->left->u.var_func_array.var_id != func_id)
+      return;
+    num_effects--;
+  }
+
+  num_found_names = 0;
+  for (i = 0; i < num_effects; i++)
+  {
+    if (cur_stmts[i]->expr_tag == E_FUNC && cur_stmts[i]->expr_typetag != TYVOID)
+      return;
+    if (!collect_names(cur_stmts[i], func_id))
+      return;
+  }
+  if (is_function && !collect_names(cur_stmts[num_effects]->right, func_id))
+    return;
+
+  INLINE_BODY *body = (INLINE_BODY *) malloc(sizeof(INLINE_BODY));
+  body->func_rec = func_rec;
+  body->func_id = func_id;
+  body->params = params;
+  body->is_function = is_function;
+  body->num_stmts = cur_num_stmts;
+  body->stmts = (EXPR *) malloc(cur_num_stmts * sizeof(EXPR) + 1);
+  memcpy(body->stmts, cur_stmts, cur_num_stmts * sizeof(EXPR));
+  body->num_names = num_found_names;
+  body->names = (INLINE_NAME *) malloc(num_found_names * sizeof(INLINE_NAME) + 1);
+  memcpy(body->names, found_names, num_found_names * sizeof(INLINE_NAME));
+  body->expanding = FALSE;
+  body->next = bodies;
+  bodies = body;
+}
+
+/* -----=====----- EXPANDING CALLS -----=====----- */
+
+// Returns the number of arguments of a call
+static int count_args(EXPR call)
+{
+  EXPR_LIST arg;
+  int count = 0;
+
+  for (arg = call->u.var_func_array.arguments; arg != NULL && arg->base != NULL; arg = arg->next)
+    count++;
+  return count;
+}
+
+// Tell whether statement i of a body may change a variable, and whether
+// it makes a call.  Setting a function's result does not count.
+static BOOLEAN stmt_has_effects(INLINE_BODY *body, int i)
+{
+  if (body->is_function && i == body->num_stmts - 1)
+    return has_call(body->stmts[i]->right);
+  return has_effects(body->stmts[i]);
+}
+
+static BOOLEAN stmt_has_call(INLINE_BODY *body, int i)
+{
+  if (body->is_function && i == body->num_stmts - 1)
+    return has_call(body->stmts[i]->right);
+  return has_call(body->stmts[i]);
+}
+
+// Tells whether an argument is a constant
+static BOOLEAN is_constant_arg(EXPR expr)
+{
+  while (expr->expr_tag == E_CAST && expr->u.cast_tag != CT_LDEREF)
+    expr = expr->right;
+  return expr->expr_tag == E_INTCONST || expr->expr_tag == E_REALCONST
+    || expr->expr_tag == E_CHARCONST || expr->expr_tag == E_BOOLCONST;
+}
+
+// Finds the body of the function called, and binds each of its parameters
+// to what stands for it in bindings (see the top of the file).  Returns
+// NULL if the call cannot be expanded.
+static INLINE_BODY *bind_call(EXPR call, EXPR bindings[])
+{
+  INLINE_BODY *body;
+  int block, i;
+
+  if (call->expr_typetag == TYERROR)
+    return NULL;
+  ST_DR func_rec = st_lookup(call->u.var_func_array.var_id, &block);
+  for (body = bodies; body != NULL; body = body->next)
+    if (body->func_rec == func_rec)
+      break;
+  if (body == NULL || body->expanding)
+    return NULL;
+
+  for (i = 0; i < body->num_names; i++)
+    if (st_lookup(body->names[i].id, &block) != body->names[i].record)
+      return NULL;
+
+  // The actual parameter list is built back to front
+  int num_args = count_args(call);
+  EXPR_LIST arguments;
+  PARAM_LIST param;
+  int num_params = 0;
+  for (param = body->params; param != NULL; param = param->next)
+    num_params++;
+  if (num_args != num_params)
+    return NULL;
+
+  EXPR args[num_args];
+  arguments = call->u.var_func_array.arguments;
+  for (i = num_args - 1; i >= 0; i--)
+  {
+    args[i] = arguments->base;
+    arguments = arguments->next;
+  }
+
+  // Values may be used up to the first statement that may change a
+  // variable, and in that one too if it is an assignment without calls,
+  // which stores last
+  int safe_end = 0;
+  while (safe_end < body->num_stmts && !stmt_has_effects(body, safe_end))
+    safe_end++;
+  if (safe_end < body->num_stmts && !stmt_has_call(body, safe_end))
+    safe_end++;
+
+  param = body->params;
+  for (i = 0; i < num_args; i++, param = param->next)
+  {
+    EXPR arg = args[i];
+    ST_ID unresolved;
+    int uses = 0, last_use = -1, j;
+
+    if (param->is_ref)
+    {
+      if (arg->expr_tag != E_VAR
+          || arg->expr_typetag != ty_query(ty_query_ptr(param->type, &unresolved)))
+        return NULL;
+      bindings[i] = arg;
+      continue;
+    }
+
+    for (j = 0; j < body->num_stmts; j++)
+    {
+      if (assigns(body->stmts[j], param->id))
+        return NULL;
+      if (count_uses(body->stmts[j], param->id) > 0)
+      {
+        uses += count_uses(body->stmts[j], param->id);
+        last_use = j;
+      }
+    }
+    if (has_effects(arg))
+      return NULL;
+
+    BOOLEAN is_lvalue = arg->expr_tag == E_VAR || arg->expr_tag == E_ARRAY;
+    TYPETAG param_type = ty_query(param->type);
+    EXPR value = arg;
+    if (arg->expr_typetag != param_type)
+    {
+      if ((arg->expr_typetag != TYINTEGER && arg->expr_typetag != TYSINGLE
+           && arg->expr_typetag != TYREAL)
+          || (param_type != TYSINGLE && param_type != TYREAL))
+        return NULL;
+      value = new_expr_cast(get_cast_constant(arg->expr_typetag, param_type),
+                            is_lvalue ? new_expr_cast(CT_LDEREF, arg) : arg);
+      is_lvalue = FALSE;
+    }
+
+    if (!is_constant_arg(value))
+    {
+      if (last_use >= safe_end)
+        return NULL;
+      if (!is_lvalue && uses > 1)
+        return NULL;
+    }
+    bindings[i] = value;
+  }
+
+  if (body->is_function && body->stmts[body->num_stmts - 1]->right->expr_typetag != call->expr_typetag)
+    return NULL;
+  return body;
+}
+
+// Returns the parameter of a body that id names, or -1
+static int param_index(INLINE_BODY *body, ST_ID id)
+{
+  PARAM_LIST param;
+  int i = 0;
+
+  for (param = body->params; param != NULL; param = param->next, i++)
+    if (param->id == id)
+      return i;
+  return -1;
+}
+
+static EXPR copy_node(EXPR expr)
+{
+  EXPR copy = (EXPR) malloc(sizeof(expression));
+  memcpy(copy, expr, sizeof(expression));
+  return copy;
+}
+
+// Returns a copy of a tree of the body with its parameters replaced by
+// their bindings, simplified again now that they are known
+static EXPR substitute(EXPR expr, INLINE_BODY *body, EXPR bindings[])
+{
+  EXPR copy;
+  EXPR_LIST arg, *tail;
+  int i;
+
+  switch (expr->expr_tag)
+  {
+    case E_VAR:
+      i = param_index(body, expr->u.var_func_array.var_id);
+      return i < 0 ? expr : bindings[i];
+    case E_CAST:
+      // A value that is not a variable needs no dereferencing
+      if (expr->u.cast_tag == CT_LDEREF && expr->right->expr_tag == E_VAR
+          && (i = param_index(body, expr->right->u.var_func_array.var_id)) >= 0
+          && bindings[i]->expr_tag != E_VAR && bindings[i]->expr_tag != E_ARRAY)
+        return bindings[i];
+      /* FALL THROUGH */
+    case E_SIGN:
+    case E_UNFUNC:
+      copy = copy_node(expr);
+      copy->right = substitute(expr->right, body, bindings);
+      return simplify_expr(copy);
+    case E_ASSIGN:
+    case E_ARITH:
+    case E_COMPR:
+      copy = copy_node(expr);
+      copy->left = substitute(expr->left, body, bindings);
+      copy->right = substitute(expr->right, body, bindings);
+      return simplify_expr(copy);
+    case E_ARRAY:
+    case E_FUNC:
+      copy = copy_node(expr);
+      if (expr->expr_tag == E_ARRAY)
+        copy->right = substitute(expr->right, body, bindings);
+      tail = &copy->u.var_func_array.arguments;
+      for (arg = expr->u.var_func_array.arguments; arg != NULL; arg = arg->next)
+      {
+        *tail = (EXPR_LIST) malloc(sizeof(expr_list_node));
+        (*tail)->base = arg->base ? substitute(arg->base, body, bindings) : NULL;
+        tail = &(*tail)->next;
+      }
+      *tail = NULL;
+      return copy;
+    default:
+      return expr;
+  }
+}
+
+BOOLEAN inline_possible(EXPR call)
+{
+  EXPR bindings[count_args(call) + 1];
+  return opt_inline && bind_call(call, bindings) != NULL;
+}
+
+BOOLEAN inline_call(EXPR call)
+{
+  EXPR bindings[count_args(call) + 1];
+  INLINE_BODY *body;
+  int i;
+
+  if (!opt_inline || (body = bind_call(call, bindings)) == NULL)
+    return FALSE;
+
+  body->expanding = TRUE;
+  for (i = 0; i < body->num_stmts; i++)
+  {
+    if (body->is_function && i == body->num_stmts - 1)
+      encode_expression(substitute(body->stmts[i]->right, body, bindings));
+    else
+      encode_expression(substitute(body->stmts[i], body, bindings));
+  }
+  body->expanding = FALSE;
+  return TRUE;
+}
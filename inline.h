@@ -0,0 +1,29 @@
+#ifndef INLINE_H
+#define INLINE_H
+
+#include "defs.h"
+#include "expr.h"
+#include "symtab.h"
+
+// Inline expansion of calls (enabled by -finline).  While the body of a
+// function declared at the global level is compiled, each assignment or
+// call statement is passed to inline_note_statement with the code marks
+// (ir_code_mark) before and after its code; inline_begin_body is called
+// before the first and inline_end_body after the last.  If the body is
+// nothing but those statements, and small enough, their trees are kept,
+// and inline_call then expands calls of the function in place.
+
+void inline_begin_body();
+void inline_note_statement(EXPR stmt, int start, int end);
+void inline_end_body(ST_ID func_id);
+
+// Tells whether the call can be expanded in place
+BOOLEAN inline_possible(EXPR call);
+
+// Encodes the body of the function called instead of the call, with its
+// parameters bound to the arguments, and returns TRUE; returns FALSE,
+// encoding nothing, if the call cannot be expanded.  The value of a
+// function is left on the stack, as a call would leave it.
+BOOLEAN inline_call(EXPR call);
+
+#endif
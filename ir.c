@@ -0,0 +1,1604 @@
+/****************************************************************/
+/*								*/
+/*	CSCE531 - "Pascal" Compiler				*/
+/*								*/
+/*	--ir.c--						*/
+/*								*/
+/*	Building, checking and printing the SSA intermediate	*/
+/*	representation (see ir.h).				*/
+/*								*/
+/****************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ir.h"
+#include "options.h"
+#include "message.h"
+
+/* The body being built, and whether it is */
+static IR_FUNC func;
+static BOOLEAN building = FALSE;
+
+/* Every instruction of the body by id, and every block, placed or not */
+static IR_INSN **insns = NULL;
+static int insns_size = 0;
+static IR_BLOCK **blocks = NULL;
+static int nblocks = 0, blocks_size = 0;
+
+/* The block being added to.  The next instruction goes into it if it is
+   OPEN; after a conditional jump (BRANCHED) it goes into a new block that
+   this one falls into, and after an unconditional one (ENDED) into a new
+   dead block. */
+static IR_BLOCK *cur;
+static enum { OPEN, BRANCHED, ENDED } cur_state;
+
+/* The operand stack at the end of the code so far, top last */
+static IR_VALUE *stk = NULL;
+static int depth = 0, stk_size = 0;
+
+/* The block of each label named so far, hashed by name */
+#define LABEL_HASH_SIZE 509
+
+typedef struct label_ent {
+    IR_BLOCK *block;
+    struct label_ent *next;
+} LABEL_ENT;
+
+static LABEL_ENT *labels[LABEL_HASH_SIZE];
+
+
+static void *ir_alloc (size_t size)
+{
+    void *ret = calloc(1, size);
+
+    if (ret == NULL)
+	bug("ir: out of memory");
+    return ret;
+}
+
+/* Makes room for one more element in the array *a of *size elements of
+   elsize bytes, n of which are in use */
+static void grow (void *a, int n, int *size, size_t elsize)
+{
+    void **p = (void **) a;
+
+    if (n < *size)
+	return;
+    *size = *size ? 2 * *size : 8;
+    *p = realloc(*p, *size * elsize);
+    if (*p == NULL)
+	bug("ir: out of memory");
+}
+
+
+/* Names for ir_dump */
+
+static char *op_names[] = {
+    "const", "const", "addr", "addr", "addr", "load", "convert", "neg",
+    "incdec", "store", "arith", "arith", "ptrarith", "check", "dup", "phi",
+    "call", "undef", "drop", "setreturn", "args", "arg", "arg", "line",
+    "jump", "branch", "branch", "branch", "dispatch", "dispatch",
+    "jumptable", "tailself", "tailcall"
+};
+
+static char *arop_names[] = {
+    "add", "sub", "mul", "div", "mod", "lt", "le", "gt", "ge", "eq", "ne"
+};
+
+static char *idop_names[] = { "preinc", "postinc", "predec", "postdec" };
+
+static char *type_names[] = {
+    "void", "float", "double", "ldouble", "long", "short", "int", "ulong",
+    "ushort", "uint", "uchar", "schar", "struct", "union", "enum", "array",
+    "set", "func", "ptr", "bitfield", "subrange", "error"
+};
+
+
+/* Instructions and blocks */
+
+BOOLEAN ir_has_value (IR_INSN *insn)
+{
+    return insn->op <= IR_UNDEF && (insn->op != IR_CALL || insn->type != TYVOID);
+}
+
+
+BOOLEAN ir_is_terminator (IR_INSN *insn)
+{
+    return insn->op >= IR_JUMP;
+}
+
+
+BOOLEAN ir_has_side_effect (IR_INSN *insn)
+{
+    switch (insn->op) {
+    case IR_INC_DEC:
+    case IR_STORE:
+    case IR_CHECK_INDEX:
+    case IR_CALL:
+    case IR_DROP:
+    case IR_SET_RETURN:
+    case IR_ARGS:
+    case IR_ARG:
+    case IR_ARG_IMM:
+    case IR_LINE:
+	return TRUE;
+    default:
+	return ir_is_terminator(insn);
+    }
+}
+
+
+int ir_stack_pops (IR_INSN *insn)
+{
+    switch (insn->op) {
+    case IR_DUP:
+    case IR_PHI:
+    case IR_DISPATCH:
+    case IR_DISPATCH_BITS:
+	return 0;
+    default:
+	return insn->nargs;
+    }
+}
+
+
+static IR_INSN *new_insn (IR_OP op, TYPETAG type, int nargs)
+{
+    IR_INSN *insn = (IR_INSN *) ir_alloc(sizeof(IR_INSN));
+
+    insn->op = op;
+    insn->type = insn->optype = type;
+    insn->nargs = nargs;
+    if (nargs > 0)
+	insn->args = (IR_VALUE *) ir_alloc(nargs * sizeof(IR_VALUE));
+    insn->id = func.ninsns;
+    grow(&insns, func.ninsns, &insns_size, sizeof(IR_INSN *));
+    insns[func.ninsns++] = insn;
+    return insn;
+}
+
+
+/* Adds insn at the end of block b */
+static void append_insn (IR_BLOCK *b, IR_INSN *insn)
+{
+    insn->block = b;
+    insn->prev = b->last;
+    insn->next = NULL;
+    if (b->last != NULL)
+	b->last->next = insn;
+    else
+	b->first = insn;
+    b->last = insn;
+}
+
+
+/* Takes insn out of its block's list */
+static void unlink_insn (IR_INSN *insn)
+{
+    IR_BLOCK *b = insn->block;
+
+    if (insn->prev != NULL)
+	insn->prev->next = insn->next;
+    else
+	b->first = insn->next;
+    if (insn->next != NULL)
+	insn->next->prev = insn->prev;
+    else
+	b->last = insn->prev;
+    insn->prev = insn->next = NULL;
+}
+
+
+void ir_delete_insn (IR_INSN *insn)
+{
+    unlink_insn(insn);
+    insn->deleted = TRUE;
+}
+
+
+IR_INSN *ir_new_insn (IR_OP op, TYPETAG type, int nargs)
+{
+    return new_insn(op, type, nargs);
+}
+
+
+IR_INSN *ir_copy_insn (IR_INSN *insn)
+{
+    IR_INSN *copy = new_insn(insn->op, insn->type, insn->nargs);
+    int i;
+
+    copy->optype = insn->optype;
+    for (i = 0; i < insn->nargs; i++)
+	copy->args[i] = insn->args[i];
+    copy->imm = insn->imm;
+    copy->real = insn->real;
+    copy->name = insn->name;
+    copy->level = insn->level;
+    copy->mask = insn->mask;
+    copy->arop = insn->arop;
+    copy->idop = insn->idop;
+    copy->cond = insn->cond;
+    return copy;
+}
+
+
+void ir_move_insn (IR_INSN *insn, IR_BLOCK *b)
+{
+    IR_INSN *end = b->last;
+
+    if (end != NULL && ir_is_terminator(end)) {
+	ir_insert_before(insn, end);
+	return;
+    }
+    if (insn->block != NULL)
+	unlink_insn(insn);
+    append_insn(b, insn);
+}
+
+
+void ir_insert_before (IR_INSN *insn, IR_INSN *before)
+{
+    IR_BLOCK *b = before->block;
+
+    if (insn->block != NULL)
+	unlink_insn(insn);
+    insn->block = b;
+    insn->next = before;
+    insn->prev = before->prev;
+    if (before->prev != NULL)
+	before->prev->next = insn;
+    else
+	b->first = insn;
+    before->prev = insn;
+}
+
+
+static IR_BLOCK *new_block (void)
+{
+    IR_BLOCK *b = (IR_BLOCK *) ir_alloc(sizeof(IR_BLOCK));
+
+    b->nstack = -1;
+    grow(&blocks, nblocks, &blocks_size, sizeof(IR_BLOCK *));
+    blocks[nblocks++] = b;
+    return b;
+}
+
+
+/* Adds b at the end of the layout */
+static void place (IR_BLOCK *b)
+{
+    b->placed = TRUE;
+    b->index = func.nblocks++;
+    b->prev = func.last;
+    if (func.last != NULL)
+	func.last->next = b;
+    else
+	func.first = b;
+    func.last = b;
+}
+
+
+/* Returns the block of the given label, making it if it is new */
+static IR_BLOCK *label_block (char *label)
+{
+    unsigned int h = 0;
+    char *s;
+    LABEL_ENT *ent;
+
+    for (s = label; *s != '\0'; s++)
+	h = 31 * h + (unsigned char) *s;
+    h %= LABEL_HASH_SIZE;
+    for (ent = labels[h]; ent != NULL; ent = ent->next)
+	if (!strcmp(ent->block->label, label))
+	    return ent->block;
+
+    ent = (LABEL_ENT *) ir_alloc(sizeof(LABEL_ENT));
+    ent->block = new_block();
+    ent->block->label = label;
+    ent->next = labels[h];
+    labels[h] = ent;
+    return ent->block;
+}
+
+
+/* Sets the operand stack on entry to b to the n values in vals */
+static void set_entry (IR_BLOCK *b, IR_VALUE vals[], int n)
+{
+    b->nstack = n;
+    b->stack = (IR_VALUE *) ir_alloc((n + 1) * sizeof(IR_VALUE));
+    memcpy(b->stack, vals, n * sizeof(IR_VALUE));
+}
+
+
+/* Gives b, which has no code yet, a phi for each of n operands on entry,
+   of the types of the values in vals */
+static void make_phis (IR_BLOCK *b, IR_VALUE vals[], int n)
+{
+    int i;
+
+    set_entry(b, vals, n);
+    for (i = 0; i < n; i++) {
+	IR_INSN *phi = new_insn(IR_PHI, vals[i]->type, 0);
+
+	append_insn(b, phi);
+	b->stack[i] = phi;
+    }
+}
+
+
+/* Appends arg to the operands of a phi */
+static void add_phi_arg (IR_INSN *phi, IR_VALUE arg)
+{
+    phi->args = (IR_VALUE *) realloc(phi->args,
+				     (phi->nargs + 1) * sizeof(IR_VALUE));
+    if (phi->args == NULL)
+	bug("ir: out of memory");
+    phi->args[phi->nargs++] = arg;
+}
+
+
+/* Records that from reaches to with the n values in vals on the operand
+   stack */
+static void add_edge (IR_BLOCK *from, IR_BLOCK *to, IR_VALUE vals[], int n)
+{
+    int i;
+
+    if (from->dead)
+	return;
+    if (to->nstack < 0)
+	make_phis(to, vals, n);
+    else if (to->nstack != n) {
+	if (compiler_errors == 0)
+	    bug("ir: %d operands on the stack for %s, which has %d",
+		n, to->label ? to->label : "a block", to->nstack);
+	return;
+    }
+    for (i = 0; i < from->nsuccs; i++)
+	if (from->succs[i] == to)
+	    return;
+
+    grow(&from->succs, from->nsuccs, &from->succs_size, sizeof(IR_BLOCK *));
+    from->succs[from->nsuccs++] = to;
+    grow(&to->preds, to->npreds, &to->preds_size, sizeof(IR_BLOCK *));
+    to->preds[to->npreds++] = from;
+    for (i = 0; i < n; i++)
+	if (to->stack[i]->op == IR_PHI && to->stack[i]->block == to)
+	    add_phi_arg(to->stack[i], vals[i]);
+}
+
+
+void ir_remove_edge (IR_BLOCK *from, IR_BLOCK *to)
+{
+    IR_INSN *phi;
+    int i, j;
+
+    for (i = 0; i < from->nsuccs && from->succs[i] != to; i++)
+	;
+    if (i == from->nsuccs)
+	bug("ir: no edge to remove");
+    for (; i + 1 < from->nsuccs; i++)
+	from->succs[i] = from->succs[i + 1];
+    from->nsuccs--;
+    if (from->fall == to)
+	from->fall = NULL;
+
+    for (i = 0; to->preds[i] != from; i++)
+	;
+    for (j = i; j + 1 < to->npreds; j++)
+	to->preds[j] = to->preds[j + 1];
+    to->npreds--;
+    for (phi = to->first; phi != NULL && phi->op == IR_PHI; phi = phi->next) {
+	for (j = i; j + 1 < phi->nargs; j++)
+	    phi->args[j] = phi->args[j + 1];
+	phi->nargs--;
+    }
+}
+
+
+/* The operand stack */
+
+static void push_value (IR_VALUE v)
+{
+    grow(&stk, depth, &stk_size, sizeof(IR_VALUE));
+    stk[depth++] = v;
+}
+
+
+/* Pops the top operand.  Only an erroneous program can run out of them,
+   and then it gets an undefined value. */
+static IR_VALUE pop_value (void)
+{
+    if (depth == 0) {
+	if (compiler_errors == 0)
+	    bug("ir: operand stack underflow");
+	return new_insn(IR_UNDEF, TYSIGNEDLONGINT, 0);
+    }
+    return stk[--depth];
+}
+
+
+static IR_VALUE top_value (void)
+{
+    if (depth == 0) {
+	push_value(pop_value());
+    }
+    return stk[depth - 1];
+}
+
+
+/* Sets the operand stack to what it is at the end of block b */
+static void simulate_block (IR_BLOCK *b)
+{
+    IR_INSN *insn;
+    int i;
+
+    depth = 0;
+    for (i = 0; i < b->nstack; i++)
+	push_value(b->stack[i]);
+    for (insn = b->first; insn != NULL; insn = insn->next) {
+	if (insn->op == IR_PHI)
+	    continue;
+	for (i = ir_stack_pops(insn); i > 0 && depth > 0; i--)
+	    depth--;
+	if (ir_has_value(insn))
+	    push_value(insn);
+    }
+}
+
+
+/* Adding code */
+
+/* Makes cur a block that the next instruction can go into */
+static void open_block (void)
+{
+    IR_BLOCK *b;
+
+    if (cur_state == OPEN)
+	return;
+    b = new_block();
+    set_entry(b, stk, depth);
+    if (cur_state == BRANCHED) {
+	add_edge(cur, b, stk, depth);
+	cur->fall = b;
+    }
+    else
+	b->dead = TRUE;
+    place(b);
+    cur = b;
+    cur_state = OPEN;
+}
+
+
+/* Adds an instruction with nargs operands, to be filled in, to the
+   current block */
+static IR_INSN *add_insn (IR_OP op, TYPETAG type, int nargs)
+{
+    IR_INSN *insn;
+
+    open_block();
+    insn = new_insn(op, type, nargs);
+    append_insn(cur, insn);
+    return insn;
+}
+
+
+/* Adds an instruction that pops nargs operands, the last on top */
+static IR_INSN *add_popping (IR_OP op, TYPETAG type, int nargs)
+{
+    IR_INSN *insn = add_insn(op, type, nargs);
+    int i;
+
+    for (i = nargs - 1; i >= 0; i--)
+	insn->args[i] = pop_value();
+    return insn;
+}
+
+
+/* Ends the current block with the jump insn to the given labels, the
+   operand stack being what it is, less the top operand if pop is set.
+   state is BRANCHED if the jump is conditional. */
+static void end_block (IR_INSN *insn, int ntargets, char *targets[],
+		       BOOLEAN pop, int state)
+{
+    int i;
+
+    insn->ntargets = ntargets;
+    insn->targets = (IR_BLOCK **) ir_alloc(ntargets * sizeof(IR_BLOCK *));
+    for (i = 0; i < ntargets; i++) {
+	insn->targets[i] = label_block(targets[i]);
+	add_edge(cur, insn->targets[i], stk, pop && depth > 0 ? depth - 1 : depth);
+    }
+    cur_state = state;
+}
+
+
+/* Starts the block of a label.  If it is a case arm, dispatch is the
+   label of its dispatch, which pops one operand before jumping to it. */
+static void start_label (char *label, char *dispatch)
+{
+    IR_BLOCK *b = label_block(label);
+
+    if (b->placed) {
+	if (compiler_errors == 0)
+	    bug("ir: label %s placed twice", label);
+	return;
+    }
+    if (cur_state != ENDED) {
+	add_edge(cur, b, stk, depth);
+	cur->fall = b;
+    }
+    if (b->nstack < 0) {
+	IR_BLOCK *d = dispatch ? label_block(dispatch) : NULL;
+
+	if (d != NULL && d->nstack > 0)
+	    make_phis(b, d->stack, d->nstack - 1);
+	else
+	    make_phis(b, stk, depth);
+    }
+    b->dispatch_label = dispatch;
+    place(b);
+    cur = b;
+    cur_state = OPEN;
+    simulate_block(b);
+}
+
+
+void ir_begin_function (char *name)
+{
+    int i;
+
+    memset(&func, 0, sizeof(func));
+    func.name = name;
+    nblocks = 0;
+    for (i = 0; i < LABEL_HASH_SIZE; i++)
+	labels[i] = NULL;
+    cur = new_block();
+    set_entry(cur, NULL, 0);
+    place(cur);
+    cur_state = OPEN;
+    depth = 0;
+    building = TRUE;
+}
+
+
+void ir_param (int offset)
+{
+    if (!building)
+	return;
+    grow(&func.params, func.nparams, &func.params_size, sizeof(int));
+    func.params[func.nparams++] = offset;
+}
+
+
+void ir_share_frame (void)
+{
+    func.shared_frame = TRUE;
+}
+
+
+BOOLEAN ir_building (void)
+{
+    return building;
+}
+
+
+IR_FUNC *ir_function (void)
+{
+    return &func;
+}
+
+
+/* The stand-ins for the back end */
+
+void ir_pop (void)
+{
+    IR_INSN *insn;
+
+    if (!building) {
+	b_pop();
+	return;
+    }
+    insn = add_popping(IR_DROP, TYVOID, 1);
+    insn->optype = insn->args[0]->type;
+}
+
+
+void ir_duplicate (TYPETAG type)
+{
+    IR_INSN *insn;
+
+    if (!building) {
+	b_duplicate(type);
+	return;
+    }
+    insn = add_insn(IR_DUP, type, 1);
+    insn->args[0] = top_value();
+    push_value(insn);
+}
+
+
+void ir_push_ext_addr (char *id)
+{
+    IR_INSN *insn;
+
+    if (!building) {
+	b_push_ext_addr(id);
+	return;
+    }
+    insn = add_insn(IR_GLOBAL_ADDR, TYPTR, 0);
+    insn->name = id;
+    push_value(insn);
+}
+
+
+void ir_push_loc_addr (int offset)
+{
+    IR_INSN *insn;
+
+    if (!building) {
+	b_push_loc_addr(offset);
+	return;
+    }
+    insn = add_insn(IR_LOCAL_ADDR, TYPTR, 0);
+    insn->imm = offset;
+    push_value(insn);
+}
+
+
+void ir_push_display_addr (int level, int offset)
+{
+    IR_INSN *insn;
+
+    if (!building) {
+	b_push_display_addr(level, offset);
+	return;
+    }
+    insn = add_insn(IR_DISPLAY_ADDR, TYPTR, 0);
+    insn->level = level;
+    insn->imm = offset;
+    push_value(insn);
+}
+
+
+void ir_push_const_int (long value)
+{
+    IR_INSN *insn;
+
+    if (!building) {
+	b_push_const_int(value);
+	return;
+    }
+    insn = add_insn(IR_CONST_INT, TYSIGNEDLONGINT, 0);
+    insn->imm = value;
+    push_value(insn);
+}
+
+
+void ir_push_const_double (double value)
+{
+    IR_INSN *insn;
+
+    if (!building) {
+	b_push_const_double(value);
+	return;
+    }
+    insn = add_insn(IR_CONST_REAL, TYDOUBLE, 0);
+    insn->real = value;
+    push_value(insn);
+}
+
+
+void ir_deref (TYPETAG type)
+{
+    IR_INSN *insn;
+
+    if (!building) {
+	b_deref(type);
+	return;
+    }
+    insn = add_popping(IR_LOAD, type, 1);
+    push_value(insn);
+}
+
+
+void ir_convert (TYPETAG from_type, TYPETAG to_type)
+{
+    IR_INSN *insn;
+
+    if (!building) {
+	b_convert(from_type, to_type);
+	return;
+    }
+    insn = add_popping(IR_CONVERT, to_type, 1);
+    insn->optype = from_type;
+    push_value(insn);
+}
+
+
+void ir_negate (TYPETAG type)
+{
+    IR_INSN *insn;
+
+    if (!building) {
+	b_negate(type);
+	return;
+    }
+    insn = add_popping(IR_NEGATE, type, 1);
+    push_value(insn);
+}
+
+
+void ir_inc_dec (TYPETAG type, B_INC_DEC_OP idop, unsigned int size)
+{
+    IR_INSN *insn;
+
+    if (!building) {
+	b_inc_dec(type, idop, size);
+	return;
+    }
+    insn = add_popping(IR_INC_DEC, type, 1);
+    insn->idop = idop;
+    insn->imm = size;
+    push_value(insn);
+}
+
+
+void ir_assign (TYPETAG type)
+{
+    IR_INSN *insn;
+
+    if (!building) {
+	b_assign(type);
+	return;
+    }
+    insn = add_popping(IR_STORE, type, 2);
+    push_value(insn);
+}
+
+
+/* The type of the value of arop applied to operands of the given type */
+static TYPETAG arith_type (B_ARITH_REL_OP arop, TYPETAG type)
+{
+    return arop >= B_LT ? TYSIGNEDLONGINT : type;
+}
+
+
+void ir_arith_rel_op (B_ARITH_REL_OP arop, TYPETAG type)
+{
+    IR_INSN *insn;
+
+    if (!building) {
+	b_arith_rel_op(arop, type);
+	return;
+    }
+    insn = add_popping(IR_ARITH, arith_type(arop, type), 2);
+    insn->optype = type;
+    insn->arop = arop;
+    push_value(insn);
+}
+
+
+void ir_arith_rel_op_const (B_ARITH_REL_OP arop, TYPETAG type, long value)
+{
+    IR_INSN *insn;
+
+    if (!building) {
+	b_arith_rel_op_const(arop, type, value);
+	return;
+    }
+    insn = add_popping(IR_ARITH_IMM, arith_type(arop, type), 1);
+    insn->optype = type;
+    insn->arop = arop;
+    insn->imm = value;
+    push_value(insn);
+}
+
+
+void ir_ptr_arith_op (B_ARITH_REL_OP arop, TYPETAG type, unsigned int size)
+{
+    IR_INSN *insn;
+
+    if (!building) {
+	b_ptr_arith_op(arop, type, size);
+	return;
+    }
+    insn = add_popping(IR_PTR_ARITH, TYPTR, 2);
+    insn->optype = type;
+    insn->arop = arop;
+    insn->imm = size;
+    push_value(insn);
+}
+
+
+void ir_check_index (TYPETAG type, int n)
+{
+    IR_INSN *insn;
+
+    if (!building) {
+	b_check_index(type, n);
+	return;
+    }
+    insn = add_popping(IR_CHECK_INDEX, type, 1);
+    insn->imm = n;
+    push_value(insn);
+}
+
+
+void ir_set_return (TYPETAG type)
+{
+    if (!building) {
+	b_set_return(type);
+	return;
+    }
+    add_popping(IR_SET_RETURN, type, 1);
+}
+
+
+void ir_alloc_arglist (int total_size)
+{
+    IR_INSN *insn;
+
+    if (!building) {
+	b_alloc_arglist(total_size);
+	return;
+    }
+    insn = add_insn(IR_ARGS, TYVOID, 0);
+    insn->imm = total_size;
+}
+
+
+void ir_load_arg (TYPETAG type)
+{
+    if (!building) {
+	b_load_arg(type);
+	return;
+    }
+    add_popping(IR_ARG, type, 1);
+}
+
+
+void ir_load_arg_const_int (long value)
+{
+    IR_INSN *insn;
+
+    if (!building) {
+	b_load_arg_const_int(value);
+	return;
+    }
+    insn = add_insn(IR_ARG_IMM, TYSIGNEDLONGINT, 0);
+    insn->imm = value;
+}
+
+
+void ir_funcall_by_name (char *f_name, TYPETAG return_type)
+{
+    IR_INSN *insn;
+
+    if (!building) {
+	b_funcall_by_name(f_name, return_type);
+	return;
+    }
+    insn = add_insn(IR_CALL, return_type, 0);
+    insn->name = f_name;
+    if (return_type != TYVOID)
+	push_value(insn);
+}
+
+
+void ir_label (char *label)
+{
+    if (!building) {
+	b_label(label);
+	return;
+    }
+    start_label(label, NULL);
+}
+
+
+void ir_dispatch_label (char *label, char *dispatch)
+{
+    if (!building) {
+	b_dispatch_label(label, dispatch);
+	return;
+    }
+    start_label(label, dispatch);
+}
+
+
+void ir_jump (char *label)
+{
+    if (!building) {
+	b_jump(label);
+	return;
+    }
+    end_block(add_insn(IR_JUMP, TYVOID, 0), 1, &label, FALSE, ENDED);
+}
+
+
+void ir_cond_jump (TYPETAG type, B_COND cond, char *label)
+{
+    IR_INSN *insn;
+
+    if (!building) {
+	b_cond_jump(type, cond, label);
+	return;
+    }
+    insn = add_popping(IR_BRANCH, TYVOID, 1);
+    insn->optype = type;
+    insn->cond = cond;
+    end_block(insn, 1, &label, FALSE, BRANCHED);
+}
+
+
+void ir_cond_jump_rel (B_ARITH_REL_OP arop, TYPETAG type, char *label)
+{
+    IR_INSN *insn;
+
+    if (!building) {
+	b_cond_jump_rel(arop, type, label);
+	return;
+    }
+    insn = add_popping(IR_BRANCH_REL, TYVOID, 2);
+    insn->optype = type;
+    insn->arop = arop;
+    end_block(insn, 1, &label, FALSE, BRANCHED);
+}
+
+
+void ir_cond_jump_rel_const (B_ARITH_REL_OP arop, TYPETAG type, long value,
+			     char *label)
+{
+    IR_INSN *insn;
+
+    if (!building) {
+	b_cond_jump_rel_const(arop, type, value, label);
+	return;
+    }
+    insn = add_popping(IR_BRANCH_REL_IMM, TYVOID, 1);
+    insn->optype = type;
+    insn->arop = arop;
+    insn->imm = value;
+    end_block(insn, 1, &label, FALSE, BRANCHED);
+}
+
+
+void ir_dispatch (B_ARITH_REL_OP arop, TYPETAG type, long match_val,
+		  char *label, BOOLEAN pop)
+{
+    IR_INSN *insn;
+
+    if (!building) {
+	b_dispatch(arop, type, match_val, label, pop);
+	return;
+    }
+    insn = add_insn(IR_DISPATCH, TYVOID, 1);
+    insn->args[0] = top_value();
+    insn->optype = type;
+    insn->arop = arop;
+    insn->imm = match_val;
+    insn->pop = pop;
+    end_block(insn, 1, &label, pop, BRANCHED);
+}
+
+
+void ir_dispatch_bits (TYPETAG type, long low, unsigned int mask, char *label,
+		       BOOLEAN pop)
+{
+    IR_INSN *insn;
+
+    if (!building) {
+	b_dispatch_bits(type, low, mask, label, pop);
+	return;
+    }
+    insn = add_insn(IR_DISPATCH_BITS, TYVOID, 1);
+    insn->args[0] = top_value();
+    insn->optype = type;
+    insn->imm = low;
+    insn->mask = mask;
+    insn->pop = pop;
+    end_block(insn, 1, &label, pop, BRANCHED);
+}
+
+
+void ir_jump_table (TYPETAG type, long low, int n, char *labels[],
+		    char *default_label)
+{
+    IR_INSN *insn;
+    char **targets;
+
+    if (!building) {
+	b_jump_table(type, low, n, labels, default_label);
+	return;
+    }
+    insn = add_popping(IR_JUMP_TABLE, TYVOID, 1);
+    insn->optype = type;
+    insn->imm = low;
+    targets = (char **) ir_alloc((n + 1) * sizeof(char *));
+    memcpy(targets, labels, n * sizeof(char *));
+    targets[n] = default_label;
+    end_block(insn, n + 1, targets, FALSE, ENDED);
+    free(targets);
+}
+
+
+void ir_lineno_comment (int lineno)
+{
+    IR_INSN *insn;
+
+    if (!building) {
+	b_lineno_comment(lineno);
+	return;
+    }
+    insn = add_insn(IR_LINE, TYVOID, 0);
+    insn->imm = lineno;
+}
+
+
+int ir_code_mark (void)
+{
+    if (!building)
+	return b_code_mark();
+    return func.ninsns;
+}
+
+
+BOOLEAN ir_code_is_empty (int start, int end)
+{
+    int i;
+
+    if (!building)
+	return b_code_is_empty(start, end);
+    for (i = start; i < end; i++)
+	if (!insns[i]->deleted && insns[i]->op != IR_LINE)
+	    return FALSE;
+    return TRUE;
+}
+
+
+/* As b_retract_code, the lines that follow the retracted code are kept
+   before the tail call, and the labels after it */
+BOOLEAN ir_retract_code (int start, int end)
+{
+    IR_BLOCK *s = NULL, *b;
+    IR_INSN *insn, *next;
+    int i;
+
+    if (!building)
+	return b_retract_code(start, end);
+
+	/* The code must be in one block, with nothing but lines and
+	 * labels after it */
+    for (i = start; i < end; i++)
+	if (!insns[i]->deleted) {
+	    if (s == NULL)
+		s = insns[i]->block;
+	    else if (insns[i]->block != s)
+		return FALSE;
+	}
+    if (s == NULL)
+	return FALSE;
+    for (i = end; i < func.ninsns; i++)
+	if (!insns[i]->deleted && insns[i]->op != IR_LINE
+	    && insns[i]->op != IR_PHI)
+	    return FALSE;
+    for (b = s->next; b != NULL; b = b->next)
+	for (insn = b->first; insn != NULL; insn = insn->next)
+	    if (insn->op != IR_LINE && insn->op != IR_PHI)
+		return FALSE;
+
+    for (i = start; i < end; i++)
+	if (!insns[i]->deleted)
+	    ir_delete_insn(insns[i]);
+    for (b = s->next; b != NULL; b = b->next)
+	for (insn = b->first; insn != NULL; insn = next) {
+	    next = insn->next;
+	    if (insn->op == IR_LINE) {
+		unlink_insn(insn);
+		append_insn(s, insn);
+	    }
+	}
+    if (s->fall != NULL)
+	ir_remove_edge(s, s->fall);
+
+    cur = s;
+    cur_state = OPEN;
+    simulate_block(s);
+    return TRUE;
+}
+
+
+/* Ends a tail call, the last thing in the retracted block; the lines
+   that come after go at the end of the body */
+static BOOLEAN end_tail_call (void)
+{
+    cur_state = ENDED;
+    if (cur == func.last)
+	return TRUE;
+    cur = func.last;
+    cur_state = OPEN;
+    simulate_block(cur);
+    return FALSE;
+}
+
+
+BOOLEAN ir_tail_call_self (int nparams, TYPETAG types[], int offsets[])
+{
+    IR_INSN *insn;
+
+    if (!building)
+	return b_tail_call_self(nparams, types, offsets);
+    insn = add_popping(IR_TAIL_SELF, TYVOID, nparams);
+    insn->types = (TYPETAG *) ir_alloc((nparams + 1) * sizeof(TYPETAG));
+    memcpy(insn->types, types, nparams * sizeof(TYPETAG));
+    insn->offsets = (int *) ir_alloc((nparams + 1) * sizeof(int));
+    memcpy(insn->offsets, offsets, nparams * sizeof(int));
+    return end_tail_call();
+}
+
+
+BOOLEAN ir_tail_call_by_name (char *f_name, int nargs, TYPETAG types[])
+{
+    IR_INSN *insn;
+
+    if (!building)
+	return b_tail_call_by_name(f_name, nargs, types);
+    insn = add_popping(IR_TAIL_CALL, TYVOID, nargs);
+    insn->name = f_name;
+    insn->types = (TYPETAG *) ir_alloc((nargs + 1) * sizeof(TYPETAG));
+    memcpy(insn->types, types, nargs * sizeof(TYPETAG));
+    return end_tail_call();
+}
+
+
+/* Reusing values */
+
+int ir_top_value (void)
+{
+    if (!building || depth == 0)
+	return -1;
+    return stk[depth - 1]->id;
+}
+
+
+/* A value on top of the stack is duplicated; any other is just pushed
+   again, and the lowering gives it a home */
+void ir_reuse_value (int value)
+{
+    IR_VALUE v;
+    IR_INSN *insn;
+
+    if (!building || value < 0 || value >= func.ninsns
+	|| insns[value]->deleted) {
+	bug("ir: value %d cannot be reused", value);
+	return;
+    }
+    v = insns[value];
+    if (cur_state == OPEN && depth > 0 && stk[depth - 1] == v) {
+	insn = add_insn(IR_DUP, v->type, 1);
+	insn->args[0] = v;
+	push_value(insn);
+	return;
+    }
+    open_block();
+    push_value(v);
+}
+
+
+/* Passes over the IR */
+
+void ir_replace_uses (IR_FUNC *f, IR_VALUE old, IR_VALUE new)
+{
+    IR_BLOCK *b;
+    IR_INSN *insn;
+    int i;
+
+    for (b = f->first; b != NULL; b = b->next) {
+	for (i = 0; i < b->nstack; i++)
+	    if (b->stack[i] == old)
+		b->stack[i] = new;
+	for (insn = b->first; insn != NULL; insn = insn->next)
+	    for (i = 0; i < insn->nargs; i++)
+		if (insn->args[i] == old)
+		    insn->args[i] = new;
+    }
+}
+
+
+void ir_count_uses (IR_FUNC *f)
+{
+    IR_BLOCK *b;
+    IR_INSN *insn;
+    int i;
+
+    for (b = f->first; b != NULL; b = b->next)
+	for (insn = b->first; insn != NULL; insn = insn->next)
+	    insn->nuses = 0;
+    for (b = f->first; b != NULL; b = b->next) {
+	for (i = 0; i < b->nstack; i++)
+	    b->stack[i]->nuses++;
+	for (insn = b->first; insn != NULL; insn = insn->next)
+	    for (i = 0; i < insn->nargs; i++)
+		insn->args[i]->nuses++;
+    }
+}
+
+
+/* The common dominator of a and b, walking up from the later one in
+   reverse postorder (Cooper, Harvey and Kennedy) */
+static IR_BLOCK *intersect (IR_BLOCK *a, IR_BLOCK *b)
+{
+    while (a != b) {
+	while (a->rpo > b->rpo)
+	    a = a->idom;
+	while (b->rpo > a->rpo)
+	    b = b->idom;
+    }
+    return a;
+}
+
+
+void ir_find_dominators (IR_FUNC *f)
+{
+    IR_BLOCK **order, **work, *b, *idom;
+    int *next_succ;
+    int n = 0, depth = 0, i, j;
+    BOOLEAN changed;
+
+    if (f->first == NULL)
+	return;
+    order = (IR_BLOCK **) malloc(f->nblocks * sizeof(IR_BLOCK *));
+    work = (IR_BLOCK **) malloc(f->nblocks * sizeof(IR_BLOCK *));
+    next_succ = (int *) malloc(f->nblocks * sizeof(int));
+    if (order == NULL || work == NULL || next_succ == NULL)
+	bug("ir: out of memory");
+
+    /* Depth-first search for the postorder, with rpo marking the blocks
+       seen so far */
+    for (b = f->first; b != NULL; b = b->next) {
+	b->idom = NULL;
+	b->rpo = -1;
+    }
+    f->first->rpo = 0;
+    work[depth] = f->first;
+    next_succ[depth++] = 0;
+    while (depth > 0) {
+	b = work[depth - 1];
+	if (next_succ[depth - 1] < b->nsuccs) {
+	    IR_BLOCK *s = b->succs[next_succ[depth - 1]++];
+
+	    if (s->rpo < 0) {
+		s->rpo = 0;
+		work[depth] = s;
+		next_succ[depth++] = 0;
+	    }
+	}
+	else {
+	    order[n++] = b;
+	    depth--;
+	}
+    }
+    for (i = 0; i < n; i++)
+	order[i]->rpo = n - 1 - i;
+
+    f->first->idom = f->first;
+    do {
+	changed = FALSE;
+	for (i = n - 2; i >= 0; i--) {
+	    b = order[i];
+	    idom = NULL;
+	    for (j = 0; j < b->npreds; j++) {
+		if (b->preds[j]->idom == NULL)
+		    continue;
+		idom = idom == NULL ? b->preds[j] : intersect(b->preds[j], idom);
+	    }
+	    if (idom != b->idom) {
+		b->idom = idom;
+		changed = TRUE;
+	    }
+	}
+    } while (changed);
+    f->first->idom = NULL;
+
+    free(order);
+    free(work);
+    free(next_succ);
+}
+
+
+BOOLEAN ir_dominates (IR_BLOCK *a, IR_BLOCK *b)
+{
+    if (a->rpo < 0 || b->rpo < 0)
+	return FALSE;
+    for (; b != NULL; b = b->idom)
+	if (b == a)
+	    return TRUE;
+    return FALSE;
+}
+
+
+/* Replaces each phi whose operands are all one value (or itself) with that
+   value, until none is left.  The builder makes a phi for every operand
+   on the stack at every label, and most turn out to be of this kind. */
+static void remove_trivial_phis (IR_FUNC *f)
+{
+    IR_BLOCK *b;
+    IR_INSN *phi, *next;
+    BOOLEAN changed;
+    int i;
+
+    do {
+	changed = FALSE;
+	for (b = f->first; b != NULL; b = b->next)
+	    for (phi = b->first; phi != NULL && phi->op == IR_PHI; phi = next) {
+		IR_VALUE same = NULL;
+
+		next = phi->next;
+		for (i = 0; i < phi->nargs; i++) {
+		    if (phi->args[i] == phi || phi->args[i] == same)
+			continue;
+		    if (same != NULL)
+			break;
+		    same = phi->args[i];
+		}
+		if (i < phi->nargs || same == NULL)
+		    continue;
+		ir_replace_uses(f, phi, same);
+		ir_delete_insn(phi);
+		changed = TRUE;
+	    }
+    } while (changed);
+}
+
+
+static char *block_name (IR_BLOCK *b)
+{
+    static char buf[4][24];
+    static int n = 0;
+
+    if (!b->placed)
+	return b->label;
+    n = (n + 1) % 4;
+    sprintf(buf[n], "b%d", b->index);
+    return buf[n];
+}
+
+
+static void dump_insn (IR_INSN *insn)
+{
+    int i;
+
+    fprintf(stderr, "\t");
+    if (ir_has_value(insn))
+	fprintf(stderr, "v%d = ", insn->id);
+    switch (insn->op) {
+    case IR_ARITH:
+    case IR_ARITH_IMM:
+	fprintf(stderr, "%s", arop_names[insn->arop]);
+	break;
+    case IR_INC_DEC:
+	fprintf(stderr, "%s", idop_names[insn->idop]);
+	break;
+    default:
+	fprintf(stderr, "%s", op_names[insn->op]);
+	break;
+    }
+    if (insn->op == IR_CONVERT)
+	fprintf(stderr, ".%s", type_names[insn->optype]);
+    if (insn->optype != TYVOID)
+	fprintf(stderr, ".%s", type_names[insn->op == IR_CONVERT ? insn->type
+					   : insn->optype]);
+
+    switch (insn->op) {
+    case IR_CONST_INT:
+    case IR_ARGS:
+    case IR_ARG_IMM:
+    case IR_LINE:
+	fprintf(stderr, " %ld", insn->imm);
+	break;
+    case IR_CONST_REAL:
+	fprintf(stderr, " %.17g", insn->real);
+	break;
+    case IR_GLOBAL_ADDR:
+    case IR_CALL:
+    case IR_TAIL_CALL:
+	fprintf(stderr, " %s", insn->name);
+	break;
+    case IR_LOCAL_ADDR:
+	fprintf(stderr, " %ld(fp)", insn->imm);
+	break;
+    case IR_DISPLAY_ADDR:
+	fprintf(stderr, " %ld(display %d)", insn->imm, insn->level);
+	break;
+    case IR_BRANCH:
+	fprintf(stderr, " %s", insn->cond == B_ZERO ? "zero" : "nonzero");
+	break;
+    case IR_BRANCH_REL:
+    case IR_BRANCH_REL_IMM:
+    case IR_DISPATCH:
+    case IR_PTR_ARITH:
+	fprintf(stderr, " %s", arop_names[insn->arop]);
+	break;
+    default:
+	break;
+    }
+
+    for (i = 0; i < insn->nargs; i++) {
+	fprintf(stderr, "%s v%d", i == 0 ? "" : ",", insn->args[i]->id);
+	if (insn->op == IR_PHI)
+	    fprintf(stderr, " (%s)", block_name(insn->block->preds[i]));
+    }
+    switch (insn->op) {
+    case IR_ARITH_IMM:
+    case IR_CHECK_INDEX:
+    case IR_BRANCH_REL_IMM:
+    case IR_DISPATCH:
+	fprintf(stderr, ", %ld", insn->imm);
+	break;
+    case IR_INC_DEC:
+    case IR_PTR_ARITH:
+	fprintf(stderr, ", size %ld", insn->imm);
+	break;
+    case IR_DISPATCH_BITS:
+	fprintf(stderr, ", %ld, 0x%x", insn->imm, insn->mask);
+	break;
+    case IR_JUMP_TABLE:
+	fprintf(stderr, ", %ld", insn->imm);
+	break;
+    case IR_TAIL_SELF:
+	for (i = 0; i < insn->nargs; i++)
+	    fprintf(stderr, "%s%d(fp)", i == 0 ? " -> " : ", ", insn->offsets[i]);
+	break;
+    default:
+	break;
+    }
+    for (i = 0; i < insn->ntargets; i++)
+	fprintf(stderr, "%s%s", i == 0 ? " -> " : " ",
+		block_name(insn->targets[i]));
+    if (insn->pop)
+	fprintf(stderr, " (pop)");
+    fprintf(stderr, "\n");
+}
+
+
+void ir_dump (IR_FUNC *f)
+{
+    IR_BLOCK *b;
+    IR_INSN *insn;
+    int i;
+
+    fprintf(stderr, "ir: %s\n", f->name);
+    for (b = f->first; b != NULL; b = b->next) {
+	fprintf(stderr, "%s:", block_name(b));
+	if (b->label != NULL)
+	    fprintf(stderr, " %s", b->label);
+	if (b->dead)
+	    fprintf(stderr, " dead");
+	if (b->npreds > 0) {
+	    fprintf(stderr, " <-");
+	    for (i = 0; i < b->npreds; i++)
+		fprintf(stderr, " %s", block_name(b->preds[i]));
+	}
+	if (b->nstack > 0) {
+	    fprintf(stderr, " [");
+	    for (i = 0; i < b->nstack; i++)
+		fprintf(stderr, "%sv%d", i == 0 ? "" : " ", b->stack[i]->id);
+	    fprintf(stderr, "]");
+	}
+	fprintf(stderr, "\n");
+	for (insn = b->first; insn != NULL; insn = insn->next)
+	    dump_insn(insn);
+	if (b->fall != NULL && b->fall != b->next)
+	    fprintf(stderr, "\tfalls to %s\n", block_name(b->fall));
+    }
+}
+
+
+void ir_verify (IR_FUNC *f)
+{
+    IR_BLOCK *b, *prev = NULL;
+    IR_INSN *insn;
+    int i, j, index = 0;
+
+    for (b = f->first; b != NULL; prev = b, b = b->next) {
+	if (b->prev != prev || b->index != index++ || !b->placed)
+	    bug("ir: layout broken at %s", block_name(b));
+	for (i = 0; i < b->nsuccs; i++) {
+	    for (j = 0; j < b->succs[i]->npreds; j++)
+		if (b->succs[i]->preds[j] == b)
+		    break;
+	    if (j == b->succs[i]->npreds)
+		bug("ir: %s -> %s has no pred", block_name(b),
+		    block_name(b->succs[i]));
+	}
+	for (i = 0; i < b->npreds; i++) {
+	    for (j = 0; j < b->preds[i]->nsuccs; j++)
+		if (b->preds[i]->succs[j] == b)
+		    break;
+	    if (j == b->preds[i]->nsuccs)
+		bug("ir: %s <- %s has no succ", block_name(b),
+		    block_name(b->preds[i]));
+	}
+	if (b->dead && (b->npreds > 0 || b->nsuccs > 0))
+	    bug("ir: dead block %s has edges", block_name(b));
+
+	for (insn = b->first; insn != NULL; insn = insn->next) {
+	    if (insn->block != b || insn->deleted)
+		bug("ir: v%d is not in %s", insn->id, block_name(b));
+	    if (insn->op == IR_PHI && ((insn->prev && insn->prev->op != IR_PHI)
+				       || insn->nargs != b->npreds))
+		bug("ir: bad phi v%d", insn->id);
+	    if (ir_is_terminator(insn) && insn->next != NULL)
+		bug("ir: v%d ends %s early", insn->id, block_name(b));
+	    for (i = 0; i < insn->nargs; i++)
+		if (insn->args[i]->deleted || !ir_has_value(insn->args[i]))
+		    bug("ir: v%d uses v%d", insn->id, insn->args[i]->id);
+	}
+	for (i = 0; i < b->nstack; i++)
+	    if (b->stack[i]->deleted)
+		bug("ir: %s starts with deleted v%d", block_name(b),
+		    b->stack[i]->id);
+    }
+}
+
+
+/* Frees the IR of the body */
+static void free_function (void)
+{
+    int i;
+
+    for (i = 0; i < func.ninsns; i++) {
+	free(insns[i]->args);
+	free(insns[i]->types);
+	free(insns[i]->offsets);
+	free(insns[i]->targets);
+	free(insns[i]);
+    }
+    for (i = 0; i < nblocks; i++) {
+	free(blocks[i]->stack);
+	free(blocks[i]->preds);
+	free(blocks[i]->succs);
+	free(blocks[i]);
+    }
+    for (i = 0; i < LABEL_HASH_SIZE; i++)
+	while (labels[i] != NULL) {
+	    LABEL_ENT *next = labels[i]->next;
+
+	    free(labels[i]);
+	    labels[i] = next;
+	}
+    nblocks = 0;
+    free(func.params);
+    memset(&func, 0, sizeof(func));
+}
+
+
+int ir_end_function (void)
+{
+    building = FALSE;
+	/* An erroneous body is not worth generating */
+    if (compiler_errors > 0)
+	return 0;
+
+    if (opt_dce)
+	ir_remove_dead_code(&func);
+    remove_trivial_phis(&func);
+    if (opt_gvn)
+	ir_number_values(&func);
+    if (opt_bounds_checks && opt_bounds_elim)
+	ir_remove_bounds_checks(&func);
+    if (opt_licm)
+	ir_hoist_invariants(&func);
+    ir_verify(&func);
+    if (opt_dump_ir)
+	ir_dump(&func);
+    return ir_plan_lowering(&func);
+}
+
+
+void ir_lower_function (int temp_offset)
+{
+    if (compiler_errors == 0)
+	ir_lower(&func, temp_offset);
+    free_function();
+}
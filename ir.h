@@ -0,0 +1,326 @@
+/****************************************************************/
+/*								*/
+/*	CSCE531 - "Pascal" Compiler				*/
+/*								*/
+/*	--ir.h--						*/
+/*								*/
+/*	Typed three-address intermediate representation in	*/
+/*	SSA form (enabled by -fssa).  The front end drives it	*/
+/*	through ir_* functions that take the same arguments as	*/
+/*	the back-end calls they stand for; while a body is	*/
+/*	being built they add instructions to its IR instead,	*/
+/*	turning the operand stack into explicit values, and	*/
+/*	otherwise they call the back end directly.  When the	*/
+/*	body ends, its IR is lowered to the same back-end	*/
+/*	calls (see lower.c).					*/
+/*								*/
+/****************************************************************/
+
+#ifndef IR_H
+#define IR_H
+
+#include "defs.h"
+#include "types.h"
+#include BACKEND_HEADER_FILE
+
+/* Operations.  The instructions up to IR_UNDEF produce a value; those
+   from IR_JUMP on end a basic block. */
+typedef enum {
+    IR_CONST_INT,	/* imm */
+    IR_CONST_REAL,	/* real */
+    IR_GLOBAL_ADDR,	/* address of name */
+    IR_LOCAL_ADDR,	/* imm(frame pointer) */
+    IR_DISPLAY_ADDR,	/* imm in the frame of nesting level level */
+    IR_LOAD,		/* *args[0] */
+    IR_CONVERT,		/* args[0] from optype to type */
+    IR_NEGATE,		/* -args[0] */
+    IR_INC_DEC,		/* idop on *args[0], imm the size pointed to */
+    IR_STORE,		/* *args[0] = args[1], which is also the value */
+    IR_ARITH,		/* args[0] arop args[1], both of optype */
+    IR_ARITH_IMM,	/* args[0] arop imm */
+    IR_PTR_ARITH,	/* pointer args[0] arop integer args[1] * imm */
+    IR_CHECK_INDEX,	/* args[0], which traps unless below imm unsigned */
+    IR_DUP,		/* copy of args[0] (see b_duplicate) */
+    IR_PHI,		/* args[i] when entered from block->preds[i] */
+    IR_CALL,		/* call of name, with the arguments since IR_ARGS */
+    IR_UNDEF,		/* a value that no path defines */
+    IR_DROP,		/* discards args[0] */
+    IR_SET_RETURN,	/* args[0] is the function's return value */
+    IR_ARGS,		/* starts an argument list of imm bytes */
+    IR_ARG,		/* args[0] is the next argument, of type type */
+    IR_ARG_IMM,		/* imm is the next argument */
+    IR_LINE,		/* source line imm starts */
+    IR_JUMP,		/* to targets[0] */
+    IR_BRANCH,		/* to targets[0] if args[0] is cond */
+    IR_BRANCH_REL,	/* to targets[0] if args[0] arop args[1] */
+    IR_BRANCH_REL_IMM,	/* to targets[0] if args[0] arop imm */
+    IR_DISPATCH,	/* to targets[0] if args[0] arop imm */
+    IR_DISPATCH_BITS,	/* to targets[0] if bit args[0] - imm of mask */
+    IR_JUMP_TABLE,	/* to targets[args[0] - imm], else targets[ntargets-1] */
+    IR_TAIL_SELF,	/* args to the parameters at offsets, then back */
+    IR_TAIL_CALL	/* args over the function's own, then to name */
+} IR_OP;
+
+struct ir_block;
+
+/* One instruction, which is also the value it produces.  type is the
+   type of the value (TYVOID if none); optype is the type operated on
+   where that is different, or the one argument type of the back-end call.
+   The operands in args are removed from the operand stack by the
+   instruction, except by IR_DUP, IR_DISPATCH and IR_DISPATCH_BITS, which
+   leave them there (the latter two pop it only if they jump, and pop is
+   set).  id is the position in the order of creation.  nuses and home
+   belong to the passes (see HOME_STACK). */
+typedef struct ir_insn {
+    IR_OP op;
+    TYPETAG type, optype;
+    int id;
+    int nargs;
+    struct ir_insn **args;
+    long imm;
+    double real;
+    char *name;
+    int level;
+    unsigned int mask;
+    B_ARITH_REL_OP arop;
+    B_INC_DEC_OP idop;
+    B_COND cond;
+    BOOLEAN pop;
+    TYPETAG *types;
+    int *offsets;
+    int ntargets;
+    struct ir_block **targets;
+    struct ir_block *block;
+    struct ir_insn *prev, *next;
+    BOOLEAN deleted;
+    int nuses;
+    int home;
+} IR_INSN, *IR_VALUE;
+
+/* A basic block.  label is its assembly label (NULL if it is only ever
+   fallen into), dispatch_label the case dispatch it is an arm of (see
+   b_dispatch_label).  The operand stack holds nstack values on entry,
+   stack[0] the deepest; at a join they are the block's phis.  preds are
+   the blocks that reach it, and succs those it reaches, fall the one of
+   them it falls into (NULL if it ends with a jump).  A block that nothing
+   can fall into and that has no label is dead and has no edges.  next and
+   prev give the layout, the order in which the code is emitted.  idom and
+   rpo are set by ir_find_dominators. */
+typedef struct ir_block {
+    int index;
+    char *label;
+    char *dispatch_label;
+    BOOLEAN placed;
+    BOOLEAN dead;
+    IR_INSN *first, *last;
+    int nstack;
+    IR_VALUE *stack;
+    int npreds, preds_size;
+    struct ir_block **preds;
+    int nsuccs, succs_size;
+    struct ir_block **succs;
+    struct ir_block *fall;
+    struct ir_block *next, *prev;
+    struct ir_block *idom;
+    int rpo;
+} IR_BLOCK;
+
+/* Values of home, which says where the lowering keeps a value that is
+   not used from the operand stack: HOME_STACK if it is, HOME_REMAT if
+   it is computed again for each use, HOME_REG(r) if it is kept in the
+   back end's register variable r (see b_push_var_reg), and otherwise the
+   number of its temporary in the frame (from 1).  An IR_LOCAL_ADDR with a
+   register home stands for a variable kept in that register. */
+#define HOME_STACK 0
+#define HOME_REMAT (-1)
+#define HOME_REG(r) (-2 - (r))
+#define IS_HOME_REG(home) ((home) <= -2)
+#define HOME_REG_NUM(home) (-2 - (home))
+
+/* The IR of one body: its blocks in layout order.  params are the frame
+   offsets of the nparams parameters, which hold their values on entry,
+   and shared_frame tells whether nested functions use its variables. */
+typedef struct {
+    char *name;
+    IR_BLOCK *first, *last;
+    int nblocks;
+    int ninsns;
+    int nparams, params_size;
+    int *params;
+    BOOLEAN shared_frame;
+} IR_FUNC;
+
+
+/* Starts building the IR of the body of the function name (the prologue
+   having been generated).  Until ir_end_function, the calls below add to
+   it. */
+void ir_begin_function (char *name);
+
+/* Ends the IR of the current body, cleans it up and works out how to
+   lower it, and returns the number of bytes of frame space it needs for
+   temporaries (see ir_lower_function) */
+int ir_end_function (void);
+
+/* Generates the code of the body ended by ir_end_function, with its
+   temporaries in the frame from temp_offset (the lowest address) up, and
+   frees its IR */
+void ir_lower_function (int temp_offset);
+
+/* Tell the body being built that the variable at offset in the frame
+   is a parameter, and that functions nested in it use its parameters or
+   variables (see b_enter_display) */
+void ir_param (int offset);
+void ir_share_frame (void);
+
+/* Tells whether a body is being built */
+BOOLEAN ir_building (void);
+
+/* The body being built, or the one ended by ir_end_function */
+IR_FUNC *ir_function (void);
+
+
+/* Stand-ins for the back-end calls of the same names (see the back-end
+   header).  ir_code_mark, ir_code_is_empty and ir_retract_code work on
+   instructions instead of assembly lines, and the tail calls return TRUE
+   if no label follows the retracted code. */
+void ir_pop (void);
+void ir_duplicate (TYPETAG type);
+void ir_push_ext_addr (char *id);
+void ir_push_loc_addr (int offset);
+void ir_push_display_addr (int level, int offset);
+void ir_push_const_int (long value);
+void ir_push_const_double (double value);
+void ir_deref (TYPETAG type);
+void ir_convert (TYPETAG from_type, TYPETAG to_type);
+void ir_negate (TYPETAG type);
+void ir_inc_dec (TYPETAG type, B_INC_DEC_OP idop, unsigned int size);
+void ir_assign (TYPETAG type);
+void ir_arith_rel_op (B_ARITH_REL_OP arop, TYPETAG type);
+void ir_arith_rel_op_const (B_ARITH_REL_OP arop, TYPETAG type, long value);
+void ir_ptr_arith_op (B_ARITH_REL_OP arop, TYPETAG type, unsigned int size);
+void ir_check_index (TYPETAG type, int n);
+void ir_set_return (TYPETAG type);
+void ir_alloc_arglist (int total_size);
+void ir_load_arg (TYPETAG type);
+void ir_load_arg_const_int (long value);
+void ir_funcall_by_name (char *f_name, TYPETAG return_type);
+void ir_label (char *label);
+void ir_jump (char *label);
+void ir_cond_jump (TYPETAG type, B_COND cond, char *label);
+void ir_cond_jump_rel (B_ARITH_REL_OP arop, TYPETAG type, char *label);
+void ir_cond_jump_rel_const (B_ARITH_REL_OP arop, TYPETAG type, long value,
+			     char *label);
+void ir_dispatch (B_ARITH_REL_OP arop, TYPETAG type, long match_val,
+		  char *label, BOOLEAN pop);
+void ir_dispatch_bits (TYPETAG type, long low, unsigned int mask, char *label,
+		       BOOLEAN pop);
+void ir_jump_table (TYPETAG type, long low, int n, char *labels[],
+		    char *default_label);
+void ir_dispatch_label (char *label, char *dispatch);
+void ir_lineno_comment (int lineno);
+int ir_code_mark (void);
+BOOLEAN ir_code_is_empty (int start, int end);
+BOOLEAN ir_retract_code (int start, int end);
+BOOLEAN ir_tail_call_self (int nparams, TYPETAG types[], int offsets[]);
+BOOLEAN ir_tail_call_by_name (char *f_name, int nargs, TYPETAG types[]);
+
+/* Returns the id of the value on top of the operand stack, or -1 if no
+   body is being built */
+int ir_top_value (void);
+
+/* Pushes the value with the given id, from ir_top_value, once more.  It
+   must still be available: nothing that could change it may have come
+   in between.  The lowering keeps it for the new use. */
+void ir_reuse_value (int value);
+
+
+/* Utilities for the passes */
+
+/* Tells whether the instruction produces a value, ends a block, or has
+   an effect other than its value */
+BOOLEAN ir_has_value (IR_INSN *insn);
+BOOLEAN ir_is_terminator (IR_INSN *insn);
+BOOLEAN ir_has_side_effect (IR_INSN *insn);
+
+/* The number of operands the instruction takes off the operand stack
+   when it does not jump */
+int ir_stack_pops (IR_INSN *insn);
+
+/* Replaces every use of old, by instructions and on entry to blocks,
+   with new */
+void ir_replace_uses (IR_FUNC *f, IR_VALUE old, IR_VALUE new);
+
+/* Removes the edge from one block to another, with the phi operands
+   for it */
+void ir_remove_edge (IR_BLOCK *from, IR_BLOCK *to);
+
+/* Removes an instruction from its block */
+void ir_delete_insn (IR_INSN *insn);
+
+/* Returns a new instruction with nargs operands, in no block yet */
+IR_INSN *ir_new_insn (IR_OP op, TYPETAG type, int nargs);
+
+/* Returns a copy of a value-producing instruction with the same operands,
+   in no block yet */
+IR_INSN *ir_copy_insn (IR_INSN *insn);
+
+/* Moves insn (which may be in no block) to the end of b, before the jump
+   that ends it if any */
+void ir_move_insn (IR_INSN *insn, IR_BLOCK *b);
+
+/* Moves insn (which may be in no block) to just before the instruction
+   before */
+void ir_insert_before (IR_INSN *insn, IR_INSN *before);
+
+/* Sets idom of each block reachable from the first to its immediate
+   dominator (NULL for the first), and rpo to its position in reverse
+   postorder; rpo is -1 in the others */
+void ir_find_dominators (IR_FUNC *f);
+
+/* Tells whether every path from the entry to b goes through a, after
+   ir_find_dominators */
+BOOLEAN ir_dominates (IR_BLOCK *a, IR_BLOCK *b);
+
+/* Sets nuses of every value to the number of its uses */
+void ir_count_uses (IR_FUNC *f);
+
+/* Prints the IR to stderr (see -fdump-ir) */
+void ir_dump (IR_FUNC *f);
+
+/* Checks that the IR is well formed, and calls bug() if not */
+void ir_verify (IR_FUNC *f);
+
+/* In dce.c: folds the conditional jumps on constants, and takes out the
+   code that cannot be reached and the stores that nothing reads */
+void ir_remove_dead_code (IR_FUNC *f);
+
+/* In gvn.c: replaces the values that compute or load what a value before
+   them on every path has, where that saves work */
+void ir_number_values (IR_FUNC *f);
+
+/* In bounds.c: takes out the array bounds checks whose indices are
+   known to be in range */
+void ir_remove_bounds_checks (IR_FUNC *f);
+
+/* In licm.c: moves the computations that do not change in a loop to
+   just before it */
+void ir_hoist_invariants (IR_FUNC *f);
+
+/* In regalloc.c: gives register homes to the variables of f that are
+   only ever loaded and stored, before the lowering is planned */
+void ir_alloc_var_regs (IR_FUNC *f);
+
+/* In regalloc.c: gives the registers left to the values that the
+   lowering keeps in the ntemps temporaries, renumbering the others, and
+   returns how many of those are left.  *nregs is set to the number of
+   registers used. */
+int ir_alloc_temp_regs (IR_FUNC *f, int ntemps, int *nregs);
+
+/* In lower.c: works out where each value of f is kept while it is not
+   on the operand stack, and returns the bytes of temporaries needed */
+int ir_plan_lowering (IR_FUNC *f);
+
+/* In lower.c: generates the code of f, planned by ir_plan_lowering */
+void ir_lower (IR_FUNC *f, int temp_offset);
+
+#endif
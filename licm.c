@@ -0,0 +1,395 @@
+/****************************************************************/
+/*								*/
+/*	CSCE531 - "Pascal" Compiler				*/
+/*								*/
+/*	--licm.c--						*/
+/*								*/
+/*	Loop-invariant code motion on the SSA intermediate	*/
+/*	representation (see ir.h), enabled by -flicm.		*/
+/*								*/
+/****************************************************************/
+
+/*
+ * A loop is found from its back edges: the jumps to a block (its header)
+ * from blocks that the header dominates.  Its body is the header and
+ * every block that reaches one of those jumps without going through the
+ * header.  The statements of while, repeat and for loops all come out
+ * this way, with the header at the label the loop jumps back to.
+ *
+ * A computation in the body whose operands all come from outside it
+ * gives the same value on every iteration, so if it has no effect and
+ * cannot trap it is moved to the end of the loop's preheader: the one
+ * block outside the loop that leads to the header, which must lead
+ * nowhere else.  A load is moved only if it is of a variable that
+ * nothing in the loop may store to.  Moving a computation can make
+ * others invariant, and the moved ones are seen again by the loops
+ * around, so the passes are repeated until nothing moves.
+ *
+ * The moved values are used across the loop's labels, so the lowering
+ * gives them homes; the values the front end left on the operand stack
+ * across a jump must stay there, so those, and what they are computed
+ * from, are never moved.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "ir.h"
+#include "message.h"
+
+/* What the body of the current loop is, and what it stores to */
+typedef struct {
+    IR_BLOCK *header;
+    IR_BLOCK *preheader;
+    char *in_loop;		/* indexed by block index */
+    BOOLEAN stores_anywhere;	/* a call, or a store through a pointer */
+    int nglobals, globals_size;
+    char **globals;		/* names of the globals stored to */
+    int nlocals, locals_size;
+    int *locals;		/* frame offsets of the locals stored to */
+} LOOP;
+
+/* Values that must stay on the operand stack, indexed by id */
+static char *pinned = NULL;
+static int npinned;
+
+/* What hoist_loop has found of each value of the current loop, indexed
+   by id: invariant, and used by something that is not */
+#define INVARIANT 1
+#define ROOT 2
+static char *mark = NULL;
+static int nmarks;
+
+
+static void *loop_alloc (void *p, int *size, int n, size_t elsize)
+{
+    if (n < *size)
+	return p;
+    *size = *size ? 2 * *size : 16;
+    p = realloc(p, *size * elsize);
+    if (p == NULL)
+	bug("licm: out of memory");
+    return p;
+}
+
+
+static BOOLEAN is_pinned (IR_VALUE v)
+{
+    return v->id < npinned && pinned[v->id];
+}
+
+
+static void find_pinned (IR_FUNC *f)
+{
+    IR_BLOCK *b;
+    IR_INSN *insn;
+    int i;
+
+    npinned = f->ninsns;
+    pinned = (char *) realloc(pinned, npinned + 1);
+    if (pinned == NULL)
+	bug("licm: out of memory");
+    memset(pinned, 0, npinned + 1);
+    for (b = f->first; b != NULL; b = b->next) {
+	for (i = 0; i < b->nstack; i++)
+	    pinned[b->stack[i]->id] = TRUE;
+	for (insn = b->first; insn != NULL; insn = insn->next)
+	    if (insn->op == IR_PHI)
+		for (i = 0; i < insn->nargs; i++)
+		    pinned[insn->args[i]->id] = TRUE;
+    }
+}
+
+
+/* Tells whether the value is a constant or an address, which the
+   lowering computes again wherever it is used */
+static BOOLEAN is_remat (IR_VALUE v)
+{
+    switch (v->op) {
+    case IR_CONST_INT:
+    case IR_CONST_REAL:
+    case IR_GLOBAL_ADDR:
+    case IR_LOCAL_ADDR:
+    case IR_DISPLAY_ADDR:
+	return TRUE;
+    default:
+	return FALSE;
+    }
+}
+
+
+/* Records what the store through addr may change */
+static void note_store (LOOP *loop, IR_VALUE addr)
+{
+    while (addr->op == IR_PTR_ARITH || addr->op == IR_DUP)
+	addr = addr->args[0];
+    switch (addr->op) {
+    case IR_GLOBAL_ADDR:
+	loop->globals = loop_alloc(loop->globals, &loop->globals_size,
+				   loop->nglobals, sizeof(char *));
+	loop->globals[loop->nglobals++] = addr->name;
+	break;
+    case IR_LOCAL_ADDR:
+    case IR_DISPLAY_ADDR:
+	loop->locals = loop_alloc(loop->locals, &loop->locals_size,
+				  loop->nlocals, sizeof(int));
+	loop->locals[loop->nlocals++] = (int) addr->imm;
+	break;
+    default:
+	loop->stores_anywhere = TRUE;
+	break;
+    }
+}
+
+
+/* Tells whether the variable at addr may change in the loop.  Frame
+   offsets are compared whatever the nesting level. */
+static BOOLEAN may_change (LOOP *loop, IR_VALUE addr)
+{
+    int i;
+
+    if (loop->stores_anywhere)
+	return TRUE;
+    switch (addr->op) {
+    case IR_GLOBAL_ADDR:
+	for (i = 0; i < loop->nglobals; i++)
+	    if (!strcmp(loop->globals[i], addr->name))
+		return TRUE;
+	return FALSE;
+    case IR_LOCAL_ADDR:
+    case IR_DISPLAY_ADDR:
+	for (i = 0; i < loop->nlocals; i++)
+	    if (loop->locals[i] == addr->imm)
+		return TRUE;
+	return FALSE;
+    default:
+	return TRUE;
+    }
+}
+
+
+/* Finds the body of the loop with the given header and what it stores
+   to.  Returns FALSE if the loop has no preheader. */
+static BOOLEAN find_loop (LOOP *loop, IR_FUNC *f, IR_BLOCK *header)
+{
+    IR_BLOCK **work = NULL, *b;
+    IR_INSN *insn;
+    int nwork = 0, work_size = 0, i;
+
+    loop->header = header;
+    loop->preheader = NULL;
+    loop->stores_anywhere = FALSE;
+    loop->nglobals = loop->nlocals = 0;
+
+	/* A back edge goes against reverse postorder, which is quicker to
+	   check than dominance */
+    for (i = 0; i < header->npreds; i++)
+	if (header->preds[i]->rpo >= header->rpo
+	    && ir_dominates(header, header->preds[i])) {
+	    work = loop_alloc(work, &work_size, nwork, sizeof(IR_BLOCK *));
+	    work[nwork++] = header->preds[i];
+	}
+    if (nwork == 0) {
+	free(work);
+	return FALSE;
+    }
+    memset(loop->in_loop, 0, f->nblocks);
+    loop->in_loop[header->index] = TRUE;
+    while (nwork > 0) {
+	b = work[--nwork];
+	if (loop->in_loop[b->index])
+	    continue;
+	loop->in_loop[b->index] = TRUE;
+	for (i = 0; i < b->npreds; i++)
+	    if (!loop->in_loop[b->preds[i]->index]) {
+		work = loop_alloc(work, &work_size, nwork, sizeof(IR_BLOCK *));
+		work[nwork++] = b->preds[i];
+	    }
+    }
+    free(work);
+
+    for (i = 0; i < header->npreds; i++) {
+	b = header->preds[i];
+	if (loop->in_loop[b->index])
+	    continue;
+	if (loop->preheader != NULL)
+	    return FALSE;
+	loop->preheader = b;
+    }
+    b = loop->preheader;
+    if (b == NULL || b->nsuccs != 1 || b->dead || b->rpo < 0
+	|| header->dispatch_label != NULL)
+	return FALSE;
+
+    for (b = f->first; b != NULL; b = b->next)
+	if (loop->in_loop[b->index])
+	    for (insn = b->first; insn != NULL; insn = insn->next)
+		switch (insn->op) {
+		case IR_STORE:
+		case IR_INC_DEC:
+		    note_store(loop, insn->args[0]);
+		    break;
+		case IR_CALL:
+		case IR_TAIL_SELF:
+		case IR_TAIL_CALL:
+		    loop->stores_anywhere = TRUE;
+		    break;
+		default:
+		    break;
+		}
+    return TRUE;
+}
+
+
+/* Tells whether the operand v of a computation in the loop has the same
+   value on every iteration */
+static BOOLEAN is_invariant (LOOP *loop, IR_VALUE v)
+{
+    if (is_pinned(v))
+	return FALSE;
+    return !loop->in_loop[v->block->index] || is_remat(v)
+	|| (mark[v->id] & INVARIANT);
+}
+
+
+/* Tells whether insn, in the loop, can be moved to the preheader */
+static BOOLEAN can_hoist (LOOP *loop, IR_INSN *insn)
+{
+    int i;
+
+    switch (insn->op) {
+    case IR_LOAD:
+	if (!is_remat(insn->args[0]) || insn->args[0]->op == IR_CONST_INT
+	    || may_change(loop, insn->args[0]))
+	    return FALSE;
+	break;
+    case IR_ARITH:
+	if (insn->arop == B_DIV || insn->arop == B_MOD)
+	    return FALSE;
+	break;
+    case IR_ARITH_IMM:
+	if ((insn->arop == B_DIV || insn->arop == B_MOD)
+	    && (insn->imm == 0 || insn->imm == -1))
+	    return FALSE;
+	break;
+    case IR_CONVERT:
+    case IR_NEGATE:
+    case IR_PTR_ARITH:
+	break;
+    default:
+	return FALSE;
+    }
+    if (is_pinned(insn))
+	return FALSE;
+    for (i = 0; i < insn->nargs; i++)
+	if (!is_invariant(loop, insn->args[i]))
+	    return FALSE;
+    return TRUE;
+}
+
+
+/* Moves insn to the end of the preheader, after the invariant values in
+   the loop that it uses, so that each comes out just before its use.  The
+   constants and addresses it uses are moved too, or copied if something
+   else uses them. */
+static void hoist (LOOP *loop, IR_INSN *insn)
+{
+    int i;
+
+    for (i = 0; i < insn->nargs; i++) {
+	IR_VALUE arg = insn->args[i];
+
+	if (!loop->in_loop[arg->block->index])
+	    continue;
+	if (mark[arg->id] & INVARIANT) {
+	    hoist(loop, arg);
+	    continue;
+	}
+	if (arg->nuses > 1) {
+	    arg->nuses--;
+	    arg = insn->args[i] = ir_copy_insn(arg);
+	    arg->nuses = 1;
+	}
+	ir_move_insn(arg, loop->preheader);
+    }
+    ir_move_insn(insn, loop->preheader);
+}
+
+
+/* Moves the invariant computations of the loop to its preheader.
+   Returns TRUE if there were any. */
+static BOOLEAN hoist_loop (LOOP *loop, IR_FUNC *f)
+{
+    IR_BLOCK *b;
+    IR_INSN *insn, *next;
+    BOOLEAN changed, moved = FALSE;
+    int i;
+
+    if (nmarks <= f->ninsns) {
+	nmarks = f->ninsns + 1;
+	mark = (char *) realloc(mark, nmarks);
+	if (mark == NULL)
+	    bug("licm: out of memory");
+    }
+    memset(mark, 0, nmarks);
+    do {
+	changed = FALSE;
+	for (b = f->first; b != NULL; b = b->next)
+	    if (loop->in_loop[b->index])
+		for (insn = b->first; insn != NULL; insn = insn->next)
+		    if (!(mark[insn->id] & INVARIANT) && can_hoist(loop, insn)) {
+			mark[insn->id] |= INVARIANT;
+			changed = TRUE;
+		    }
+    } while (changed);
+
+	/* The roots are the invariant values used by something that stays */
+    for (b = f->first; b != NULL; b = b->next)
+	for (insn = b->first; insn != NULL; insn = insn->next) {
+	    if (loop->in_loop[b->index] && (mark[insn->id] & INVARIANT))
+		continue;
+	    for (i = 0; i < insn->nargs; i++)
+		if (mark[insn->args[i]->id] & INVARIANT)
+		    mark[insn->args[i]->id] |= ROOT;
+	}
+
+    for (b = f->first; b != NULL; b = b->next) {
+	if (!loop->in_loop[b->index])
+	    continue;
+	for (insn = b->first; insn != NULL; insn = next) {
+	    next = insn->next;
+	    if (mark[insn->id] & ROOT) {
+		hoist(loop, insn);
+		moved = TRUE;
+	    }
+	}
+    }
+    return moved;
+}
+
+
+void ir_hoist_invariants (IR_FUNC *f)
+{
+    LOOP loop;
+    IR_BLOCK *header;
+    BOOLEAN changed;
+
+    memset(&loop, 0, sizeof(loop));
+    loop.in_loop = (char *) malloc(f->nblocks + 1);
+    if (loop.in_loop == NULL)
+	bug("licm: out of memory");
+    ir_find_dominators(f);
+    ir_count_uses(f);
+    find_pinned(f);
+
+    do {
+	changed = FALSE;
+	for (header = f->first; header != NULL; header = header->next)
+	    if (header->rpo >= 0 && find_loop(&loop, f, header)
+		&& hoist_loop(&loop, f))
+		changed = TRUE;
+    } while (changed);
+
+    free(loop.in_loop);
+    free(loop.globals);
+    free(loop.locals);
+}
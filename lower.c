@@ -0,0 +1,603 @@
+/****************************************************************/
+/*								*/
+/*	CSCE531 - "Pascal" Compiler				*/
+/*								*/
+/*	--lower.c--						*/
+/*								*/
+/*	Lowering of the SSA intermediate representation (see	*/
+/*	ir.h) to back-end calls.				*/
+/*								*/
+/****************************************************************/
+
+/*
+ * The back end is a stack machine, so each value is computed onto its
+ * operand stack, and should be used from there.  The blocks are lowered
+ * in layout order, each instruction to the call it came from, which gives
+ * back the code the front end would have generated itself as long as
+ * every value is on top of the stack when it is used.  A value for which
+ * that does not hold, because a pass has moved or shared it, is given a
+ * home instead: a constant or address is computed again where it is used,
+ * and anything else is stored into a temporary in the frame just after
+ * it is computed, and loaded back just before each use.
+ *
+ * The values that the front end left on the stack across a jump (the
+ * phis and the values on entry to a block, and the operands of the phis)
+ * must stay there, as the back end keeps them in the same place on every
+ * path.
+ *
+ * With -fregalloc, the variables that are only loaded and stored may be
+ * kept in the back end's register variables instead of the frame (see
+ * regalloc.c), and their loads and stores then take no address from the
+ * stack.  Once the planning is done, temporaries get the registers left.
+ */
+
+#include <stdlib.h>
+#include "ir.h"
+#include "options.h"
+#include "message.h"
+
+/* The number of temporaries given out */
+static int ntemps;
+
+/* Whether the value with each id must stay on the stack */
+static char *pinned = NULL;
+
+/* What is on the operand stack while a block is planned, top last.  An
+   argument list under way is marked by arglist_mark. */
+static IR_VALUE *stk = NULL;
+static int depth = 0, stk_size = 0;
+static IR_INSN arglist_mark;
+
+/* The offset of the first temporary */
+static int temp_base;
+
+
+static void push (IR_VALUE v)
+{
+    if (depth == stk_size) {
+	stk_size = stk_size ? 2 * stk_size : 64;
+	stk = (IR_VALUE *) realloc(stk, stk_size * sizeof(IR_VALUE));
+	if (stk == NULL)
+	    bug("lower: out of memory");
+    }
+    stk[depth++] = v;
+}
+
+
+static BOOLEAN on_stack (IR_VALUE v)
+{
+    return v->home == HOME_STACK;
+}
+
+
+/* Tells whether v is the address of a variable kept in a register */
+static BOOLEAN is_reg_var (IR_VALUE v)
+{
+    return v->op == IR_LOCAL_ADDR && IS_HOME_REG(v->home);
+}
+
+
+/* The index of the first operand of insn that is taken off the stack:
+   the address of a variable kept in a register is not on it */
+static int first_operand (IR_INSN *insn)
+{
+    switch (insn->op) {
+    case IR_LOAD:
+    case IR_STORE:
+    case IR_INC_DEC:
+	return is_reg_var(insn->args[0]) ? 1 : 0;
+    default:
+	return 0;
+    }
+}
+
+
+/* Gives v a home off the stack */
+static void make_home (IR_VALUE v)
+{
+    if (pinned[v->id])
+	bug("lower: v%d must stay on the operand stack", v->id);
+    switch (v->op) {
+    case IR_CONST_INT:
+    case IR_CONST_REAL:
+    case IR_GLOBAL_ADDR:
+    case IR_LOCAL_ADDR:
+    case IR_DISPLAY_ADDR:
+    case IR_UNDEF:
+	v->home = HOME_REMAT;
+	break;
+    default:
+	v->home = ++ntemps;
+	break;
+    }
+}
+
+
+/* Returns the position of v on the stack, or -1 */
+static int stack_pos (IR_VALUE v)
+{
+    int i;
+
+    for (i = depth - 1; i >= 0; i--)
+	if (stk[i] == v)
+	    return i;
+    return -1;
+}
+
+
+/* Called when the n values in vals, which are to be used from the stack,
+   are not the top n in that order: gives a home to a value that is in
+   the way, or to one of them.  Returns FALSE, as the planning has to
+   start over. */
+static BOOLEAN unblock (IR_VALUE vals[], int n)
+{
+    int low = depth, i, j, pos;
+
+    for (i = 0; i < n; i++) {
+	pos = stack_pos(vals[i]);
+	if (pos < 0) {
+	    make_home(vals[i]);
+	    return FALSE;
+	}
+	if (pos < low)
+	    low = pos;
+    }
+    for (pos = depth - 1; pos >= low; pos--) {
+	if (stk[pos] == &arglist_mark) {
+		/* A value from outside an argument list is used inside */
+	    for (i = 0; i < n; i++)
+		if (stack_pos(vals[i]) < pos && !pinned[vals[i]->id]) {
+		    make_home(vals[i]);
+		    return FALSE;
+		}
+	    continue;
+	}
+	for (i = 0; i < n && vals[i] != stk[pos]; i++)
+	    ;
+	if (i == n && !pinned[stk[pos]->id]) {
+	    make_home(stk[pos]);
+	    return FALSE;
+	}
+    }
+    for (j = n - 1; j >= 0; j--)
+	if (!pinned[vals[j]->id]) {
+	    make_home(vals[j]);
+	    return FALSE;
+	}
+    bug("lower: operands out of order");
+    return FALSE;
+}
+
+
+/* Takes the operands of insn off the stack.  Those with a home are pushed
+   just before insn, so they have to come last. */
+static BOOLEAN take_operands (IR_INSN *insn)
+{
+    int first = first_operand(insn), n = ir_stack_pops(insn) - first, k, i;
+    IR_VALUE *args = insn->args + first;
+
+    for (k = 0; k < n && on_stack(args[k]); k++)
+	;
+    for (i = k; i < n; i++)
+	if (on_stack(args[i])) {
+	    make_home(args[i]);
+	    return FALSE;
+	}
+    if (depth < k)
+	return unblock(args, k);
+    for (i = 0; i < k; i++)
+	if (stk[depth - k + i] != args[i])
+	    return unblock(args, k);
+    depth -= k;
+    return TRUE;
+}
+
+
+/* Checks that the operand that insn looks at without popping it is on
+   top of the stack, if it is used from there */
+static BOOLEAN check_top (IR_INSN *insn)
+{
+    IR_VALUE v = insn->args[0];
+
+    if (!on_stack(v) || (depth > 0 && stk[depth - 1] == v))
+	return TRUE;
+    return unblock(&v, 1);
+}
+
+
+/* Takes the mark of an argument list off the stack at a call */
+static BOOLEAN take_arglist_mark (void)
+{
+    int pos;
+
+    if (depth > 0 && stk[depth - 1] == &arglist_mark) {
+	depth--;
+	return TRUE;
+    }
+    for (pos = depth - 1; pos >= 0 && stk[pos] != &arglist_mark; pos--)
+	if (!pinned[stk[pos]->id]) {
+	    make_home(stk[pos]);
+	    return FALSE;
+	}
+    bug("lower: argument list not ended");
+    return FALSE;
+}
+
+
+/* Checks that the stack at the end of block b, given its terminator
+   term, holds what each of its successors expects */
+static BOOLEAN check_exit (IR_BLOCK *b, IR_INSN *term)
+{
+    int i, j, k, n;
+
+    if (b->dead)
+	return TRUE;
+    if (b->nsuccs == 0) {
+	for (i = depth - 1; i >= 0; i--)
+	    if (!pinned[stk[i]->id]) {
+		make_home(stk[i]);
+		return FALSE;
+	    }
+	return TRUE;
+    }
+
+    for (i = 0; i < b->nsuccs; i++) {
+	IR_BLOCK *s = b->succs[i];
+
+	    /* A dispatch pops the value if it jumps */
+	n = depth;
+	if (term != NULL && term->pop && s != b->fall)
+	    n--;
+	for (k = 0; s->preds[k] != b; k++)
+	    ;
+	for (j = 0; j < n && j < s->nstack; j++) {
+	    IR_VALUE want = s->stack[j];
+
+	    if (want->op == IR_PHI && want->block == s)
+		want = want->args[k];
+	    if (stk[j] != want)
+		break;
+	}
+	if (j == n && j == s->nstack)
+	    continue;
+	for (j = n - 1; j >= 0; j--)
+	    if (!pinned[stk[j]->id]) {
+		make_home(stk[j]);
+		return FALSE;
+	    }
+	bug("lower: operand stack mismatch from b%d to b%d", b->index,
+	    s->index);
+    }
+    return TRUE;
+}
+
+
+/* Works through block b as it will be lowered, checking that each value
+   used from the stack is where it should be.  Returns FALSE after giving
+   a home to a value that is not. */
+static BOOLEAN plan_block (IR_BLOCK *b)
+{
+    IR_INSN *insn, *term = NULL;
+    int i;
+
+    depth = 0;
+    for (i = 0; i < b->nstack; i++)
+	push(b->stack[i]);
+    for (insn = b->first; insn != NULL; insn = insn->next) {
+	switch (insn->op) {
+	case IR_PHI:
+	case IR_LINE:
+	    continue;
+	case IR_ARGS:
+	    push(&arglist_mark);
+	    continue;
+	case IR_DUP:
+	case IR_DISPATCH:
+	case IR_DISPATCH_BITS:
+	    if (!check_top(insn))
+		return FALSE;
+	    break;
+	default:
+	    if (!take_operands(insn))
+		return FALSE;
+	    break;
+	}
+	if (insn->op == IR_CALL && !take_arglist_mark())
+	    return FALSE;
+	if (ir_has_value(insn) && insn->nuses > 0 && on_stack(insn))
+	    push(insn);
+	if (ir_is_terminator(insn))
+	    term = insn;
+    }
+    return check_exit(b, term);
+}
+
+
+/* Deletes the values that nothing uses and that have no other effect,
+   and the ones that only they used */
+static void delete_unused (IR_FUNC *f)
+{
+    IR_BLOCK *b;
+    IR_INSN *insn, *prev;
+    BOOLEAN changed;
+    int i;
+
+    do {
+	changed = FALSE;
+	for (b = f->last; b != NULL; b = b->prev)
+	    for (insn = b->last; insn != NULL; insn = prev) {
+		prev = insn->prev;
+		if (!ir_has_value(insn) || insn->nuses > 0 || insn->op == IR_PHI
+		    || ir_has_side_effect(insn))
+		    continue;
+		for (i = 0; i < insn->nargs; i++)
+		    insn->args[i]->nuses--;
+		ir_delete_insn(insn);
+		changed = TRUE;
+	    }
+    } while (changed);
+}
+
+
+int ir_plan_lowering (IR_FUNC *f)
+{
+    IR_BLOCK *b;
+    IR_INSN *insn;
+    int nregs = 0, i;
+
+    ntemps = 0;
+    ir_count_uses(f);
+    delete_unused(f);
+    for (b = f->first; b != NULL; b = b->next)
+	for (insn = b->first; insn != NULL; insn = insn->next)
+	    insn->home = HOME_STACK;
+    if (opt_regalloc && !f->shared_frame)
+	ir_alloc_var_regs(f);
+
+    pinned = (char *) realloc(pinned, f->ninsns + 1);
+    if (pinned == NULL)
+	bug("lower: out of memory");
+    for (i = 0; i <= f->ninsns; i++)
+	pinned[i] = FALSE;
+    for (b = f->first; b != NULL; b = b->next) {
+	for (i = 0; i < b->nstack; i++)
+	    pinned[b->stack[i]->id] = TRUE;
+	for (insn = b->first; insn != NULL; insn = insn->next) {
+	    if (insn->op == IR_PHI)
+		for (i = 0; i < insn->nargs; i++)
+		    pinned[insn->args[i]->id] = TRUE;
+	    for (i = 0; i < insn->ntargets; i++)
+		if (insn->targets[i]->label == NULL)
+		    insn->targets[i]->label = new_symbol();
+	}
+	if (b->fall != NULL && b->fall != b->next && b->fall->label == NULL)
+	    b->fall->label = new_symbol();
+    }
+
+    for (b = f->first; b != NULL; b = plan_block(b) ? b->next : f->first)
+	;
+    if (opt_regalloc)
+	ntemps = ir_alloc_temp_regs(f, ntemps, &nregs);
+    if (nregs > 0)
+	b_save_var_regs(nregs);
+    return 8 * ntemps;
+}
+
+
+/* Makes the back-end call for a constant or address v */
+static void push_remat (IR_VALUE v)
+{
+    switch (v->op) {
+    case IR_CONST_INT:
+	b_push_const_int(v->imm);
+	break;
+    case IR_CONST_REAL:
+	b_push_const_double(v->real);
+	break;
+    case IR_GLOBAL_ADDR:
+	b_push_ext_addr(v->name);
+	break;
+    case IR_LOCAL_ADDR:
+	b_push_loc_addr((int) v->imm);
+	break;
+    case IR_DISPLAY_ADDR:
+	b_push_display_addr(v->level, (int) v->imm);
+	break;
+    default:
+	b_push_const_int(0);
+	break;
+    }
+}
+
+
+/* Pushes a value that has a home */
+static void push_home (IR_VALUE v)
+{
+    if (v->home == HOME_STACK)
+	bug("lower: v%d is not at home", v->id);
+    if (v->home == HOME_REMAT)
+	push_remat(v);
+    else if (IS_HOME_REG(v->home))
+	b_push_var_reg(v->type, HOME_REG_NUM(v->home));
+    else
+	b_load_temp(v->type, temp_base + 8 * (v->home - 1));
+}
+
+
+/* Labels of the targets of a jump, from targets[first] on */
+static char **target_labels (IR_INSN *insn, int first)
+{
+    char **ret = (char **) malloc((insn->ntargets + 1) * sizeof(char *));
+    int i;
+
+    if (ret == NULL)
+	bug("lower: out of memory");
+    for (i = first; i < insn->ntargets; i++)
+	ret[i - first] = insn->targets[i]->label;
+    return ret;
+}
+
+
+/* Makes the back-end call for insn, its operands being on the stack */
+static void lower_op (IR_INSN *insn)
+{
+    char **labels;
+
+    switch (insn->op) {
+    case IR_CONST_INT:
+    case IR_CONST_REAL:
+    case IR_GLOBAL_ADDR:
+    case IR_LOCAL_ADDR:
+    case IR_DISPLAY_ADDR:
+    case IR_UNDEF:
+	push_remat(insn);
+	break;
+    case IR_LOAD:
+	if (first_operand(insn) > 0)
+	    b_push_var_reg(insn->type, HOME_REG_NUM(insn->args[0]->home));
+	else
+	    b_deref(insn->type);
+	break;
+    case IR_CONVERT:
+	b_convert(insn->optype, insn->type);
+	break;
+    case IR_NEGATE:
+	b_negate(insn->type);
+	break;
+    case IR_INC_DEC:
+	if (first_operand(insn) > 0)
+	    b_inc_dec_var_reg(insn->type, insn->idop, (unsigned int) insn->imm,
+			      HOME_REG_NUM(insn->args[0]->home));
+	else
+	    b_inc_dec(insn->type, insn->idop, (unsigned int) insn->imm);
+	break;
+    case IR_STORE:
+	if (first_operand(insn) > 0)
+	    b_assign_var_reg(insn->type, HOME_REG_NUM(insn->args[0]->home));
+	else
+	    b_assign(insn->type);
+	break;
+    case IR_ARITH:
+	b_arith_rel_op(insn->arop, insn->optype);
+	break;
+    case IR_ARITH_IMM:
+	b_arith_rel_op_const(insn->arop, insn->optype, insn->imm);
+	break;
+    case IR_PTR_ARITH:
+	b_ptr_arith_op(insn->arop, insn->optype, (unsigned int) insn->imm);
+	break;
+    case IR_CHECK_INDEX:
+	b_check_index(insn->type, (int) insn->imm);
+	break;
+    case IR_DUP:
+	b_duplicate(insn->type);
+	break;
+    case IR_CALL:
+	b_funcall_by_name(insn->name, insn->type);
+	break;
+    case IR_DROP:
+	b_pop();
+	break;
+    case IR_SET_RETURN:
+	b_set_return(insn->type);
+	break;
+    case IR_ARGS:
+	b_alloc_arglist((int) insn->imm);
+	break;
+    case IR_ARG:
+	b_load_arg(insn->type);
+	break;
+    case IR_ARG_IMM:
+	b_load_arg_const_int(insn->imm);
+	break;
+    case IR_LINE:
+	b_lineno_comment((int) insn->imm);
+	break;
+    case IR_JUMP:
+	b_jump(insn->targets[0]->label);
+	break;
+    case IR_BRANCH:
+	b_cond_jump(insn->optype, insn->cond, insn->targets[0]->label);
+	break;
+    case IR_BRANCH_REL:
+	b_cond_jump_rel(insn->arop, insn->optype, insn->targets[0]->label);
+	break;
+    case IR_BRANCH_REL_IMM:
+	b_cond_jump_rel_const(insn->arop, insn->optype, insn->imm,
+			      insn->targets[0]->label);
+	break;
+    case IR_DISPATCH:
+	b_dispatch(insn->arop, insn->optype, insn->imm,
+		   insn->targets[0]->label, insn->pop);
+	break;
+    case IR_DISPATCH_BITS:
+	b_dispatch_bits(insn->optype, insn->imm, insn->mask,
+			insn->targets[0]->label, insn->pop);
+	break;
+    case IR_JUMP_TABLE:
+	labels = target_labels(insn, 0);
+	b_jump_table(insn->optype, insn->imm, insn->ntargets - 1, labels,
+		     labels[insn->ntargets - 1]);
+	free(labels);
+	break;
+    case IR_TAIL_SELF:
+	b_tail_call_self(insn->nargs, insn->types, insn->offsets);
+	break;
+    case IR_TAIL_CALL:
+	b_tail_call_by_name(insn->name, insn->nargs, insn->types);
+	break;
+    default:
+	bug("lower: unexpected instruction v%d", insn->id);
+    }
+}
+
+
+static void lower_insn (IR_INSN *insn)
+{
+    int n, i;
+
+    if (insn->op == IR_PHI || insn->home == HOME_REMAT || is_reg_var(insn))
+	return;
+    if (insn->op == IR_DROP && !on_stack(insn->args[0]))
+	return;
+
+    if (insn->op == IR_DUP && !on_stack(insn->args[0]))
+	push_home(insn->args[0]);
+    else {
+	n = ir_stack_pops(insn);
+	for (i = first_operand(insn); i < n; i++)
+	    if (!on_stack(insn->args[i]))
+		push_home(insn->args[i]);
+	lower_op(insn);
+    }
+
+    if (ir_has_value(insn)) {
+	if (insn->nuses == 0)
+	    b_pop();
+	else if (IS_HOME_REG(insn->home)) {
+	    b_assign_var_reg(insn->type, HOME_REG_NUM(insn->home));
+	    b_pop();
+	}
+	else if (insn->home != HOME_STACK)
+	    b_store_temp(insn->type, temp_base + 8 * (insn->home - 1));
+    }
+}
+
+
+void ir_lower (IR_FUNC *f, int temp_offset)
+{
+    IR_BLOCK *b;
+    IR_INSN *insn;
+
+    temp_base = temp_offset;
+    for (b = f->first; b != NULL; b = b->next) {
+	if (b->dispatch_label != NULL)
+	    b_dispatch_label(b->label, b->dispatch_label);
+	else if (b->label != NULL)
+	    b_label(b->label);
+	for (insn = b->first; insn != NULL; insn = insn->next)
+	    lower_insn(insn);
+	if (b->fall != NULL && b->fall != b->next)
+	    b_jump(b->fall->label);
+    }
+}
@@ -1,21 +1,43 @@
 #include "defs.h"
 #include "types.h"
 #include "symtab.h"
+#include "options.h"
+#include "message.h"
+#include "elfobj.h"
+#include BACKEND_HEADER_FILE
 
 #include <stdio.h>
 
 FILE *errfp;		/* file to which message.c will write */
+FILE *outfp;		/* file to which the back end writes its code */
+
+/* Size of the user-space buffer of outfp.  The output runs to several
+   lines per source token, so a large buffer saves many write calls. */
+#define OUTPUT_BUFFER_SIZE (1 << 20)
 
 /* For debugging purposes only */
 #ifdef YYDEBUG
 extern int yydebug;
 #endif
 
-int main()
+int main(int argc, char *argv[])
 {
 	int status, yyparse();
 
+	if (!parse_options(argc, argv))
+		return 1;
 	errfp = stderr;
+	if (opt_input != NULL && freopen(opt_input, "r", stdin) == NULL) {
+		perror(opt_input);
+		return 1;
+	}
+	outfp = stdout;
+	if (opt_output != NULL && (outfp = fopen(opt_output, "w")) == NULL) {
+		perror(opt_output);
+		return 1;
+	}
+	setvbuf(outfp, NULL, _IOFBF, OUTPUT_BUFFER_SIZE);
+	b_source_file(opt_input != NULL ? opt_input : "<stdin>");
 	ty_types_init();
 	st_init_symtab();
 	st_establish_data_dump_func(stdr_dump);
@@ -23,9 +45,21 @@ int main()
 	yydebug = 1;		/* DEBUG */
 #endif
 	status = yyparse();
+	/* A program with errors the parser recovered from fails too */
+	if (compiler_errors > 0)
+		status = 1;
+	b_emit_const_pool();
+	if (opt_elf)
+		elf_write(outfp);
 #if 0
 	st_dump();
 #endif
+	if (fclose(outfp) != 0) {
+		perror(opt_output != NULL ? opt_output : "stdout");
+		status = 1;
+	}
+	if (status != 0 && opt_output != NULL)
+		remove(opt_output);
 	return status;
 }
 
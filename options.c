@@ -0,0 +1,178 @@
+/****************************************************************/
+/*								*/
+/*	CSCE531 - "Pascal" Compiler				*/
+/*								*/
+/*	--options.c--						*/
+/*								*/
+/*	Parsing of the ppc3 command line.			*/
+/*								*/
+/****************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "options.h"
+#include BACKEND_HEADER_FILE
+
+BOOLEAN opt_tos_cache = FALSE;
+BOOLEAN opt_sse2 = FALSE;
+BOOLEAN opt_bounds_checks = FALSE;
+BOOLEAN opt_peephole = FALSE;
+BOOLEAN opt_omit_frame_pointer = FALSE;
+BOOLEAN opt_direct_args = FALSE;
+BOOLEAN opt_tail_calls = FALSE;
+BOOLEAN opt_inline = FALSE;
+int opt_inline_limit = 20;
+BOOLEAN opt_simplify = FALSE;
+BOOLEAN opt_cse = FALSE;
+BOOLEAN opt_dce = FALSE;
+BOOLEAN opt_gvn = FALSE;
+BOOLEAN opt_bounds_elim = FALSE;
+BOOLEAN opt_licm = FALSE;
+BOOLEAN opt_regalloc = FALSE;
+BOOLEAN opt_ssa = FALSE;
+BOOLEAN opt_dump_ir = FALSE;
+BOOLEAN opt_elf = FALSE;
+ASM_VERBOSITY opt_verbose_asm = VERBOSE_FULL;
+BOOLEAN opt_debug = FALSE;
+char *opt_input = NULL;
+char *opt_output = NULL;
+
+/* Names of the -fverbose-asm levels, indexed by ASM_VERBOSITY */
+static char *verbosity_names[] = { "none", "lines", "full", NULL };
+
+/* Table of the -f options.  in_O tells whether -O turns the option on. */
+static struct {
+    char *name;
+    BOOLEAN *flag;
+    BOOLEAN in_O;
+} flag_options[] = {
+    { "tos-cache", &opt_tos_cache, TRUE },
+    { "sse2", &opt_sse2, FALSE },
+    { "bounds-checks", &opt_bounds_checks, FALSE },
+    { "peephole", &opt_peephole, TRUE },
+    { "omit-frame-pointer", &opt_omit_frame_pointer, TRUE },
+    { "direct-args", &opt_direct_args, TRUE },
+    { "tail-calls", &opt_tail_calls, TRUE },
+    { "inline", &opt_inline, TRUE },
+    { "simplify", &opt_simplify, TRUE },
+    { "cse", &opt_cse, TRUE },
+    { "dce", &opt_dce, TRUE },
+    { "gvn", &opt_gvn, TRUE },
+    { "bounds-elim", &opt_bounds_elim, TRUE },
+    { "licm", &opt_licm, TRUE },
+    { "regalloc", &opt_regalloc, TRUE },
+    { "ssa", &opt_ssa, TRUE },
+    { "dump-ir", &opt_dump_ir, FALSE },
+    { "elf", &opt_elf, FALSE },
+    { NULL, NULL, FALSE }
+};
+
+static void usage(char *prog)
+{
+    int i;
+
+    fprintf(stderr, "usage: %s [-O] [-f[no-]<option>]... [-g] [-o file] "
+	    "[source.pas]\n", prog);
+    fprintf(stderr, "options:");
+    for (i = 0; flag_options[i].name != NULL; i++)
+	fprintf(stderr, " %s", flag_options[i].name);
+    fprintf(stderr, " verbose-asm[=");
+    for (i = 0; verbosity_names[i] != NULL; i++)
+	fprintf(stderr, "%s%s", i == 0 ? "" : "|", verbosity_names[i]);
+    fprintf(stderr, "] inline-limit=n\n");
+}
+
+BOOLEAN parse_options(int argc, char *argv[])
+{
+    int arg, i;
+
+    for (arg = 1; arg < argc; arg++) {
+	char *name = argv[arg];
+	BOOLEAN value = TRUE;
+
+	if (!strcmp(name, "-O")) {
+	    for (i = 0; flag_options[i].name != NULL; i++)
+		if (flag_options[i].in_O)
+		    *flag_options[i].flag = TRUE;
+	    continue;
+	}
+
+	if (!strcmp(name, "-g")) {
+	    opt_debug = TRUE;
+	    continue;
+	}
+
+	if (name[0] != '-' && opt_input == NULL) {
+	    opt_input = name;
+	    continue;
+	}
+
+	if (!strcmp(name, "-o") && arg + 1 < argc) {
+	    opt_output = argv[++arg];
+	    continue;
+	}
+
+	if (strncmp(name, "-f", 2) != 0) {
+	    usage(argv[0]);
+	    return FALSE;
+	}
+	name += 2;
+	if (!strncmp(name, "no-", 3)) {
+	    name += 3;
+	    value = FALSE;
+	}
+
+	if (!strcmp(name, "verbose-asm")) {
+	    opt_verbose_asm = value ? VERBOSE_FULL : VERBOSE_NONE;
+	    continue;
+	}
+	if (value && !strncmp(name, "verbose-asm=", 12)) {
+	    for (i = 0; verbosity_names[i] != NULL; i++)
+		if (!strcmp(name + 12, verbosity_names[i]))
+		    break;
+	    if (verbosity_names[i] == NULL) {
+		usage(argv[0]);
+		return FALSE;
+	    }
+	    opt_verbose_asm = (ASM_VERBOSITY) i;
+	    continue;
+	}
+	if (value && !strncmp(name, "inline-limit=", 13)) {
+	    char *end;
+	    long limit = strtol(name + 13, &end, 10);
+
+	    if (name[13] == '\0' || *end != '\0' || limit < 0) {
+		usage(argv[0]);
+		return FALSE;
+	    }
+	    opt_inline_limit = (int) limit;
+	    continue;
+	}
+
+	for (i = 0; flag_options[i].name != NULL; i++)
+	    if (!strcmp(name, flag_options[i].name))
+		break;
+	if (flag_options[i].name == NULL) {
+	    usage(argv[0]);
+	    return FALSE;
+	}
+	*flag_options[i].flag = value;
+    }
+
+    if (opt_elf) {
+	/* The object file writer only knows the 32-bit encodings */
+	if (TARGET_PTR_SIZE == 8) {
+	    fprintf(stderr, "%s: -felf is not supported by the x86-64 "
+		    "back end\n", argv[0]);
+	    return FALSE;
+	}
+	if (opt_debug)
+	    fprintf(stderr, "%s: warning: -g is ignored with -felf, which "
+		    "does not emit debugging information\n", argv[0]);
+	opt_verbose_asm = VERBOSE_NONE;
+	opt_debug = FALSE;
+    }
+
+    return TRUE;
+}
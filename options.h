@@ -0,0 +1,144 @@
+/****************************************************************/
+/*								*/
+/*	CSCE531 - "Pascal" Compiler				*/
+/*								*/
+/*	--options.h--						*/
+/*								*/
+/*	Command-line options for ppc3.  Each option is a flag	*/
+/*	consulted by the front end or the back end; main()	*/
+/*	sets them from argv by calling parse_options().		*/
+/*								*/
+/****************************************************************/
+
+#ifndef OPTIONS_H
+#define OPTIONS_H
+
+#include "defs.h"
+
+/* -ftos-cache: keep the top one or two integer/pointer items of the
+   expression stack in registers, spilling them only when forced */
+extern BOOLEAN opt_tos_cache;
+
+/* -fsse2: do Real and Single arithmetic and conversions with scalar SSE2
+   instructions instead of the x87.  Not implied by -O, since the target
+   machine must support SSE2. */
+extern BOOLEAN opt_sse2;
+
+/* -fbounds-checks: check every array index against the bounds of its
+   dimension, stopping the program with a trap if it is outside them (see
+   encode_array in encode.c and b_check_index).  Not implied by -O, since
+   it adds code. */
+extern BOOLEAN opt_bounds_checks;
+
+/* -fpeephole: clean up each function's code with the peephole pass in
+   peephole.c before it is printed */
+extern BOOLEAN opt_peephole;
+
+/* -fomit-frame-pointer: run leaf functions without a frame pointer, and
+   without a return value slot when possible (see frame.c) */
+extern BOOLEAN opt_omit_frame_pointer;
+
+/* -fdirect-args: store the arguments of a call straight into the
+   argument list where the x86 back end can (integer constants, and real
+   values just computed, whose store to the stack top is redirected to the
+   argument slot; other integers go there from the register that
+   -ftos-cache keeps them in), and align the argument list with a constant
+   adjustment of the stack pointer wherever its alignment is known (see
+   frame.c) */
+extern BOOLEAN opt_direct_args;
+
+/* -ftail-calls: turn a call that ends a procedure or function body into
+   a jump, back to the start of the body for a call of the function
+   itself, and to the callee after leaving the frame for others (see
+   encode_tail_call in encode.c) */
+extern BOOLEAN opt_tail_calls;
+
+/* -finline: expand calls of small global procedures and functions whose
+   bodies are straight-line assignments and calls in place of the call
+   (see inline.c) */
+extern BOOLEAN opt_inline;
+
+/* -finline-limit=n: the most expression tree nodes a body may have to be
+   expanded by -finline (20 by default) */
+extern int opt_inline_limit;
+
+/* -fsimplify: fold constant subexpressions and apply integer identities
+   such as x*1 and x+0 as the expression trees are built (see
+   simplify_expr in expr.c) */
+extern BOOLEAN opt_simplify;
+
+/* -fcse: share the nodes of equal subexpressions of a statement as its
+   trees are built, and with -fssa compute each of them once, reusing its
+   value after that (see hash_cons in expr.c and encode_expression) */
+extern BOOLEAN opt_cse;
+
+/* -fdce: with -fssa, take out the code that cannot be reached, the tests
+   of constant conditions and the stores to variables that are never read
+   (see dce.c) */
+extern BOOLEAN opt_dce;
+
+/* -fgvn: with -fssa, reuse the values computed or loaded before on every
+   path instead of computing or loading them again (see gvn.c) */
+extern BOOLEAN opt_gvn;
+
+/* -fbounds-elim: leave out the checks of -fbounds-checks on constant
+   indices, and with -fssa the ones whose indices are known to be in
+   range from for loops, the types of the values or checks before them
+   (see bounds.c) */
+extern BOOLEAN opt_bounds_elim;
+
+/* -flicm: with -fssa, move the computations that give the same value on
+   every iteration of a loop to just before it (see licm.c) */
+extern BOOLEAN opt_licm;
+
+/* -fregalloc: with -fssa, keep local variables, parameters and
+   temporaries in the back end's spare registers where it can (see
+   regalloc.c) */
+extern BOOLEAN opt_regalloc;
+
+/* -fssa: build the code of each body as the SSA intermediate
+   representation of ir.h first, and generate it from that when the body
+   ends */
+extern BOOLEAN opt_ssa;
+
+/* -fdump-ir: with -fssa, print the IR of each body to stderr before it
+   is lowered */
+extern BOOLEAN opt_dump_ir;
+
+/* -felf: write a relocatable ELF32 object file instead of assembly code
+   (see elfobj.c).  Only the x86 back end supports it. */
+extern BOOLEAN opt_elf;
+
+/* How much commentary goes into the assembly code */
+typedef enum {
+    VERBOSE_NONE,	/* instructions and directives only */
+    VERBOSE_LINES,	/* plus a comment for each source line */
+    VERBOSE_FULL	/* plus a comment for each back-end call */
+} ASM_VERBOSITY;
+
+/* -fverbose-asm=none|lines|full: the comments to emit (full by default).
+   -fverbose-asm means full and -fno-verbose-asm means none.  -felf sets
+   it to none, since an object file has no place for comments. */
+extern ASM_VERBOSITY opt_verbose_asm;
+
+/* -g: emit DWARF line numbers (.file and .loc) and call frame information
+   (.cfi_* directives), so that debuggers and profilers can map the code
+   back to source lines and unwind the stack.  -felf turns it off with a
+   warning, since elfobj.c does not build debugging sections. */
+extern BOOLEAN opt_debug;
+
+/* The source file named on the command line, which is read instead of
+   stdin (NULL if none was given) */
+extern char *opt_input;
+
+/* -o file: the file to write the output to instead of stdout (NULL if
+   none was given) */
+extern char *opt_output;
+
+/* Parses the command line and sets the options above.  Flags are of the
+   form -f<name> and -fno-<name>; -O turns on every optimization.
+   Returns FALSE (after printing a usage message) on an unrecognized
+   argument. */
+BOOLEAN parse_options(int argc, char *argv[]);
+
+#endif
@@ -0,0 +1,238 @@
+/****************************************************************/
+/*								*/
+/*	CSCE531 - "Pascal" Compiler				*/
+/*								*/
+/*	--peephole.c--						*/
+/*								*/
+/*	Peephole optimization of the buffered assembly code.	*/
+/*								*/
+/****************************************************************/
+
+/*
+ * The back end translates each stack-machine operation on its own, so
+ * its output is full of short sequences that undo each other: a value is
+ * popped (addl $8, %esp) and the next operation pushes a new one (subl $8,
+ * %esp), a register is stored to the top slot and immediately loaded back,
+ * and so on.  This pass looks at short runs of instructions (comments
+ * and -g's .loc and .cfi_* lines are skipped, so that -g does not change
+ * the code; labels and other directives end a run) and removes or merges
+ * them, repeating until nothing changes:
+ *
+ *   addl/subl $m, %esp; addl/subl $n, %esp   -->  one adjustment, or none
+ *   movX S, (%esp); ...; addl $n, %esp       -->  ...; addl $n, %esp
+ *   movX S, (%esp); ...; movX S2, (%esp)     -->  ...; movX S2, (%esp)
+ *   movX R, M; movX M, R2                    -->  movX R, M; movX R, R2
+ *   movX R, R                                -->  (nothing)
+ *   jmp/jcc L; L:                            -->  L:
+ *
+ * In the second and third rules, S and S2 are registers or immediates,
+ * n >= 8, and the instructions in between may use only registers and
+ * immediates; they are safe because nothing ever reads below the stack
+ * pointer.  In long mode %rsp takes the place
+ * of %esp, and movl R, R is kept, because writing a 32-bit register clears
+ * the upper half of the 64-bit one.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "peephole.h"
+#include "message.h"
+
+/* The moves that the store/reload and self-move rules apply to */
+static char *mov_ops[] = {
+    "movb", "movw", "movl", "movq", "movss", "movsd", NULL
+};
+
+static BOOLEAN is_mov (ASM_LIST rec)
+{
+    int i;
+
+    if (rec->kind != AK_INSN || rec->nargs != 2)
+	return FALSE;
+    for (i = 0; mov_ops[i] != NULL; i++)
+	if (!strcmp(rec->op, mov_ops[i]))
+	    return TRUE;
+    return FALSE;
+}
+
+static BOOLEAN is_reg (char *arg)
+{
+    return arg[0] == '%';
+}
+
+static BOOLEAN is_mem (char *arg)
+{
+    return arg[0] != '$' && strchr(arg, '(') != NULL;
+}
+
+/* Returns the index of the first record at or after i that is not deleted
+   and not a comment or debugging directive, or -1 if there is none */
+static int next_live (ASM_LIST recs[], int n, int i)
+{
+    for ( ; i < n; i++)
+	if (!recs[i]->deleted && recs[i]->kind != AK_COMMENT
+	    && recs[i]->kind != AK_DEBUG)
+	    return i;
+    return -1;
+}
+
+/* If rec adds a constant to or subtracts a constant from the stack
+   pointer, sets *amount to the signed change and returns TRUE */
+static BOOLEAN is_sp_adjust (ASM_LIST rec, BOOLEAN long_mode, long *amount)
+{
+    char *end;
+    long n;
+
+    if (rec->kind != AK_INSN || rec->nargs != 2 || rec->args[0][0] != '$'
+	|| strcmp(rec->args[1], long_mode ? "%rsp" : "%esp"))
+	return FALSE;
+    n = strtol(rec->args[0] + 1, &end, 10);
+    if (*end != '\0')
+	return FALSE;
+    if (!strcmp(rec->op, long_mode ? "addq" : "addl"))
+	*amount = n;
+    else if (!strcmp(rec->op, long_mode ? "subq" : "subl"))
+	*amount = -n;
+    else
+	return FALSE;
+    return TRUE;
+}
+
+/* Merges two adjacent stack pointer adjustments into a */
+static BOOLEAN fold_sp_adjust (ASM_LIST a, ASM_LIST b, BOOLEAN long_mode)
+{
+    long m, n;
+    char *imm;
+
+    if (!is_sp_adjust(a, long_mode, &m) || !is_sp_adjust(b, long_mode, &n))
+	return FALSE;
+
+    b->deleted = TRUE;
+    if (m + n == 0) {
+	a->deleted = TRUE;
+	return TRUE;
+    }
+    imm = (char *) malloc(24);
+    if (imm == NULL)
+	bug("peephole: out of memory");
+    sprintf(imm, "$%ld", m + n > 0 ? m + n : -(m + n));
+    if (long_mode)
+	asm_set_insn(a, m + n > 0 ? "addq" : "subq", imm, "%rsp");
+    else
+	asm_set_insn(a, m + n > 0 ? "addl" : "subl", imm, "%esp");
+    return TRUE;
+}
+
+/* Tells whether rec can be moved past a store to the top stack slot
+   without reading it: it must be an instruction that has only register
+   and immediate operands and does not use the stack implicitly */
+static BOOLEAN ignores_stack (ASM_LIST rec)
+{
+    int i;
+
+    if (rec->kind != AK_INSN)
+	return FALSE;
+    if (rec->nargs == 0)
+	return !strcmp(rec->op, "cltd") || !strcmp(rec->op, "cqto")
+	    || !strcmp(rec->op, "cltq");
+    if (rec->op[0] == 'j' || !strncmp(rec->op, "push", 4)
+	|| !strncmp(rec->op, "pop", 3) || !strncmp(rec->op, "call", 4))
+	return FALSE;
+    for (i = 0; i < rec->nargs; i++)
+	if (strchr(rec->args[i], '(') != NULL || strstr(rec->args[i], "sp"))
+	    return FALSE;
+    return TRUE;
+}
+
+/* Deletes a store to the top stack slot that is popped, or overwritten by
+   a store of the same size, before anything can read it */
+static BOOLEAN drop_dead_store (ASM_LIST recs[], int n, int i,
+				BOOLEAN long_mode)
+{
+    ASM_LIST a = recs[i], b;
+    char *top = long_mode ? "(%rsp)" : "(%esp)";
+    long amount;
+
+    if (!is_mov(a) || strchr(a->args[0], '(') != NULL
+	|| strcmp(a->args[1], top))
+	return FALSE;
+    for (i = next_live(recs, n, i + 1); i >= 0; i = next_live(recs, n, i + 1)) {
+	b = recs[i];
+	if ((is_sp_adjust(b, long_mode, &amount) && amount >= 8)
+	    || (is_mov(b) && !strcmp(b->op, a->op) && !strcmp(b->args[1], top)
+		&& strchr(b->args[0], '(') == NULL)) {
+	    a->deleted = TRUE;
+	    return TRUE;
+	}
+	if (!ignores_stack(b))
+	    return FALSE;
+    }
+    return FALSE;
+}
+
+/* Turns a reload of the value just stored into a register move */
+static BOOLEAN forward_store (ASM_LIST a, ASM_LIST b)
+{
+    if (!is_mov(a) || !is_mov(b) || strcmp(a->op, b->op))
+	return FALSE;
+    if (!is_reg(a->args[0]) || !is_mem(a->args[1])
+	|| strcmp(a->args[1], b->args[0]) || !is_reg(b->args[1]))
+	return FALSE;
+    asm_set_insn(b, b->op, a->args[0], b->args[1]);
+    return TRUE;
+}
+
+/* Deletes a register move to itself */
+static BOOLEAN drop_self_move (ASM_LIST a, BOOLEAN long_mode)
+{
+    if (!is_mov(a) || !is_reg(a->args[0]) || strcmp(a->args[0], a->args[1]))
+	return FALSE;
+    if (long_mode && !strcmp(a->op, "movl"))
+	return FALSE;
+    a->deleted = TRUE;
+    return TRUE;
+}
+
+/* Deletes a jump to a label that follows it (possibly after other labels) */
+static BOOLEAN drop_jump_to_next (ASM_LIST recs[], int n, int i)
+{
+    ASM_LIST a = recs[i];
+
+    if (a->kind != AK_INSN || a->op[0] != 'j' || a->nargs != 1)
+	return FALSE;
+    for (i = next_live(recs, n, i + 1); i >= 0 && recs[i]->kind == AK_LABEL;
+	 i = next_live(recs, n, i + 1))
+	if (!strcmp(recs[i]->op, a->args[0])) {
+	    a->deleted = TRUE;
+	    return TRUE;
+	}
+    return FALSE;
+}
+
+
+void peephole (ASM_LIST recs[], int n, BOOLEAN long_mode)
+{
+    BOOLEAN changed;
+    int i, j;
+
+    do {
+	changed = FALSE;
+	for (i = next_live(recs, n, 0); i >= 0; i = next_live(recs, n, i + 1)) {
+	    if (recs[i]->kind != AK_INSN)
+		continue;
+	    if (drop_self_move(recs[i], long_mode)
+		|| drop_jump_to_next(recs, n, i)) {
+		changed = TRUE;
+		continue;
+	    }
+	    j = next_live(recs, n, i + 1);
+	    if (j < 0 || recs[j]->kind != AK_INSN)
+		continue;
+	    if (fold_sp_adjust(recs[i], recs[j], long_mode)
+		|| drop_dead_store(recs, n, i, long_mode)
+		|| forward_store(recs[i], recs[j]))
+		changed = TRUE;
+	}
+    } while (changed);
+}
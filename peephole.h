@@ -0,0 +1,21 @@
+/****************************************************************/
+/*								*/
+/*	CSCE531 - "Pascal" Compiler				*/
+/*								*/
+/*	--peephole.h--						*/
+/*								*/
+/*	Peephole optimization of the buffered assembly code	*/
+/*	(enabled by -fpeephole).				*/
+/*								*/
+/****************************************************************/
+
+#ifndef PEEPHOLE_H
+#define PEEPHOLE_H
+
+#include "asmbuf.h"
+
+/* Rewrites the n records of recs in place, marking records that are no
+   longer needed as deleted.  long_mode is TRUE for x86-64 code. */
+void peephole (ASM_LIST recs[], int n, BOOLEAN long_mode);
+
+#endif
@@ -0,0 +1,717 @@
+/****************************************************************/
+/*								*/
+/*	CSCE531 - "Pascal" Compiler				*/
+/*								*/
+/*	--regalloc.c--						*/
+/*								*/
+/*	Register allocation for the lowering of the SSA		*/
+/*	intermediate representation (see ir.h), enabled by	*/
+/*	-fregalloc.						*/
+/*								*/
+/****************************************************************/
+
+/*
+ * The back end has B_NUM_VAR_REGS registers that its code leaves alone
+ * and that calls preserve (see b_push_var_reg).  They are given out by
+ * linear scan over the instructions in layout order, first to variables
+ * before the lowering is planned, then to the temporaries it needed.
+ *
+ * A local variable or parameter can live in a register if everything
+ * that takes its address only loads, stores or increments it, all with
+ * the same type, and no nested function uses the frame.  Its interval
+ * runs from its first reference to its last, and the value of a variable
+ * may go around a loop, so an interval that meets a loop is widened to
+ * cover all of it; a loop is the stretch from a block to one that jumps
+ * back to it.  Each reference weighs ten times as much for each loop
+ * around it.  When the registers run out, the interval of least weight
+ * stays in the frame.  A parameter that is read is loaded into its
+ * register on entry to the body, after the label that a self tail call
+ * jumps back to.
+ *
+ * A variable left in the frame may still have a register over a loop
+ * that refers to it, if none of the others has that register there: its
+ * live range is split at the edges into and out of the loop.  It is
+ * loaded into the register at the end of the loop's preheader, and if
+ * the loop may change it, stored back at the start of each block the
+ * loop leaves to; in between, its references in the loop use the
+ * register.  The heaviest variables are split first, each over the
+ * outermost loops that have a register free.
+ *
+ * A temporary is defined once and used after, in the same iteration of
+ * any loop around both, so its interval is only widened by a loop that
+ * it does not lie within.  The temporaries get the registers where no
+ * variable's interval meets theirs, and those left over keep their slots
+ * in the frame, renumbered.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "ir.h"
+#include "message.h"
+
+/* Loops are never counted more than this deep in the weights */
+#define MAX_DEPTH 3
+
+/* A live interval, of positions start to end, of a variable (at offset
+   in the frame) or a temporary (value) */
+typedef struct {
+    int offset;
+    IR_VALUE value;
+    TYPETAG type;
+    BOOLEAN ok, is_param, read;
+    int start, end;
+    long weight;
+    int reg;
+} INTERVAL;
+
+/* The position of each instruction in the layout, indexed by id, and of
+   the first and last instructions of each block, indexed by index */
+static int *pos = NULL;
+static int *block_start = NULL, *block_end = NULL;
+
+/* The loops, as ranges of positions, and the block each starts with */
+typedef struct {
+    int start, end;
+    IR_BLOCK *header;
+} RANGE;
+static RANGE *loops = NULL;
+static int nloops, loops_size;
+
+static INTERVAL *ivals = NULL;
+static int nivals, ivals_size;
+
+/* The pieces of the variables left in the frame that are kept in a
+   register over a loop, and the blocks of the loop looked at, indexed by
+   block index */
+static INTERVAL *pieces = NULL;
+static int npieces, pieces_size;
+static char *in_loop = NULL;
+
+
+static void *ra_alloc (void *p, int *size, int n, size_t elsize)
+{
+    if (n < *size)
+	return p;
+    *size = *size ? 2 * *size : 16;
+    p = realloc(p, *size * elsize);
+    if (p == NULL)
+	bug("regalloc: out of memory");
+    return p;
+}
+
+
+/* Numbers the instructions in layout order from 1, and finds the loops */
+static void number_insns (IR_FUNC *f)
+{
+    IR_BLOCK *b;
+    IR_INSN *insn;
+    int n = 0, i;
+
+    pos = (int *) realloc(pos, (f->ninsns + 1) * sizeof(int));
+    block_start = (int *) realloc(block_start, (f->nblocks + 1) * sizeof(int));
+    block_end = (int *) realloc(block_end, (f->nblocks + 1) * sizeof(int));
+    if (pos == NULL || block_start == NULL || block_end == NULL)
+	bug("regalloc: out of memory");
+    for (b = f->first; b != NULL; b = b->next) {
+	block_start[b->index] = n + 1;
+	for (insn = b->first; insn != NULL; insn = insn->next)
+	    pos[insn->id] = ++n;
+	block_end[b->index] = n;
+    }
+
+    nloops = 0;
+    for (b = f->first; b != NULL; b = b->next)
+	for (i = 0; i < b->nsuccs; i++)
+	    if (block_start[b->succs[i]->index] <= block_end[b->index]) {
+		loops = ra_alloc(loops, &loops_size, nloops, sizeof(RANGE));
+		loops[nloops].start = block_start[b->succs[i]->index];
+		loops[nloops].end = block_end[b->index];
+		loops[nloops].header = b->succs[i];
+		nloops++;
+	    }
+}
+
+
+/* The weight of a reference at position p: 10 for each loop around it */
+static long weight_at (int p)
+{
+    long w = 1;
+    int depth = 0, i;
+
+    for (i = 0; i < nloops && depth < MAX_DEPTH; i++)
+	if (loops[i].start <= p && p <= loops[i].end) {
+	    w *= 10;
+	    depth++;
+	}
+    return w;
+}
+
+
+/* Widens the interval over the loops it meets, or with within set only
+   over those it does not lie within, until there are no more */
+static void widen (INTERVAL *iv, BOOLEAN within)
+{
+    BOOLEAN changed;
+    int i;
+
+    do {
+	changed = FALSE;
+	for (i = 0; i < nloops; i++) {
+	    RANGE *r = &loops[i];
+
+	    if (r->start > iv->end || r->end < iv->start)
+		continue;
+	    if (!within && r->start <= iv->start && iv->end <= r->end)
+		continue;
+	    if (r->start < iv->start) {
+		iv->start = r->start;
+		changed = TRUE;
+	    }
+	    if (r->end > iv->end) {
+		iv->end = r->end;
+		changed = TRUE;
+	    }
+	}
+    } while (changed);
+}
+
+
+static INTERVAL *new_interval (void)
+{
+    INTERVAL *iv;
+
+    ivals = ra_alloc(ivals, &ivals_size, nivals, sizeof(INTERVAL));
+    iv = &ivals[nivals++];
+    memset(iv, 0, sizeof(*iv));
+    iv->reg = -1;
+    return iv;
+}
+
+
+/* The interval of the variable at offset, or NULL */
+static INTERVAL *find_var (int offset)
+{
+    int i;
+
+    for (i = 0; i < nivals; i++)
+	if (ivals[i].value == NULL && ivals[i].offset == offset)
+	    return &ivals[i];
+    return NULL;
+}
+
+
+/* Tells whether a variable of the type fits in a register */
+static BOOLEAN reg_type (TYPETAG type)
+{
+    switch (type) {
+    case TYSIGNEDCHAR:
+    case TYUNSIGNEDCHAR:
+    case TYSIGNEDINT:
+    case TYUNSIGNEDINT:
+    case TYSIGNEDLONGINT:
+    case TYUNSIGNEDLONGINT:
+    case TYPTR:
+	return TRUE;
+    default:
+	return FALSE;
+    }
+}
+
+
+/* Notes the use of the local address v as operand i of insn (at position
+   p), or elsewhere if insn is NULL */
+static void note_var_use (IR_VALUE v, IR_INSN *insn, int i, int p)
+{
+    INTERVAL *iv = find_var((int) v->imm);
+
+    if (iv == NULL) {
+	iv = new_interval();
+	iv->offset = (int) v->imm;
+	iv->type = insn != NULL ? insn->type : TYVOID;
+	iv->ok = TRUE;
+	iv->start = iv->end = p;
+    }
+    if (insn == NULL || i != 0 || insn->type != iv->type
+	|| !reg_type(insn->type))
+	iv->ok = FALSE;
+    else
+	switch (insn->op) {
+	case IR_INC_DEC:
+	    if (insn->type != TYSIGNEDLONGINT
+		&& insn->type != TYUNSIGNEDLONGINT && insn->type != TYPTR)
+		iv->ok = FALSE;
+	    /* falls through */
+	case IR_LOAD:
+	    iv->read = TRUE;
+	    break;
+	case IR_STORE:
+	    break;
+	default:
+	    iv->ok = FALSE;
+	    break;
+	}
+    if (p < iv->start)
+	iv->start = p;
+    if (p > iv->end)
+	iv->end = p;
+    iv->weight += weight_at(p);
+}
+
+
+static int by_start (const void *a, const void *b)
+{
+    const INTERVAL *x = *(const INTERVAL **) a, *y = *(const INTERVAL **) b;
+
+    return x->start != y->start ? x->start - y->start : x->end - y->end;
+}
+
+
+/* Gives registers to the n intervals in order of start, spilling the one
+   of least weight when they run out, and taking the registers of the
+   intervals in fixed (of nfixed) as in use.  Returns the highest register
+   used, or -1. */
+static int linear_scan (INTERVAL **order, int n, INTERVAL *fixed, int nfixed)
+{
+    INTERVAL *active[B_NUM_VAR_REGS];
+    int maxreg = -1, i, j, r;
+
+    memset(active, 0, sizeof(active));
+    qsort(order, n, sizeof(INTERVAL *), by_start);
+    for (i = 0; i < n; i++) {
+	INTERVAL *iv = order[i], *victim = NULL;
+	BOOLEAN blocked[B_NUM_VAR_REGS];
+
+	for (r = 0; r < B_NUM_VAR_REGS; r++) {
+	    blocked[r] = FALSE;
+	    for (j = 0; j < nfixed; j++)
+		if (fixed[j].reg == r && fixed[j].start <= iv->end
+		    && iv->start <= fixed[j].end)
+		    blocked[r] = TRUE;
+	    if (active[r] != NULL && active[r]->end < iv->start)
+		active[r] = NULL;
+	}
+	for (r = 0; r < B_NUM_VAR_REGS; r++)
+	    if (!blocked[r] && active[r] == NULL)
+		break;
+	if (r == B_NUM_VAR_REGS) {
+		/* Evict the active interval of least weight, if lighter */
+	    for (j = 0; j < B_NUM_VAR_REGS; j++)
+		if (!blocked[j] && active[j]->weight < iv->weight
+		    && (victim == NULL || active[j]->weight < victim->weight)) {
+		    victim = active[j];
+		    r = j;
+		}
+	    if (victim == NULL)
+		continue;
+	    victim->reg = -1;
+	}
+	iv->reg = r;
+	active[r] = iv;
+	if (r > maxreg)
+	    maxreg = r;
+    }
+    return maxreg;
+}
+
+
+/* Copies the variable in iv between its slot in the frame and register
+   reg, into the register if to_reg is set, before the instruction before
+   in b, or at the end of b if that is NULL */
+static void copy_var (INTERVAL *iv, int reg, BOOLEAN to_reg, IR_BLOCK *b,
+		      IR_INSN *before)
+{
+    IR_INSN *addr, *load, *raddr, *store;
+
+    addr = ir_new_insn(IR_LOCAL_ADDR, TYPTR, 0);
+    addr->imm = iv->offset;
+    raddr = ir_new_insn(IR_LOCAL_ADDR, TYPTR, 0);
+    raddr->imm = iv->offset;
+    raddr->home = HOME_REG(reg);
+    load = ir_new_insn(IR_LOAD, iv->type, 1);
+    load->args[0] = to_reg ? addr : raddr;
+    store = ir_new_insn(IR_STORE, iv->type, 2);
+    store->args[0] = to_reg ? raddr : addr;
+    store->args[1] = load;
+    addr->nuses = load->nuses = raddr->nuses = 1;
+
+	/* The address stored to comes first, so that the loaded value can
+	   go straight from the operand stack */
+    if (before != NULL) {
+	ir_insert_before(store->args[0], before);
+	ir_insert_before(load->args[0], before);
+	ir_insert_before(load, before);
+	ir_insert_before(store, before);
+    }
+    else {
+	ir_move_insn(store->args[0], b);
+	ir_move_insn(load->args[0], b);
+	ir_move_insn(load, b);
+	ir_move_insn(store, b);
+    }
+}
+
+
+/* Loads the parameter in iv from the frame into its register at the
+   start of the body */
+static void load_param (IR_FUNC *f, INTERVAL *iv)
+{
+    copy_var(iv, iv->reg, TRUE, f->first, f->first->first);
+}
+
+
+/* Finds the intervals of the variables whose addresses are only loaded
+   from, stored to and incremented.  Their homes are left alone. */
+static void find_vars (IR_FUNC *f)
+{
+    IR_BLOCK *b;
+    IR_INSN *insn;
+    int i;
+
+    nivals = 0;
+    for (b = f->first; b != NULL; b = b->next) {
+	for (i = 0; i < b->nstack; i++)
+	    if (b->stack[i]->op == IR_LOCAL_ADDR)
+		note_var_use(b->stack[i], NULL, 0, block_start[b->index]);
+	for (insn = b->first; insn != NULL; insn = insn->next)
+	    for (i = 0; i < insn->nargs; i++)
+		if (insn->args[i]->op == IR_LOCAL_ADDR)
+		    note_var_use(insn->args[i], insn, i, pos[insn->id]);
+    }
+    for (i = 0; i < nivals; i++) {
+	int j;
+
+	for (j = 0; j < f->nparams; j++)
+	    if (f->params[j] == ivals[i].offset) {
+		ivals[i].is_param = TRUE;
+		ivals[i].start = 0;
+	    }
+	widen(&ivals[i], TRUE);
+    }
+}
+
+
+/* Marks the blocks of the loop in in_loop, and returns its preheader if a
+   variable can be kept in a register over it alone: the header must be
+   the only block entered from outside, from one block that goes nowhere
+   else, and each block the loop leaves to must come after it and be
+   entered only from it.  Returns NULL otherwise. */
+static IR_BLOCK *find_preheader (IR_FUNC *f, RANGE *loop)
+{
+    IR_BLOCK *b, *s, *pre = NULL;
+    int i, j;
+
+    memset(in_loop, 0, f->nblocks + 1);
+    for (b = loop->header; b != NULL; b = b->next) {
+	in_loop[b->index] = TRUE;
+	if (b->first != NULL && block_end[b->index] >= loop->end)
+	    break;
+    }
+    if (loop->header->dispatch_label != NULL)
+	return NULL;
+    for (b = loop->header; b != NULL && in_loop[b->index]; b = b->next) {
+	for (i = 0; i < b->npreds; i++)
+	    if (!in_loop[b->preds[i]->index]) {
+		if (b != loop->header || pre != NULL)
+		    return NULL;
+		pre = b->preds[i];
+	    }
+	for (i = 0; i < b->nsuccs; i++) {
+	    s = b->succs[i];
+	    if (in_loop[s->index])
+		continue;
+	    if (block_start[s->index] <= loop->end || s->dispatch_label != NULL)
+		return NULL;
+	    for (j = 0; j < s->npreds; j++)
+		if (!in_loop[s->preds[j]->index])
+		    return NULL;
+	}
+    }
+    if (pre == NULL || pre->nsuccs != 1 || pre->dead)
+	return NULL;
+    return pre;
+}
+
+
+/* Tells whether the loop marked in in_loop refers to the variable at
+   offset through addresses of its own, and sets *stored if it may change
+   it.  An address used both in the loop and outside makes it FALSE. */
+static BOOLEAN refers_to (IR_FUNC *f, int offset, BOOLEAN *stored)
+{
+    IR_BLOCK *b;
+    IR_INSN *insn;
+    BOOLEAN found = FALSE;
+    int i;
+
+    *stored = FALSE;
+    for (b = f->first; b != NULL; b = b->next)
+	for (insn = b->first; insn != NULL; insn = insn->next)
+	    for (i = 0; i < insn->nargs; i++) {
+		IR_VALUE v = insn->args[i];
+
+		if (v->op != IR_LOCAL_ADDR || v->imm != offset)
+		    continue;
+		if (in_loop[v->block->index] != in_loop[b->index])
+		    return FALSE;
+		if (!in_loop[b->index])
+		    continue;
+		found = TRUE;
+		if (insn->op != IR_LOAD)
+		    *stored = TRUE;
+	    }
+    return found;
+}
+
+
+/* Returns a register that neither a variable nor a piece of one has from
+   start to end, or -1 */
+static int free_reg (int start, int end)
+{
+    int r, i;
+
+    for (r = 0; r < B_NUM_VAR_REGS; r++) {
+	for (i = 0; i < nivals; i++)
+	    if (ivals[i].ok && ivals[i].reg == r && ivals[i].start <= end
+		&& start <= ivals[i].end)
+		break;
+	if (i < nivals)
+	    continue;
+	for (i = 0; i < npieces; i++)
+	    if (pieces[i].reg == r && pieces[i].start <= end
+		&& start <= pieces[i].end)
+		break;
+	if (i == npieces)
+	    return r;
+    }
+    return -1;
+}
+
+
+static int by_size (const void *a, const void *b)
+{
+    const RANGE *x = (const RANGE *) a, *y = (const RANGE *) b;
+
+    return (y->end - y->start) - (x->end - x->start);
+}
+
+
+static int by_weight (const void *a, const void *b)
+{
+    const INTERVAL *x = *(const INTERVAL **) a, *y = *(const INTERVAL **) b;
+
+    return x->weight < y->weight ? 1 : x->weight > y->weight ? -1 : 0;
+}
+
+
+/* Keeps the variable in iv, which stays in the frame, in a register over
+   the loops that refer to it where one is free: outermost loops first.
+   It is loaded into the register at the end of the preheader and stored
+   back at the start of each block the loop leaves to. */
+static void split_var (IR_FUNC *f, INTERVAL *iv)
+{
+    IR_BLOCK *b, *pre;
+    IR_INSN *insn;
+    BOOLEAN stored;
+    int start, end, i, j, r;
+
+    for (i = 0; i < nloops; i++) {
+	RANGE *loop = &loops[i];
+
+	for (j = 0; j < npieces; j++)
+	    if (pieces[j].offset == iv->offset && pieces[j].start <= loop->end
+		&& loop->start <= pieces[j].end)
+		break;
+	if (j < npieces || (pre = find_preheader(f, loop)) == NULL
+	    || !refers_to(f, iv->offset, &stored))
+	    continue;
+
+	    /* The register is in use from the load in the preheader to the
+	       stores after the loop */
+	start = block_end[pre->index] < loop->start
+	    ? block_end[pre->index] : loop->start;
+	end = loop->end;
+	for (b = f->first; b != NULL; b = b->next)
+	    if (!in_loop[b->index] && b->npreds > 0
+		&& in_loop[b->preds[0]->index] && block_start[b->index] > end)
+		end = block_start[b->index];
+	r = free_reg(start, end);
+	if (r < 0)
+	    continue;
+
+	pieces = ra_alloc(pieces, &pieces_size, npieces, sizeof(INTERVAL));
+	pieces[npieces] = *iv;
+	pieces[npieces].start = start;
+	pieces[npieces].end = end;
+	pieces[npieces].reg = r;
+	npieces++;
+
+	for (b = f->first; b != NULL; b = b->next)
+	    if (in_loop[b->index])
+		for (insn = b->first; insn != NULL; insn = insn->next)
+		    if (insn->op == IR_LOCAL_ADDR && insn->imm == iv->offset)
+			insn->home = HOME_REG(r);
+	if (iv->read)
+	    copy_var(iv, r, TRUE, pre, NULL);
+	if (!stored)
+	    continue;
+	for (b = f->first; b != NULL; b = b->next)
+	    if (!in_loop[b->index] && b->npreds > 0
+		&& in_loop[b->preds[0]->index]) {
+		for (insn = b->first; insn != NULL && insn->op == IR_PHI;
+		     insn = insn->next)
+		    ;
+		copy_var(iv, r, FALSE, b, insn);
+	    }
+    }
+}
+
+
+void ir_alloc_var_regs (IR_FUNC *f)
+{
+    IR_BLOCK *b;
+    IR_INSN *insn;
+    INTERVAL **order;
+    int n = 0, i;
+
+    number_insns(f);
+    find_vars(f);
+    order = (INTERVAL **) malloc((nivals + 1) * sizeof(INTERVAL *));
+    if (order == NULL)
+	bug("regalloc: out of memory");
+    for (i = 0; i < nivals; i++)
+	if (ivals[i].ok)
+	    order[n++] = &ivals[i];
+    linear_scan(order, n, NULL, 0);
+
+    for (b = f->first; b != NULL; b = b->next)
+	for (insn = b->first; insn != NULL; insn = insn->next)
+	    if (insn->op == IR_LOCAL_ADDR && insn->nuses > 0) {
+		INTERVAL *iv = find_var((int) insn->imm);
+
+		if (iv != NULL && iv->ok && iv->reg >= 0)
+		    insn->home = HOME_REG(iv->reg);
+	    }
+    for (i = 0; i < nivals; i++)
+	if (ivals[i].ok && ivals[i].reg >= 0 && ivals[i].is_param
+	    && ivals[i].read)
+	    load_param(f, &ivals[i]);
+
+	/* The variables left in the frame, heaviest first, get registers
+	   over the loops where some are free */
+    in_loop = (char *) realloc(in_loop, f->nblocks + 1);
+    if (in_loop == NULL)
+	bug("regalloc: out of memory");
+    qsort(loops, nloops, sizeof(RANGE), by_size);
+    qsort(order, n, sizeof(INTERVAL *), by_weight);
+    npieces = 0;
+    for (i = 0; i < n; i++)
+	if (order[i]->reg < 0)
+	    split_var(f, order[i]);
+    free(order);
+}
+
+
+int ir_alloc_temp_regs (IR_FUNC *f, int ntemps, int *nregs)
+{
+    IR_BLOCK *b;
+    IR_INSN *insn;
+    INTERVAL *vars = NULL, **order;
+    int nvars = 0, vars_size = 0, n = 0, maxreg = -1, i, j, t;
+    int *renumber;
+
+	/* The intervals of the variables in registers, one for each register
+	   a variable is kept in, as they are now that the parameters and the
+	   pieces are loaded and stored */
+    number_insns(f);
+    for (b = f->first; b != NULL; b = b->next)
+	for (insn = b->first; insn != NULL; insn = insn->next)
+	    for (j = 0; j < insn->nargs; j++) {
+		IR_VALUE v = insn->args[j];
+		int p = pos[insn->id];
+
+		if (v->op != IR_LOCAL_ADDR || !IS_HOME_REG(v->home))
+		    continue;
+		for (i = 0; i < nvars; i++)
+		    if (vars[i].offset == v->imm
+			&& vars[i].reg == HOME_REG_NUM(v->home))
+			break;
+		if (i == nvars) {
+		    vars = ra_alloc(vars, &vars_size, nvars, sizeof(INTERVAL));
+		    memset(&vars[nvars], 0, sizeof(INTERVAL));
+		    vars[nvars].offset = (int) v->imm;
+		    vars[nvars].reg = HOME_REG_NUM(v->home);
+		    vars[nvars].start = vars[nvars].end = p;
+		    if (vars[nvars].reg > maxreg)
+			maxreg = vars[nvars].reg;
+		    nvars++;
+		}
+		if (p < vars[i].start)
+		    vars[i].start = p;
+		if (p > vars[i].end)
+		    vars[i].end = p;
+	    }
+    for (i = 0; i < nvars; i++)
+	widen(&vars[i], TRUE);
+
+	/* The intervals of the temporaries that fit in registers */
+    nivals = 0;
+    renumber = (int *) calloc(ntemps + 1, sizeof(int));
+    if (renumber == NULL)
+	bug("regalloc: out of memory");
+    for (b = f->first; b != NULL; b = b->next)
+	for (insn = b->first; insn != NULL; insn = insn->next)
+	    if (insn->home >= 1 && reg_type(insn->type)) {
+		INTERVAL *iv = new_interval();
+
+		iv->value = insn;
+		iv->type = insn->type;
+		iv->start = iv->end = pos[insn->id];
+		iv->weight = weight_at(iv->start);
+		renumber[insn->home] = nivals;
+	    }
+    for (b = f->first; b != NULL; b = b->next)
+	for (insn = b->first; insn != NULL; insn = insn->next)
+	    for (i = 0; i < insn->nargs; i++) {
+		IR_VALUE v = insn->args[i];
+		INTERVAL *iv;
+
+		if (v->home < 1 || !reg_type(v->type))
+		    continue;
+		iv = &ivals[renumber[v->home] - 1];
+		if (pos[insn->id] < iv->start)
+		    iv->start = pos[insn->id];
+		if (pos[insn->id] > iv->end)
+		    iv->end = pos[insn->id];
+		iv->weight += weight_at(pos[insn->id]);
+	    }
+
+    order = (INTERVAL **) malloc((nivals + 1) * sizeof(INTERVAL *));
+    if (order == NULL)
+	bug("regalloc: out of memory");
+    for (i = 0; i < nivals; i++) {
+	widen(&ivals[i], FALSE);
+	order[n++] = &ivals[i];
+    }
+    t = linear_scan(order, n, vars, nvars);
+    if (t > maxreg)
+	maxreg = t;
+    for (i = 0; i < nivals; i++)
+	if (ivals[i].reg >= 0)
+	    ivals[i].value->home = HOME_REG(ivals[i].reg);
+
+	/* The temporaries left keep slots in the frame */
+    memset(renumber, 0, (ntemps + 1) * sizeof(int));
+    t = 0;
+    for (b = f->first; b != NULL; b = b->next)
+	for (insn = b->first; insn != NULL; insn = insn->next)
+	    if (insn->home >= 1) {
+		if (renumber[insn->home] == 0)
+		    renumber[insn->home] = ++t;
+		insn->home = renumber[insn->home];
+	    }
+
+    free(renumber);
+    free(order);
+    free(vars);
+    *nregs = maxreg + 1;
+    return t;
+}
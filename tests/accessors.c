@@ -0,0 +1,3 @@
+#include "rt.h"
+extern long X, Y, Z, Cnt, A; extern double R;
+void Done(void){ P("x",X); P("y",Y); P("z",Z); P("cnt",Cnt); P("a",A); PD("r",R); }
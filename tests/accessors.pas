@@ -0,0 +1,83 @@
+program getset;
+var x, y, z, cnt, a : Integer;
+    r : Real;
+
+procedure Done; external;
+
+procedure SetX(v : Integer);
+begin
+  x := v
+end;
+
+function GetX : Integer;
+begin
+  GetX := x
+end;
+
+function Add(p, q : Integer) : Integer;
+begin
+  Add := p + q
+end;
+
+procedure Bump(var t : Integer; d : Integer);
+begin
+  t := t + d
+end;
+
+function Scale(s : Real; k : Integer) : Real;
+begin
+  Scale := s * k
+end;
+
+procedure Both(v : Integer);
+begin
+  x := v;
+  y := v
+end;
+
+function Next : Integer;
+begin
+  cnt := cnt + 1;
+  Next := cnt
+end;
+
+function Twice : Integer;
+begin
+  Twice := GetX + GetX
+end;
+
+procedure Shadow;
+var x : Integer;
+begin
+  x := 100;
+  SetX(x + 1);
+  z := z + x
+end;
+
+procedure Chain(v : Integer);
+begin
+  SetX(v);
+  Bump(y, v)
+end;
+
+begin
+  x := 0; y := 0; z := 0; cnt := 0;
+  SetX(5);
+  SetX(GetX + 1);
+  z := Add(1, 2) + Add(x, GetX);
+  Bump(z, 10);
+  Bump(x, x);
+  r := Scale(2, 3) + Scale(0.5, x);
+  Both(7);
+  a := y;
+  Both(x + 1);
+  a := a + y * 100;
+  Both(z);
+  a := a + y * 10000;
+  y := Next + Next * 10;
+  z := z + Twice;
+  Shadow;
+  Chain(3);
+  a := a + Add(a, 1);
+  Done
+end.
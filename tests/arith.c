@@ -0,0 +1,3 @@
+#include "rt.h"
+extern long I,J,K,S; extern double R,Q; extern float F; extern unsigned char C,D; extern signed char B,E; extern long M[4][5]; extern double V[8];
+void Done(void){ P("I",I); P("K",K); P("S",S); PD("R",R); PD("Q",Q); PD("F",F); P("C",C); P("D",D); P("B",B); P("E",E); P("M23",M[2][2]); PD("V3",V[2]); }
@@ -0,0 +1,51 @@
+program arith;
+var i, j, k, s : Integer;
+    r, q : Real;
+    f : Single;
+    c, d : Char;
+    b, e : Boolean;
+    m : array[0..3, 1..5] of Integer;
+    v : array[1..8] of Real;
+
+procedure Done; external;
+
+begin
+  i := 17; j := -5; k := 0; s := 0;
+  k := i div 3; s := s + k;
+  k := i mod 5; s := s * 10 + k;
+  k := (i - j) * (i + j); s := s + k;
+  k := -i; s := s + k;
+  k := j div 2; s := s * 3 + k;
+  k := j mod 3; s := s * 3 + k;
+  k := (i * 1000) div 7 - (i * 1000) mod 9; s := s + k;
+  k := -(i * 100) div 16 + i mod 8; s := s + k;
+  f := 1.5; r := f; r := r * 2 + i; q := -r;
+  c := 'A'; d := succ(c); c := pred(d);
+  k := ord(d); s := s + k;
+  b := (i > j) ; e := r <= q;
+  for i := 0 to 3 do
+    for j := 1 to 5 do
+      m[i, j] := i * 10 + j;
+  k := m[2, 3] + m[3, 5]; s := s + k;
+  for i := 8 downto 1 do v[i] := i * 0.5;
+  q := v[3] + v[8];
+  i := 0;
+  while i < 100 do
+  begin
+    i := i + 7;
+    if i > 50 then break
+  end;
+  case i of
+    1, 2: k := 1;
+    3..55: k := 2;
+    56: k := 3
+  else
+    k := 4
+  end;
+  s := s + k;
+  s := s + 1000;
+  if r > 10.0 then s := s + 1 else s := s - 1;
+  if c = 'A' then s := s + 2;
+  if b <> e then s := s + 4;
+  Done
+end.
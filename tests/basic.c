@@ -0,0 +1,3 @@
+#include "rt.h"
+extern long I,J; extern double R; extern unsigned char C; extern signed char B; extern long A[10];
+void Done(void){ P("I",I); P("J",J); PD("R",R); P("C",C); P("B",B); P("A2",A[1]); }
@@ -0,0 +1,20 @@
+program foo;
+var i, j : Integer;
+    r : Real;
+    c : Char;
+    b : Boolean;
+    a : array[1..10] of Integer;
+
+procedure Done; external;
+
+begin
+  i := 3;
+  j := i * 7 + 2;
+  r := j * 2.5;
+  a[2] := j - 1;
+  c := 'x';
+  b := i < j;
+  if b then i := i + 100 else i := 0;
+  while j > 0 do j := j - 5;
+  Done
+end.
@@ -0,0 +1,4 @@
+#include "rt.h"
+extern long I, J, Q, R, K, C1, C2, C3, C4;
+void Done(void){ P("I",I); P("J",J); P("Q",Q); P("R",R); P("K",K);
+  P("C1",C1); P("C2",C2); P("C3",C3); P("C4",C4); }
@@ -0,0 +1,63 @@
+program bigint;
+var i, j, q, r, k, n, x, y, c1, c2, c3, c4 : Integer;
+procedure Done; external;
+function F(a : Integer) : Integer;
+begin
+  F := a - 1
+end;
+begin
+  i := 5000000000;
+  j := i div 4294967296;
+  q := i mod 4294967296;
+  r := i * 3 + 10000000000;
+  if i > 4294967296 then r := r + 1;
+  if r < 3000000000 then r := 0;
+  i := -123456789012345;
+  j := j + i div 10000000007;
+  q := q + i mod 10000000007;
+  r := r + i div -4294967296;
+  k := i mod 1099511627776;
+  k := k + (i div 1099511627776) * 1000;
+  q := q + F(7000000000) * 10;
+  j := j + (i - -9000000000) div 3;
+  c1 := 0; c2 := 0; c3 := 0; c4 := 0;
+  for n := 0 to 7 do
+  begin
+    x := 4999999998 + n;
+    y := -x;
+    case x of
+      5000000000: c1 := c1 * 10 + 1;
+      5000000001, 5000000003: c1 := c1 * 10 + 2;
+      -5000000000: c1 := c1 * 10 + 3
+    else
+      c1 := c1 * 10
+    end;
+    case x of
+      4999999998, 5000000000, 5000000002, 5000000004: c2 := c2 * 10 + 1;
+      5000000005: c2 := c2 * 10 + 2;
+      5000000001: c2 := c2 * 10 + 3
+    else
+      c2 := c2 * 10
+    end;
+    case y of
+      -5000000005: c3 := c3 * 10 + 1;
+      -5000000004: c3 := c3 * 10 + 2;
+      -5000000003, -5000000002: c3 := c3 * 10 + 3;
+      -5000000001: c3 := c3 * 10 + 4;
+      -4999999999: c3 := c3 * 10 + 5
+    else
+      c3 := c3 * 10
+    end;
+    case x of
+      1: c4 := c4 * 10 + 1;
+      4611686018427387904: c4 := c4 * 10 + 2;
+      -4611686018427387904: c4 := c4 * 10 + 3;
+      9223372036854775807: c4 := c4 * 10 + 4;
+      5000000003..5000000005: c4 := c4 * 10 + 5;
+      4999999999: c4 := c4 * 10 + 6
+    else
+      c4 := c4 * 10
+    end
+  end;
+  Done
+end.
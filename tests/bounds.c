@@ -0,0 +1,3 @@
+#include "rt.h"
+extern long S, I, J;
+void Done(void){ P("S",S); P("I",I); P("J",J); }
@@ -0,0 +1,21 @@
+program bounds;
+var a : array[1..10] of Integer; i, j, n, s : Integer; c : Char;
+    h : array[0..255] of Integer;
+procedure Done; external;
+begin
+  s := 0; n := 10;
+  for i := 1 to n do a[i] := i;
+  for i := 1 to 10 do s := s + a[i];
+  c := 'A';
+  h[Ord(c)] := 5;
+  s := s + h[65];
+  j := 3;
+  s := s + a[j] + a[j];
+  for i := 1 to 9 do s := s + a[i + 1];
+  for i := 2 to 10 do s := s + a[i - 1];
+  for i := 1 to 10 do s := s + h[i mod 7];
+  i := 5;
+  j := n + 1 - 4;
+  s := s + a[j];
+  Done
+end.
@@ -0,0 +1,3 @@
+#include "rt.h"
+extern long I,K,S,N; extern unsigned char C;
+void Done(void){ P("K",K); P("S",S); P("N",N); P("C",C); }
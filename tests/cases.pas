@@ -0,0 +1,80 @@
+program cases;
+var i, k, s, n : Integer;
+    c : Char;
+
+procedure Done; external;
+
+begin
+  s := 0; n := 0;
+  for i := -50 to 300 do
+  begin
+    case i of
+      0: k := 1;
+      1: k := 2;
+      2: k := 3;
+      3, 4: k := 4;
+      6: k := 5;
+      7..9: k := 6;
+      10: k := 7
+    else
+      k := 0
+    end;
+    s := (s * 7 + k) mod 1000003;
+    case i of
+      1, 3, 5, 7, 9, 11: k := 1;
+      2, 4, 6: k := 2;
+      20..25, 27: k := 3
+    else
+      k := 9
+    end;
+    s := (s * 7 + k) mod 1000003;
+    case i of
+      -40: k := 1;
+      7: k := 2;
+      100: k := 3;
+      150: k := 4;
+      200: k := 5;
+      250: k := 6;
+      299: k := 7
+    else
+      k := 8
+    end;
+    s := (s * 7 + k) mod 1000003;
+    k := 11;
+    case i of
+      -30: k := 1;
+      100, 101: k := 2;
+      102: k := 3;
+      103: k := 4;
+      105: k := 5;
+      106..108: k := 6;
+      250: k := 7;
+      280: k := 8
+    end;
+    s := (s * 7 + k) mod 1000003;
+    case i mod 5 of
+      0: case i of
+           10, 20, 30: k := 1;
+           40..60: k := 2
+         else
+           k := 3
+         end;
+      1, 2: k := 4;
+      -1: k := 5
+    else
+      n := n + 1
+    end;
+    s := (s * 7 + k) mod 1000003;
+    c := chr(i mod 128 + 128 * ord(i < 0));
+    case c of
+      'a'..'z': k := 1;
+      'A'..'Z': k := 2;
+      '0'..'9': k := 3;
+      ' ', '.', ',': k := 4
+    else
+      k := 5
+    end;
+    s := (s * 7 + k) mod 1000003
+  end;
+  Done
+end.
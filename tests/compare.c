@@ -0,0 +1,3 @@
+#include "rt.h"
+extern long I,J,N,S; extern double X,Y; extern unsigned char C; extern signed char T; extern long H[20];
+void Done(void){ P("I",I); P("J",J); P("N",N); P("S",S); PD("X",X); PD("Y",Y); P("T",T); P("H5",H[4]); }
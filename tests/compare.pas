@@ -0,0 +1,53 @@
+program cmp;
+var i, j, n, s : Integer;
+    x, y : Real;
+    c : Char;
+    t : Boolean;
+    h : array[1..20] of Integer;
+
+procedure Done; external;
+
+begin
+  s := 0; n := 0;
+  x := 2.5; y := -1.25;
+  if x < y then s := s + 1;
+  if x <= y then s := s + 2;
+  if x > y then s := s + 4;
+  if x >= y then s := s + 8;
+  if x = y then s := s + 16;
+  if x <> y then s := s + 32;
+  i := 3; j := 3;
+  if i < j then s := s + 64;
+  if i <= j then s := s + 128;
+  if i > j then s := s + 256;
+  if i >= j then s := s + 512;
+  if i = j then s := s + 1024;
+  if i <> j then s := s + 2048;
+  for i := 1 to 20 do h[i] := (i * 37 + 11) mod 17 - 8;
+  for i := 1 to 20 do
+  begin
+    j := h[i];
+    case j of
+      -8..-5: n := n + 1;
+      -4, -3, 0: n := n + 10;
+      1..3: n := n + 100
+    else
+      n := n + 1000
+    end
+  end;
+  c := 'q';
+  case c of
+    'a'..'m': n := n + 7;
+    'n'..'z': n := n + 70000
+  end;
+  j := 0;
+  for i := 10 downto 1 do
+  begin
+    j := j + i * i;
+    if j > 200 then break
+  end;
+  t := (j > 100) = (i < 5);
+  x := (x + y) * (x - y) * 1.0 + j;
+  y := -x * 2.0 - 1.5;
+  Done
+end.
@@ -0,0 +1,3 @@
+#include "rt.h"
+extern long I,J,K,S,N; extern unsigned char C;
+void Done(void){ P("I",I); P("K",K); P("S",S); P("N",N); P("C",C); }
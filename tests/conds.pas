@@ -0,0 +1,45 @@
+program conds;
+var i, j, k, s, n : Integer;
+    c : Char;
+    b : Boolean;
+    r : Real;
+
+procedure Done; external;
+
+begin
+  s := 0; n := 0; i := 0; j := 5;
+  repeat
+    i := i + 1;
+    if i < 3 then s := s + 1;
+    if i <= 3 then s := s + 10;
+    if i > 7 then s := s + 100 else s := s + 1000;
+    if i >= j then s := s + 10000;
+    if i = j then s := s - 7;
+    if i <> 4 then n := n + 1
+  until i = 12;
+  k := 0;
+  while k < i do
+  begin
+    k := k + 3;
+    if k > 20 then break
+  end;
+  c := 'a';
+  while c < 'f' do
+  begin
+    c := succ(c);
+    if c = 'c' then s := s + 3
+  end;
+  b := true;
+  if b then s := s + 50;
+  r := 2.5;
+  if r > 2.0 then s := s + 500;
+  for j := 1 to 10 do
+    if j mod 3 = 0 then n := n + 10;
+  for j := 10 downto -3 do
+    if j < 0 then n := n + 100;
+  i := 0;
+  repeat
+    i := i - 1
+  until i <= -9;
+  Done
+end.
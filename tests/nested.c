@@ -0,0 +1,3 @@
+#include "rt.h"
+extern long Total, R; extern double X;
+void Done(void){ P("total",Total); P("r",R); PD("x",X); }
@@ -0,0 +1,80 @@
+program nest;
+var total, r : Integer;
+    x : Real;
+
+procedure Done; external;
+
+procedure Outer(n : Integer; var acc : Integer);
+var k, depth : Integer;
+    w : Real;
+
+  procedure Add(v : Integer);
+  begin
+    acc := acc + v;
+    depth := depth + 1
+  end;
+
+  procedure Middle(m : Integer);
+  var j : Integer;
+
+    procedure Inner;
+    begin
+      Add(m * 10 + j);
+      w := w + 0.5;
+      k := k + 1
+    end;
+
+  begin
+    for j := 1 to m do
+      Inner
+  end;
+
+begin
+  k := 0; depth := 0; w := 1.0;
+  Add(n);
+  Middle(3);
+  if n > 0 then
+    Outer(n - 1, acc);
+  acc := acc + k * 1000 + depth * 100000;
+  x := x + w
+end;
+
+function Fact(n : Integer) : Integer;
+  function Helper : Integer;
+  begin
+    if n <= 1 then Fact := 1 else Fact := n * 2;
+    Helper := n
+  end;
+begin
+  r := Helper;
+  if n > 1 then Fact := n * Fact(n - 1)
+end;
+
+function Twice(a : Real; b : Integer) : Real;
+begin
+  Twice := a * 2 + b
+end;
+
+procedure Mix(c : Char; b : Boolean; s : Single; i : Integer);
+begin
+  total := total + ord(c) * i;
+  if b then x := x + s
+end;
+
+procedure Sub2(a, b : Integer; var p, q : Integer);
+begin
+  p := a - b;
+  q := b - a
+end;
+
+begin
+  total := 0; x := 0;
+  Outer(2, total);
+  r := Fact(5);
+  total := total + r;
+  x := x + Twice(1.5, 3);
+  Mix('A', r > 100, 0.25, 2);
+  Mix(succ('A'), r < 100, 0.5, 3);
+  Sub2(total, 1000000, total, r);
+  Done
+end.
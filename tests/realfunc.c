@@ -0,0 +1,3 @@
+#include "rt.h"
+extern double Y, Z;
+void Done(void){ PD("Y",Y); PD("Z",Z); }
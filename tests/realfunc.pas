@@ -0,0 +1,19 @@
+program realfunc;
+var y, z: real; k: integer;
+procedure Done; external;
+function sq(x: real): real;
+begin sq := x * x end;
+function pick(x: real; b: boolean): real;
+begin if b then pick := x else pick := 2.0 * x end;
+function third(x: real): real;
+begin third := 1.0; third := x * 0.25 end;
+function sum(n: integer): real;
+var s: real; i: integer;
+begin s := 0.0; for i := 1 to n do s := s + sq(i * 0.5); sum := s end;
+begin
+y := sq(3.0) + pick(1.5, false) + pick(0.25, true);
+z := 0.0;
+for k := 1 to 10 do z := z + third(k) * sq(k);
+z := z + sum(20);
+Done
+end.
@@ -0,0 +1,3 @@
+#include "rt.h"
+extern long S;
+void Done(void){ P("S",S); }
@@ -0,0 +1,22 @@
+program regs;
+var S : Integer;
+procedure Done; external;
+procedure P(n : Integer);
+var a, b, c, d, e, i, j, k : Integer;
+begin
+  a := 1; b := 2; c := 3; d := 4; e := 5;
+  for i := 1 to n do
+  begin
+    a := a + i; b := b + a; c := c + b; d := d + c; e := e + d
+  end;
+  k := 0;
+  for j := 1 to n do
+    k := k + j * 2;
+  while k > 100 do
+    k := k - 7;
+  S := a + b + c + d + e + k
+end;
+begin
+  P(20);
+  Done
+end.
@@ -0,0 +1,89 @@
+/*
+ * A minimal freestanding runtime for the test programs (see run.sh).  It
+ * writes to stdout with system calls, so the tests link without a C
+ * library, for either back end.  P prints an integer variable and PD a
+ * real one (to 4 decimal places, truncated), each as name=value on a line.
+ */
+
+static void sys_write (const char *s, int n)
+{
+#ifdef __x86_64__
+  long r;
+  __asm__ volatile ("syscall" : "=a" (r)
+		    : "a" (1), "D" (1), "S" (s), "d" (n) : "rcx", "r11", "memory");
+#else
+  int r;
+  __asm__ volatile ("int $0x80" : "=a" (r)
+		    : "a" (4), "b" (1), "c" (s), "d" (n) : "memory");
+#endif
+}
+
+static void ps (const char *s)
+{
+  int n = 0;
+
+  while (s[n])
+      n++;
+  sys_write (s, n);
+}
+
+static void pi (long v)
+{
+  char b[32];
+  int n = 31, neg = v < 0;
+  unsigned long u = neg ? -(unsigned long) v : (unsigned long) v;
+
+  b[n] = 0;
+  do {
+      b[--n] = '0' + u % 10;
+      u /= 10;
+  } while (u);
+  if (neg)
+      b[--n] = '-';
+  ps (b + n);
+}
+
+static void pd (double d)
+{
+  long ip;
+  int k, dg;
+  char c;
+
+  if (d < 0) {
+      ps ("-");
+      d = -d;
+  }
+  ip = (long) d;
+  pi (ip);
+  ps (".");
+  d -= ip;
+  for (k = 0; k < 4; k++) {
+      d *= 10;
+      dg = (int) d;
+      c = '0' + dg;
+      sys_write (&c, 1);
+      d -= dg;
+  }
+}
+
+#define P(name, v) (ps (name), ps ("="), pi (v), ps ("\n"))
+#define PD(name, v) (ps (name), ps ("="), pd (v), ps ("\n"))
+
+/* The Pascal program's main */
+int main (void);
+
+#ifdef __x86_64__
+void _start (void)
+{
+  __asm__ volatile ("andq $-16, %rsp");
+  main ();
+  __asm__ volatile ("syscall" : : "a" (60), "D" (0));
+}
+#else
+void _start (void)
+{
+  __asm__ volatile ("andl $-16, %esp");
+  main ();
+  __asm__ volatile ("int $0x80" : : "a" (1), "b" (0));
+}
+#endif
@@ -0,0 +1,82 @@
+#!/bin/sh
+#
+# Runs the test programs with a ppc3 compiler and compares what they
+# print with the expected output:
+#
+#	sh tests/run.sh 32|64 path/to/ppc3 [ppc3 options...]
+#
+# The first argument says which back end the compiler was built with
+# (backend-x86 or backend-x86_64).  Each test is a Pascal program
+# name.pas that calls the external procedure Done at its end.  Done is
+# defined by the C file name.c, which prints the program's global
+# variables with the helpers in rt.h.  That small runtime makes the
+# system calls itself, so no C library is needed, and the test passes if
+# the output is name.out.  A test that has name.out64 instead is run for
+# the 64-bit back end only, because Integer is 32 bits on x86.  The
+# programs are assembled with as and linked with ld, with the C files
+# compiled by gcc (-m32 for the 32-bit back end).  With -felf the
+# compiler writes the object file itself, which is linked directly; that
+# option is skipped for the 64-bit back end, which does not have it.
+#
+
+if [ $# -lt 2 ] || { [ "$1" != 32 ] && [ "$1" != 64 ]; }; then
+    echo "usage: $0 32|64 ppc3 [ppc3 options...]" >&2
+    exit 2
+fi
+bits=$1
+ppc3=$2
+shift 2
+
+elf=false
+for opt; do
+    [ "$opt" = -felf ] && elf=true
+done
+if $elf && [ $bits = 64 ]; then
+    echo "$bits-bit, options \"$*\": skipped"
+    exit 0
+fi
+
+if [ $bits = 64 ]; then
+    asflags=--64 ccflags=-m64 emul=elf_x86_64
+else
+    asflags=--32 ccflags=-m32 emul=elf_i386
+fi
+
+dir=`dirname "$0"`
+tmp=`mktemp -d` || exit 2
+trap 'rm -rf "$tmp"' 0 1 2 15
+
+pass=0
+fail=0
+for src in "$dir"/*.pas; do
+    name=`basename "$src" .pas`
+    expected="$dir/$name.out"
+    if [ ! -f "$expected" ]; then
+	expected="$dir/$name.out64"
+	[ $bits = 64 ] && [ -f "$expected" ] || continue
+    fi
+
+    if $elf; then
+	"$ppc3" "$@" < "$src" > "$tmp/$name.o" 2> "$tmp/$name.err"
+    else
+	"$ppc3" "$@" < "$src" > "$tmp/$name.s" 2> "$tmp/$name.err" \
+	    && as $asflags -o "$tmp/$name.o" "$tmp/$name.s"
+    fi
+    if [ $? = 0 ] \
+	&& gcc $ccflags -O1 -ffreestanding -fno-pic -fno-stack-protector \
+	       -nostdlib -c -o "$tmp/$name.rt.o" "$dir/$name.c" \
+	&& ld -m $emul -static -o "$tmp/$name" "$tmp/$name.o" \
+	      "$tmp/$name.rt.o" 2> /dev/null \
+	&& "$tmp/$name" > "$tmp/$name.out" \
+	&& cmp -s "$expected" "$tmp/$name.out"; then
+	pass=`expr $pass + 1`
+    else
+	echo "FAIL: $name ($*)"
+	cat "$tmp/$name.err" 2> /dev/null
+	[ -f "$tmp/$name.out" ] && diff "$expected" "$tmp/$name.out"
+	fail=`expr $fail + 1`
+    fi
+done
+
+echo "$bits-bit, options \"$*\": $pass passed, $fail failed"
+[ $fail = 0 ]
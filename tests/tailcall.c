@@ -0,0 +1,4 @@
+#include "rt.h"
+extern long N, S, Odds; extern double Acc; extern unsigned char C;
+void Note(long v){ P("note",v); }
+void Done(void){ P("n",N); P("s",S); P("odds",Odds); P("c",C); PD("acc",Acc); }
@@ -0,0 +1,95 @@
+program tail;
+var n, s, odds : Integer;
+    acc : Real;
+    c : Char;
+
+procedure Done; external;
+procedure Note(v : Integer); external;
+
+procedure Count(k : Integer; var total : Integer);
+begin
+  total := total + k;
+  if k > 0 then
+    Count(k - 1, total)
+end;
+
+procedure Loop(k : Integer; step : Integer);
+begin
+  s := s + step;
+  if k > 0 then Loop(k - 1, step + 1)
+end;
+
+function Sum(k, a : Integer) : Integer;
+begin
+  if k = 0 then
+    Sum := a
+  else
+    Sum := Sum(k - 1, a + k)
+end;
+
+function IsEven(k : Integer) : Boolean; forward;
+
+function IsOdd(k : Integer) : Boolean;
+begin
+  if k = 0 then IsOdd := false
+  else IsOdd := IsEven(k - 1)
+end;
+
+function IsEven(k : Integer) : Boolean;
+begin
+  if k = 0 then IsEven := true
+  else IsEven := IsOdd(k - 1)
+end;
+
+function Half(x : Real; k : Integer) : Real;
+begin
+  if k = 0 then Half := x
+  else Half := Half(x * 0.5, k - 1)
+end;
+
+procedure Chars(ch : Char; k : Integer);
+begin
+  c := ch;
+  if k > 0 then Chars(succ(ch), k - 1)
+end;
+
+procedure Report(k : Integer);
+begin
+  Note(k)
+end;
+
+procedure Outer(k : Integer);
+var local : Integer;
+
+  procedure Inner(j : Integer);
+  begin
+    local := local + j;
+    if j > 0 then Inner(j - 1)
+  end;
+
+begin
+  local := 0;
+  Inner(k);
+  Report(local)
+end;
+
+procedure Scale(f : Single; k : Integer);
+begin
+  acc := acc + f;
+  if k > 0 then Scale(acc, k - 1)
+end;
+
+begin
+  n := 0; s := 0; acc := 0;
+  Count(10000, n);
+  Loop(10000, 1);
+  odds := 0;
+  if IsOdd(10001) then odds := odds + 1;
+  if IsEven(10001) then odds := odds + 10;
+  Outer(10);
+  Chars('A', 5);
+  Scale(0.5, 3);
+  acc := acc + Half(1024.0, 4);
+  n := n + Sum(1000, 0);
+  Done
+end.
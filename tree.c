@@ -14,6 +14,7 @@
  */
  
 #include "tree.h"
+#include "functions.h"
 
 TYPE_LIST unresolveds = NULL;
 
@@ -414,14 +415,16 @@ PARAM_LIST append_to_param_list(PARAM_LIST list, PARAM_LIST p)
 
 PARAM_LIST merge_param_lists(PARAM_LIST list1, PARAM_LIST list2)
 {
+    PARAM_LIST last = list1;
+    
     //go to end of list
-    while(list1->next)
+    while(last->next)
     {
-        list1 = list1->next;
+        last = last->next;
     }
     
     //append list2 onto list1
-    list1->next = list2;
+    last->next = list2;
     return list1;
 }
 
@@ -431,25 +434,20 @@ PARAM_LIST id_list_to_param_list(stid_list idList, TYPE listType, BOOLEAN isRef)
     PARAM_LIST list = NULL;
     
     //while list is not null
+    //The id list is in reverse order, so each parameter goes in front
     while (idList)
     {
-        if(list == NULL)
-        {
-            list = make_new_param_list(listType);
-        }
-        else
-        {
-            PARAM_LIST newItem = make_new_param_list(listType);
-            list = append_to_param_list(list, newItem);
-        }
+        PARAM_LIST newItem = make_new_param_list(listType);
         
-        list->id = idList->enrollment_papers;
-        //message(st_get_id_str(list->id));      
+        newItem->id = idList->enrollment_papers;
+        //message(st_get_id_str(newItem->id));      
         if(isRef)
         {
-        		list->type = ty_build_ptr(list->type);
+        		newItem->type = ty_build_ptr(listType);
         }
-        list->is_ref = isRef;
+        newItem->is_ref = isRef;
+        newItem->next = list;
+        list = newItem;
         idList = idList->next;
     }
     
@@ -500,6 +498,8 @@ void vardec(stid_list list, TYPE t)
     {
         dr = stdr_alloc();           
         dr->u.decl.type = t;
+        dr->u.decl.is_ref = FALSE;
+        dr->u.decl.err = FALSE;
         
         // Block 0 (install block) and 1 (global block) are reserved.
         // Any other blocks are local blocks, so variables must be installed
@@ -513,6 +513,7 @@ void vardec(stid_list list, TYPE t)
         {
             //This is a local variable
             dr->tag = LDECL;            
+            dr->u.decl.v.offset = alloc_local_var(t);
         }
         
         BOOLEAN newRec = st_install(list->enrollment_papers, dr);
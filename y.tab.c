@@ -0,0 +1,4374 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 47 "gram.y"
+
+
+/* Cause the `yydebug' variable to be defined.  */
+#define YYDEBUG 1
+
+#include "tree.h"
+#include "encode.h"
+#include "expr.h"
+#include "functions.h"
+#include "types.h"
+
+void set_yydebug(int);
+void yyerror(char *);
+
+/* Like YYERROR but do call yyerror */
+#define YYERROR1 { yyerror ("syntax error"); YYERROR; }
+
+
+#line 90 "y.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+/* Use api.header.include to #include this header
+   instead of duplicating it here.  */
+#ifndef YY_YY_Y_TAB_H_INCLUDED
+# define YY_YY_Y_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    LEX_ID = 258,                  /* LEX_ID  */
+    LEX_ARRAY = 259,               /* LEX_ARRAY  */
+    LEX_BEGIN = 260,               /* LEX_BEGIN  */
+    LEX_CASE = 261,                /* LEX_CASE  */
+    LEX_CONST = 262,               /* LEX_CONST  */
+    LEX_DO = 263,                  /* LEX_DO  */
+    LEX_DOWNTO = 264,              /* LEX_DOWNTO  */
+    LEX_END = 265,                 /* LEX_END  */
+    LEX_FILE = 266,                /* LEX_FILE  */
+    LEX_FOR = 267,                 /* LEX_FOR  */
+    LEX_FUNCTION = 268,            /* LEX_FUNCTION  */
+    LEX_GOTO = 269,                /* LEX_GOTO  */
+    LEX_IF = 270,                  /* LEX_IF  */
+    LEX_LABEL = 271,               /* LEX_LABEL  */
+    LEX_NIL = 272,                 /* LEX_NIL  */
+    LEX_OF = 273,                  /* LEX_OF  */
+    LEX_PACKED = 274,              /* LEX_PACKED  */
+    LEX_PROCEDURE = 275,           /* LEX_PROCEDURE  */
+    LEX_PROGRAM = 276,             /* LEX_PROGRAM  */
+    LEX_RECORD = 277,              /* LEX_RECORD  */
+    LEX_REPEAT = 278,              /* LEX_REPEAT  */
+    LEX_SET = 279,                 /* LEX_SET  */
+    LEX_THEN = 280,                /* LEX_THEN  */
+    LEX_TO = 281,                  /* LEX_TO  */
+    LEX_TYPE = 282,                /* LEX_TYPE  */
+    LEX_UNTIL = 283,               /* LEX_UNTIL  */
+    LEX_VAR = 284,                 /* LEX_VAR  */
+    LEX_WHILE = 285,               /* LEX_WHILE  */
+    LEX_WITH = 286,                /* LEX_WITH  */
+    LEX_FORWARD = 287,             /* LEX_FORWARD  */
+    pp_SIN = 288,                  /* pp_SIN  */
+    pp_COS = 289,                  /* pp_COS  */
+    pp_EXP = 290,                  /* pp_EXP  */
+    pp_LN = 291,                   /* pp_LN  */
+    pp_SQRT = 292,                 /* pp_SQRT  */
+    pp_ARCTAN = 293,               /* pp_ARCTAN  */
+    rr_POW = 294,                  /* rr_POW  */
+    rr_EXPON = 295,                /* rr_EXPON  */
+    r_WRITE = 296,                 /* r_WRITE  */
+    r_READ = 297,                  /* r_READ  */
+    r_INITFDR = 298,               /* r_INITFDR  */
+    r_LAZYTRYGET = 299,            /* r_LAZYTRYGET  */
+    r_LAZYGET = 300,               /* r_LAZYGET  */
+    r_LAZYUNGET = 301,             /* r_LAZYUNGET  */
+    r_POW = 302,                   /* r_POW  */
+    r_EXPON = 303,                 /* r_EXPON  */
+    z_ABS = 304,                   /* z_ABS  */
+    z_ARCTAN = 305,                /* z_ARCTAN  */
+    z_COS = 306,                   /* z_COS  */
+    z_EXP = 307,                   /* z_EXP  */
+    z_LN = 308,                    /* z_LN  */
+    z_SIN = 309,                   /* z_SIN  */
+    z_SQRT = 310,                  /* z_SQRT  */
+    z_POW = 311,                   /* z_POW  */
+    z_EXPON = 312,                 /* z_EXPON  */
+    set_card = 313,                /* set_card  */
+    set_isempty = 314,             /* set_isempty  */
+    set_equal = 315,               /* set_equal  */
+    set_le = 316,                  /* set_le  */
+    set_less = 317,                /* set_less  */
+    set_in = 318,                  /* set_in  */
+    set_clear = 319,               /* set_clear  */
+    set_include = 320,             /* set_include  */
+    set_exclude = 321,             /* set_exclude  */
+    set_include_range = 322,       /* set_include_range  */
+    set_copy = 323,                /* set_copy  */
+    set_intersection = 324,        /* set_intersection  */
+    set_union = 325,               /* set_union  */
+    set_diff = 326,                /* set_diff  */
+    set_symdiff = 327,             /* set_symdiff  */
+    p_DONEFDR = 328,               /* p_DONEFDR  */
+    gpc_IOCHECK = 329,             /* gpc_IOCHECK  */
+    gpc_RUNTIME_ERROR = 330,       /* gpc_RUNTIME_ERROR  */
+    p_INPUT = 331,                 /* p_INPUT  */
+    p_OUTPUT = 332,                /* p_OUTPUT  */
+    p_REWRITE = 333,               /* p_REWRITE  */
+    p_RESET = 334,                 /* p_RESET  */
+    p_PUT = 335,                   /* p_PUT  */
+    p_GET = 336,                   /* p_GET  */
+    p_WRITE = 337,                 /* p_WRITE  */
+    p_READ = 338,                  /* p_READ  */
+    p_WRITELN = 339,               /* p_WRITELN  */
+    p_READLN = 340,                /* p_READLN  */
+    p_PAGE = 341,                  /* p_PAGE  */
+    p_NEW = 342,                   /* p_NEW  */
+    p_DISPOSE = 343,               /* p_DISPOSE  */
+    p_ABS = 344,                   /* p_ABS  */
+    p_SQR = 345,                   /* p_SQR  */
+    p_SIN = 346,                   /* p_SIN  */
+    p_COS = 347,                   /* p_COS  */
+    p_EXP = 348,                   /* p_EXP  */
+    p_LN = 349,                    /* p_LN  */
+    p_SQRT = 350,                  /* p_SQRT  */
+    p_ARCTAN = 351,                /* p_ARCTAN  */
+    p_TRUNC = 352,                 /* p_TRUNC  */
+    p_ROUND = 353,                 /* p_ROUND  */
+    p_PACK = 354,                  /* p_PACK  */
+    p_UNPACK = 355,                /* p_UNPACK  */
+    p_ORD = 356,                   /* p_ORD  */
+    p_CHR = 357,                   /* p_CHR  */
+    p_SUCC = 358,                  /* p_SUCC  */
+    p_PRED = 359,                  /* p_PRED  */
+    p_ODD = 360,                   /* p_ODD  */
+    p_EOF = 361,                   /* p_EOF  */
+    p_EOLN = 362,                  /* p_EOLN  */
+    p_MAXINT = 363,                /* p_MAXINT  */
+    p_TRUE = 364,                  /* p_TRUE  */
+    p_FALSE = 365,                 /* p_FALSE  */
+    bp_RANDOM = 366,               /* bp_RANDOM  */
+    bp_RANDOMIZE = 367,            /* bp_RANDOMIZE  */
+    BREAK = 368,                   /* BREAK  */
+    CONTINUE = 369,                /* CONTINUE  */
+    RETURN_ = 370,                 /* RETURN_  */
+    RESULT = 371,                  /* RESULT  */
+    EXIT = 372,                    /* EXIT  */
+    FAIL = 373,                    /* FAIL  */
+    p_CLOSE = 374,                 /* p_CLOSE  */
+    CONJUGATE = 375,               /* CONJUGATE  */
+    p_DEFINESIZE = 376,            /* p_DEFINESIZE  */
+    SIZEOF = 377,                  /* SIZEOF  */
+    BITSIZEOF = 378,               /* BITSIZEOF  */
+    ALIGNOF = 379,                 /* ALIGNOF  */
+    TYPEOF = 380,                  /* TYPEOF  */
+    gpc_RETURNADDRESS = 381,       /* gpc_RETURNADDRESS  */
+    gpc_FRAMEADDRESS = 382,        /* gpc_FRAMEADDRESS  */
+    LEX_LABEL_ADDR = 383,          /* LEX_LABEL_ADDR  */
+    LEX_INTCONST = 384,            /* LEX_INTCONST  */
+    LEX_STRCONST = 385,            /* LEX_STRCONST  */
+    LEX_REALCONST = 386,           /* LEX_REALCONST  */
+    LEX_RANGE = 387,               /* LEX_RANGE  */
+    LEX_ELLIPSIS = 388,            /* LEX_ELLIPSIS  */
+    LEX_ASSIGN = 389,              /* LEX_ASSIGN  */
+    LEX_IN = 390,                  /* LEX_IN  */
+    LEX_NE = 391,                  /* LEX_NE  */
+    LEX_GE = 392,                  /* LEX_GE  */
+    LEX_LE = 393,                  /* LEX_LE  */
+    LEX_OR = 394,                  /* LEX_OR  */
+    LEX_OR_ELSE = 395,             /* LEX_OR_ELSE  */
+    LEX_CEIL_PLUS = 396,           /* LEX_CEIL_PLUS  */
+    LEX_CEIL_MINUS = 397,          /* LEX_CEIL_MINUS  */
+    LEX_FLOOR_PLUS = 398,          /* LEX_FLOOR_PLUS  */
+    LEX_FLOOR_MINUS = 399,         /* LEX_FLOOR_MINUS  */
+    LEX_DIV = 400,                 /* LEX_DIV  */
+    LEX_MOD = 401,                 /* LEX_MOD  */
+    LEX_AND = 402,                 /* LEX_AND  */
+    LEX_AND_THEN = 403,            /* LEX_AND_THEN  */
+    LEX_SHL = 404,                 /* LEX_SHL  */
+    LEX_SHR = 405,                 /* LEX_SHR  */
+    LEX_XOR = 406,                 /* LEX_XOR  */
+    LEX_CEIL_MULT = 407,           /* LEX_CEIL_MULT  */
+    LEX_CEIL_DIV = 408,            /* LEX_CEIL_DIV  */
+    LEX_FLOOR_MULT = 409,          /* LEX_FLOOR_MULT  */
+    LEX_FLOOR_DIV = 410,           /* LEX_FLOOR_DIV  */
+    LEX_POW = 411,                 /* LEX_POW  */
+    LEX_POWER = 412,               /* LEX_POWER  */
+    LEX_IS = 413,                  /* LEX_IS  */
+    LEX_AS = 414,                  /* LEX_AS  */
+    LEX_NOT = 415,                 /* LEX_NOT  */
+    LEX_EXTERNAL = 416,            /* LEX_EXTERNAL  */
+    p_MARK = 417,                  /* p_MARK  */
+    p_RELEASE = 418,               /* p_RELEASE  */
+    p_UPDATE = 419,                /* p_UPDATE  */
+    p_GETTIMESTAMP = 420,          /* p_GETTIMESTAMP  */
+    p_UNBIND = 421,                /* p_UNBIND  */
+    p_EXTEND = 422,                /* p_EXTEND  */
+    bp_APPEND = 423,               /* bp_APPEND  */
+    p_BIND = 424,                  /* p_BIND  */
+    p_SEEKREAD = 425,              /* p_SEEKREAD  */
+    p_SEEKWRITE = 426,             /* p_SEEKWRITE  */
+    p_SEEKUPDATE = 427,            /* p_SEEKUPDATE  */
+    LEX_SYMDIFF = 428,             /* LEX_SYMDIFF  */
+    p_ARG = 429,                   /* p_ARG  */
+    p_CARD = 430,                  /* p_CARD  */
+    p_EMPTY = 431,                 /* p_EMPTY  */
+    p_POSITION = 432,              /* p_POSITION  */
+    p_LASTPOSITION = 433,          /* p_LASTPOSITION  */
+    p_LENGTH = 434,                /* p_LENGTH  */
+    p_TRIM = 435,                  /* p_TRIM  */
+    p_BINDING = 436,               /* p_BINDING  */
+    p_DATE = 437,                  /* p_DATE  */
+    p_TIME = 438,                  /* p_TIME  */
+    LEX_RENAME = 439,              /* LEX_RENAME  */
+    LEX_IMPORT = 440,              /* LEX_IMPORT  */
+    LEX_USES = 441,                /* LEX_USES  */
+    LEX_QUALIFIED = 442,           /* LEX_QUALIFIED  */
+    LEX_ONLY = 443,                /* LEX_ONLY  */
+    prec_if = 444,                 /* prec_if  */
+    LEX_ELSE = 445,                /* LEX_ELSE  */
+    lower_than_error = 446         /* lower_than_error  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
+#define LEX_ID 258
+#define LEX_ARRAY 259
+#define LEX_BEGIN 260
+#define LEX_CASE 261
+#define LEX_CONST 262
+#define LEX_DO 263
+#define LEX_DOWNTO 264
+#define LEX_END 265
+#define LEX_FILE 266
+#define LEX_FOR 267
+#define LEX_FUNCTION 268
+#define LEX_GOTO 269
+#define LEX_IF 270
+#define LEX_LABEL 271
+#define LEX_NIL 272
+#define LEX_OF 273
+#define LEX_PACKED 274
+#define LEX_PROCEDURE 275
+#define LEX_PROGRAM 276
+#define LEX_RECORD 277
+#define LEX_REPEAT 278
+#define LEX_SET 279
+#define LEX_THEN 280
+#define LEX_TO 281
+#define LEX_TYPE 282
+#define LEX_UNTIL 283
+#define LEX_VAR 284
+#define LEX_WHILE 285
+#define LEX_WITH 286
+#define LEX_FORWARD 287
+#define pp_SIN 288
+#define pp_COS 289
+#define pp_EXP 290
+#define pp_LN 291
+#define pp_SQRT 292
+#define pp_ARCTAN 293
+#define rr_POW 294
+#define rr_EXPON 295
+#define r_WRITE 296
+#define r_READ 297
+#define r_INITFDR 298
+#define r_LAZYTRYGET 299
+#define r_LAZYGET 300
+#define r_LAZYUNGET 301
+#define r_POW 302
+#define r_EXPON 303
+#define z_ABS 304
+#define z_ARCTAN 305
+#define z_COS 306
+#define z_EXP 307
+#define z_LN 308
+#define z_SIN 309
+#define z_SQRT 310
+#define z_POW 311
+#define z_EXPON 312
+#define set_card 313
+#define set_isempty 314
+#define set_equal 315
+#define set_le 316
+#define set_less 317
+#define set_in 318
+#define set_clear 319
+#define set_include 320
+#define set_exclude 321
+#define set_include_range 322
+#define set_copy 323
+#define set_intersection 324
+#define set_union 325
+#define set_diff 326
+#define set_symdiff 327
+#define p_DONEFDR 328
+#define gpc_IOCHECK 329
+#define gpc_RUNTIME_ERROR 330
+#define p_INPUT 331
+#define p_OUTPUT 332
+#define p_REWRITE 333
+#define p_RESET 334
+#define p_PUT 335
+#define p_GET 336
+#define p_WRITE 337
+#define p_READ 338
+#define p_WRITELN 339
+#define p_READLN 340
+#define p_PAGE 341
+#define p_NEW 342
+#define p_DISPOSE 343
+#define p_ABS 344
+#define p_SQR 345
+#define p_SIN 346
+#define p_COS 347
+#define p_EXP 348
+#define p_LN 349
+#define p_SQRT 350
+#define p_ARCTAN 351
+#define p_TRUNC 352
+#define p_ROUND 353
+#define p_PACK 354
+#define p_UNPACK 355
+#define p_ORD 356
+#define p_CHR 357
+#define p_SUCC 358
+#define p_PRED 359
+#define p_ODD 360
+#define p_EOF 361
+#define p_EOLN 362
+#define p_MAXINT 363
+#define p_TRUE 364
+#define p_FALSE 365
+#define bp_RANDOM 366
+#define bp_RANDOMIZE 367
+#define BREAK 368
+#define CONTINUE 369
+#define RETURN_ 370
+#define RESULT 371
+#define EXIT 372
+#define FAIL 373
+#define p_CLOSE 374
+#define CONJUGATE 375
+#define p_DEFINESIZE 376
+#define SIZEOF 377
+#define BITSIZEOF 378
+#define ALIGNOF 379
+#define TYPEOF 380
+#define gpc_RETURNADDRESS 381
+#define gpc_FRAMEADDRESS 382
+#define LEX_LABEL_ADDR 383
+#define LEX_INTCONST 384
+#define LEX_STRCONST 385
+#define LEX_REALCONST 386
+#define LEX_RANGE 387
+#define LEX_ELLIPSIS 388
+#define LEX_ASSIGN 389
+#define LEX_IN 390
+#define LEX_NE 391
+#define LEX_GE 392
+#define LEX_LE 393
+#define LEX_OR 394
+#define LEX_OR_ELSE 395
+#define LEX_CEIL_PLUS 396
+#define LEX_CEIL_MINUS 397
+#define LEX_FLOOR_PLUS 398
+#define LEX_FLOOR_MINUS 399
+#define LEX_DIV 400
+#define LEX_MOD 401
+#define LEX_AND 402
+#define LEX_AND_THEN 403
+#define LEX_SHL 404
+#define LEX_SHR 405
+#define LEX_XOR 406
+#define LEX_CEIL_MULT 407
+#define LEX_CEIL_DIV 408
+#define LEX_FLOOR_MULT 409
+#define LEX_FLOOR_DIV 410
+#define LEX_POW 411
+#define LEX_POWER 412
+#define LEX_IS 413
+#define LEX_AS 414
+#define LEX_NOT 415
+#define LEX_EXTERNAL 416
+#define p_MARK 417
+#define p_RELEASE 418
+#define p_UPDATE 419
+#define p_GETTIMESTAMP 420
+#define p_UNBIND 421
+#define p_EXTEND 422
+#define bp_APPEND 423
+#define p_BIND 424
+#define p_SEEKREAD 425
+#define p_SEEKWRITE 426
+#define p_SEEKUPDATE 427
+#define LEX_SYMDIFF 428
+#define p_ARG 429
+#define p_CARD 430
+#define p_EMPTY 431
+#define p_POSITION 432
+#define p_LASTPOSITION 433
+#define p_LENGTH 434
+#define p_TRIM 435
+#define p_BINDING 436
+#define p_DATE 437
+#define p_TIME 438
+#define LEX_RENAME 439
+#define LEX_IMPORT 440
+#define LEX_USES 441
+#define LEX_QUALIFIED 442
+#define LEX_ONLY 443
+#define prec_if 444
+#define LEX_ELSE 445
+#define lower_than_error 446
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 71 "gram.y"
+
+    char *          y_string;
+    int	           y_cint;
+    long            y_int;
+    double          y_real;
+    
+    stid_item_p     y_stid_item;
+    ST_ID           y_stid;
+    
+    typedef_item_p  y_typedef_item;
+    TYPE_LIST	     y_type_list;
+    TYPE            y_type;
+
+    EXPR		        y_expr;
+    EXPR_LIST 	     y_expr_list;
+    DIRECTIVETYPE   y_dir;
+    DIR_LIST        y_dir_list;
+    PARAM_LIST 	  y_param_list;
+    
+    BOOLEAN			  y_boolean;
+    control_labels  y_control;
+    FOR_DIRECTION   y_for_dir;
+    
+    num_const_p     y_num_const;
+
+#line 551 "y.tab.c"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+extern YYSTYPE yylval;
+
+
+int yyparse (void);
+
+
+#endif /* !YY_YY_Y_TAB_H_INCLUDED  */
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_LEX_ID = 3,                     /* LEX_ID  */
+  YYSYMBOL_LEX_ARRAY = 4,                  /* LEX_ARRAY  */
+  YYSYMBOL_LEX_BEGIN = 5,                  /* LEX_BEGIN  */
+  YYSYMBOL_LEX_CASE = 6,                   /* LEX_CASE  */
+  YYSYMBOL_LEX_CONST = 7,                  /* LEX_CONST  */
+  YYSYMBOL_LEX_DO = 8,                     /* LEX_DO  */
+  YYSYMBOL_LEX_DOWNTO = 9,                 /* LEX_DOWNTO  */
+  YYSYMBOL_LEX_END = 10,                   /* LEX_END  */
+  YYSYMBOL_LEX_FILE = 11,                  /* LEX_FILE  */
+  YYSYMBOL_LEX_FOR = 12,                   /* LEX_FOR  */
+  YYSYMBOL_LEX_FUNCTION = 13,              /* LEX_FUNCTION  */
+  YYSYMBOL_LEX_GOTO = 14,                  /* LEX_GOTO  */
+  YYSYMBOL_LEX_IF = 15,                    /* LEX_IF  */
+  YYSYMBOL_LEX_LABEL = 16,                 /* LEX_LABEL  */
+  YYSYMBOL_LEX_NIL = 17,                   /* LEX_NIL  */
+  YYSYMBOL_LEX_OF = 18,                    /* LEX_OF  */
+  YYSYMBOL_LEX_PACKED = 19,                /* LEX_PACKED  */
+  YYSYMBOL_LEX_PROCEDURE = 20,             /* LEX_PROCEDURE  */
+  YYSYMBOL_LEX_PROGRAM = 21,               /* LEX_PROGRAM  */
+  YYSYMBOL_LEX_RECORD = 22,                /* LEX_RECORD  */
+  YYSYMBOL_LEX_REPEAT = 23,                /* LEX_REPEAT  */
+  YYSYMBOL_LEX_SET = 24,                   /* LEX_SET  */
+  YYSYMBOL_LEX_THEN = 25,                  /* LEX_THEN  */
+  YYSYMBOL_LEX_TO = 26,                    /* LEX_TO  */
+  YYSYMBOL_LEX_TYPE = 27,                  /* LEX_TYPE  */
+  YYSYMBOL_LEX_UNTIL = 28,                 /* LEX_UNTIL  */
+  YYSYMBOL_LEX_VAR = 29,                   /* LEX_VAR  */
+  YYSYMBOL_LEX_WHILE = 30,                 /* LEX_WHILE  */
+  YYSYMBOL_LEX_WITH = 31,                  /* LEX_WITH  */
+  YYSYMBOL_LEX_FORWARD = 32,               /* LEX_FORWARD  */
+  YYSYMBOL_pp_SIN = 33,                    /* pp_SIN  */
+  YYSYMBOL_pp_COS = 34,                    /* pp_COS  */
+  YYSYMBOL_pp_EXP = 35,                    /* pp_EXP  */
+  YYSYMBOL_pp_LN = 36,                     /* pp_LN  */
+  YYSYMBOL_pp_SQRT = 37,                   /* pp_SQRT  */
+  YYSYMBOL_pp_ARCTAN = 38,                 /* pp_ARCTAN  */
+  YYSYMBOL_rr_POW = 39,                    /* rr_POW  */
+  YYSYMBOL_rr_EXPON = 40,                  /* rr_EXPON  */
+  YYSYMBOL_r_WRITE = 41,                   /* r_WRITE  */
+  YYSYMBOL_r_READ = 42,                    /* r_READ  */
+  YYSYMBOL_r_INITFDR = 43,                 /* r_INITFDR  */
+  YYSYMBOL_r_LAZYTRYGET = 44,              /* r_LAZYTRYGET  */
+  YYSYMBOL_r_LAZYGET = 45,                 /* r_LAZYGET  */
+  YYSYMBOL_r_LAZYUNGET = 46,               /* r_LAZYUNGET  */
+  YYSYMBOL_r_POW = 47,                     /* r_POW  */
+  YYSYMBOL_r_EXPON = 48,                   /* r_EXPON  */
+  YYSYMBOL_z_ABS = 49,                     /* z_ABS  */
+  YYSYMBOL_z_ARCTAN = 50,                  /* z_ARCTAN  */
+  YYSYMBOL_z_COS = 51,                     /* z_COS  */
+  YYSYMBOL_z_EXP = 52,                     /* z_EXP  */
+  YYSYMBOL_z_LN = 53,                      /* z_LN  */
+  YYSYMBOL_z_SIN = 54,                     /* z_SIN  */
+  YYSYMBOL_z_SQRT = 55,                    /* z_SQRT  */
+  YYSYMBOL_z_POW = 56,                     /* z_POW  */
+  YYSYMBOL_z_EXPON = 57,                   /* z_EXPON  */
+  YYSYMBOL_set_card = 58,                  /* set_card  */
+  YYSYMBOL_set_isempty = 59,               /* set_isempty  */
+  YYSYMBOL_set_equal = 60,                 /* set_equal  */
+  YYSYMBOL_set_le = 61,                    /* set_le  */
+  YYSYMBOL_set_less = 62,                  /* set_less  */
+  YYSYMBOL_set_in = 63,                    /* set_in  */
+  YYSYMBOL_set_clear = 64,                 /* set_clear  */
+  YYSYMBOL_set_include = 65,               /* set_include  */
+  YYSYMBOL_set_exclude = 66,               /* set_exclude  */
+  YYSYMBOL_set_include_range = 67,         /* set_include_range  */
+  YYSYMBOL_set_copy = 68,                  /* set_copy  */
+  YYSYMBOL_set_intersection = 69,          /* set_intersection  */
+  YYSYMBOL_set_union = 70,                 /* set_union  */
+  YYSYMBOL_set_diff = 71,                  /* set_diff  */
+  YYSYMBOL_set_symdiff = 72,               /* set_symdiff  */
+  YYSYMBOL_p_DONEFDR = 73,                 /* p_DONEFDR  */
+  YYSYMBOL_gpc_IOCHECK = 74,               /* gpc_IOCHECK  */
+  YYSYMBOL_gpc_RUNTIME_ERROR = 75,         /* gpc_RUNTIME_ERROR  */
+  YYSYMBOL_p_INPUT = 76,                   /* p_INPUT  */
+  YYSYMBOL_p_OUTPUT = 77,                  /* p_OUTPUT  */
+  YYSYMBOL_p_REWRITE = 78,                 /* p_REWRITE  */
+  YYSYMBOL_p_RESET = 79,                   /* p_RESET  */
+  YYSYMBOL_p_PUT = 80,                     /* p_PUT  */
+  YYSYMBOL_p_GET = 81,                     /* p_GET  */
+  YYSYMBOL_p_WRITE = 82,                   /* p_WRITE  */
+  YYSYMBOL_p_READ = 83,                    /* p_READ  */
+  YYSYMBOL_p_WRITELN = 84,                 /* p_WRITELN  */
+  YYSYMBOL_p_READLN = 85,                  /* p_READLN  */
+  YYSYMBOL_p_PAGE = 86,                    /* p_PAGE  */
+  YYSYMBOL_p_NEW = 87,                     /* p_NEW  */
+  YYSYMBOL_p_DISPOSE = 88,                 /* p_DISPOSE  */
+  YYSYMBOL_p_ABS = 89,                     /* p_ABS  */
+  YYSYMBOL_p_SQR = 90,                     /* p_SQR  */
+  YYSYMBOL_p_SIN = 91,                     /* p_SIN  */
+  YYSYMBOL_p_COS = 92,                     /* p_COS  */
+  YYSYMBOL_p_EXP = 93,                     /* p_EXP  */
+  YYSYMBOL_p_LN = 94,                      /* p_LN  */
+  YYSYMBOL_p_SQRT = 95,                    /* p_SQRT  */
+  YYSYMBOL_p_ARCTAN = 96,                  /* p_ARCTAN  */
+  YYSYMBOL_p_TRUNC = 97,                   /* p_TRUNC  */
+  YYSYMBOL_p_ROUND = 98,                   /* p_ROUND  */
+  YYSYMBOL_p_PACK = 99,                    /* p_PACK  */
+  YYSYMBOL_p_UNPACK = 100,                 /* p_UNPACK  */
+  YYSYMBOL_p_ORD = 101,                    /* p_ORD  */
+  YYSYMBOL_p_CHR = 102,                    /* p_CHR  */
+  YYSYMBOL_p_SUCC = 103,                   /* p_SUCC  */
+  YYSYMBOL_p_PRED = 104,                   /* p_PRED  */
+  YYSYMBOL_p_ODD = 105,                    /* p_ODD  */
+  YYSYMBOL_p_EOF = 106,                    /* p_EOF  */
+  YYSYMBOL_p_EOLN = 107,                   /* p_EOLN  */
+  YYSYMBOL_p_MAXINT = 108,                 /* p_MAXINT  */
+  YYSYMBOL_p_TRUE = 109,                   /* p_TRUE  */
+  YYSYMBOL_p_FALSE = 110,                  /* p_FALSE  */
+  YYSYMBOL_bp_RANDOM = 111,                /* bp_RANDOM  */
+  YYSYMBOL_bp_RANDOMIZE = 112,             /* bp_RANDOMIZE  */
+  YYSYMBOL_BREAK = 113,                    /* BREAK  */
+  YYSYMBOL_CONTINUE = 114,                 /* CONTINUE  */
+  YYSYMBOL_RETURN_ = 115,                  /* RETURN_  */
+  YYSYMBOL_RESULT = 116,                   /* RESULT  */
+  YYSYMBOL_EXIT = 117,                     /* EXIT  */
+  YYSYMBOL_FAIL = 118,                     /* FAIL  */
+  YYSYMBOL_p_CLOSE = 119,                  /* p_CLOSE  */
+  YYSYMBOL_CONJUGATE = 120,                /* CONJUGATE  */
+  YYSYMBOL_p_DEFINESIZE = 121,             /* p_DEFINESIZE  */
+  YYSYMBOL_SIZEOF = 122,                   /* SIZEOF  */
+  YYSYMBOL_BITSIZEOF = 123,                /* BITSIZEOF  */
+  YYSYMBOL_ALIGNOF = 124,                  /* ALIGNOF  */
+  YYSYMBOL_TYPEOF = 125,                   /* TYPEOF  */
+  YYSYMBOL_gpc_RETURNADDRESS = 126,        /* gpc_RETURNADDRESS  */
+  YYSYMBOL_gpc_FRAMEADDRESS = 127,         /* gpc_FRAMEADDRESS  */
+  YYSYMBOL_LEX_LABEL_ADDR = 128,           /* LEX_LABEL_ADDR  */
+  YYSYMBOL_LEX_INTCONST = 129,             /* LEX_INTCONST  */
+  YYSYMBOL_LEX_STRCONST = 130,             /* LEX_STRCONST  */
+  YYSYMBOL_LEX_REALCONST = 131,            /* LEX_REALCONST  */
+  YYSYMBOL_LEX_RANGE = 132,                /* LEX_RANGE  */
+  YYSYMBOL_LEX_ELLIPSIS = 133,             /* LEX_ELLIPSIS  */
+  YYSYMBOL_LEX_ASSIGN = 134,               /* LEX_ASSIGN  */
+  YYSYMBOL_135_ = 135,                     /* '<'  */
+  YYSYMBOL_136_ = 136,                     /* '='  */
+  YYSYMBOL_137_ = 137,                     /* '>'  */
+  YYSYMBOL_LEX_IN = 138,                   /* LEX_IN  */
+  YYSYMBOL_LEX_NE = 139,                   /* LEX_NE  */
+  YYSYMBOL_LEX_GE = 140,                   /* LEX_GE  */
+  YYSYMBOL_LEX_LE = 141,                   /* LEX_LE  */
+  YYSYMBOL_142_ = 142,                     /* '-'  */
+  YYSYMBOL_143_ = 143,                     /* '+'  */
+  YYSYMBOL_LEX_OR = 144,                   /* LEX_OR  */
+  YYSYMBOL_LEX_OR_ELSE = 145,              /* LEX_OR_ELSE  */
+  YYSYMBOL_LEX_CEIL_PLUS = 146,            /* LEX_CEIL_PLUS  */
+  YYSYMBOL_LEX_CEIL_MINUS = 147,           /* LEX_CEIL_MINUS  */
+  YYSYMBOL_LEX_FLOOR_PLUS = 148,           /* LEX_FLOOR_PLUS  */
+  YYSYMBOL_LEX_FLOOR_MINUS = 149,          /* LEX_FLOOR_MINUS  */
+  YYSYMBOL_150_ = 150,                     /* '/'  */
+  YYSYMBOL_151_ = 151,                     /* '*'  */
+  YYSYMBOL_LEX_DIV = 152,                  /* LEX_DIV  */
+  YYSYMBOL_LEX_MOD = 153,                  /* LEX_MOD  */
+  YYSYMBOL_LEX_AND = 154,                  /* LEX_AND  */
+  YYSYMBOL_LEX_AND_THEN = 155,             /* LEX_AND_THEN  */
+  YYSYMBOL_LEX_SHL = 156,                  /* LEX_SHL  */
+  YYSYMBOL_LEX_SHR = 157,                  /* LEX_SHR  */
+  YYSYMBOL_LEX_XOR = 158,                  /* LEX_XOR  */
+  YYSYMBOL_LEX_CEIL_MULT = 159,            /* LEX_CEIL_MULT  */
+  YYSYMBOL_LEX_CEIL_DIV = 160,             /* LEX_CEIL_DIV  */
+  YYSYMBOL_LEX_FLOOR_MULT = 161,           /* LEX_FLOOR_MULT  */
+  YYSYMBOL_LEX_FLOOR_DIV = 162,            /* LEX_FLOOR_DIV  */
+  YYSYMBOL_LEX_POW = 163,                  /* LEX_POW  */
+  YYSYMBOL_LEX_POWER = 164,                /* LEX_POWER  */
+  YYSYMBOL_LEX_IS = 165,                   /* LEX_IS  */
+  YYSYMBOL_LEX_AS = 166,                   /* LEX_AS  */
+  YYSYMBOL_LEX_NOT = 167,                  /* LEX_NOT  */
+  YYSYMBOL_LEX_EXTERNAL = 168,             /* LEX_EXTERNAL  */
+  YYSYMBOL_p_MARK = 169,                   /* p_MARK  */
+  YYSYMBOL_p_RELEASE = 170,                /* p_RELEASE  */
+  YYSYMBOL_p_UPDATE = 171,                 /* p_UPDATE  */
+  YYSYMBOL_p_GETTIMESTAMP = 172,           /* p_GETTIMESTAMP  */
+  YYSYMBOL_p_UNBIND = 173,                 /* p_UNBIND  */
+  YYSYMBOL_p_EXTEND = 174,                 /* p_EXTEND  */
+  YYSYMBOL_bp_APPEND = 175,                /* bp_APPEND  */
+  YYSYMBOL_p_BIND = 176,                   /* p_BIND  */
+  YYSYMBOL_p_SEEKREAD = 177,               /* p_SEEKREAD  */
+  YYSYMBOL_p_SEEKWRITE = 178,              /* p_SEEKWRITE  */
+  YYSYMBOL_p_SEEKUPDATE = 179,             /* p_SEEKUPDATE  */
+  YYSYMBOL_LEX_SYMDIFF = 180,              /* LEX_SYMDIFF  */
+  YYSYMBOL_p_ARG = 181,                    /* p_ARG  */
+  YYSYMBOL_p_CARD = 182,                   /* p_CARD  */
+  YYSYMBOL_p_EMPTY = 183,                  /* p_EMPTY  */
+  YYSYMBOL_p_POSITION = 184,               /* p_POSITION  */
+  YYSYMBOL_p_LASTPOSITION = 185,           /* p_LASTPOSITION  */
+  YYSYMBOL_p_LENGTH = 186,                 /* p_LENGTH  */
+  YYSYMBOL_p_TRIM = 187,                   /* p_TRIM  */
+  YYSYMBOL_p_BINDING = 188,                /* p_BINDING  */
+  YYSYMBOL_p_DATE = 189,                   /* p_DATE  */
+  YYSYMBOL_p_TIME = 190,                   /* p_TIME  */
+  YYSYMBOL_LEX_RENAME = 191,               /* LEX_RENAME  */
+  YYSYMBOL_LEX_IMPORT = 192,               /* LEX_IMPORT  */
+  YYSYMBOL_LEX_USES = 193,                 /* LEX_USES  */
+  YYSYMBOL_LEX_QUALIFIED = 194,            /* LEX_QUALIFIED  */
+  YYSYMBOL_LEX_ONLY = 195,                 /* LEX_ONLY  */
+  YYSYMBOL_prec_if = 196,                  /* prec_if  */
+  YYSYMBOL_LEX_ELSE = 197,                 /* LEX_ELSE  */
+  YYSYMBOL_lower_than_error = 198,         /* lower_than_error  */
+  YYSYMBOL_199_ = 199,                     /* '.'  */
+  YYSYMBOL_200_ = 200,                     /* '('  */
+  YYSYMBOL_201_ = 201,                     /* ')'  */
+  YYSYMBOL_202_ = 202,                     /* ','  */
+  YYSYMBOL_203_ = 203,                     /* '^'  */
+  YYSYMBOL_204_ = 204,                     /* '@'  */
+  YYSYMBOL_205_ = 205,                     /* ':'  */
+  YYSYMBOL_206_ = 206,                     /* '['  */
+  YYSYMBOL_207_ = 207,                     /* ']'  */
+  YYSYMBOL_208_ = 208,                     /* ';'  */
+  YYSYMBOL_YYACCEPT = 209,                 /* $accept  */
+  YYSYMBOL_pascal_program = 210,           /* pascal_program  */
+  YYSYMBOL_main_program_declaration = 211, /* main_program_declaration  */
+  YYSYMBOL_212_1 = 212,                    /* $@1  */
+  YYSYMBOL_program_heading = 213,          /* program_heading  */
+  YYSYMBOL_optional_par_id_list = 214,     /* optional_par_id_list  */
+  YYSYMBOL_id_list = 215,                  /* id_list  */
+  YYSYMBOL_typename = 216,                 /* typename  */
+  YYSYMBOL_identifier = 217,               /* identifier  */
+  YYSYMBOL_new_identifier = 218,           /* new_identifier  */
+  YYSYMBOL_new_identifier_1 = 219,         /* new_identifier_1  */
+  YYSYMBOL_any_global_declaration_part = 220, /* any_global_declaration_part  */
+  YYSYMBOL_any_declaration_part = 221,     /* any_declaration_part  */
+  YYSYMBOL_any_decl = 222,                 /* any_decl  */
+  YYSYMBOL_simple_decl = 223,              /* simple_decl  */
+  YYSYMBOL_constant_definition_part = 224, /* constant_definition_part  */
+  YYSYMBOL_constant_definition_list = 225, /* constant_definition_list  */
+  YYSYMBOL_constant_definition = 226,      /* constant_definition  */
+  YYSYMBOL_constant = 227,                 /* constant  */
+  YYSYMBOL_number = 228,                   /* number  */
+  YYSYMBOL_unsigned_number = 229,          /* unsigned_number  */
+  YYSYMBOL_sign = 230,                     /* sign  */
+  YYSYMBOL_constant_literal = 231,         /* constant_literal  */
+  YYSYMBOL_predefined_literal = 232,       /* predefined_literal  */
+  YYSYMBOL_string = 233,                   /* string  */
+  YYSYMBOL_type_definition_part = 234,     /* type_definition_part  */
+  YYSYMBOL_type_definition_list = 235,     /* type_definition_list  */
+  YYSYMBOL_type_definition = 236,          /* type_definition  */
+  YYSYMBOL_type_denoter = 237,             /* type_denoter  */
+  YYSYMBOL_new_ordinal_type = 238,         /* new_ordinal_type  */
+  YYSYMBOL_enumerated_type = 239,          /* enumerated_type  */
+  YYSYMBOL_enum_list = 240,                /* enum_list  */
+  YYSYMBOL_enumerator = 241,               /* enumerator  */
+  YYSYMBOL_subrange_type = 242,            /* subrange_type  */
+  YYSYMBOL_new_pointer_type = 243,         /* new_pointer_type  */
+  YYSYMBOL_pointer_char = 244,             /* pointer_char  */
+  YYSYMBOL_pointer_domain_type = 245,      /* pointer_domain_type  */
+  YYSYMBOL_new_procedural_type = 246,      /* new_procedural_type  */
+  YYSYMBOL_optional_procedural_type_formal_parameter_list = 247, /* optional_procedural_type_formal_parameter_list  */
+  YYSYMBOL_procedural_type_formal_parameter_list = 248, /* procedural_type_formal_parameter_list  */
+  YYSYMBOL_procedural_type_formal_parameter = 249, /* procedural_type_formal_parameter  */
+  YYSYMBOL_new_structured_type = 250,      /* new_structured_type  */
+  YYSYMBOL_array_type = 251,               /* array_type  */
+  YYSYMBOL_array_index_list = 252,         /* array_index_list  */
+  YYSYMBOL_ordinal_index_type = 253,       /* ordinal_index_type  */
+  YYSYMBOL_set_type = 254,                 /* set_type  */
+  YYSYMBOL_record_type = 255,              /* record_type  */
+  YYSYMBOL_record_field_list = 256,        /* record_field_list  */
+  YYSYMBOL_fixed_part = 257,               /* fixed_part  */
+  YYSYMBOL_record_section = 258,           /* record_section  */
+  YYSYMBOL_variant_part = 259,             /* variant_part  */
+  YYSYMBOL_rest_of_variant = 260,          /* rest_of_variant  */
+  YYSYMBOL_variant_selector = 261,         /* variant_selector  */
+  YYSYMBOL_variant_type = 262,             /* variant_type  */
+  YYSYMBOL_variant_list = 263,             /* variant_list  */
+  YYSYMBOL_variant = 264,                  /* variant  */
+  YYSYMBOL_case_constant_list = 265,       /* case_constant_list  */
+  YYSYMBOL_one_case_constant = 266,        /* one_case_constant  */
+  YYSYMBOL_variable_declaration_part = 267, /* variable_declaration_part  */
+  YYSYMBOL_variable_declaration_list = 268, /* variable_declaration_list  */
+  YYSYMBOL_variable_declaration = 269,     /* variable_declaration  */
+  YYSYMBOL_function_declaration = 270,     /* function_declaration  */
+  YYSYMBOL_271_2 = 271,                    /* $@2  */
+  YYSYMBOL_272_3 = 272,                    /* $@3  */
+  YYSYMBOL_function_heading = 273,         /* function_heading  */
+  YYSYMBOL_directive_list = 274,           /* directive_list  */
+  YYSYMBOL_directive = 275,                /* directive  */
+  YYSYMBOL_functiontype = 276,             /* functiontype  */
+  YYSYMBOL_optional_par_formal_parameter_list = 277, /* optional_par_formal_parameter_list  */
+  YYSYMBOL_formal_parameter_list = 278,    /* formal_parameter_list  */
+  YYSYMBOL_formal_parameter = 279,         /* formal_parameter  */
+  YYSYMBOL_statement_part = 280,           /* statement_part  */
+  YYSYMBOL_compound_statement = 281,       /* compound_statement  */
+  YYSYMBOL_statement_sequence = 282,       /* statement_sequence  */
+  YYSYMBOL_statement = 283,                /* statement  */
+  YYSYMBOL_structured_statement = 284,     /* structured_statement  */
+  YYSYMBOL_with_statement = 285,           /* with_statement  */
+  YYSYMBOL_structured_variable_list = 286, /* structured_variable_list  */
+  YYSYMBOL_structured_variable = 287,      /* structured_variable  */
+  YYSYMBOL_conditional_statement = 288,    /* conditional_statement  */
+  YYSYMBOL_simple_if = 289,                /* simple_if  */
+  YYSYMBOL_290_4 = 290,                    /* @4  */
+  YYSYMBOL_if_statement = 291,             /* if_statement  */
+  YYSYMBOL_292_5 = 292,                    /* @5  */
+  YYSYMBOL_case_statement = 293,           /* case_statement  */
+  YYSYMBOL_294_6 = 294,                    /* $@6  */
+  YYSYMBOL_optional_semicolon_or_else_branch = 295, /* optional_semicolon_or_else_branch  */
+  YYSYMBOL_296_7 = 296,                    /* $@7  */
+  YYSYMBOL_case_element_list = 297,        /* case_element_list  */
+  YYSYMBOL_case_element = 298,             /* case_element  */
+  YYSYMBOL_299_8 = 299,                    /* $@8  */
+  YYSYMBOL_case_default = 300,             /* case_default  */
+  YYSYMBOL_repetitive_statement = 301,     /* repetitive_statement  */
+  YYSYMBOL_repeat_statement = 302,         /* repeat_statement  */
+  YYSYMBOL_303_9 = 303,                    /* @9  */
+  YYSYMBOL_while_statement = 304,          /* while_statement  */
+  YYSYMBOL_305_10 = 305,                   /* @10  */
+  YYSYMBOL_for_statement = 306,            /* for_statement  */
+  YYSYMBOL_307_11 = 307,                   /* @11  */
+  YYSYMBOL_for_direction = 308,            /* for_direction  */
+  YYSYMBOL_simple_statement = 309,         /* simple_statement  */
+  YYSYMBOL_empty_statement = 310,          /* empty_statement  */
+  YYSYMBOL_optional_par_actual_parameter_list = 311, /* optional_par_actual_parameter_list  */
+  YYSYMBOL_actual_parameter_list = 312,    /* actual_parameter_list  */
+  YYSYMBOL_actual_parameter = 313,         /* actual_parameter  */
+  YYSYMBOL_assignment_or_call_statement = 314, /* assignment_or_call_statement  */
+  YYSYMBOL_variable_or_function_access_maybe_assignment = 315, /* variable_or_function_access_maybe_assignment  */
+  YYSYMBOL_rest_of_statement = 316,        /* rest_of_statement  */
+  YYSYMBOL_standard_procedure_statement = 317, /* standard_procedure_statement  */
+  YYSYMBOL_optional_par_write_parameter_list = 318, /* optional_par_write_parameter_list  */
+  YYSYMBOL_write_actual_parameter_list = 319, /* write_actual_parameter_list  */
+  YYSYMBOL_write_actual_parameter = 320,   /* write_actual_parameter  */
+  YYSYMBOL_rts_proc_onepar = 321,          /* rts_proc_onepar  */
+  YYSYMBOL_rts_proc_parlist = 322,         /* rts_proc_parlist  */
+  YYSYMBOL_statement_extensions = 323,     /* statement_extensions  */
+  YYSYMBOL_return_statement = 324,         /* return_statement  */
+  YYSYMBOL_break_statement = 325,          /* break_statement  */
+  YYSYMBOL_continue_statement = 326,       /* continue_statement  */
+  YYSYMBOL_variable_access_or_typename = 327, /* variable_access_or_typename  */
+  YYSYMBOL_index_expression_list = 328,    /* index_expression_list  */
+  YYSYMBOL_index_expression_item = 329,    /* index_expression_item  */
+  YYSYMBOL_static_expression = 330,        /* static_expression  */
+  YYSYMBOL_boolean_expression = 331,       /* boolean_expression  */
+  YYSYMBOL_expression = 332,               /* expression  */
+  YYSYMBOL_simple_expression = 333,        /* simple_expression  */
+  YYSYMBOL_term = 334,                     /* term  */
+  YYSYMBOL_signed_primary = 335,           /* signed_primary  */
+  YYSYMBOL_primary = 336,                  /* primary  */
+  YYSYMBOL_signed_factor = 337,            /* signed_factor  */
+  YYSYMBOL_factor = 338,                   /* factor  */
+  YYSYMBOL_address_operator = 339,         /* address_operator  */
+  YYSYMBOL_variable_or_function_access = 340, /* variable_or_function_access  */
+  YYSYMBOL_variable_or_function_access_no_standard_function = 341, /* variable_or_function_access_no_standard_function  */
+  YYSYMBOL_variable_or_function_access_no_id = 342, /* variable_or_function_access_no_id  */
+  YYSYMBOL_set_constructor = 343,          /* set_constructor  */
+  YYSYMBOL_set_constructor_element_list = 344, /* set_constructor_element_list  */
+  YYSYMBOL_member_designator = 345,        /* member_designator  */
+  YYSYMBOL_standard_functions = 346,       /* standard_functions  */
+  YYSYMBOL_optional_par_actual_parameter = 347, /* optional_par_actual_parameter  */
+  YYSYMBOL_rts_fun_optpar = 348,           /* rts_fun_optpar  */
+  YYSYMBOL_rts_fun_onepar = 349,           /* rts_fun_onepar  */
+  YYSYMBOL_rts_fun_parlist = 350,          /* rts_fun_parlist  */
+  YYSYMBOL_relational_operator = 351,      /* relational_operator  */
+  YYSYMBOL_multiplying_operator = 352,     /* multiplying_operator  */
+  YYSYMBOL_adding_operator = 353,          /* adding_operator  */
+  YYSYMBOL_semi = 354,                     /* semi  */
+  YYSYMBOL_optional_semicolon = 355        /* optional_semicolon  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  51
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   1646
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  209
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  147
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  378
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  560
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   446
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_uint8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+     200,   201,   151,   143,   202,   142,   199,   150,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   205,   208,
+     135,   136,   137,     2,   204,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,   206,     2,   207,   203,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     138,   139,   140,   141,   144,   145,   146,   147,   148,   149,
+     152,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   189,   190,   191,
+     192,   193,   194,   195,   196,   197,   198
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   214,   214,   218,   218,   222,   225,   227,   232,   233,
+     238,   243,   248,   253,   255,   256,   257,   259,   260,   261,
+     262,   263,   264,   265,   266,   267,   268,   269,   270,   271,
+     273,   274,   276,   277,   278,   279,   280,   281,   282,   283,
+     284,   285,   287,   288,   290,   291,   292,   293,   294,   296,
+     297,   298,   299,   300,   301,   302,   303,   306,   308,   312,
+     313,   317,   318,   322,   323,   324,   330,   334,   335,   339,
+     343,   344,   345,   346,   350,   351,   355,   356,   360,   361,
+     365,   366,   370,   371,   372,   376,   377,   382,   387,   388,
+     393,   398,   399,   400,   401,   402,   407,   408,   413,   418,
+     419,   424,   429,   434,   438,   439,   444,   445,   450,   454,
+     461,   462,   467,   468,   473,   474,   475,   476,   481,   482,
+     483,   490,   495,   496,   501,   502,   508,   512,   515,   517,
+     518,   519,   523,   524,   528,   532,   536,   537,   541,   542,
+     546,   547,   551,   552,   556,   560,   561,   565,   566,   574,
+     580,   581,   585,   592,   598,   602,   598,   613,   616,   622,
+     623,   627,   628,   632,   633,   639,   640,   644,   645,   649,
+     650,   657,   661,   665,   666,   670,   671,   675,   676,   677,
+     678,   682,   686,   687,   691,   695,   696,   701,   700,   715,
+     714,   725,   729,   729,   747,   748,   748,   752,   753,   757,
+     757,   806,   807,   811,   812,   813,   818,   817,   838,   837,
+     859,   858,   931,   932,   936,   937,   938,   939,   943,   949,
+     950,   954,   955,   959,   966,   971,   972,   973,   977,   978,
+     982,   983,   984,   985,   986,   987,   988,   989,   990,   993,
+     995,   999,  1000,  1004,  1005,  1006,  1011,  1012,  1013,  1014,
+    1015,  1016,  1017,  1018,  1022,  1023,  1024,  1025,  1026,  1027,
+    1028,  1029,  1030,  1031,  1032,  1033,  1034,  1035,  1036,  1037,
+    1038,  1042,  1043,  1044,  1048,  1049,  1050,  1051,  1055,  1059,
+    1063,  1064,  1068,  1069,  1073,  1074,  1080,  1084,  1088,  1089,
+    1090,  1094,  1095,  1096,  1097,  1098,  1102,  1103,  1104,  1108,
+    1109,  1113,  1114,  1115,  1116,  1120,  1121,  1125,  1126,  1127,
+    1128,  1129,  1130,  1134,  1138,  1139,  1143,  1144,  1148,  1149,
+    1150,  1151,  1152,  1153,  1154,  1155,  1159,  1160,  1164,  1165,
+    1169,  1170,  1174,  1175,  1176,  1181,  1182,  1186,  1187,  1191,
+    1192,  1193,  1194,  1195,  1196,  1197,  1198,  1199,  1200,  1201,
+    1202,  1203,  1204,  1205,  1206,  1207,  1208,  1209,  1210,  1211,
+    1212,  1213,  1217,  1218,  1222,  1223,  1224,  1225,  1226,  1227,
+    1231,  1232,  1233,  1234,  1238,  1239,  1243,  1246,  1248
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "LEX_ID", "LEX_ARRAY",
+  "LEX_BEGIN", "LEX_CASE", "LEX_CONST", "LEX_DO", "LEX_DOWNTO", "LEX_END",
+  "LEX_FILE", "LEX_FOR", "LEX_FUNCTION", "LEX_GOTO", "LEX_IF", "LEX_LABEL",
+  "LEX_NIL", "LEX_OF", "LEX_PACKED", "LEX_PROCEDURE", "LEX_PROGRAM",
+  "LEX_RECORD", "LEX_REPEAT", "LEX_SET", "LEX_THEN", "LEX_TO", "LEX_TYPE",
+  "LEX_UNTIL", "LEX_VAR", "LEX_WHILE", "LEX_WITH", "LEX_FORWARD", "pp_SIN",
+  "pp_COS", "pp_EXP", "pp_LN", "pp_SQRT", "pp_ARCTAN", "rr_POW",
+  "rr_EXPON", "r_WRITE", "r_READ", "r_INITFDR", "r_LAZYTRYGET",
+  "r_LAZYGET", "r_LAZYUNGET", "r_POW", "r_EXPON", "z_ABS", "z_ARCTAN",
+  "z_COS", "z_EXP", "z_LN", "z_SIN", "z_SQRT", "z_POW", "z_EXPON",
+  "set_card", "set_isempty", "set_equal", "set_le", "set_less", "set_in",
+  "set_clear", "set_include", "set_exclude", "set_include_range",
+  "set_copy", "set_intersection", "set_union", "set_diff", "set_symdiff",
+  "p_DONEFDR", "gpc_IOCHECK", "gpc_RUNTIME_ERROR", "p_INPUT", "p_OUTPUT",
+  "p_REWRITE", "p_RESET", "p_PUT", "p_GET", "p_WRITE", "p_READ",
+  "p_WRITELN", "p_READLN", "p_PAGE", "p_NEW", "p_DISPOSE", "p_ABS",
+  "p_SQR", "p_SIN", "p_COS", "p_EXP", "p_LN", "p_SQRT", "p_ARCTAN",
+  "p_TRUNC", "p_ROUND", "p_PACK", "p_UNPACK", "p_ORD", "p_CHR", "p_SUCC",
+  "p_PRED", "p_ODD", "p_EOF", "p_EOLN", "p_MAXINT", "p_TRUE", "p_FALSE",
+  "bp_RANDOM", "bp_RANDOMIZE", "BREAK", "CONTINUE", "RETURN_", "RESULT",
+  "EXIT", "FAIL", "p_CLOSE", "CONJUGATE", "p_DEFINESIZE", "SIZEOF",
+  "BITSIZEOF", "ALIGNOF", "TYPEOF", "gpc_RETURNADDRESS",
+  "gpc_FRAMEADDRESS", "LEX_LABEL_ADDR", "LEX_INTCONST", "LEX_STRCONST",
+  "LEX_REALCONST", "LEX_RANGE", "LEX_ELLIPSIS", "LEX_ASSIGN", "'<'", "'='",
+  "'>'", "LEX_IN", "LEX_NE", "LEX_GE", "LEX_LE", "'-'", "'+'", "LEX_OR",
+  "LEX_OR_ELSE", "LEX_CEIL_PLUS", "LEX_CEIL_MINUS", "LEX_FLOOR_PLUS",
+  "LEX_FLOOR_MINUS", "'/'", "'*'", "LEX_DIV", "LEX_MOD", "LEX_AND",
+  "LEX_AND_THEN", "LEX_SHL", "LEX_SHR", "LEX_XOR", "LEX_CEIL_MULT",
+  "LEX_CEIL_DIV", "LEX_FLOOR_MULT", "LEX_FLOOR_DIV", "LEX_POW",
+  "LEX_POWER", "LEX_IS", "LEX_AS", "LEX_NOT", "LEX_EXTERNAL", "p_MARK",
+  "p_RELEASE", "p_UPDATE", "p_GETTIMESTAMP", "p_UNBIND", "p_EXTEND",
+  "bp_APPEND", "p_BIND", "p_SEEKREAD", "p_SEEKWRITE", "p_SEEKUPDATE",
+  "LEX_SYMDIFF", "p_ARG", "p_CARD", "p_EMPTY", "p_POSITION",
+  "p_LASTPOSITION", "p_LENGTH", "p_TRIM", "p_BINDING", "p_DATE", "p_TIME",
+  "LEX_RENAME", "LEX_IMPORT", "LEX_USES", "LEX_QUALIFIED", "LEX_ONLY",
+  "prec_if", "LEX_ELSE", "lower_than_error", "'.'", "'('", "')'", "','",
+  "'^'", "'@'", "':'", "'['", "']'", "';'", "$accept", "pascal_program",
+  "main_program_declaration", "$@1", "program_heading",
+  "optional_par_id_list", "id_list", "typename", "identifier",
+  "new_identifier", "new_identifier_1", "any_global_declaration_part",
+  "any_declaration_part", "any_decl", "simple_decl",
+  "constant_definition_part", "constant_definition_list",
+  "constant_definition", "constant", "number", "unsigned_number", "sign",
+  "constant_literal", "predefined_literal", "string",
+  "type_definition_part", "type_definition_list", "type_definition",
+  "type_denoter", "new_ordinal_type", "enumerated_type", "enum_list",
+  "enumerator", "subrange_type", "new_pointer_type", "pointer_char",
+  "pointer_domain_type", "new_procedural_type",
+  "optional_procedural_type_formal_parameter_list",
+  "procedural_type_formal_parameter_list",
+  "procedural_type_formal_parameter", "new_structured_type", "array_type",
+  "array_index_list", "ordinal_index_type", "set_type", "record_type",
+  "record_field_list", "fixed_part", "record_section", "variant_part",
+  "rest_of_variant", "variant_selector", "variant_type", "variant_list",
+  "variant", "case_constant_list", "one_case_constant",
+  "variable_declaration_part", "variable_declaration_list",
+  "variable_declaration", "function_declaration", "$@2", "$@3",
+  "function_heading", "directive_list", "directive", "functiontype",
+  "optional_par_formal_parameter_list", "formal_parameter_list",
+  "formal_parameter", "statement_part", "compound_statement",
+  "statement_sequence", "statement", "structured_statement",
+  "with_statement", "structured_variable_list", "structured_variable",
+  "conditional_statement", "simple_if", "@4", "if_statement", "@5",
+  "case_statement", "$@6", "optional_semicolon_or_else_branch", "$@7",
+  "case_element_list", "case_element", "$@8", "case_default",
+  "repetitive_statement", "repeat_statement", "@9", "while_statement",
+  "@10", "for_statement", "@11", "for_direction", "simple_statement",
+  "empty_statement", "optional_par_actual_parameter_list",
+  "actual_parameter_list", "actual_parameter",
+  "assignment_or_call_statement",
+  "variable_or_function_access_maybe_assignment", "rest_of_statement",
+  "standard_procedure_statement", "optional_par_write_parameter_list",
+  "write_actual_parameter_list", "write_actual_parameter",
+  "rts_proc_onepar", "rts_proc_parlist", "statement_extensions",
+  "return_statement", "break_statement", "continue_statement",
+  "variable_access_or_typename", "index_expression_list",
+  "index_expression_item", "static_expression", "boolean_expression",
+  "expression", "simple_expression", "term", "signed_primary", "primary",
+  "signed_factor", "factor", "address_operator",
+  "variable_or_function_access",
+  "variable_or_function_access_no_standard_function",
+  "variable_or_function_access_no_id", "set_constructor",
+  "set_constructor_element_list", "member_designator",
+  "standard_functions", "optional_par_actual_parameter", "rts_fun_optpar",
+  "rts_fun_onepar", "rts_fun_parlist", "relational_operator",
+  "multiplying_operator", "adding_operator", "semi", "optional_semicolon", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-499)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-379)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+      36,  1523,    71,  -115,  -122,  -499,  -499,  -499,  -499,  -499,
+    -499,  -499,  -499,  -499,  -499,  -499,  -499,  -499,  -499,  -499,
+    -499,  -499,  -499,  -499,  -499,  -499,  -499,  -499,  -499,  -499,
+    -499,  -499,  -499,  -499,  -499,  -499,  -499,  -499,  -499,  -499,
+    -499,  -499,  -499,  -499,  -499,  -499,  -499,  -499,  -499,   -97,
+    -499,  -499,  -499,  -499,  -499,  1523,  -499,    78,  -163,  -499,
+    1523,  1523,  1523,  1523,  1523,   107,  -499,  -499,  -499,  -499,
+    -499,  -499,  -122,  -499,  1523,   -21,  1523,  -499,   -81,   -81,
+     -11,  -122,  -499,  -133,  1523,  -499,   866,  -499,  -499,   -10,
+    -499,   664,  -499,  1319,   -95,  -499,   887,  1523,   887,  -499,
+    -499,   664,   601,   664,  -499,   664,   601,  -499,  -499,  -499,
+    -499,  -499,  -499,   -73,   -60,   -73,   -60,   -60,   -48,   -44,
+    -499,  -499,  -499,  -499,  -499,  -499,  -499,  -499,  -499,  -499,
+    -499,  -499,  -499,  -499,  -499,  -499,  -499,  -499,  -499,  -499,
+    -499,   664,  -499,  -499,  -499,  -499,  -499,  -499,  -499,  -499,
+    -499,  -499,  -499,  -499,  -499,  -499,  -499,  -499,  -499,  -499,
+    -499,  -499,  -499,  -499,  -499,  -499,  -499,  -499,  -499,  -499,
+    -499,  -499,  -499,   664,  -499,  -110,  -499,     9,  -499,  -499,
+    -499,  -499,   -65,  -499,  -499,  -499,  -499,  -499,  -499,  -499,
+    -499,  -499,    34,  -499,   -36,   -29,  -499,  -499,  -499,  -499,
+     601,     0,    16,    42,  -499,    26,    40,    43,  -499,  -499,
+    -499,  -122,  -499,  -499,  -499,  -499,  -499,  -499,  -499,  -499,
+    -499,   664,   465,  -499,  -499,   664,  -499,  -499,     6,  -122,
+     379,   -83,    31,  -499,   -19,  -499,   732,     0,  -499,  -499,
+    1523,   -79,  -128,  -499,   205,  -499,   104,    47,    56,    56,
+    1367,   248,  1523,  -499,  -499,  -499,  -499,   141,  -499,  -499,
+      30,  -499,  -499,  -499,  -499,  -499,  -499,  1211,  -499,  -499,
+    -499,  -499,  -499,  -499,  -122,   197,   -34,   255,   379,   866,
+     276,     8,  -499,     0,   664,  -499,   664,  -499,  -499,  -499,
+    -499,  1086,   664,   379,   246,  -499,   866,  -499,   664,  -499,
+     664,   664,     0,  1523,   664,  -499,   664,   664,  -499,   664,
+     664,    78,   -10,   664,  -499,  -499,  -499,   357,  -154,  -499,
+    -499,  -499,  -499,  -499,  -499,  -499,   664,  -499,  -499,  -499,
+     664,  -499,  -499,   664,   664,   664,   664,  -499,  -499,  -499,
+    -499,   664,   664,   732,   732,   205,  -499,   -64,   205,  -499,
+    1319,  -499,  -499,    20,  1475,   -95,  -499,  1029,   -45,   278,
+      88,  -499,  -499,   887,  -499,   -14,  -499,    24,  -499,  -499,
+    -499,  -499,  -499,  -499,  -499,   664,  -499,    -3,  -499,   866,
+     601,    81,    50,  -499,   379,    63,  -499,   102,   116,   117,
+      89,  -499,  -499,   866,   379,   118,    91,  -499,  -120,  -499,
+     367,   105,   119,   121,   108,  -499,   107,  -499,  -499,   664,
+     664,  -499,   -83,   -83,    31,    31,    31,    31,  -499,  -499,
+    -499,  -499,  -499,   205,  -499,  -499,  -499,  -499,   -98,  -499,
+    1523,   -26,  -113,  -499,  -499,  -103,   191,   192,  -499,   120,
+    -499,   309,  -499,   887,  -499,    11,  1367,  -499,  -499,  -499,
+    1523,  -499,   664,   122,   866,   664,   866,  -499,  -499,   664,
+    -499,   664,  -499,   664,  -499,  -499,   664,  -499,  -499,  -499,
+     664,  -499,   664,  -499,  -499,  -499,  -499,  -122,   379,  -499,
+    -499,    20,   310,    -9,   205,  -499,  1475,    20,   664,  -499,
+    -499,  -499,  -499,   127,  -499,  -161,  -499,   198,  -499,  -499,
+     664,  -499,  -499,  -499,   213,  -499,  -499,   111,  -499,   379,
+    -499,  -499,   887,   205,  -499,  -499,  -499,  -161,  -499,    -7,
+     664,   126,  -499,   329,  -499,   533,  -499,   664,    93,   664,
+    -499,  -499,  -499,  -499,   142,   533,  -499,   143,  -499,   866,
+    -499,   866,  -499,  -499,  -499,  -499,   379,  1367,  -499,  1367,
+    -499,  -122,   866,   140,   144,  -499,   136,  -499,  -499,  -499
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+       0,     0,     0,     0,     0,    13,    17,    18,    19,    20,
+      21,    22,    23,    24,    25,    26,    27,    30,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
+      43,    44,    45,    46,    47,    48,    28,    29,    14,    16,
+      15,    49,    50,    51,    52,    53,    54,    55,    56,     6,
+      12,     1,     2,   376,    57,     0,     5,     3,     0,     8,
+       0,     0,     0,     0,     0,     0,    58,    61,    63,    64,
+      65,    62,     0,     7,     0,     0,    66,    67,   165,   165,
+       0,     0,    88,     0,   149,   150,   218,     4,   171,   154,
+       9,     0,    68,     0,   163,   157,     0,    87,     0,   151,
+      11,     0,     0,     0,   206,     0,     0,   319,   318,   254,
+     255,   246,   247,   239,   219,   239,   219,   219,     0,     0,
+     339,   340,   341,   342,   343,   344,   345,   346,   348,   349,
+     258,   259,   351,   352,   362,   363,   353,   337,   338,   278,
+     279,   274,   276,   277,   250,   264,   266,   265,   269,   270,
+     268,   267,   248,   249,   251,   252,   253,   256,   257,   260,
+     261,   262,   263,   347,   350,   354,   355,   356,   357,   358,
+     359,   360,   361,     0,   313,   225,   177,     0,   173,   175,
+     178,   179,   191,   185,   186,   180,   203,   204,   205,   176,
+     214,   215,   228,   216,     0,     0,   217,   271,   273,   272,
+       0,     0,   314,   227,   315,   335,     0,     0,   161,   162,
+      59,     0,   159,    82,    84,    83,    76,    85,    77,    79,
+      78,     0,     0,   316,   309,     0,   308,    81,    80,     0,
+     286,   290,   291,   296,   299,   301,     0,   307,   317,   310,
+       0,     0,     0,   167,     0,   158,    10,     0,   110,   110,
+     128,     0,     0,   104,   105,    91,    70,     0,    72,    75,
+       0,    73,    90,    92,    96,    97,    93,     0,    94,    95,
+     118,   119,   120,    89,     0,     0,     0,     0,   287,   218,
+       0,     0,   182,   184,     0,   232,     0,   234,   233,   235,
+     236,     0,     0,   275,     0,   172,   218,   189,     0,   224,
+       0,     0,   226,     0,     0,   322,     0,     0,   333,     0,
+       0,   155,   153,     0,   311,   305,   326,   330,     0,   328,
+     300,    86,    69,   368,   367,   369,     0,   364,   366,   365,
+       0,   374,   375,     0,     0,     0,     0,   372,   373,   370,
+     371,     0,     0,     0,     0,     0,   312,     0,     0,   166,
+       0,    10,   164,     0,     0,   163,   108,     0,     0,     0,
+     377,   132,   131,     0,   101,     0,    99,     0,    71,    74,
+     106,   103,   107,   152,   192,     0,   187,     0,   208,   218,
+       0,   243,     0,   241,   223,     0,   221,    11,     0,   317,
+       0,   321,   174,   218,   229,     0,     0,   320,     0,   282,
+     284,     0,     0,     0,     0,    60,     0,   160,   306,     0,
+       0,   327,   289,   288,   294,   295,   293,   292,   298,   297,
+     302,   303,   304,     0,   169,   168,   125,   124,     0,   122,
+       0,   114,     0,   112,   109,    10,    16,    15,   140,     0,
+     141,     0,   139,     0,   127,   376,     0,   129,   126,    98,
+       0,   102,     0,     0,   218,     0,   218,   181,   183,     0,
+     240,     0,   220,     0,   325,   237,     0,   190,   230,   231,
+       0,   323,     0,   324,   336,   332,   334,     0,   331,   329,
+     170,     0,     0,   117,     0,   111,     0,     0,     0,   134,
+     133,   130,   100,   199,   145,   377,   197,   147,   213,   212,
+       0,   188,   207,   209,   244,   242,   222,     0,   283,   285,
+     156,   123,     0,     0,   115,   113,   138,   377,   142,     0,
+       0,     0,   201,     0,   195,     0,   194,     0,     0,     0,
+     238,   121,   116,   135,     0,     0,   136,     0,   146,   218,
+     193,   218,   202,   198,   148,   210,   245,   128,   143,   128,
+     200,   196,   218,     0,     0,   211,   377,   144,   378,   137
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -499,  -499,  -499,  -499,  -499,  -499,   -50,  -237,   -85,     2,
+    -499,  -499,  -499,    35,  -499,  -499,  -499,   279,    -5,  -499,
+     -68,   -86,    41,  -499,  -499,  -499,  -499,   267,   -80,  -307,
+    -499,  -499,   -84,  -499,  -499,    38,  -499,   100,   124,  -499,
+    -118,  -499,  -499,  -499,  -111,  -499,  -499,  -498,  -499,   -58,
+     -57,  -499,  -499,   -96,  -499,  -145,  -456,  -127,  -499,  -499,
+     308,  -499,  -499,  -499,  -499,  -499,    85,    44,   321,  -499,
+      55,     1,   -59,  -262,  -265,  -499,  -499,  -499,    29,  -499,
+    -499,  -499,  -499,  -499,  -499,  -499,  -499,  -499,  -499,  -114,
+    -499,  -105,  -499,  -499,  -499,  -499,  -499,  -499,  -499,  -499,
+    -499,  -499,     5,  -266,  -226,  -499,  -499,  -499,  -499,   299,
+    -499,   -46,  -499,  -499,  -499,  -499,  -499,  -499,  -499,  -499,
+     -54,   -89,   -90,   -49,  -213,  -112,  -199,  -499,   109,  -166,
+     -77,   -82,  -499,   -78,  -499,  -499,     7,  -499,  -499,  -499,
+    -499,  -499,  -499,  -499,  -499,    -4,  -450
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,     2,     3,    65,     4,    56,   358,   255,   223,    59,
+      50,    57,   311,    66,    67,    68,    76,    77,   257,   258,
+     224,   225,   226,   227,   228,    69,    81,    82,   262,   263,
+     264,   365,   366,   265,   266,   267,   371,   268,   355,   432,
+     433,   269,   270,   428,   429,   271,   272,   359,   360,   361,
+     362,   533,   441,   442,   517,   518,   493,   494,    70,    84,
+      85,    71,   210,   406,    72,   211,   212,   245,    94,   242,
+     243,    87,   176,   177,   178,   179,   180,   281,   282,   181,
+     182,   454,   183,   393,   184,   452,   523,   541,   495,   496,
+     521,   524,   185,   186,   279,   187,   456,   188,   552,   500,
+     189,   190,   287,   385,   386,   191,   192,   299,   193,   285,
+     382,   383,   194,   195,   196,   197,   198,   199,   388,   398,
+     399,   497,   277,   384,   231,   232,   233,   234,   314,   235,
+     236,   237,   202,   238,   239,   318,   319,   204,   308,   205,
+     206,   207,   330,   342,   336,   296,   447
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      54,   175,   229,    49,   201,    58,    88,   352,   203,   200,
+     260,   256,   260,   256,    83,   280,   379,   377,   274,   295,
+     276,  -378,   208,   246,   283,   455,   320,   100,   259,   -11,
+     259,   392,   519,   100,    83,   396,   522,   213,    73,    74,
+     401,   213,   230,   241,   404,   526,   427,   445,   410,   553,
+     440,   554,   275,   411,   278,   315,   278,     1,   381,   331,
+     332,   333,    75,    78,    79,    80,   390,   536,    89,    74,
+     346,    51,    98,   349,   395,   334,    90,    97,    75,   519,
+      53,   402,   470,   403,    52,    60,    53,   471,   485,  -316,
+    -316,    61,   293,  -316,  -316,    53,  -316,   335,    62,    80,
+     375,   545,   -13,    55,   481,    63,   559,    64,   422,   482,
+     244,   424,    86,   412,   457,    91,   426,   413,   302,    93,
+     438,   289,   290,    74,   294,    96,   348,   284,   467,   214,
+     215,   498,   297,   214,   215,   313,   321,   261,    74,   261,
+     286,   423,   418,   419,   343,   344,   345,   315,   499,   216,
+     217,   218,   291,   216,   217,   218,   292,    74,   209,   216,
+     443,   218,   219,   220,   300,   303,   219,   220,   298,   253,
+     254,   301,   304,   317,   427,   368,    74,   420,   421,   484,
+     440,   337,   338,   339,   340,   341,   480,   449,   450,   501,
+     347,   503,   369,    74,   175,   520,   513,   201,   537,   303,
+     507,   203,   200,   253,   254,    53,   304,   312,   351,   201,
+     380,   175,  -378,   389,   201,   374,   306,    53,   203,   200,
+     252,   414,   415,   416,   417,   322,   307,   313,   323,   324,
+     325,   326,   327,   328,   329,   381,   -11,   506,   350,   305,
+     309,  -317,  -317,   310,   426,  -317,  -317,   514,  -317,   394,
+     438,   460,   461,   353,   364,   400,   354,   323,   324,   325,
+     326,   327,   328,   329,   462,   463,   363,   260,   256,   370,
+     373,   260,   256,   367,   550,   305,   532,   260,   256,   551,
+     376,   260,   256,   448,   378,   259,   459,   555,   444,   259,
+     465,   466,   469,   463,   175,   259,   445,   201,   283,   259,
+     241,   203,   200,  -281,   431,   397,   473,   463,   175,   476,
+     463,   201,   530,   463,   305,   203,   200,   464,  -280,   468,
+     474,   305,   475,   -84,   -83,   487,   453,   488,   512,   520,
+     527,   539,   323,   324,   325,   326,   327,   328,   329,   540,
+     305,   556,   547,   549,   558,   557,   405,    88,   323,   324,
+     325,   326,   327,   328,   329,    92,   446,   260,   256,   439,
+     478,   317,   451,   489,   273,   502,   492,   372,   515,   175,
+     511,   175,   201,   356,   201,   259,   203,   200,   203,   200,
+     483,   323,   324,   325,   326,   327,   328,   329,   490,   491,
+     548,   516,    99,   538,   261,   260,   256,   407,   261,   434,
+      95,   260,   256,   230,   261,   425,   278,   477,   261,   458,
+     504,   543,   534,   259,   288,   505,   508,   479,   529,   259,
+       0,   400,   408,   509,     0,     0,   260,   256,   486,     0,
+       0,     0,   531,     0,     0,     0,   431,     0,   544,   230,
+       0,     0,     0,     0,   259,     0,     0,   391,     0,     0,
+       0,   528,   364,     0,   175,     0,   175,   201,     0,   201,
+       0,   203,   200,   203,   200,     0,     0,   175,   100,     0,
+     201,   230,     0,   510,   203,   200,   230,     0,   230,     0,
+     546,     0,   213,     0,   261,     0,   230,     0,     0,   409,
+       0,   525,   323,   324,   325,   326,   327,   328,   329,   472,
+       0,     0,   323,   324,   325,   326,   327,   328,   329,     0,
+       0,     0,     0,   535,   323,   324,   325,   326,   327,   328,
+     329,     0,   261,     0,     0,     0,     0,     0,   261,     0,
+       0,     0,     0,     0,     0,     0,   100,     0,     0,     0,
+       0,   107,   108,     0,     0,     0,     0,     0,     0,     0,
+     213,     0,   118,   261,   120,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,     0,     0,   132,   133,   134,   135,
+     136,   137,   138,     0,   214,   215,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   216,   217,   218,     0,     0,     0,
+       0,     0,     0,     0,   100,     0,     0,   219,   220,   107,
+     108,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     118,     0,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   221,     0,   132,   133,   134,   135,   136,   137,
+     138,     0,   214,   215,     0,     0,   163,   164,   165,   166,
+     167,   168,   169,   170,   171,   172,     0,     0,     0,     0,
+       0,     0,   216,   217,   218,   173,     0,   100,     0,   174,
+       0,   222,   316,     0,     0,   219,   220,   107,   108,     0,
+       0,   213,     0,     0,     0,     0,     0,     0,   118,     0,
+     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
+     221,     0,   132,   133,   134,   135,   136,   137,   138,     0,
+       0,     0,     0,     0,   163,   164,   165,   166,   167,   168,
+     169,   170,   171,   172,     0,     0,     0,     0,     0,     0,
+     542,     0,     0,   173,     0,   100,     0,   174,     0,   222,
+     107,   108,     0,     0,     0,     0,     0,     0,     0,   213,
+       0,   118,     0,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,     0,     0,   132,   133,   134,   135,   136,
+     137,   138,     0,   214,   215,     0,     0,     0,     0,     0,
+       0,     0,   163,   164,   165,   166,   167,   168,   169,   170,
+     171,   172,     0,   216,   217,   218,     0,     0,     0,     0,
+       0,   173,     0,     0,     0,     0,   219,   220,   107,   108,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   118,
+       0,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   221,     0,   132,   133,   134,   135,   136,   137,   138,
+       0,   214,   215,     0,     0,   163,   164,   165,   166,   167,
+     168,   169,   170,   171,   172,     0,     0,     0,     0,     0,
+       0,   216,   217,   218,   173,     0,     0,     0,   174,   100,
+     222,    86,   101,     0,     0,     0,     0,     0,   102,     0,
+       0,   103,     0,     0,     0,     0,     0,     0,     0,   104,
+     246,   247,     0,     0,     0,     0,   105,   106,     0,   221,
+     248,     0,     0,     0,   213,     0,     0,   249,     0,   250,
+       0,   251,     0,   163,   164,   165,   166,   167,   168,   169,
+     170,   171,   172,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   173,     0,     0,     0,   174,     0,   222,     0,
+       0,     0,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,     0,     0,     0,     0,     0,   139,
+     140,   141,     0,   142,   143,   144,     0,   145,     0,     0,
+       0,     0,     0,     0,     0,     0,   214,   215,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     146,     0,     0,     0,     0,     0,   216,   217,   218,     0,
+     147,     0,   148,   149,   150,     0,     0,     0,     0,   219,
+     220,     0,   435,   151,     0,   152,   153,   154,   155,   156,
+     157,   158,   159,   160,   161,   162,   213,   163,   164,   165,
+     166,   167,   168,   169,   170,   171,   172,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   173,     0,     0,     0,
+     174,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   252,     0,   387,
+     253,   254,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     6,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
+      21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
+      31,    32,    33,    34,    35,    36,    37,    38,   436,   437,
+       0,     0,    41,    42,    43,    44,    45,    46,     0,     0,
+       0,    47,    48,     0,     0,     0,     0,     0,   216,   217,
+     218,     0,   107,   108,     0,     0,     0,     0,     0,     0,
+       0,   219,   220,   118,     0,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,     0,     0,   132,   133,   134,
+     135,   136,   137,   138,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     5,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   248,     0,     0,     0,     0,   252,
+       0,   249,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   163,   164,   165,
+     166,   167,   168,   169,   170,   171,   172,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   173,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,     5,     0,    41,    42,    43,    44,    45,    46,
+       0,     0,     0,    47,    48,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   240,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       5,     0,     0,   357,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     6,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
+      21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
+      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
+       0,     0,    41,    42,    43,    44,    45,    46,     0,     0,
+       0,    47,    48,     6,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
+      23,    24,    25,    26,    27,    28,    29,    30,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    40,     5,     0,
+      41,    42,    43,    44,    45,    46,     0,     0,     0,    47,
+      48,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   430,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     5,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,     0,     0,    41,    42,
+      43,    44,    45,    46,     0,     0,     0,    47,    48,     6,
+       7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,     0,     0,    41,    42,    43,    44,
+      45,    46,     0,     0,     0,    47,    48
+};
+
+static const yytype_int16 yycheck[] =
+{
+       4,    86,    91,     1,    86,    55,    65,   244,    86,    86,
+      96,    96,    98,    98,    64,   105,     8,   279,    98,    10,
+     102,    10,    32,     3,   106,    28,   225,     3,    96,   132,
+      98,   296,   488,     3,    84,   301,   197,    17,   201,   202,
+     306,    17,    91,    93,   310,   495,   353,   208,   202,   547,
+     357,   549,   101,   207,   103,   221,   105,    21,   284,   142,
+     143,   144,    60,    61,    62,    63,   292,   517,    72,   202,
+     236,     0,   205,   201,   300,   158,    74,    81,    76,   535,
+     208,   307,   202,   309,   199,     7,   208,   207,   201,   199,
+     200,    13,   141,   203,   204,   208,   206,   180,    20,    97,
+     134,     8,   205,   200,   202,    27,   556,    29,   345,   207,
+     205,   348,     5,   326,   379,   136,   353,   330,   200,   200,
+     357,   116,   117,   202,   173,   136,   205,   200,   393,   109,
+     110,     9,   197,   109,   110,   221,   130,    96,   202,    98,
+     200,   205,   341,   342,   163,   164,   165,   313,    26,   129,
+     130,   131,   200,   129,   130,   131,   200,   202,   168,   129,
+     205,   131,   142,   143,   200,   199,   142,   143,   134,   203,
+     204,   200,   206,   222,   481,   260,   202,   343,   344,   205,
+     487,   150,   151,   152,   153,   154,   423,   201,   202,   454,
+     240,   456,   260,   202,   279,   202,   205,   279,   205,   199,
+     466,   279,   279,   203,   204,   208,   206,   211,     3,   291,
+     202,   296,   201,   291,   296,    18,   200,   208,   296,   296,
+     200,   333,   334,   335,   336,   229,   200,   313,   135,   136,
+     137,   138,   139,   140,   141,   461,   132,   463,   242,   201,
+     200,   199,   200,   200,   481,   203,   204,   484,   206,   298,
+     487,   201,   202,   206,   252,   304,   200,   135,   136,   137,
+     138,   139,   140,   141,   201,   202,    18,   353,   353,   267,
+     274,   357,   357,   132,   539,   237,   513,   363,   363,   541,
+      25,   367,   367,   363,     8,   353,   205,   552,    10,   357,
+     201,   202,   201,   202,   379,   363,   208,   379,   380,   367,
+     350,   379,   379,   201,   354,   303,   201,   202,   393,   201,
+     202,   393,   201,   202,   276,   393,   393,   201,   201,   201,
+     201,   283,   201,   132,   132,   205,   375,    18,    18,   202,
+     132,   205,   135,   136,   137,   138,   139,   140,   141,    10,
+     302,   201,   200,   200,   208,   201,   311,   406,   135,   136,
+     137,   138,   139,   140,   141,    76,   360,   443,   443,   357,
+     409,   410,   367,   443,    97,   455,   450,   267,   486,   454,
+     481,   456,   454,   249,   456,   443,   454,   454,   456,   456,
+     430,   135,   136,   137,   138,   139,   140,   141,   446,   446,
+     535,   487,    84,   520,   353,   481,   481,   312,   357,   355,
+      79,   487,   487,   452,   363,   350,   455,   406,   367,   380,
+     459,   525,   517,   481,   115,   461,   470,   410,   205,   487,
+      -1,   470,   313,   472,    -1,    -1,   512,   512,   432,    -1,
+      -1,    -1,   512,    -1,    -1,    -1,   486,    -1,   527,   488,
+      -1,    -1,    -1,    -1,   512,    -1,    -1,   201,    -1,    -1,
+      -1,   500,   450,    -1,   539,    -1,   541,   539,    -1,   541,
+      -1,   539,   539,   541,   541,    -1,    -1,   552,     3,    -1,
+     552,   520,    -1,   477,   552,   552,   525,    -1,   527,    -1,
+     529,    -1,    17,    -1,   443,    -1,   535,    -1,    -1,   132,
+      -1,   495,   135,   136,   137,   138,   139,   140,   141,   132,
+      -1,    -1,   135,   136,   137,   138,   139,   140,   141,    -1,
+      -1,    -1,    -1,   517,   135,   136,   137,   138,   139,   140,
+     141,    -1,   481,    -1,    -1,    -1,    -1,    -1,   487,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,     3,    -1,    -1,    -1,
+      -1,    76,    77,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      17,    -1,    87,   512,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    -1,    -1,   101,   102,   103,   104,
+     105,   106,   107,    -1,   109,   110,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   129,   130,   131,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,     3,    -1,    -1,   142,   143,    76,
+      77,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      87,    -1,    89,    90,    91,    92,    93,    94,    95,    96,
+      97,    98,   167,    -1,   101,   102,   103,   104,   105,   106,
+     107,    -1,   109,   110,    -1,    -1,   181,   182,   183,   184,
+     185,   186,   187,   188,   189,   190,    -1,    -1,    -1,    -1,
+      -1,    -1,   129,   130,   131,   200,    -1,     3,    -1,   204,
+      -1,   206,   207,    -1,    -1,   142,   143,    76,    77,    -1,
+      -1,    17,    -1,    -1,    -1,    -1,    -1,    -1,    87,    -1,
+      89,    90,    91,    92,    93,    94,    95,    96,    97,    98,
+     167,    -1,   101,   102,   103,   104,   105,   106,   107,    -1,
+      -1,    -1,    -1,    -1,   181,   182,   183,   184,   185,   186,
+     187,   188,   189,   190,    -1,    -1,    -1,    -1,    -1,    -1,
+     197,    -1,    -1,   200,    -1,     3,    -1,   204,    -1,   206,
+      76,    77,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    17,
+      -1,    87,    -1,    89,    90,    91,    92,    93,    94,    95,
+      96,    97,    98,    -1,    -1,   101,   102,   103,   104,   105,
+     106,   107,    -1,   109,   110,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   181,   182,   183,   184,   185,   186,   187,   188,
+     189,   190,    -1,   129,   130,   131,    -1,    -1,    -1,    -1,
+      -1,   200,    -1,    -1,    -1,    -1,   142,   143,    76,    77,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    87,
+      -1,    89,    90,    91,    92,    93,    94,    95,    96,    97,
+      98,   167,    -1,   101,   102,   103,   104,   105,   106,   107,
+      -1,   109,   110,    -1,    -1,   181,   182,   183,   184,   185,
+     186,   187,   188,   189,   190,    -1,    -1,    -1,    -1,    -1,
+      -1,   129,   130,   131,   200,    -1,    -1,    -1,   204,     3,
+     206,     5,     6,    -1,    -1,    -1,    -1,    -1,    12,    -1,
+      -1,    15,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    23,
+       3,     4,    -1,    -1,    -1,    -1,    30,    31,    -1,   167,
+      13,    -1,    -1,    -1,    17,    -1,    -1,    20,    -1,    22,
+      -1,    24,    -1,   181,   182,   183,   184,   185,   186,   187,
+     188,   189,   190,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   200,    -1,    -1,    -1,   204,    -1,   206,    -1,
+      -1,    -1,    76,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    91,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,    -1,    -1,    -1,    -1,    -1,   113,
+     114,   115,    -1,   117,   118,   119,    -1,   121,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   109,   110,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     144,    -1,    -1,    -1,    -1,    -1,   129,   130,   131,    -1,
+     154,    -1,   156,   157,   158,    -1,    -1,    -1,    -1,   142,
+     143,    -1,     3,   167,    -1,   169,   170,   171,   172,   173,
+     174,   175,   176,   177,   178,   179,    17,   181,   182,   183,
+     184,   185,   186,   187,   188,   189,   190,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   200,    -1,    -1,    -1,
+     204,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   200,    -1,     3,
+     203,   204,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    76,    77,    78,    79,    80,
+      81,    82,    83,    84,    85,    86,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,    96,    97,    98,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+      -1,    -1,   113,   114,   115,   116,   117,   118,    -1,    -1,
+      -1,   122,   123,    -1,    -1,    -1,    -1,    -1,   129,   130,
+     131,    -1,    76,    77,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   142,   143,    87,    -1,    89,    90,    91,    92,    93,
+      94,    95,    96,    97,    98,    -1,    -1,   101,   102,   103,
+     104,   105,   106,   107,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,     3,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    13,    -1,    -1,    -1,    -1,   200,
+      -1,    20,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   181,   182,   183,
+     184,   185,   186,   187,   188,   189,   190,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   200,    76,    77,    78,
+      79,    80,    81,    82,    83,    84,    85,    86,    87,    88,
+      89,    90,    91,    92,    93,    94,    95,    96,    97,    98,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     109,   110,     3,    -1,   113,   114,   115,   116,   117,   118,
+      -1,    -1,    -1,   122,   123,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    29,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+       3,    -1,    -1,     6,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    76,    77,    78,    79,    80,
+      81,    82,    83,    84,    85,    86,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,    96,    97,    98,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+      -1,    -1,   113,   114,   115,   116,   117,   118,    -1,    -1,
+      -1,   122,   123,    76,    77,    78,    79,    80,    81,    82,
+      83,    84,    85,    86,    87,    88,    89,    90,    91,    92,
+      93,    94,    95,    96,    97,    98,    99,   100,   101,   102,
+     103,   104,   105,   106,   107,   108,   109,   110,     3,    -1,
+     113,   114,   115,   116,   117,   118,    -1,    -1,    -1,   122,
+     123,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    29,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,     3,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,    -1,    -1,   113,   114,
+     115,   116,   117,   118,    -1,    -1,    -1,   122,   123,    76,
+      77,    78,    79,    80,    81,    82,    83,    84,    85,    86,
+      87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,   104,   105,   106,
+     107,   108,   109,   110,    -1,    -1,   113,   114,   115,   116,
+     117,   118,    -1,    -1,    -1,   122,   123
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
+{
+       0,    21,   210,   211,   213,     3,    76,    77,    78,    79,
+      80,    81,    82,    83,    84,    85,    86,    87,    88,    89,
+      90,    91,    92,    93,    94,    95,    96,    97,    98,    99,
+     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,   113,   114,   115,   116,   117,   118,   122,   123,   218,
+     219,     0,   199,   208,   354,   200,   214,   220,   215,   218,
+       7,    13,    20,    27,    29,   212,   222,   223,   224,   234,
+     267,   270,   273,   201,   202,   218,   225,   226,   218,   218,
+     218,   235,   236,   215,   268,   269,     5,   280,   281,   354,
+     218,   136,   226,   200,   277,   277,   136,   354,   205,   269,
+       3,     6,    12,    15,    23,    30,    31,    76,    77,    78,
+      79,    80,    81,    82,    83,    84,    85,    86,    87,    88,
+      89,    90,    91,    92,    93,    94,    95,    96,    97,    98,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   113,
+     114,   115,   117,   118,   119,   121,   144,   154,   156,   157,
+     158,   167,   169,   170,   171,   172,   173,   174,   175,   176,
+     177,   178,   179,   181,   182,   183,   184,   185,   186,   187,
+     188,   189,   190,   200,   204,   217,   281,   282,   283,   284,
+     285,   288,   289,   291,   293,   301,   302,   304,   306,   309,
+     310,   314,   315,   317,   321,   322,   323,   324,   325,   326,
+     339,   340,   341,   342,   346,   348,   349,   350,    32,   168,
+     271,   274,   275,    17,   109,   110,   129,   130,   131,   142,
+     143,   167,   206,   217,   229,   230,   231,   232,   233,   330,
+     332,   333,   334,   335,   336,   338,   339,   340,   342,   343,
+      29,   215,   278,   279,   205,   276,     3,     4,    13,    20,
+      22,    24,   200,   203,   204,   216,   217,   227,   228,   229,
+     230,   231,   237,   238,   239,   242,   243,   244,   246,   250,
+     251,   254,   255,   236,   237,   332,   340,   331,   332,   303,
+     331,   286,   287,   340,   200,   318,   200,   311,   318,   311,
+     311,   200,   200,   332,   332,    10,   354,   197,   134,   316,
+     200,   200,   340,   199,   206,   244,   200,   200,   347,   200,
+     200,   221,   354,   230,   337,   338,   207,   332,   344,   345,
+     335,   130,   354,   135,   136,   137,   138,   139,   140,   141,
+     351,   142,   143,   144,   158,   180,   353,   150,   151,   152,
+     153,   154,   352,   163,   164,   165,   338,   215,   205,   201,
+     354,     3,   216,   206,   200,   247,   247,     6,   215,   256,
+     257,   258,   259,    18,   218,   240,   241,   132,   217,   229,
+     218,   245,   246,   354,    18,   134,    25,   282,     8,     8,
+     202,   313,   319,   320,   332,   312,   313,     3,   327,   342,
+     313,   201,   283,   292,   332,   313,   312,   218,   328,   329,
+     332,   312,   313,   313,   312,   222,   272,   275,   337,   132,
+     202,   207,   333,   333,   334,   334,   334,   334,   335,   335,
+     338,   338,   216,   205,   216,   279,   216,   238,   252,   253,
+      29,   215,   248,   249,   276,     3,   109,   110,   216,   218,
+     238,   261,   262,   205,    10,   208,   354,   355,   237,   201,
+     202,   227,   294,   332,   290,    28,   305,   283,   287,   205,
+     201,   202,   201,   202,   201,   201,   202,   283,   201,   201,
+     202,   207,   132,   201,   201,   201,   201,   280,   332,   345,
+     216,   202,   207,   215,   205,   201,   354,   205,    18,   237,
+     258,   259,   241,   265,   266,   297,   298,   330,     9,    26,
+     308,   283,   331,   283,   332,   320,   313,   312,   329,   332,
+     354,   253,    18,   205,   216,   249,   262,   263,   264,   265,
+     202,   299,   197,   295,   300,   354,   355,   132,   332,   205,
+     201,   237,   216,   260,   300,   354,   355,   205,   266,   205,
+      10,   296,   197,   298,   330,     8,   332,   200,   264,   200,
+     283,   282,   307,   256,   256,   283,   201,   201,   208,   355
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
+{
+       0,   209,   210,   212,   211,   213,   214,   214,   215,   215,
+     216,   217,   218,   219,   219,   219,   219,   219,   219,   219,
+     219,   219,   219,   219,   219,   219,   219,   219,   219,   219,
+     219,   219,   219,   219,   219,   219,   219,   219,   219,   219,
+     219,   219,   219,   219,   219,   219,   219,   219,   219,   219,
+     219,   219,   219,   219,   219,   219,   219,   220,   220,   221,
+     221,   222,   222,   223,   223,   223,   224,   225,   225,   226,
+     227,   227,   227,   227,   228,   228,   229,   229,   230,   230,
+     231,   231,   232,   232,   232,   233,   233,   234,   235,   235,
+     236,   237,   237,   237,   237,   237,   238,   238,   239,   240,
+     240,   241,   242,   243,   244,   244,   245,   245,   246,   246,
+     247,   247,   248,   248,   249,   249,   249,   249,   250,   250,
+     250,   251,   252,   252,   253,   253,   254,   255,   256,   256,
+     256,   256,   257,   257,   258,   259,   260,   260,   261,   261,
+     262,   262,   263,   263,   264,   265,   265,   266,   266,   267,
+     268,   268,   269,   270,   271,   272,   270,   273,   273,   274,
+     274,   275,   275,   276,   276,   277,   277,   278,   278,   279,
+     279,   280,   281,   282,   282,   283,   283,   284,   284,   284,
+     284,   285,   286,   286,   287,   288,   288,   290,   289,   292,
+     291,   291,   294,   293,   295,   296,   295,   297,   297,   299,
+     298,   300,   300,   301,   301,   301,   303,   302,   305,   304,
+     307,   306,   308,   308,   309,   309,   309,   309,   310,   311,
+     311,   312,   312,   313,   314,   315,   315,   315,   316,   316,
+     317,   317,   317,   317,   317,   317,   317,   317,   317,   318,
+     318,   319,   319,   320,   320,   320,   321,   321,   321,   321,
+     321,   321,   321,   321,   322,   322,   322,   322,   322,   322,
+     322,   322,   322,   322,   322,   322,   322,   322,   322,   322,
+     322,   323,   323,   323,   324,   324,   324,   324,   325,   326,
+     327,   327,   328,   328,   329,   329,   330,   331,   332,   332,
+     332,   333,   333,   333,   333,   333,   334,   334,   334,   335,
+     335,   336,   336,   336,   336,   337,   337,   338,   338,   338,
+     338,   338,   338,   339,   340,   340,   341,   341,   342,   342,
+     342,   342,   342,   342,   342,   342,   343,   343,   344,   344,
+     345,   345,   346,   346,   346,   347,   347,   348,   348,   349,
+     349,   349,   349,   349,   349,   349,   349,   349,   349,   349,
+     349,   349,   349,   349,   349,   349,   349,   349,   349,   349,
+     349,   349,   350,   350,   351,   351,   351,   351,   351,   351,
+     352,   352,   352,   352,   353,   353,   354,   355,   355
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     2,     0,     5,     3,     0,     3,     1,     3,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     0,     2,     0,
+       2,     1,     1,     1,     1,     1,     2,     1,     2,     4,
+       1,     2,     1,     1,     2,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     2,     3,     1,     3,
+       3,     1,     1,     1,     1,     1,     1,     1,     3,     1,
+       3,     1,     3,     2,     1,     1,     1,     1,     2,     3,
+       0,     3,     1,     3,     1,     3,     4,     2,     1,     1,
+       1,     6,     1,     3,     1,     1,     3,     3,     0,     2,
+       3,     1,     1,     3,     3,     5,     1,     5,     3,     1,
+       1,     1,     1,     3,     5,     1,     3,     1,     3,     2,
+       1,     2,     4,     4,     0,     0,     7,     3,     4,     1,
+       3,     1,     1,     0,     2,     0,     3,     1,     3,     3,
+       4,     1,     3,     1,     3,     1,     1,     1,     1,     1,
+       1,     4,     1,     3,     1,     1,     1,     0,     5,     0,
+       4,     1,     0,     7,     1,     0,     3,     1,     3,     0,
+       4,     1,     2,     1,     1,     1,     0,     5,     0,     5,
+       0,     9,     1,     1,     1,     1,     1,     1,     0,     0,
+       3,     1,     3,     1,     2,     1,     2,     1,     0,     2,
+       4,     4,     2,     2,     2,     2,     2,     4,     6,     0,
+       3,     1,     3,     1,     3,     5,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     2,     1,     1,     1,     1,
+       1,     1,     1,     3,     1,     3,     1,     1,     3,     3,
+       1,     1,     3,     3,     3,     3,     1,     3,     3,     1,
+       2,     1,     3,     3,     3,     1,     2,     1,     1,     1,
+       1,     2,     2,     1,     1,     1,     1,     1,     1,     1,
+       3,     3,     2,     4,     4,     4,     2,     3,     1,     3,
+       1,     3,     4,     2,     4,     0,     3,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     0,     1
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/* Lookahead token kind.  */
+int yychar;
+
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Number of syntax errors so far.  */
+int yynerrs;
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 3: /* $@1: %empty  */
+#line 218 "gram.y"
+                                                     { start_main(); }
+#line 2606 "y.tab.c"
+    break;
+
+  case 4: /* main_program_declaration: program_heading semi any_global_declaration_part $@1 statement_part  */
+#line 218 "gram.y"
+                                                                                      { end_main(); }
+#line 2612 "y.tab.c"
+    break;
+
+  case 8: /* id_list: new_identifier  */
+#line 232 "gram.y"
+                                { (yyval.y_stid_item) = new_stid_list((yyvsp[0].y_stid)); }
+#line 2618 "y.tab.c"
+    break;
+
+  case 9: /* id_list: id_list ',' new_identifier  */
+#line 233 "gram.y"
+                                { (yyval.y_stid_item) = append_stid_to_list((yyvsp[-2].y_stid_item), (yyvsp[0].y_stid)); }
+#line 2624 "y.tab.c"
+    break;
+
+  case 10: /* typename: LEX_ID  */
+#line 238 "gram.y"
+           { (yyval.y_type) = get_basic_type((yyvsp[0].y_string)); }
+#line 2630 "y.tab.c"
+    break;
+
+  case 11: /* identifier: LEX_ID  */
+#line 243 "gram.y"
+           { (yyval.y_stid) = st_enter_id((yyvsp[0].y_string)); }
+#line 2636 "y.tab.c"
+    break;
+
+  case 12: /* new_identifier: new_identifier_1  */
+#line 248 "gram.y"
+                     { (yyval.y_stid) = st_enter_id((yyvsp[0].y_string)); }
+#line 2642 "y.tab.c"
+    break;
+
+  case 13: /* new_identifier_1: LEX_ID  */
+#line 253 "gram.y"
+             { (yyval.y_string) = (yyvsp[0].y_string); }
+#line 2648 "y.tab.c"
+    break;
+
+  case 14: /* new_identifier_1: p_MAXINT  */
+#line 255 "gram.y"
+             {}
+#line 2654 "y.tab.c"
+    break;
+
+  case 15: /* new_identifier_1: p_FALSE  */
+#line 256 "gram.y"
+             {}
+#line 2660 "y.tab.c"
+    break;
+
+  case 16: /* new_identifier_1: p_TRUE  */
+#line 257 "gram.y"
+             {}
+#line 2666 "y.tab.c"
+    break;
+
+  case 17: /* new_identifier_1: p_INPUT  */
+#line 259 "gram.y"
+              {}
+#line 2672 "y.tab.c"
+    break;
+
+  case 18: /* new_identifier_1: p_OUTPUT  */
+#line 260 "gram.y"
+              {}
+#line 2678 "y.tab.c"
+    break;
+
+  case 19: /* new_identifier_1: p_REWRITE  */
+#line 261 "gram.y"
+              {}
+#line 2684 "y.tab.c"
+    break;
+
+  case 20: /* new_identifier_1: p_RESET  */
+#line 262 "gram.y"
+              {}
+#line 2690 "y.tab.c"
+    break;
+
+  case 21: /* new_identifier_1: p_PUT  */
+#line 263 "gram.y"
+              {}
+#line 2696 "y.tab.c"
+    break;
+
+  case 22: /* new_identifier_1: p_GET  */
+#line 264 "gram.y"
+              {}
+#line 2702 "y.tab.c"
+    break;
+
+  case 23: /* new_identifier_1: p_WRITE  */
+#line 265 "gram.y"
+              {}
+#line 2708 "y.tab.c"
+    break;
+
+  case 24: /* new_identifier_1: p_READ  */
+#line 266 "gram.y"
+              {}
+#line 2714 "y.tab.c"
+    break;
+
+  case 25: /* new_identifier_1: p_WRITELN  */
+#line 267 "gram.y"
+              {}
+#line 2720 "y.tab.c"
+    break;
+
+  case 26: /* new_identifier_1: p_READLN  */
+#line 268 "gram.y"
+              {}
+#line 2726 "y.tab.c"
+    break;
+
+  case 27: /* new_identifier_1: p_PAGE  */
+#line 269 "gram.y"
+              {}
+#line 2732 "y.tab.c"
+    break;
+
+  case 28: /* new_identifier_1: p_EOF  */
+#line 270 "gram.y"
+              {}
+#line 2738 "y.tab.c"
+    break;
+
+  case 29: /* new_identifier_1: p_EOLN  */
+#line 271 "gram.y"
+              {}
+#line 2744 "y.tab.c"
+    break;
+
+  case 30: /* new_identifier_1: p_NEW  */
+#line 273 "gram.y"
+              {}
+#line 2750 "y.tab.c"
+    break;
+
+  case 31: /* new_identifier_1: p_DISPOSE  */
+#line 274 "gram.y"
+              {}
+#line 2756 "y.tab.c"
+    break;
+
+  case 32: /* new_identifier_1: p_ABS  */
+#line 276 "gram.y"
+             {}
+#line 2762 "y.tab.c"
+    break;
+
+  case 33: /* new_identifier_1: p_SQR  */
+#line 277 "gram.y"
+             {}
+#line 2768 "y.tab.c"
+    break;
+
+  case 34: /* new_identifier_1: p_SIN  */
+#line 278 "gram.y"
+             {}
+#line 2774 "y.tab.c"
+    break;
+
+  case 35: /* new_identifier_1: p_COS  */
+#line 279 "gram.y"
+             {}
+#line 2780 "y.tab.c"
+    break;
+
+  case 36: /* new_identifier_1: p_EXP  */
+#line 280 "gram.y"
+             {}
+#line 2786 "y.tab.c"
+    break;
+
+  case 37: /* new_identifier_1: p_LN  */
+#line 281 "gram.y"
+             {}
+#line 2792 "y.tab.c"
+    break;
+
+  case 38: /* new_identifier_1: p_SQRT  */
+#line 282 "gram.y"
+             {}
+#line 2798 "y.tab.c"
+    break;
+
+  case 39: /* new_identifier_1: p_ARCTAN  */
+#line 283 "gram.y"
+             {}
+#line 2804 "y.tab.c"
+    break;
+
+  case 40: /* new_identifier_1: p_TRUNC  */
+#line 284 "gram.y"
+             {}
+#line 2810 "y.tab.c"
+    break;
+
+  case 41: /* new_identifier_1: p_ROUND  */
+#line 285 "gram.y"
+             {}
+#line 2816 "y.tab.c"
+    break;
+
+  case 42: /* new_identifier_1: p_PACK  */
+#line 287 "gram.y"
+             {}
+#line 2822 "y.tab.c"
+    break;
+
+  case 43: /* new_identifier_1: p_UNPACK  */
+#line 288 "gram.y"
+             {}
+#line 2828 "y.tab.c"
+    break;
+
+  case 44: /* new_identifier_1: p_ORD  */
+#line 290 "gram.y"
+           {}
+#line 2834 "y.tab.c"
+    break;
+
+  case 45: /* new_identifier_1: p_CHR  */
+#line 291 "gram.y"
+           {}
+#line 2840 "y.tab.c"
+    break;
+
+  case 46: /* new_identifier_1: p_SUCC  */
+#line 292 "gram.y"
+           {}
+#line 2846 "y.tab.c"
+    break;
+
+  case 47: /* new_identifier_1: p_PRED  */
+#line 293 "gram.y"
+           {}
+#line 2852 "y.tab.c"
+    break;
+
+  case 48: /* new_identifier_1: p_ODD  */
+#line 294 "gram.y"
+           {}
+#line 2858 "y.tab.c"
+    break;
+
+  case 49: /* new_identifier_1: BREAK  */
+#line 296 "gram.y"
+              {}
+#line 2864 "y.tab.c"
+    break;
+
+  case 50: /* new_identifier_1: CONTINUE  */
+#line 297 "gram.y"
+              {}
+#line 2870 "y.tab.c"
+    break;
+
+  case 51: /* new_identifier_1: RETURN_  */
+#line 298 "gram.y"
+              {}
+#line 2876 "y.tab.c"
+    break;
+
+  case 52: /* new_identifier_1: RESULT  */
+#line 299 "gram.y"
+              {}
+#line 2882 "y.tab.c"
+    break;
+
+  case 53: /* new_identifier_1: EXIT  */
+#line 300 "gram.y"
+              {}
+#line 2888 "y.tab.c"
+    break;
+
+  case 54: /* new_identifier_1: FAIL  */
+#line 301 "gram.y"
+              {}
+#line 2894 "y.tab.c"
+    break;
+
+  case 55: /* new_identifier_1: SIZEOF  */
+#line 302 "gram.y"
+              {}
+#line 2900 "y.tab.c"
+    break;
+
+  case 56: /* new_identifier_1: BITSIZEOF  */
+#line 303 "gram.y"
+              {}
+#line 2906 "y.tab.c"
+    break;
+
+  case 59: /* any_declaration_part: %empty  */
+#line 312 "gram.y"
+                { (yyval.y_cint) = 0;}
+#line 2912 "y.tab.c"
+    break;
+
+  case 60: /* any_declaration_part: any_declaration_part any_decl  */
+#line 313 "gram.y"
+                                  { (yyval.y_cint) = (yyvsp[-1].y_cint)+(yyvsp[0].y_cint); }
+#line 2918 "y.tab.c"
+    break;
+
+  case 63: /* simple_decl: constant_definition_part  */
+#line 322 "gram.y"
+                             { (yyval.y_cint) = 0; }
+#line 2924 "y.tab.c"
+    break;
+
+  case 64: /* simple_decl: type_definition_part  */
+#line 323 "gram.y"
+                         { (yyval.y_cint) = 0; }
+#line 2930 "y.tab.c"
+    break;
+
+  case 70: /* constant: identifier  */
+#line 343 "gram.y"
+                     {}
+#line 2936 "y.tab.c"
+    break;
+
+  case 71: /* constant: sign identifier  */
+#line 344 "gram.y"
+                     {}
+#line 2942 "y.tab.c"
+    break;
+
+  case 72: /* constant: number  */
+#line 345 "gram.y"
+                     { (yyval.y_expr) = (yyvsp[0].y_expr); }
+#line 2948 "y.tab.c"
+    break;
+
+  case 73: /* constant: constant_literal  */
+#line 346 "gram.y"
+                     { (yyval.y_expr) = (yyvsp[0].y_expr); }
+#line 2954 "y.tab.c"
+    break;
+
+  case 74: /* number: sign unsigned_number  */
+#line 350 "gram.y"
+                         { EXPR sign = new_expr_intconst((yyvsp[-1].y_cint)); (yyval.y_expr) = new_expr_arith(sign, AR_MULT, (yyvsp[0].y_expr)); }
+#line 2960 "y.tab.c"
+    break;
+
+  case 75: /* number: unsigned_number  */
+#line 351 "gram.y"
+                    { (yyval.y_expr) = (yyvsp[0].y_expr); }
+#line 2966 "y.tab.c"
+    break;
+
+  case 76: /* unsigned_number: LEX_INTCONST  */
+#line 355 "gram.y"
+                  { (yyval.y_expr) = new_expr_intconst((yyvsp[0].y_int)); }
+#line 2972 "y.tab.c"
+    break;
+
+  case 77: /* unsigned_number: LEX_REALCONST  */
+#line 356 "gram.y"
+                  { (yyval.y_expr) = new_expr_realconst((yyvsp[0].y_real)); }
+#line 2978 "y.tab.c"
+    break;
+
+  case 78: /* sign: '+'  */
+#line 360 "gram.y"
+        { (yyval.y_cint) = 1; }
+#line 2984 "y.tab.c"
+    break;
+
+  case 79: /* sign: '-'  */
+#line 361 "gram.y"
+        { (yyval.y_cint) = -1; }
+#line 2990 "y.tab.c"
+    break;
+
+  case 82: /* predefined_literal: LEX_NIL  */
+#line 370 "gram.y"
+            { }
+#line 2996 "y.tab.c"
+    break;
+
+  case 83: /* predefined_literal: p_FALSE  */
+#line 371 "gram.y"
+            { (yyval.y_expr) = new_expr_boolconst(FALSE); }
+#line 3002 "y.tab.c"
+    break;
+
+  case 84: /* predefined_literal: p_TRUE  */
+#line 372 "gram.y"
+            { (yyval.y_expr) = new_expr_boolconst(TRUE); }
+#line 3008 "y.tab.c"
+    break;
+
+  case 85: /* string: LEX_STRCONST  */
+#line 376 "gram.y"
+                 { (yyval.y_expr) = new_expr_strconst((yyvsp[0].y_string)); }
+#line 3014 "y.tab.c"
+    break;
+
+  case 86: /* string: string LEX_STRCONST  */
+#line 377 "gram.y"
+                        { (yyval.y_expr) = new_expr_strconst((yyvsp[0].y_string)); }
+#line 3020 "y.tab.c"
+    break;
+
+  case 87: /* type_definition_part: LEX_TYPE type_definition_list semi  */
+#line 382 "gram.y"
+                                               { process_unresolved_types(); }
+#line 3026 "y.tab.c"
+    break;
+
+  case 88: /* type_definition_list: type_definition  */
+#line 387 "gram.y"
+                                               { install_typedef((yyvsp[0].y_typedef_item)); }
+#line 3032 "y.tab.c"
+    break;
+
+  case 89: /* type_definition_list: type_definition_list semi type_definition  */
+#line 388 "gram.y"
+                                               { install_typedef((yyvsp[0].y_typedef_item)); }
+#line 3038 "y.tab.c"
+    break;
+
+  case 90: /* type_definition: new_identifier '=' type_denoter  */
+#line 393 "gram.y"
+                                               { (yyval.y_typedef_item) = make_typedef_node((yyvsp[-2].y_stid), (yyvsp[0].y_type)); }
+#line 3044 "y.tab.c"
+    break;
+
+  case 91: /* type_denoter: typename  */
+#line 398 "gram.y"
+                         { (yyval.y_type) = (yyvsp[0].y_type); }
+#line 3050 "y.tab.c"
+    break;
+
+  case 92: /* type_denoter: new_ordinal_type  */
+#line 399 "gram.y"
+                         { (yyval.y_type) = (yyvsp[0].y_type); }
+#line 3056 "y.tab.c"
+    break;
+
+  case 93: /* type_denoter: new_pointer_type  */
+#line 400 "gram.y"
+                         { (yyval.y_type) = (yyvsp[0].y_type); }
+#line 3062 "y.tab.c"
+    break;
+
+  case 94: /* type_denoter: new_procedural_type  */
+#line 401 "gram.y"
+                         { (yyval.y_type) = (yyvsp[0].y_type); }
+#line 3068 "y.tab.c"
+    break;
+
+  case 95: /* type_denoter: new_structured_type  */
+#line 402 "gram.y"
+                         { (yyval.y_type) = (yyvsp[0].y_type); }
+#line 3074 "y.tab.c"
+    break;
+
+  case 96: /* new_ordinal_type: enumerated_type  */
+#line 407 "gram.y"
+                     { /* enumerations not required by project 1. */ }
+#line 3080 "y.tab.c"
+    break;
+
+  case 97: /* new_ordinal_type: subrange_type  */
+#line 408 "gram.y"
+                     { (yyval.y_type) = (yyvsp[0].y_type); }
+#line 3086 "y.tab.c"
+    break;
+
+  case 102: /* subrange_type: constant LEX_RANGE constant  */
+#line 429 "gram.y"
+                                 { (yyval.y_type) = create_subrange((yyvsp[-2].y_expr), (yyvsp[0].y_expr)); }
+#line 3092 "y.tab.c"
+    break;
+
+  case 103: /* new_pointer_type: pointer_char pointer_domain_type  */
+#line 434 "gram.y"
+                                      { (yyval.y_type) = ty_build_ptr((yyvsp[0].y_type)); }
+#line 3098 "y.tab.c"
+    break;
+
+  case 106: /* pointer_domain_type: new_identifier  */
+#line 444 "gram.y"
+                        { (yyval.y_type) = get_basic_type(st_get_id_str((yyvsp[0].y_stid))); }
+#line 3104 "y.tab.c"
+    break;
+
+  case 107: /* pointer_domain_type: new_procedural_type  */
+#line 445 "gram.y"
+                        { (yyval.y_type) = (yyvsp[0].y_type); }
+#line 3110 "y.tab.c"
+    break;
+
+  case 108: /* new_procedural_type: LEX_PROCEDURE optional_procedural_type_formal_parameter_list  */
+#line 450 "gram.y"
+                                                                             { 
+    /* create new procedure type with param list. */ 
+    (yyval.y_type) = ty_build_func(ty_build_basic(TYVOID), (yyvsp[0].y_param_list), TRUE);
+    }
+#line 3119 "y.tab.c"
+    break;
+
+  case 109: /* new_procedural_type: LEX_FUNCTION optional_procedural_type_formal_parameter_list functiontype  */
+#line 454 "gram.y"
+                                                                             { /* create new functiontype-returning function type with param list. */ 
+  (yyval.y_type) = ty_build_func((yyvsp[0].y_type), (yyvsp[-1].y_param_list), TRUE);
+  }
+#line 3127 "y.tab.c"
+    break;
+
+  case 110: /* optional_procedural_type_formal_parameter_list: %empty  */
+#line 461 "gram.y"
+                 { (yyval.y_param_list) = NULL; }
+#line 3133 "y.tab.c"
+    break;
+
+  case 111: /* optional_procedural_type_formal_parameter_list: '(' procedural_type_formal_parameter_list ')'  */
+#line 462 "gram.y"
+                                                  { (yyval.y_param_list) = (yyvsp[-1].y_param_list); }
+#line 3139 "y.tab.c"
+    break;
+
+  case 112: /* procedural_type_formal_parameter_list: procedural_type_formal_parameter  */
+#line 467 "gram.y"
+                                     { (yyval.y_param_list) = (yyvsp[0].y_param_list); }
+#line 3145 "y.tab.c"
+    break;
+
+  case 113: /* procedural_type_formal_parameter_list: procedural_type_formal_parameter_list semi procedural_type_formal_parameter  */
+#line 468 "gram.y"
+                                                                                 { (yyval.y_param_list) = merge_param_lists((yyvsp[-2].y_param_list), (yyvsp[0].y_param_list)); }
+#line 3151 "y.tab.c"
+    break;
+
+  case 114: /* procedural_type_formal_parameter: id_list  */
+#line 473 "gram.y"
+                                 { (yyval.y_param_list) = id_list_to_param_list((yyvsp[0].y_stid_item), ty_build_basic(TYVOID), FALSE); }
+#line 3157 "y.tab.c"
+    break;
+
+  case 115: /* procedural_type_formal_parameter: id_list ':' typename  */
+#line 474 "gram.y"
+                                 { (yyval.y_param_list) = id_list_to_param_list((yyvsp[-2].y_stid_item), (yyvsp[0].y_type), FALSE); }
+#line 3163 "y.tab.c"
+    break;
+
+  case 116: /* procedural_type_formal_parameter: LEX_VAR id_list ':' typename  */
+#line 475 "gram.y"
+                                 {  (yyval.y_param_list) = id_list_to_param_list((yyvsp[-2].y_stid_item), (yyvsp[0].y_type), TRUE); }
+#line 3169 "y.tab.c"
+    break;
+
+  case 117: /* procedural_type_formal_parameter: LEX_VAR id_list  */
+#line 476 "gram.y"
+                                 {  (yyval.y_param_list) = id_list_to_param_list((yyvsp[0].y_stid_item), ty_build_basic(TYVOID), TRUE); }
+#line 3175 "y.tab.c"
+    break;
+
+  case 118: /* new_structured_type: array_type  */
+#line 481 "gram.y"
+                { (yyval.y_type) = (yyvsp[0].y_type); }
+#line 3181 "y.tab.c"
+    break;
+
+  case 119: /* new_structured_type: set_type  */
+#line 482 "gram.y"
+                { /* IGNORE for project 1. */ }
+#line 3187 "y.tab.c"
+    break;
+
+  case 120: /* new_structured_type: record_type  */
+#line 483 "gram.y"
+                { /* IGNORE for project 1. */ }
+#line 3193 "y.tab.c"
+    break;
+
+  case 121: /* array_type: LEX_ARRAY '[' array_index_list ']' LEX_OF type_denoter  */
+#line 490 "gram.y"
+                                                           { (yyval.y_type) = ty_build_array((yyvsp[0].y_type), (yyvsp[-3].y_type_list)); if(!isDataType((yyvsp[0].y_type))) { error("Array type must be data type."); }  }
+#line 3199 "y.tab.c"
+    break;
+
+  case 122: /* array_index_list: ordinal_index_type  */
+#line 495 "gram.y"
+                                             { (yyval.y_type_list) = make_new_type_list((yyvsp[0].y_type)); }
+#line 3205 "y.tab.c"
+    break;
+
+  case 123: /* array_index_list: array_index_list ',' ordinal_index_type  */
+#line 496 "gram.y"
+                                             { (yyval.y_type_list) = append_to_type_list((yyvsp[-2].y_type_list), (yyvsp[0].y_type)); }
+#line 3211 "y.tab.c"
+    break;
+
+  case 124: /* ordinal_index_type: new_ordinal_type  */
+#line 501 "gram.y"
+                      { (yyval.y_type) = (yyvsp[0].y_type); }
+#line 3217 "y.tab.c"
+    break;
+
+  case 125: /* ordinal_index_type: typename  */
+#line 502 "gram.y"
+                      { (yyval.y_type) = (yyvsp[0].y_type); }
+#line 3223 "y.tab.c"
+    break;
+
+  case 145: /* case_constant_list: one_case_constant  */
+#line 560 "gram.y"
+                      { (yyval.y_expr_list) = new_expr_list((yyvsp[0].y_expr)); }
+#line 3229 "y.tab.c"
+    break;
+
+  case 146: /* case_constant_list: case_constant_list ',' one_case_constant  */
+#line 561 "gram.y"
+                                             { (yyval.y_expr_list) = append_to_expr_list((yyvsp[-2].y_expr_list), (yyvsp[0].y_expr)); }
+#line 3235 "y.tab.c"
+    break;
+
+  case 148: /* one_case_constant: static_expression LEX_RANGE static_expression  */
+#line 566 "gram.y"
+                                                  { (yyval.y_expr) = new_expr_subrange((yyvsp[-2].y_expr), (yyvsp[0].y_expr)); }
+#line 3241 "y.tab.c"
+    break;
+
+  case 149: /* variable_declaration_part: LEX_VAR variable_declaration_list  */
+#line 574 "gram.y"
+                                      { 
+    (yyval.y_cint) = size_of_vars((yyvsp[0].y_stid_item)); 
+    }
+#line 3249 "y.tab.c"
+    break;
+
+  case 151: /* variable_declaration_list: variable_declaration_list variable_declaration  */
+#line 581 "gram.y"
+                                                   { (yyval.y_stid_item) = merge_stid_list((yyvsp[-1].y_stid_item), (yyvsp[0].y_stid_item)); }
+#line 3255 "y.tab.c"
+    break;
+
+  case 152: /* variable_declaration: id_list ':' type_denoter semi  */
+#line 585 "gram.y"
+                                        { 
+    vardec((yyvsp[-3].y_stid_item), (yyvsp[-1].y_type));
+    (yyval.y_stid_item) = (yyvsp[-3].y_stid_item);
+    }
+#line 3264 "y.tab.c"
+    break;
+
+  case 153: /* function_declaration: function_heading semi directive_list semi  */
+#line 592 "gram.y"
+                                              {
+      //Generate function declaration with directives
+      ST_DR rec = apply_directives((yyvsp[-3].y_typedef_item), (yyvsp[-1].y_dir_list));
+      st_install((yyvsp[-3].y_typedef_item)->new_def, rec);
+      (yyval.y_cint) = 0;
+    }
+#line 3275 "y.tab.c"
+    break;
+
+  case 154: /* $@2: %empty  */
+#line 598 "gram.y"
+                          { 
+      //Generate function declaration with local definition
+      install_function_decl((yyvsp[-1].y_typedef_item));
+      enter_function_block((yyvsp[-1].y_typedef_item));
+  }
+#line 3285 "y.tab.c"
+    break;
+
+  case 155: /* $@3: %empty  */
+#line 602 "gram.y"
+                         {
+	   int block;
+      b_func_prologue(st_lookup((yyvsp[-3].y_typedef_item)->new_def, &block)->u.decl.v.global_func_name);
+      encode_function_def((yyvsp[-3].y_typedef_item));
+  }
+#line 3295 "y.tab.c"
+    break;
+
+  case 156: /* function_declaration: function_heading semi $@2 any_declaration_part $@3 statement_part semi  */
+#line 606 "gram.y"
+                        {
+      exit_function_block((yyvsp[-6].y_typedef_item));
+      (yyval.y_cint) = 0;
+  }
+#line 3304 "y.tab.c"
+    break;
+
+  case 157: /* function_heading: LEX_PROCEDURE new_identifier optional_par_formal_parameter_list  */
+#line 613 "gram.y"
+                                                                    {
+      (yyval.y_typedef_item) = make_typedef_node((yyvsp[-1].y_stid), ty_build_func(ty_build_basic(TYVOID), (yyvsp[0].y_param_list), TRUE));
+    }
+#line 3312 "y.tab.c"
+    break;
+
+  case 158: /* function_heading: LEX_FUNCTION new_identifier optional_par_formal_parameter_list functiontype  */
+#line 616 "gram.y"
+                                                                                {
+      (yyval.y_typedef_item) = make_typedef_node((yyvsp[-2].y_stid), ty_build_func((yyvsp[0].y_type), (yyvsp[-1].y_param_list), TRUE));
+    }
+#line 3320 "y.tab.c"
+    break;
+
+  case 159: /* directive_list: directive  */
+#line 622 "gram.y"
+              { (yyval.y_dir_list) = create_dir_list((yyvsp[0].y_dir)); }
+#line 3326 "y.tab.c"
+    break;
+
+  case 160: /* directive_list: directive_list semi directive  */
+#line 623 "gram.y"
+                                  { (yyval.y_dir_list) = append_to_dir_list((yyvsp[-2].y_dir_list), (yyvsp[0].y_dir)); }
+#line 3332 "y.tab.c"
+    break;
+
+  case 161: /* directive: LEX_FORWARD  */
+#line 627 "gram.y"
+                { (yyval.y_dir) = DIRECTIVE_FORWARD; }
+#line 3338 "y.tab.c"
+    break;
+
+  case 162: /* directive: LEX_EXTERNAL  */
+#line 628 "gram.y"
+                 { (yyval.y_dir) = DIRECTIVE_EXTERNAL; }
+#line 3344 "y.tab.c"
+    break;
+
+  case 163: /* functiontype: %empty  */
+#line 632 "gram.y"
+                { (yyval.y_type) = ty_build_basic(TYERROR); error("A function should not be typeless."); }
+#line 3350 "y.tab.c"
+    break;
+
+  case 164: /* functiontype: ':' typename  */
+#line 633 "gram.y"
+                 { (yyval.y_type) = (yyvsp[0].y_type); if(!isSimpleType((yyvsp[0].y_type))) { error("Return type must be simple type."); } }
+#line 3356 "y.tab.c"
+    break;
+
+  case 165: /* optional_par_formal_parameter_list: %empty  */
+#line 639 "gram.y"
+                { (yyval.y_param_list) = NULL; }
+#line 3362 "y.tab.c"
+    break;
+
+  case 166: /* optional_par_formal_parameter_list: '(' formal_parameter_list ')'  */
+#line 640 "gram.y"
+                                  { (yyval.y_param_list) = (yyvsp[-1].y_param_list);}
+#line 3368 "y.tab.c"
+    break;
+
+  case 167: /* formal_parameter_list: formal_parameter  */
+#line 644 "gram.y"
+                     { (yyval.y_param_list) = (yyvsp[0].y_param_list); }
+#line 3374 "y.tab.c"
+    break;
+
+  case 168: /* formal_parameter_list: formal_parameter_list semi formal_parameter  */
+#line 645 "gram.y"
+                                                { (yyval.y_param_list) = merge_param_lists((yyvsp[-2].y_param_list), (yyvsp[0].y_param_list)); }
+#line 3380 "y.tab.c"
+    break;
+
+  case 169: /* formal_parameter: id_list ':' typename  */
+#line 649 "gram.y"
+                         { (yyval.y_param_list) =  id_list_to_param_list((yyvsp[-2].y_stid_item), (yyvsp[0].y_type), FALSE); }
+#line 3386 "y.tab.c"
+    break;
+
+  case 170: /* formal_parameter: LEX_VAR id_list ':' typename  */
+#line 650 "gram.y"
+                                 { (yyval.y_param_list) = id_list_to_param_list((yyvsp[-2].y_stid_item), (yyvsp[0].y_type), TRUE); }
+#line 3392 "y.tab.c"
+    break;
+
+  case 178: /* structured_statement: with_statement  */
+#line 676 "gram.y"
+                   {}
+#line 3398 "y.tab.c"
+    break;
+
+  case 181: /* with_statement: LEX_WITH structured_variable_list LEX_DO statement  */
+#line 682 "gram.y"
+                                                       {}
+#line 3404 "y.tab.c"
+    break;
+
+  case 187: /* @4: %empty  */
+#line 701 "gram.y"
+    {
+        char *after_if_label = new_symbol();
+        encode_cond_jump((yyvsp[-1].y_expr), FALSE, after_if_label);
+        
+        (yyval.y_string) = after_if_label;
+    }
+#line 3415 "y.tab.c"
+    break;
+
+  case 188: /* simple_if: LEX_IF boolean_expression LEX_THEN @4 statement  */
+#line 708 "gram.y"
+    {
+        (yyval.y_string) = (yyvsp[-1].y_string);
+    }
+#line 3423 "y.tab.c"
+    break;
+
+  case 189: /* @5: %empty  */
+#line 715 "gram.y"
+    {
+        char *end_label = new_symbol();
+        ir_jump(end_label);
+        ir_label((yyvsp[-1].y_string)); 
+        (yyval.y_string) = end_label;
+    }
+#line 3434 "y.tab.c"
+    break;
+
+  case 190: /* if_statement: simple_if LEX_ELSE @5 statement  */
+#line 722 "gram.y"
+    {
+        ir_label((yyvsp[-1].y_string));
+    }
+#line 3442 "y.tab.c"
+    break;
+
+  case 191: /* if_statement: simple_if  */
+#line 725 "gram.y"
+                            { ir_label((yyvsp[0].y_string)); }
+#line 3448 "y.tab.c"
+    break;
+
+  case 192: /* $@6: %empty  */
+#line 729 "gram.y"
+                               {
+      if (!isOrdinalType((yyvsp[-1].y_expr)->expr_typetag))
+      {
+        error("Case expression is not of ordinal type");
+      }
+      
+      enter_case_block();
+      EXPR expr = parse_expr_for_case((yyvsp[-1].y_expr));
+      
+      encode_expression(expr);
+      encode_case_begin();
+    }
+#line 3465 "y.tab.c"
+    break;
+
+  case 193: /* case_statement: LEX_CASE expression LEX_OF $@6 case_element_list optional_semicolon_or_else_branch LEX_END  */
+#line 740 "gram.y"
+                                                                  {
+      exit_case_block();
+      encode_case_end();
+    }
+#line 3474 "y.tab.c"
+    break;
+
+  case 194: /* optional_semicolon_or_else_branch: optional_semicolon  */
+#line 747 "gram.y"
+                       { (yyval.y_boolean) = FALSE; }
+#line 3480 "y.tab.c"
+    break;
+
+  case 195: /* $@7: %empty  */
+#line 748 "gram.y"
+                 { encode_case_else(); }
+#line 3486 "y.tab.c"
+    break;
+
+  case 196: /* optional_semicolon_or_else_branch: case_default $@7 statement_sequence  */
+#line 748 "gram.y"
+                                                            { (yyval.y_boolean) = TRUE;}
+#line 3492 "y.tab.c"
+    break;
+
+  case 197: /* case_element_list: case_element  */
+#line 752 "gram.y"
+                 { encode_case_arm_end(); }
+#line 3498 "y.tab.c"
+    break;
+
+  case 198: /* case_element_list: case_element_list semi case_element  */
+#line 753 "gram.y"
+                                        { encode_case_arm_end(); }
+#line 3504 "y.tab.c"
+    break;
+
+  case 199: /* $@8: %empty  */
+#line 757 "gram.y"
+                       {
+    	char *statement_label = new_symbol();
+    	
+    	EXPR_LIST list = (yyvsp[0].y_expr_list);
+    	while(list != NULL)
+    	{
+    		EXPR expr = list->base;
+    		if (!isCaseableType(expr->expr_typetag))
+    		{
+    		  // Do nothing -- error reporting done by isCaseableType().
+    		}
+    		else if (expr->expr_tag == E_SUBRANGE)
+    		{
+    			int lo = (int)get_expr_constant(expr->left);
+    			int hi = (int)get_expr_constant(expr->right);
+    			
+    			if (check_subrange(lo, hi))
+    			{
+    				add_subrange(lo, hi);
+    				encode_case_range(lo, hi, statement_label);
+				  }
+				  else
+				  {
+				  	error("Overlapping constants in case statement");
+				  }
+    		}
+    		else
+    		{
+    			int i = (int)get_expr_constant(expr);
+    			
+    			if (check_constant(i))
+    			{
+    				add_constant(i);
+    				encode_case_range(i, i, statement_label);
+    		  }
+    		  else
+    		  {
+    		  	error("Overlapping constants in case statement");
+    		  }
+    		}
+    		list = list->next;
+    	}
+    	
+    	// The selector is dispatched on once all the labels are known
+    	encode_case_arm(statement_label);
+    }
+#line 3555 "y.tab.c"
+    break;
+
+  case 206: /* @9: %empty  */
+#line 818 "gram.y"
+    {
+        char *repeat_after_label = new_symbol();
+        char *repeat_top_label = new_symbol();
+        store_label(repeat_after_label);
+        
+        ir_label(repeat_top_label);
+        
+        control_labels lbls = {repeat_top_label, repeat_after_label};
+        (yyval.y_control) = lbls;
+    }
+#line 3570 "y.tab.c"
+    break;
+
+  case 207: /* repeat_statement: LEX_REPEAT @9 statement_sequence LEX_UNTIL boolean_expression  */
+#line 829 "gram.y"
+    {
+        control_labels lbls = (yyvsp[-3].y_control);
+        encode_cond_jump((yyvsp[0].y_expr), FALSE, lbls.conditional_label);
+        ir_label(lbls.after_label);
+    }
+#line 3580 "y.tab.c"
+    break;
+
+  case 208: /* @10: %empty  */
+#line 838 "gram.y"
+    {
+        char *while_after_label = new_symbol();
+        char *while_cond_label = new_symbol();
+        store_label(while_after_label);
+        
+        ir_label(while_cond_label);
+        encode_cond_jump((yyvsp[-1].y_expr), FALSE, while_after_label);
+        
+        control_labels lbls = {while_cond_label, while_after_label};
+        (yyval.y_control) = lbls;
+    }
+#line 3596 "y.tab.c"
+    break;
+
+  case 209: /* while_statement: LEX_WHILE boolean_expression LEX_DO @10 statement  */
+#line 850 "gram.y"
+    {
+        control_labels lbls = (yyvsp[-1].y_control);
+        ir_jump(lbls.conditional_label);
+        ir_label(lbls.after_label);
+    }
+#line 3606 "y.tab.c"
+    break;
+
+  case 210: /* @11: %empty  */
+#line 859 "gram.y"
+    {
+        char *for_exit_label = new_symbol();
+        char *for_cond_label = new_symbol();
+        store_label(for_exit_label);
+        
+        if (!isOrdinalType((yyvsp[-5].y_expr)->expr_typetag))
+        {
+          error("For-loop control variable not of ordinal type");
+        }
+        else if ((yyvsp[-5].y_expr)->expr_typetag != (yyvsp[-3].y_expr)->expr_typetag || (yyvsp[-5].y_expr)->expr_typetag != (yyvsp[-1].y_expr)->expr_typetag || (yyvsp[-3].y_expr)->expr_typetag != (yyvsp[-1].y_expr)->expr_typetag)
+        {
+          error("Type mismatch in for-loop control");
+        }
+        else if (!isOrdinalType((yyvsp[-3].y_expr)->expr_typetag) || !isOrdinalType((yyvsp[-1].y_expr)->expr_typetag))
+        {
+          error("For-loop control variable not of ordinal type");
+        }
+        
+        encode_expression((yyvsp[-1].y_expr));
+        if ((yyvsp[-1].y_expr)->expr_tag == E_VAR || (yyvsp[-1].y_expr)->expr_tag == E_ARRAY) { ir_deref((yyvsp[-1].y_expr)->expr_typetag); }
+        
+        if ((yyvsp[-1].y_expr)->expr_typetag == TYUNSIGNEDCHAR || (yyvsp[-1].y_expr)->expr_typetag == TYSIGNEDCHAR)
+        {
+          ir_convert((yyvsp[-1].y_expr)->expr_typetag, TYSIGNEDLONGINT);
+        }
+        
+        ir_duplicate(TYSIGNEDLONGINT);
+        
+        encode_expression((yyvsp[-5].y_expr));
+        encode_expression((yyvsp[-3].y_expr));
+        ir_assign((yyvsp[-5].y_expr)->expr_typetag);
+        
+        ir_label(for_cond_label);
+        
+        if ((yyvsp[-5].y_expr)->expr_typetag == TYUNSIGNEDCHAR || (yyvsp[-5].y_expr)->expr_typetag == TYSIGNEDCHAR)
+        {
+          ir_convert((yyvsp[-1].y_expr)->expr_typetag, TYSIGNEDLONGINT);
+        }
+        
+        if ((yyvsp[-2].y_for_dir) == FOR_TO)
+        {
+            ir_cond_jump_rel(B_LT, TYSIGNEDLONGINT, for_exit_label);
+        }
+        else //if ($5 == FOR_DOWNTO)
+        {
+            ir_cond_jump_rel(B_GT, TYSIGNEDLONGINT, for_exit_label);
+        }
+        
+        control_labels lbls = { for_cond_label, for_exit_label };
+        
+        (yyval.y_control) = lbls;
+        
+    }
+#line 3664 "y.tab.c"
+    break;
+
+  case 211: /* for_statement: LEX_FOR variable_or_function_access LEX_ASSIGN expression for_direction expression LEX_DO @11 statement  */
+#line 913 "gram.y"
+    {
+        control_labels lbls = (yyvsp[-1].y_control);
+        
+        ir_duplicate(TYSIGNEDLONGINT);
+        
+        encode_expression((yyvsp[-7].y_expr));
+        
+        B_INC_DEC_OP idop = ((yyvsp[-4].y_for_dir) == FOR_TO) ? B_PRE_INC : B_PRE_DEC;
+        
+        ir_inc_dec((yyvsp[-7].y_expr)->expr_typetag, idop, 0);
+        
+        ir_jump(lbls.conditional_label);
+        ir_label(lbls.after_label);
+        ir_pop();
+    }
+#line 3684 "y.tab.c"
+    break;
+
+  case 212: /* for_direction: LEX_TO  */
+#line 931 "gram.y"
+                { (yyval.y_for_dir) = FOR_TO; }
+#line 3690 "y.tab.c"
+    break;
+
+  case 213: /* for_direction: LEX_DOWNTO  */
+#line 932 "gram.y"
+                { (yyval.y_for_dir) = FOR_DOWNTO; }
+#line 3696 "y.tab.c"
+    break;
+
+  case 214: /* simple_statement: empty_statement  */
+#line 936 "gram.y"
+                    { /* do nothing */ }
+#line 3702 "y.tab.c"
+    break;
+
+  case 215: /* simple_statement: assignment_or_call_statement  */
+#line 937 "gram.y"
+                                 { encode_statement_expr((yyvsp[0].y_expr)); }
+#line 3708 "y.tab.c"
+    break;
+
+  case 216: /* simple_statement: standard_procedure_statement  */
+#line 938 "gram.y"
+                                 { printf("Standard Procedure"); }
+#line 3714 "y.tab.c"
+    break;
+
+  case 217: /* simple_statement: statement_extensions  */
+#line 939 "gram.y"
+                         { /* ignore */ }
+#line 3720 "y.tab.c"
+    break;
+
+  case 219: /* optional_par_actual_parameter_list: %empty  */
+#line 949 "gram.y"
+                { }
+#line 3726 "y.tab.c"
+    break;
+
+  case 220: /* optional_par_actual_parameter_list: '(' actual_parameter_list ')'  */
+#line 950 "gram.y"
+                                        { (yyval.y_expr_list) = (yyvsp[-1].y_expr_list); }
+#line 3732 "y.tab.c"
+    break;
+
+  case 221: /* actual_parameter_list: actual_parameter  */
+#line 954 "gram.y"
+                     { (yyval.y_expr_list) = new_expr_list((yyvsp[0].y_expr)); }
+#line 3738 "y.tab.c"
+    break;
+
+  case 222: /* actual_parameter_list: actual_parameter_list ',' actual_parameter  */
+#line 955 "gram.y"
+                                               { (yyval.y_expr_list) = append_to_expr_list((yyvsp[-2].y_expr_list), (yyvsp[0].y_expr)); }
+#line 3744 "y.tab.c"
+    break;
+
+  case 224: /* assignment_or_call_statement: variable_or_function_access_maybe_assignment rest_of_statement  */
+#line 966 "gram.y"
+                                                                   { if ((yyvsp[0].y_expr) != NULL){ (yyval.y_expr) = new_expr_assign((yyvsp[-1].y_expr), (yyvsp[0].y_expr)); } 
+    																                                           else { (yyval.y_expr) = (yyvsp[-1].y_expr); } }
+#line 3751 "y.tab.c"
+    break;
+
+  case 225: /* variable_or_function_access_maybe_assignment: identifier  */
+#line 971 "gram.y"
+               { (yyval.y_expr) = new_expr_identifier((yyvsp[0].y_stid)); }
+#line 3757 "y.tab.c"
+    break;
+
+  case 226: /* variable_or_function_access_maybe_assignment: address_operator variable_or_function_access  */
+#line 972 "gram.y"
+                                                 { /* ignore */ }
+#line 3763 "y.tab.c"
+    break;
+
+  case 228: /* rest_of_statement: %empty  */
+#line 977 "gram.y"
+                                  { (yyval.y_expr) = NULL; }
+#line 3769 "y.tab.c"
+    break;
+
+  case 229: /* rest_of_statement: LEX_ASSIGN expression  */
+#line 978 "gram.y"
+                          { (yyval.y_expr) = (yyvsp[0].y_expr); }
+#line 3775 "y.tab.c"
+    break;
+
+  case 278: /* break_statement: BREAK  */
+#line 1055 "gram.y"
+            { char *last_loop_label = get_last_label(); ir_jump(last_loop_label); }
+#line 3781 "y.tab.c"
+    break;
+
+  case 282: /* index_expression_list: index_expression_item  */
+#line 1068 "gram.y"
+                            { (yyval.y_expr_list) = new_expr_list((yyvsp[0].y_expr)); }
+#line 3787 "y.tab.c"
+    break;
+
+  case 283: /* index_expression_list: index_expression_list ',' index_expression_item  */
+#line 1069 "gram.y"
+                                                      { (yyval.y_expr_list) = append_to_expr_list((yyvsp[-2].y_expr_list), (yyvsp[0].y_expr)); }
+#line 3793 "y.tab.c"
+    break;
+
+  case 287: /* boolean_expression: expression  */
+#line 1084 "gram.y"
+               { if ((yyvsp[0].y_expr)->expr_typetag != TYSIGNEDCHAR) { error("Non-Boolean expression"); } (yyval.y_expr) = (yyvsp[0].y_expr); }
+#line 3799 "y.tab.c"
+    break;
+
+  case 288: /* expression: expression relational_operator simple_expression  */
+#line 1088 "gram.y"
+                                                     { (yyval.y_expr) = new_expr_compr((yyvsp[-2].y_expr), (yyvsp[-1].y_cint), (yyvsp[0].y_expr)); }
+#line 3805 "y.tab.c"
+    break;
+
+  case 292: /* simple_expression: simple_expression adding_operator term  */
+#line 1095 "gram.y"
+                                                { (yyval.y_expr) = new_expr_arith((yyvsp[-2].y_expr), (yyvsp[-1].y_cint), (yyvsp[0].y_expr)); }
+#line 3811 "y.tab.c"
+    break;
+
+  case 297: /* term: term multiplying_operator signed_primary  */
+#line 1103 "gram.y"
+                                             { (yyval.y_expr) = new_expr_arith((yyvsp[-2].y_expr), (yyvsp[-1].y_cint), (yyvsp[0].y_expr)); }
+#line 3817 "y.tab.c"
+    break;
+
+  case 300: /* signed_primary: sign signed_primary  */
+#line 1109 "gram.y"
+                        { (yyval.y_expr) = new_expr_sign((yyvsp[-1].y_cint), (yyvsp[0].y_expr)); }
+#line 3823 "y.tab.c"
+    break;
+
+  case 306: /* signed_factor: sign signed_factor  */
+#line 1121 "gram.y"
+                        { (yyval.y_expr) = new_expr_sign((yyvsp[-1].y_cint), (yyvsp[0].y_expr)); }
+#line 3829 "y.tab.c"
+    break;
+
+  case 310: /* factor: set_constructor  */
+#line 1128 "gram.y"
+                            { /* ignore */ }
+#line 3835 "y.tab.c"
+    break;
+
+  case 311: /* factor: LEX_NOT signed_factor  */
+#line 1129 "gram.y"
+                            { /* ignore? */ }
+#line 3841 "y.tab.c"
+    break;
+
+  case 312: /* factor: address_operator factor  */
+#line 1130 "gram.y"
+                            { /* ignore */ }
+#line 3847 "y.tab.c"
+    break;
+
+  case 316: /* variable_or_function_access_no_standard_function: identifier  */
+#line 1143 "gram.y"
+               { (yyval.y_expr) = new_expr_identifier((yyvsp[0].y_stid)); }
+#line 3853 "y.tab.c"
+    break;
+
+  case 318: /* variable_or_function_access_no_id: p_OUTPUT  */
+#line 1148 "gram.y"
+              { /* ignore */ }
+#line 3859 "y.tab.c"
+    break;
+
+  case 319: /* variable_or_function_access_no_id: p_INPUT  */
+#line 1149 "gram.y"
+              { /* ignore */ }
+#line 3865 "y.tab.c"
+    break;
+
+  case 320: /* variable_or_function_access_no_id: variable_or_function_access '.' new_identifier  */
+#line 1150 "gram.y"
+                                                   { /* ignore */ }
+#line 3871 "y.tab.c"
+    break;
+
+  case 321: /* variable_or_function_access_no_id: '(' expression ')'  */
+#line 1151 "gram.y"
+                       { (yyval.y_expr) = (yyvsp[-1].y_expr); }
+#line 3877 "y.tab.c"
+    break;
+
+  case 323: /* variable_or_function_access_no_id: variable_or_function_access '[' index_expression_list ']'  */
+#line 1153 "gram.y"
+                                                              { (yyval.y_expr) = new_expr_array((yyvsp[-3].y_expr), (yyvsp[-1].y_expr_list)); }
+#line 3883 "y.tab.c"
+    break;
+
+  case 324: /* variable_or_function_access_no_id: variable_or_function_access_no_standard_function '(' actual_parameter_list ')'  */
+#line 1154 "gram.y"
+                                                                                   { (yyval.y_expr) = new_expr_var_funccall((yyvsp[-3].y_expr), (yyvsp[-1].y_expr_list)); }
+#line 3889 "y.tab.c"
+    break;
+
+  case 325: /* variable_or_function_access_no_id: p_NEW '(' variable_access_or_typename ')'  */
+#line 1155 "gram.y"
+                                              { /* TODO Pointer Variable */ }
+#line 3895 "y.tab.c"
+    break;
+
+  case 332: /* standard_functions: rts_fun_onepar '(' actual_parameter ')'  */
+#line 1174 "gram.y"
+                                            { EXPR_LIST tempList = new_expr_list((yyvsp[-1].y_expr)); (yyval.y_expr) = new_expr_unfunc((yyvsp[-3].y_cint), tempList); }
+#line 3901 "y.tab.c"
+    break;
+
+  case 333: /* standard_functions: rts_fun_optpar optional_par_actual_parameter  */
+#line 1175 "gram.y"
+                                                 { /* ignore EOF */ }
+#line 3907 "y.tab.c"
+    break;
+
+  case 334: /* standard_functions: rts_fun_parlist '(' actual_parameter_list ')'  */
+#line 1176 "gram.y"
+                                                  { (yyval.y_expr) = new_expr_unfunc((yyvsp[-3].y_cint), (yyvsp[-1].y_expr_list)); }
+#line 3913 "y.tab.c"
+    break;
+
+  case 335: /* optional_par_actual_parameter: %empty  */
+#line 1181 "gram.y"
+                { }
+#line 3919 "y.tab.c"
+    break;
+
+  case 336: /* optional_par_actual_parameter: '(' actual_parameter ')'  */
+#line 1182 "gram.y"
+                             { (yyval.y_expr) = (yyvsp[-1].y_expr); }
+#line 3925 "y.tab.c"
+    break;
+
+  case 337: /* rts_fun_optpar: p_EOF  */
+#line 1186 "gram.y"
+            { /* ignore */ }
+#line 3931 "y.tab.c"
+    break;
+
+  case 338: /* rts_fun_optpar: p_EOLN  */
+#line 1187 "gram.y"
+            { /* ignore */ }
+#line 3937 "y.tab.c"
+    break;
+
+  case 339: /* rts_fun_onepar: p_ABS  */
+#line 1191 "gram.y"
+                   { /* ignore */ }
+#line 3943 "y.tab.c"
+    break;
+
+  case 340: /* rts_fun_onepar: p_SQR  */
+#line 1192 "gram.y"
+                   { /* ignore */ }
+#line 3949 "y.tab.c"
+    break;
+
+  case 341: /* rts_fun_onepar: p_SIN  */
+#line 1193 "gram.y"
+                   { /* ignore */ }
+#line 3955 "y.tab.c"
+    break;
+
+  case 342: /* rts_fun_onepar: p_COS  */
+#line 1194 "gram.y"
+                   { /* ignore */ }
+#line 3961 "y.tab.c"
+    break;
+
+  case 343: /* rts_fun_onepar: p_EXP  */
+#line 1195 "gram.y"
+                   { /* ignore */ }
+#line 3967 "y.tab.c"
+    break;
+
+  case 344: /* rts_fun_onepar: p_LN  */
+#line 1196 "gram.y"
+                   { /* ignore */ }
+#line 3973 "y.tab.c"
+    break;
+
+  case 345: /* rts_fun_onepar: p_SQRT  */
+#line 1197 "gram.y"
+                   { /* ignore */ }
+#line 3979 "y.tab.c"
+    break;
+
+  case 346: /* rts_fun_onepar: p_ARCTAN  */
+#line 1198 "gram.y"
+                   { /* ignore */ }
+#line 3985 "y.tab.c"
+    break;
+
+  case 347: /* rts_fun_onepar: p_ARG  */
+#line 1199 "gram.y"
+                   { /* ignore */ }
+#line 3991 "y.tab.c"
+    break;
+
+  case 348: /* rts_fun_onepar: p_TRUNC  */
+#line 1200 "gram.y"
+                   { /* ignore */ }
+#line 3997 "y.tab.c"
+    break;
+
+  case 349: /* rts_fun_onepar: p_ROUND  */
+#line 1201 "gram.y"
+                   { /* ignore */ }
+#line 4003 "y.tab.c"
+    break;
+
+  case 350: /* rts_fun_onepar: p_CARD  */
+#line 1202 "gram.y"
+                   { /* ignore */ }
+#line 4009 "y.tab.c"
+    break;
+
+  case 351: /* rts_fun_onepar: p_ORD  */
+#line 1203 "gram.y"
+                   { (yyval.y_cint) = UF_ORD; }
+#line 4015 "y.tab.c"
+    break;
+
+  case 352: /* rts_fun_onepar: p_CHR  */
+#line 1204 "gram.y"
+                   { (yyval.y_cint) = UF_CHR; }
+#line 4021 "y.tab.c"
+    break;
+
+  case 353: /* rts_fun_onepar: p_ODD  */
+#line 1205 "gram.y"
+                   { /* ignore */ }
+#line 4027 "y.tab.c"
+    break;
+
+  case 354: /* rts_fun_onepar: p_EMPTY  */
+#line 1206 "gram.y"
+                   { /* ignore */ }
+#line 4033 "y.tab.c"
+    break;
+
+  case 355: /* rts_fun_onepar: p_POSITION  */
+#line 1207 "gram.y"
+                   { /* ignore */ }
+#line 4039 "y.tab.c"
+    break;
+
+  case 356: /* rts_fun_onepar: p_LASTPOSITION  */
+#line 1208 "gram.y"
+                   { /* ignore */ }
+#line 4045 "y.tab.c"
+    break;
+
+  case 357: /* rts_fun_onepar: p_LENGTH  */
+#line 1209 "gram.y"
+                   { /* ignore */ }
+#line 4051 "y.tab.c"
+    break;
+
+  case 358: /* rts_fun_onepar: p_TRIM  */
+#line 1210 "gram.y"
+                   { /* ignore */ }
+#line 4057 "y.tab.c"
+    break;
+
+  case 359: /* rts_fun_onepar: p_BINDING  */
+#line 1211 "gram.y"
+                   { /* ignore */ }
+#line 4063 "y.tab.c"
+    break;
+
+  case 360: /* rts_fun_onepar: p_DATE  */
+#line 1212 "gram.y"
+                   { /* ignore */ }
+#line 4069 "y.tab.c"
+    break;
+
+  case 361: /* rts_fun_onepar: p_TIME  */
+#line 1213 "gram.y"
+                   { /* ignore */ }
+#line 4075 "y.tab.c"
+    break;
+
+  case 362: /* rts_fun_parlist: p_SUCC  */
+#line 1217 "gram.y"
+              { (yyval.y_cint) = UF_SUCC; }
+#line 4081 "y.tab.c"
+    break;
+
+  case 363: /* rts_fun_parlist: p_PRED  */
+#line 1218 "gram.y"
+              { (yyval.y_cint) = UF_PRED; }
+#line 4087 "y.tab.c"
+    break;
+
+  case 364: /* relational_operator: LEX_NE  */
+#line 1222 "gram.y"
+                { (yyval.y_cint) = CM_NEQUAL; }
+#line 4093 "y.tab.c"
+    break;
+
+  case 365: /* relational_operator: LEX_LE  */
+#line 1223 "gram.y"
+            { (yyval.y_cint) = CM_LSEQL; }
+#line 4099 "y.tab.c"
+    break;
+
+  case 366: /* relational_operator: LEX_GE  */
+#line 1224 "gram.y"
+                { (yyval.y_cint) = CM_GTEQL; }
+#line 4105 "y.tab.c"
+    break;
+
+  case 367: /* relational_operator: '='  */
+#line 1225 "gram.y"
+                { (yyval.y_cint) = CM_EQUAL; }
+#line 4111 "y.tab.c"
+    break;
+
+  case 368: /* relational_operator: '<'  */
+#line 1226 "gram.y"
+                { (yyval.y_cint) = CM_LESS; }
+#line 4117 "y.tab.c"
+    break;
+
+  case 369: /* relational_operator: '>'  */
+#line 1227 "gram.y"
+                { (yyval.y_cint) = CM_GREAT; }
+#line 4123 "y.tab.c"
+    break;
+
+  case 370: /* multiplying_operator: LEX_DIV  */
+#line 1231 "gram.y"
+            { (yyval.y_cint) = AR_IDIV; }
+#line 4129 "y.tab.c"
+    break;
+
+  case 371: /* multiplying_operator: LEX_MOD  */
+#line 1232 "gram.y"
+                { (yyval.y_cint) = AR_MOD; }
+#line 4135 "y.tab.c"
+    break;
+
+  case 372: /* multiplying_operator: '/'  */
+#line 1233 "gram.y"
+                { (yyval.y_cint) = AR_RDIV; }
+#line 4141 "y.tab.c"
+    break;
+
+  case 373: /* multiplying_operator: '*'  */
+#line 1234 "gram.y"
+                { (yyval.y_cint) = AR_MULT; }
+#line 4147 "y.tab.c"
+    break;
+
+  case 374: /* adding_operator: '-'  */
+#line 1238 "gram.y"
+        { (yyval.y_cint) = AR_SUB; }
+#line 4153 "y.tab.c"
+    break;
+
+  case 375: /* adding_operator: '+'  */
+#line 1239 "gram.y"
+        { (yyval.y_cint) = AR_ADD; }
+#line 4159 "y.tab.c"
+    break;
+
+
+#line 4163 "y.tab.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 1251 "gram.y"
+
+
+void yyerror(char *msg)
+{
+    error(msg);
+}
+
+/* Sets the value of the 'yydebug' variable to VALUE.
+   This is a function so we don't have to have YYDEBUG defined
+   in order to build the compiler.  */
+void
+set_yydebug (int value)
+{
+#if YYDEBUG != 0
+  yydebug = value;
+#else
+  warning ("YYDEBUG not defined.");
+#endif
+}
@@ -0,0 +1,489 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_Y_TAB_H_INCLUDED
+# define YY_YY_Y_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    LEX_ID = 258,                  /* LEX_ID  */
+    LEX_ARRAY = 259,               /* LEX_ARRAY  */
+    LEX_BEGIN = 260,               /* LEX_BEGIN  */
+    LEX_CASE = 261,                /* LEX_CASE  */
+    LEX_CONST = 262,               /* LEX_CONST  */
+    LEX_DO = 263,                  /* LEX_DO  */
+    LEX_DOWNTO = 264,              /* LEX_DOWNTO  */
+    LEX_END = 265,                 /* LEX_END  */
+    LEX_FILE = 266,                /* LEX_FILE  */
+    LEX_FOR = 267,                 /* LEX_FOR  */
+    LEX_FUNCTION = 268,            /* LEX_FUNCTION  */
+    LEX_GOTO = 269,                /* LEX_GOTO  */
+    LEX_IF = 270,                  /* LEX_IF  */
+    LEX_LABEL = 271,               /* LEX_LABEL  */
+    LEX_NIL = 272,                 /* LEX_NIL  */
+    LEX_OF = 273,                  /* LEX_OF  */
+    LEX_PACKED = 274,              /* LEX_PACKED  */
+    LEX_PROCEDURE = 275,           /* LEX_PROCEDURE  */
+    LEX_PROGRAM = 276,             /* LEX_PROGRAM  */
+    LEX_RECORD = 277,              /* LEX_RECORD  */
+    LEX_REPEAT = 278,              /* LEX_REPEAT  */
+    LEX_SET = 279,                 /* LEX_SET  */
+    LEX_THEN = 280,                /* LEX_THEN  */
+    LEX_TO = 281,                  /* LEX_TO  */
+    LEX_TYPE = 282,                /* LEX_TYPE  */
+    LEX_UNTIL = 283,               /* LEX_UNTIL  */
+    LEX_VAR = 284,                 /* LEX_VAR  */
+    LEX_WHILE = 285,               /* LEX_WHILE  */
+    LEX_WITH = 286,                /* LEX_WITH  */
+    LEX_FORWARD = 287,             /* LEX_FORWARD  */
+    pp_SIN = 288,                  /* pp_SIN  */
+    pp_COS = 289,                  /* pp_COS  */
+    pp_EXP = 290,                  /* pp_EXP  */
+    pp_LN = 291,                   /* pp_LN  */
+    pp_SQRT = 292,                 /* pp_SQRT  */
+    pp_ARCTAN = 293,               /* pp_ARCTAN  */
+    rr_POW = 294,                  /* rr_POW  */
+    rr_EXPON = 295,                /* rr_EXPON  */
+    r_WRITE = 296,                 /* r_WRITE  */
+    r_READ = 297,                  /* r_READ  */
+    r_INITFDR = 298,               /* r_INITFDR  */
+    r_LAZYTRYGET = 299,            /* r_LAZYTRYGET  */
+    r_LAZYGET = 300,               /* r_LAZYGET  */
+    r_LAZYUNGET = 301,             /* r_LAZYUNGET  */
+    r_POW = 302,                   /* r_POW  */
+    r_EXPON = 303,                 /* r_EXPON  */
+    z_ABS = 304,                   /* z_ABS  */
+    z_ARCTAN = 305,                /* z_ARCTAN  */
+    z_COS = 306,                   /* z_COS  */
+    z_EXP = 307,                   /* z_EXP  */
+    z_LN = 308,                    /* z_LN  */
+    z_SIN = 309,                   /* z_SIN  */
+    z_SQRT = 310,                  /* z_SQRT  */
+    z_POW = 311,                   /* z_POW  */
+    z_EXPON = 312,                 /* z_EXPON  */
+    set_card = 313,                /* set_card  */
+    set_isempty = 314,             /* set_isempty  */
+    set_equal = 315,               /* set_equal  */
+    set_le = 316,                  /* set_le  */
+    set_less = 317,                /* set_less  */
+    set_in = 318,                  /* set_in  */
+    set_clear = 319,               /* set_clear  */
+    set_include = 320,             /* set_include  */
+    set_exclude = 321,             /* set_exclude  */
+    set_include_range = 322,       /* set_include_range  */
+    set_copy = 323,                /* set_copy  */
+    set_intersection = 324,        /* set_intersection  */
+    set_union = 325,               /* set_union  */
+    set_diff = 326,                /* set_diff  */
+    set_symdiff = 327,             /* set_symdiff  */
+    p_DONEFDR = 328,               /* p_DONEFDR  */
+    gpc_IOCHECK = 329,             /* gpc_IOCHECK  */
+    gpc_RUNTIME_ERROR = 330,       /* gpc_RUNTIME_ERROR  */
+    p_INPUT = 331,                 /* p_INPUT  */
+    p_OUTPUT = 332,                /* p_OUTPUT  */
+    p_REWRITE = 333,               /* p_REWRITE  */
+    p_RESET = 334,                 /* p_RESET  */
+    p_PUT = 335,                   /* p_PUT  */
+    p_GET = 336,                   /* p_GET  */
+    p_WRITE = 337,                 /* p_WRITE  */
+    p_READ = 338,                  /* p_READ  */
+    p_WRITELN = 339,               /* p_WRITELN  */
+    p_READLN = 340,                /* p_READLN  */
+    p_PAGE = 341,                  /* p_PAGE  */
+    p_NEW = 342,                   /* p_NEW  */
+    p_DISPOSE = 343,               /* p_DISPOSE  */
+    p_ABS = 344,                   /* p_ABS  */
+    p_SQR = 345,                   /* p_SQR  */
+    p_SIN = 346,                   /* p_SIN  */
+    p_COS = 347,                   /* p_COS  */
+    p_EXP = 348,                   /* p_EXP  */
+    p_LN = 349,                    /* p_LN  */
+    p_SQRT = 350,                  /* p_SQRT  */
+    p_ARCTAN = 351,                /* p_ARCTAN  */
+    p_TRUNC = 352,                 /* p_TRUNC  */
+    p_ROUND = 353,                 /* p_ROUND  */
+    p_PACK = 354,                  /* p_PACK  */
+    p_UNPACK = 355,                /* p_UNPACK  */
+    p_ORD = 356,                   /* p_ORD  */
+    p_CHR = 357,                   /* p_CHR  */
+    p_SUCC = 358,                  /* p_SUCC  */
+    p_PRED = 359,                  /* p_PRED  */
+    p_ODD = 360,                   /* p_ODD  */
+    p_EOF = 361,                   /* p_EOF  */
+    p_EOLN = 362,                  /* p_EOLN  */
+    p_MAXINT = 363,                /* p_MAXINT  */
+    p_TRUE = 364,                  /* p_TRUE  */
+    p_FALSE = 365,                 /* p_FALSE  */
+    bp_RANDOM = 366,               /* bp_RANDOM  */
+    bp_RANDOMIZE = 367,            /* bp_RANDOMIZE  */
+    BREAK = 368,                   /* BREAK  */
+    CONTINUE = 369,                /* CONTINUE  */
+    RETURN_ = 370,                 /* RETURN_  */
+    RESULT = 371,                  /* RESULT  */
+    EXIT = 372,                    /* EXIT  */
+    FAIL = 373,                    /* FAIL  */
+    p_CLOSE = 374,                 /* p_CLOSE  */
+    CONJUGATE = 375,               /* CONJUGATE  */
+    p_DEFINESIZE = 376,            /* p_DEFINESIZE  */
+    SIZEOF = 377,                  /* SIZEOF  */
+    BITSIZEOF = 378,               /* BITSIZEOF  */
+    ALIGNOF = 379,                 /* ALIGNOF  */
+    TYPEOF = 380,                  /* TYPEOF  */
+    gpc_RETURNADDRESS = 381,       /* gpc_RETURNADDRESS  */
+    gpc_FRAMEADDRESS = 382,        /* gpc_FRAMEADDRESS  */
+    LEX_LABEL_ADDR = 383,          /* LEX_LABEL_ADDR  */
+    LEX_INTCONST = 384,            /* LEX_INTCONST  */
+    LEX_STRCONST = 385,            /* LEX_STRCONST  */
+    LEX_REALCONST = 386,           /* LEX_REALCONST  */
+    LEX_RANGE = 387,               /* LEX_RANGE  */
+    LEX_ELLIPSIS = 388,            /* LEX_ELLIPSIS  */
+    LEX_ASSIGN = 389,              /* LEX_ASSIGN  */
+    LEX_IN = 390,                  /* LEX_IN  */
+    LEX_NE = 391,                  /* LEX_NE  */
+    LEX_GE = 392,                  /* LEX_GE  */
+    LEX_LE = 393,                  /* LEX_LE  */
+    LEX_OR = 394,                  /* LEX_OR  */
+    LEX_OR_ELSE = 395,             /* LEX_OR_ELSE  */
+    LEX_CEIL_PLUS = 396,           /* LEX_CEIL_PLUS  */
+    LEX_CEIL_MINUS = 397,          /* LEX_CEIL_MINUS  */
+    LEX_FLOOR_PLUS = 398,          /* LEX_FLOOR_PLUS  */
+    LEX_FLOOR_MINUS = 399,         /* LEX_FLOOR_MINUS  */
+    LEX_DIV = 400,                 /* LEX_DIV  */
+    LEX_MOD = 401,                 /* LEX_MOD  */
+    LEX_AND = 402,                 /* LEX_AND  */
+    LEX_AND_THEN = 403,            /* LEX_AND_THEN  */
+    LEX_SHL = 404,                 /* LEX_SHL  */
+    LEX_SHR = 405,                 /* LEX_SHR  */
+    LEX_XOR = 406,                 /* LEX_XOR  */
+    LEX_CEIL_MULT = 407,           /* LEX_CEIL_MULT  */
+    LEX_CEIL_DIV = 408,            /* LEX_CEIL_DIV  */
+    LEX_FLOOR_MULT = 409,          /* LEX_FLOOR_MULT  */
+    LEX_FLOOR_DIV = 410,           /* LEX_FLOOR_DIV  */
+    LEX_POW = 411,                 /* LEX_POW  */
+    LEX_POWER = 412,               /* LEX_POWER  */
+    LEX_IS = 413,                  /* LEX_IS  */
+    LEX_AS = 414,                  /* LEX_AS  */
+    LEX_NOT = 415,                 /* LEX_NOT  */
+    LEX_EXTERNAL = 416,            /* LEX_EXTERNAL  */
+    p_MARK = 417,                  /* p_MARK  */
+    p_RELEASE = 418,               /* p_RELEASE  */
+    p_UPDATE = 419,                /* p_UPDATE  */
+    p_GETTIMESTAMP = 420,          /* p_GETTIMESTAMP  */
+    p_UNBIND = 421,                /* p_UNBIND  */
+    p_EXTEND = 422,                /* p_EXTEND  */
+    bp_APPEND = 423,               /* bp_APPEND  */
+    p_BIND = 424,                  /* p_BIND  */
+    p_SEEKREAD = 425,              /* p_SEEKREAD  */
+    p_SEEKWRITE = 426,             /* p_SEEKWRITE  */
+    p_SEEKUPDATE = 427,            /* p_SEEKUPDATE  */
+    LEX_SYMDIFF = 428,             /* LEX_SYMDIFF  */
+    p_ARG = 429,                   /* p_ARG  */
+    p_CARD = 430,                  /* p_CARD  */
+    p_EMPTY = 431,                 /* p_EMPTY  */
+    p_POSITION = 432,              /* p_POSITION  */
+    p_LASTPOSITION = 433,          /* p_LASTPOSITION  */
+    p_LENGTH = 434,                /* p_LENGTH  */
+    p_TRIM = 435,                  /* p_TRIM  */
+    p_BINDING = 436,               /* p_BINDING  */
+    p_DATE = 437,                  /* p_DATE  */
+    p_TIME = 438,                  /* p_TIME  */
+    LEX_RENAME = 439,              /* LEX_RENAME  */
+    LEX_IMPORT = 440,              /* LEX_IMPORT  */
+    LEX_USES = 441,                /* LEX_USES  */
+    LEX_QUALIFIED = 442,           /* LEX_QUALIFIED  */
+    LEX_ONLY = 443,                /* LEX_ONLY  */
+    prec_if = 444,                 /* prec_if  */
+    LEX_ELSE = 445,                /* LEX_ELSE  */
+    lower_than_error = 446         /* lower_than_error  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
+#define LEX_ID 258
+#define LEX_ARRAY 259
+#define LEX_BEGIN 260
+#define LEX_CASE 261
+#define LEX_CONST 262
+#define LEX_DO 263
+#define LEX_DOWNTO 264
+#define LEX_END 265
+#define LEX_FILE 266
+#define LEX_FOR 267
+#define LEX_FUNCTION 268
+#define LEX_GOTO 269
+#define LEX_IF 270
+#define LEX_LABEL 271
+#define LEX_NIL 272
+#define LEX_OF 273
+#define LEX_PACKED 274
+#define LEX_PROCEDURE 275
+#define LEX_PROGRAM 276
+#define LEX_RECORD 277
+#define LEX_REPEAT 278
+#define LEX_SET 279
+#define LEX_THEN 280
+#define LEX_TO 281
+#define LEX_TYPE 282
+#define LEX_UNTIL 283
+#define LEX_VAR 284
+#define LEX_WHILE 285
+#define LEX_WITH 286
+#define LEX_FORWARD 287
+#define pp_SIN 288
+#define pp_COS 289
+#define pp_EXP 290
+#define pp_LN 291
+#define pp_SQRT 292
+#define pp_ARCTAN 293
+#define rr_POW 294
+#define rr_EXPON 295
+#define r_WRITE 296
+#define r_READ 297
+#define r_INITFDR 298
+#define r_LAZYTRYGET 299
+#define r_LAZYGET 300
+#define r_LAZYUNGET 301
+#define r_POW 302
+#define r_EXPON 303
+#define z_ABS 304
+#define z_ARCTAN 305
+#define z_COS 306
+#define z_EXP 307
+#define z_LN 308
+#define z_SIN 309
+#define z_SQRT 310
+#define z_POW 311
+#define z_EXPON 312
+#define set_card 313
+#define set_isempty 314
+#define set_equal 315
+#define set_le 316
+#define set_less 317
+#define set_in 318
+#define set_clear 319
+#define set_include 320
+#define set_exclude 321
+#define set_include_range 322
+#define set_copy 323
+#define set_intersection 324
+#define set_union 325
+#define set_diff 326
+#define set_symdiff 327
+#define p_DONEFDR 328
+#define gpc_IOCHECK 329
+#define gpc_RUNTIME_ERROR 330
+#define p_INPUT 331
+#define p_OUTPUT 332
+#define p_REWRITE 333
+#define p_RESET 334
+#define p_PUT 335
+#define p_GET 336
+#define p_WRITE 337
+#define p_READ 338
+#define p_WRITELN 339
+#define p_READLN 340
+#define p_PAGE 341
+#define p_NEW 342
+#define p_DISPOSE 343
+#define p_ABS 344
+#define p_SQR 345
+#define p_SIN 346
+#define p_COS 347
+#define p_EXP 348
+#define p_LN 349
+#define p_SQRT 350
+#define p_ARCTAN 351
+#define p_TRUNC 352
+#define p_ROUND 353
+#define p_PACK 354
+#define p_UNPACK 355
+#define p_ORD 356
+#define p_CHR 357
+#define p_SUCC 358
+#define p_PRED 359
+#define p_ODD 360
+#define p_EOF 361
+#define p_EOLN 362
+#define p_MAXINT 363
+#define p_TRUE 364
+#define p_FALSE 365
+#define bp_RANDOM 366
+#define bp_RANDOMIZE 367
+#define BREAK 368
+#define CONTINUE 369
+#define RETURN_ 370
+#define RESULT 371
+#define EXIT 372
+#define FAIL 373
+#define p_CLOSE 374
+#define CONJUGATE 375
+#define p_DEFINESIZE 376
+#define SIZEOF 377
+#define BITSIZEOF 378
+#define ALIGNOF 379
+#define TYPEOF 380
+#define gpc_RETURNADDRESS 381
+#define gpc_FRAMEADDRESS 382
+#define LEX_LABEL_ADDR 383
+#define LEX_INTCONST 384
+#define LEX_STRCONST 385
+#define LEX_REALCONST 386
+#define LEX_RANGE 387
+#define LEX_ELLIPSIS 388
+#define LEX_ASSIGN 389
+#define LEX_IN 390
+#define LEX_NE 391
+#define LEX_GE 392
+#define LEX_LE 393
+#define LEX_OR 394
+#define LEX_OR_ELSE 395
+#define LEX_CEIL_PLUS 396
+#define LEX_CEIL_MINUS 397
+#define LEX_FLOOR_PLUS 398
+#define LEX_FLOOR_MINUS 399
+#define LEX_DIV 400
+#define LEX_MOD 401
+#define LEX_AND 402
+#define LEX_AND_THEN 403
+#define LEX_SHL 404
+#define LEX_SHR 405
+#define LEX_XOR 406
+#define LEX_CEIL_MULT 407
+#define LEX_CEIL_DIV 408
+#define LEX_FLOOR_MULT 409
+#define LEX_FLOOR_DIV 410
+#define LEX_POW 411
+#define LEX_POWER 412
+#define LEX_IS 413
+#define LEX_AS 414
+#define LEX_NOT 415
+#define LEX_EXTERNAL 416
+#define p_MARK 417
+#define p_RELEASE 418
+#define p_UPDATE 419
+#define p_GETTIMESTAMP 420
+#define p_UNBIND 421
+#define p_EXTEND 422
+#define bp_APPEND 423
+#define p_BIND 424
+#define p_SEEKREAD 425
+#define p_SEEKWRITE 426
+#define p_SEEKUPDATE 427
+#define LEX_SYMDIFF 428
+#define p_ARG 429
+#define p_CARD 430
+#define p_EMPTY 431
+#define p_POSITION 432
+#define p_LASTPOSITION 433
+#define p_LENGTH 434
+#define p_TRIM 435
+#define p_BINDING 436
+#define p_DATE 437
+#define p_TIME 438
+#define LEX_RENAME 439
+#define LEX_IMPORT 440
+#define LEX_USES 441
+#define LEX_QUALIFIED 442
+#define LEX_ONLY 443
+#define prec_if 444
+#define LEX_ELSE 445
+#define lower_than_error 446
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 71 "gram.y"
+
+    char *          y_string;
+    int	           y_cint;
+    long            y_int;
+    double          y_real;
+    
+    stid_item_p     y_stid_item;
+    ST_ID           y_stid;
+    
+    typedef_item_p  y_typedef_item;
+    TYPE_LIST	     y_type_list;
+    TYPE            y_type;
+
+    EXPR		        y_expr;
+    EXPR_LIST 	     y_expr_list;
+    DIRECTIVETYPE   y_dir;
+    DIR_LIST        y_dir_list;
+    PARAM_LIST 	  y_param_list;
+    
+    BOOLEAN			  y_boolean;
+    control_labels  y_control;
+    FOR_DIRECTION   y_for_dir;
+    
+    num_const_p     y_num_const;
+
+#line 475 "y.tab.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+extern YYSTYPE yylval;
+
+
+int yyparse (void);
+
+
+#endif /* !YY_YY_Y_TAB_H_INCLUDED  */